@@ -3,9 +3,9 @@
 #include <array>
 #include <cstdint>
 
-constexpr uint32_t spirv_DeferredColourfragspv_size = 8400;
-constexpr std::array<uint32_t, 2100> spirv_DeferredColourfragspv = {
-    0x07230203, 0x00010000, 0x000D000A, 0x0000015E, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+constexpr uint32_t spirv_DeferredColourfragspv_size = 8508;
+constexpr std::array<uint32_t, 2127> spirv_DeferredColourfragspv = {
+    0x07230203, 0x00010000, 0x000D000A, 0x00000167, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
 0x00000001, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
 0x000E000F, 0x00000004, 0x00000004, 0x6E69616D, 0x00000000, 0x00000057, 0x000000BA, 0x000000CB, 
 0x00000143, 0x00000145, 0x00000147, 0x0000014D, 0x0000015C, 0x0000015D, 0x00030010, 0x00000004, 
@@ -232,40 +232,43 @@ constexpr std::array<uint32_t, 2100> spirv_DeferredColourfragspv = {
 0x000000BA, 0x0006000C, 0x0000000D, 0x000000BC, 0x00000001, 0x00000045, 0x000000BB, 0x000200FE, 
 0x000000BC, 0x000200F8, 0x000000B8, 0x0004003D, 0x00000051, 0x000000C1, 0x000000C0, 0x0004003D, 
 0x00000055, 0x000000C2, 0x00000057, 0x00050057, 0x00000007, 0x000000C3, 0x000000C1, 0x000000C2, 
-0x0008004F, 0x0000000D, 0x000000C4, 0x000000C3, 0x000000C3, 0x00000000, 0x00000001, 0x00000002, 
-0x0005008E, 0x0000000D, 0x000000C6, 0x000000C4, 0x000000C5, 0x00060050, 0x0000000D, 0x000000C7, 
-0x0000003F, 0x0000003F, 0x0000003F, 0x00050083, 0x0000000D, 0x000000C8, 0x000000C6, 0x000000C7, 
-0x0003003E, 0x000000BF, 0x000000C8, 0x0004003D, 0x00000007, 0x000000CC, 0x000000CB, 0x0008004F, 
-0x0000000D, 0x000000CD, 0x000000CC, 0x000000CC, 0x00000000, 0x00000001, 0x00000002, 0x000400CF, 
-0x0000000D, 0x000000CE, 0x000000CD, 0x0003003E, 0x000000C9, 0x000000CE, 0x0004003D, 0x00000007, 
-0x000000D0, 0x000000CB, 0x0008004F, 0x0000000D, 0x000000D1, 0x000000D0, 0x000000D0, 0x00000000, 
-0x00000001, 0x00000002, 0x000400D0, 0x0000000D, 0x000000D2, 0x000000D1, 0x0003003E, 0x000000CF, 
-0x000000D2, 0x0004003D, 0x00000055, 0x000000D5, 0x00000057, 0x000400CF, 0x00000055, 0x000000D6, 
-0x000000D5, 0x0003003E, 0x000000D4, 0x000000D6, 0x0004003D, 0x00000055, 0x000000D8, 0x00000057, 
-0x000400D0, 0x00000055, 0x000000D9, 0x000000D8, 0x0003003E, 0x000000D7, 0x000000D9, 0x0004003D, 
-0x0000000D, 0x000000DB, 0x000000BA, 0x0006000C, 0x0000000D, 0x000000DC, 0x00000001, 0x00000045, 
-0x000000DB, 0x0003003E, 0x000000DA, 0x000000DC, 0x0004003D, 0x0000000D, 0x000000DE, 0x000000C9, 
-0x00050041, 0x0000002A, 0x000000E0, 0x000000D7, 0x000000DF, 0x0004003D, 0x00000006, 0x000000E1, 
-0x000000E0, 0x0005008E, 0x0000000D, 0x000000E2, 0x000000DE, 0x000000E1, 0x0004003D, 0x0000000D, 
-0x000000E3, 0x000000CF, 0x00050041, 0x0000002A, 0x000000E4, 0x000000D4, 0x000000DF, 0x0004003D, 
-0x00000006, 0x000000E5, 0x000000E4, 0x0005008E, 0x0000000D, 0x000000E6, 0x000000E3, 0x000000E5, 
-0x00050083, 0x0000000D, 0x000000E7, 0x000000E2, 0x000000E6, 0x0006000C, 0x0000000D, 0x000000E8, 
-0x00000001, 0x00000045, 0x000000E7, 0x0003003E, 0x000000DD, 0x000000E8, 0x0004003D, 0x0000000D, 
-0x000000EA, 0x000000DA, 0x0004003D, 0x0000000D, 0x000000EB, 0x000000DD, 0x0007000C, 0x0000000D, 
-0x000000EC, 0x00000001, 0x00000044, 0x000000EA, 0x000000EB, 0x0006000C, 0x0000000D, 0x000000ED, 
-0x00000001, 0x00000045, 0x000000EC, 0x0004007F, 0x0000000D, 0x000000EE, 0x000000ED, 0x0003003E, 
-0x000000E9, 0x000000EE, 0x0004003D, 0x0000000D, 0x000000F2, 0x000000DD, 0x0004003D, 0x0000000D, 
-0x000000F3, 0x000000E9, 0x0004003D, 0x0000000D, 0x000000F4, 0x000000DA, 0x00050051, 0x00000006, 
-0x000000F6, 0x000000F2, 0x00000000, 0x00050051, 0x00000006, 0x000000F7, 0x000000F2, 0x00000001, 
-0x00050051, 0x00000006, 0x000000F8, 0x000000F2, 0x00000002, 0x00050051, 0x00000006, 0x000000F9, 
-0x000000F3, 0x00000000, 0x00050051, 0x00000006, 0x000000FA, 0x000000F3, 0x00000001, 0x00050051, 
-0x00000006, 0x000000FB, 0x000000F3, 0x00000002, 0x00050051, 0x00000006, 0x000000FC, 0x000000F4, 
-0x00000000, 0x00050051, 0x00000006, 0x000000FD, 0x000000F4, 0x00000001, 0x00050051, 0x00000006, 
-0x000000FE, 0x000000F4, 0x00000002, 0x00060050, 0x0000000D, 0x000000FF, 0x000000F6, 0x000000F7, 
-0x000000F8, 0x00060050, 0x0000000D, 0x00000100, 0x000000F9, 0x000000FA, 0x000000FB, 0x00060050, 
-0x0000000D, 0x00000101, 0x000000FC, 0x000000FD, 0x000000FE, 0x00060050, 0x000000EF, 0x00000102, 
-0x000000FF, 0x00000100, 0x00000101, 0x0003003E, 0x000000F1, 0x00000102, 0x0004003D, 0x000000EF, 
-0x00000103, 0x000000F1, 0x0004003D, 0x0000000D, 0x00000104, 0x000000BF, 0x00050091, 0x0000000D, 
-0x00000105, 0x00000103, 0x00000104, 0x0006000C, 0x0000000D, 0x00000106, 0x00000001, 0x00000045, 
-0x00000105, 0x000200FE, 0x00000106, 0x00010038, 
+0x0007004F, 0x00000055, 0x0000015E, 0x000000C3, 0x000000C3, 0x00000000, 0x00000001, 0x0005008E, 
+0x00000055, 0x0000015F, 0x0000015E, 0x000000C5, 0x00050050, 0x00000055, 0x00000160, 0x0000003F, 
+0x0000003F, 0x00050083, 0x00000055, 0x00000161, 0x0000015F, 0x00000160, 0x00050094, 0x00000006, 
+0x00000162, 0x00000161, 0x00000161, 0x00050083, 0x00000006, 0x00000163, 0x0000003F, 0x00000162, 
+0x0008000C, 0x00000006, 0x00000164, 0x00000001, 0x0000002B, 0x00000163, 0x000000F5, 0x0000003F, 
+0x0006000C, 0x00000006, 0x00000165, 0x00000001, 0x0000001F, 0x00000164, 0x00050050, 0x0000000D, 
+0x00000166, 0x00000161, 0x00000165, 0x0003003E, 0x000000BF, 0x00000166, 0x0004003D, 0x00000007, 
+0x000000CC, 0x000000CB, 0x0008004F, 0x0000000D, 0x000000CD, 0x000000CC, 0x000000CC, 0x00000000, 
+0x00000001, 0x00000002, 0x000400CF, 0x0000000D, 0x000000CE, 0x000000CD, 0x0003003E, 0x000000C9, 
+0x000000CE, 0x0004003D, 0x00000007, 0x000000D0, 0x000000CB, 0x0008004F, 0x0000000D, 0x000000D1, 
+0x000000D0, 0x000000D0, 0x00000000, 0x00000001, 0x00000002, 0x000400D0, 0x0000000D, 0x000000D2, 
+0x000000D1, 0x0003003E, 0x000000CF, 0x000000D2, 0x0004003D, 0x00000055, 0x000000D5, 0x00000057, 
+0x000400CF, 0x00000055, 0x000000D6, 0x000000D5, 0x0003003E, 0x000000D4, 0x000000D6, 0x0004003D, 
+0x00000055, 0x000000D8, 0x00000057, 0x000400D0, 0x00000055, 0x000000D9, 0x000000D8, 0x0003003E, 
+0x000000D7, 0x000000D9, 0x0004003D, 0x0000000D, 0x000000DB, 0x000000BA, 0x0006000C, 0x0000000D, 
+0x000000DC, 0x00000001, 0x00000045, 0x000000DB, 0x0003003E, 0x000000DA, 0x000000DC, 0x0004003D, 
+0x0000000D, 0x000000DE, 0x000000C9, 0x00050041, 0x0000002A, 0x000000E0, 0x000000D7, 0x000000DF, 
+0x0004003D, 0x00000006, 0x000000E1, 0x000000E0, 0x0005008E, 0x0000000D, 0x000000E2, 0x000000DE, 
+0x000000E1, 0x0004003D, 0x0000000D, 0x000000E3, 0x000000CF, 0x00050041, 0x0000002A, 0x000000E4, 
+0x000000D4, 0x000000DF, 0x0004003D, 0x00000006, 0x000000E5, 0x000000E4, 0x0005008E, 0x0000000D, 
+0x000000E6, 0x000000E3, 0x000000E5, 0x00050083, 0x0000000D, 0x000000E7, 0x000000E2, 0x000000E6, 
+0x0006000C, 0x0000000D, 0x000000E8, 0x00000001, 0x00000045, 0x000000E7, 0x0003003E, 0x000000DD, 
+0x000000E8, 0x0004003D, 0x0000000D, 0x000000EA, 0x000000DA, 0x0004003D, 0x0000000D, 0x000000EB, 
+0x000000DD, 0x0007000C, 0x0000000D, 0x000000EC, 0x00000001, 0x00000044, 0x000000EA, 0x000000EB, 
+0x0006000C, 0x0000000D, 0x000000ED, 0x00000001, 0x00000045, 0x000000EC, 0x0004007F, 0x0000000D, 
+0x000000EE, 0x000000ED, 0x0003003E, 0x000000E9, 0x000000EE, 0x0004003D, 0x0000000D, 0x000000F2, 
+0x000000DD, 0x0004003D, 0x0000000D, 0x000000F3, 0x000000E9, 0x0004003D, 0x0000000D, 0x000000F4, 
+0x000000DA, 0x00050051, 0x00000006, 0x000000F6, 0x000000F2, 0x00000000, 0x00050051, 0x00000006, 
+0x000000F7, 0x000000F2, 0x00000001, 0x00050051, 0x00000006, 0x000000F8, 0x000000F2, 0x00000002, 
+0x00050051, 0x00000006, 0x000000F9, 0x000000F3, 0x00000000, 0x00050051, 0x00000006, 0x000000FA, 
+0x000000F3, 0x00000001, 0x00050051, 0x00000006, 0x000000FB, 0x000000F3, 0x00000002, 0x00050051, 
+0x00000006, 0x000000FC, 0x000000F4, 0x00000000, 0x00050051, 0x00000006, 0x000000FD, 0x000000F4, 
+0x00000001, 0x00050051, 0x00000006, 0x000000FE, 0x000000F4, 0x00000002, 0x00060050, 0x0000000D, 
+0x000000FF, 0x000000F6, 0x000000F7, 0x000000F8, 0x00060050, 0x0000000D, 0x00000100, 0x000000F9, 
+0x000000FA, 0x000000FB, 0x00060050, 0x0000000D, 0x00000101, 0x000000FC, 0x000000FD, 0x000000FE, 
+0x00060050, 0x000000EF, 0x00000102, 0x000000FF, 0x00000100, 0x00000101, 0x0003003E, 0x000000F1, 
+0x00000102, 0x0004003D, 0x000000EF, 0x00000103, 0x000000F1, 0x0004003D, 0x0000000D, 0x00000104, 
+0x000000BF, 0x00050091, 0x0000000D, 0x00000105, 0x00000103, 0x00000104, 0x0006000C, 0x0000000D, 
+0x00000106, 0x00000001, 0x00000045, 0x00000105, 0x000200FE, 0x00000106, 0x00010038, 
     };
\ No newline at end of file
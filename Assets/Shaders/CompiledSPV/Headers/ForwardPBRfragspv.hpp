@@ -3,9 +3,9 @@
 #include <array>
 #include <cstdint>
 
-constexpr uint32_t spirv_ForwardPBRfragspv_size = 48640;
-constexpr std::array<uint32_t, 12160> spirv_ForwardPBRfragspv = {
-    0x07230203, 0x00010000, 0x000D000A, 0x000007C8, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+constexpr uint32_t spirv_ForwardPBRfragspv_size = 51316;
+constexpr std::array<uint32_t, 12829> spirv_ForwardPBRfragspv = {
+    0x07230203, 0x00010000, 0x000D000A, 0x00000838, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
 0x00000001, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
 0x0008000F, 0x00000004, 0x00000004, 0x6E69616D, 0x00000000, 0x000001FC, 0x000005A0, 0x0000066C, 
 0x00030010, 0x00000004, 0x00000007, 0x00030003, 0x00000002, 0x000001C2, 0x00090004, 0x415F4C47, 
@@ -170,216 +170,245 @@ constexpr std::array<uint32_t, 12160> spirv_ForwardPBRfragspv = {
 0x00000003, 0x65746E69, 0x7469736E, 0x00000079, 0x00050006, 0x000002A3, 0x00000004, 0x69646172, 
 0x00007375, 0x00050006, 0x000002A3, 0x00000005, 0x65707974, 0x00000000, 0x00050006, 0x000002A3, 
 0x00000006, 0x6C676E61, 0x00000065, 0x00050005, 0x000002AA, 0x4C4F4255, 0x74686769, 0x00000000, 
-0x00050006, 0x000002AA, 0x00000000, 0x6867696C, 0x00007374, 0x00070006, 0x000002AA, 0x00000001, 
-0x64616853, 0x7254776F, 0x66736E61, 0x006D726F, 0x00060006, 0x000002AA, 0x00000002, 0x77656956, 
-0x7274614D, 0x00007869, 0x00060006, 0x000002AA, 0x00000003, 0x6867694C, 0x65695674, 0x00000077, 
-0x00060006, 0x000002AA, 0x00000004, 0x73616942, 0x7274614D, 0x00007869, 0x00070006, 0x000002AA, 
-0x00000005, 0x656D6163, 0x6F506172, 0x69746973, 0x00006E6F, 0x00060006, 0x000002AA, 0x00000006, 
-0x696C7053, 0x70654474, 0x00736874, 0x00060006, 0x000002AA, 0x00000007, 0x6867694C, 0x7A695374, 
-0x00000065, 0x00070006, 0x000002AA, 0x00000008, 0x5378614D, 0x6F646168, 0x73694477, 0x00000074, 
-0x00060006, 0x000002AA, 0x00000009, 0x64616853, 0x6146776F, 0x00006564, 0x00060006, 0x000002AA, 
-0x0000000A, 0x63736143, 0x46656461, 0x00656461, 0x00060006, 0x000002AA, 0x0000000B, 0x6867694C, 
-0x756F4374, 0x0000746E, 0x00060006, 0x000002AA, 0x0000000C, 0x64616853, 0x6F43776F, 0x00746E75, 
-0x00050006, 0x000002AA, 0x0000000D, 0x65646F4D, 0x00000000, 0x00060006, 0x000002AA, 0x0000000E, 
-0x4D766E45, 0x6F437069, 0x00746E75, 0x00060006, 0x000002AA, 0x0000000F, 0x74696E49, 0x426C6169, 
-0x00736169, 0x00050006, 0x000002AA, 0x00000010, 0x74646957, 0x00000068, 0x00050006, 0x000002AA, 
-0x00000011, 0x67696548, 0x00007468, 0x00070006, 0x000002AA, 0x00000012, 0x64616873, 0x6E45776F, 
-0x656C6261, 0x00000064, 0x00030005, 0x000002AC, 0x006F6275, 0x00040005, 0x000002B0, 0x73616962, 
-0x00000000, 0x00040005, 0x000002BC, 0x73616962, 0x00000000, 0x00040005, 0x000002BD, 0x61726170, 
-0x0000006D, 0x00040005, 0x000002BF, 0x61726170, 0x0000006D, 0x00040005, 0x000002C1, 0x61726170, 
-0x0000006D, 0x00030005, 0x000002C4, 0x006D7573, 0x00040005, 0x000002C5, 0x73696F6E, 0x00000065, 
-0x00040005, 0x000002C6, 0x61726170, 0x0000006D, 0x00030005, 0x000002CA, 0x00000069, 0x00040005, 
-0x000002D3, 0x7366666F, 0x00007465, 0x00040005, 0x000002D4, 0x61726170, 0x0000006D, 0x00040005, 
-0x000002D6, 0x61726170, 0x0000006D, 0x00040005, 0x000002D7, 0x61726170, 0x0000006D, 0x00030005, 
-0x000002DD, 0x0000007A, 0x00060005, 0x000002FA, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 
-0x00040005, 0x000002FB, 0x77656976, 0x00736F50, 0x00030005, 0x00000305, 0x00000069, 0x00050005, 
-0x00000321, 0x64616873, 0x6F43776F, 0x0064726F, 0x00040005, 0x00000333, 0x5241454E, 0x00000000, 
-0x00050005, 0x00000335, 0x61527675, 0x73756964, 0x00000000, 0x00040005, 0x00000340, 0x77656976, 
-0x00736F50, 0x00060005, 0x00000349, 0x64616873, 0x6D41776F, 0x746E756F, 0x00000000, 0x00050005, 
-0x0000034A, 0x61685375, 0x4D776F64, 0x00007061, 0x00040005, 0x0000034B, 0x61726170, 0x0000006D, 
-0x00040005, 0x0000034D, 0x61726170, 0x0000006D, 0x00040005, 0x0000034F, 0x61726170, 0x0000006D, 
-0x00040005, 0x00000351, 0x61726170, 0x0000006D, 0x00040005, 0x00000353, 0x61726170, 0x0000006D, 
-0x00040005, 0x00000355, 0x61726170, 0x0000006D, 0x00050005, 0x00000358, 0x63736163, 0x46656461, 
-0x00656461, 0x00050005, 0x00000365, 0x63736163, 0x4E656461, 0x00747865, 0x00060005, 0x0000037F, 
-0x64616873, 0x6D41776F, 0x746E756F, 0x00000031, 0x00040005, 0x00000380, 0x61726170, 0x0000006D, 
-0x00040005, 0x00000382, 0x61726170, 0x0000006D, 0x00040005, 0x00000384, 0x61726170, 0x0000006D, 
-0x00040005, 0x00000386, 0x61726170, 0x0000006D, 0x00040005, 0x00000388, 0x61726170, 0x0000006D, 
-0x00040005, 0x0000038A, 0x61726170, 0x0000006D, 0x00030005, 0x00000398, 0x00000044, 0x00040005, 
-0x0000039A, 0x61726170, 0x0000006D, 0x00040005, 0x0000039C, 0x61726170, 0x0000006D, 0x00030005, 
-0x0000039F, 0x00000056, 0x00040005, 0x000003A0, 0x61726170, 0x0000006D, 0x00040005, 0x000003A2, 
-0x61726170, 0x0000006D, 0x00040005, 0x000003A4, 0x61726170, 0x0000006D, 0x00030005, 0x000003A7, 
-0x00000046, 0x00040005, 0x000003A9, 0x61726170, 0x0000006D, 0x00040005, 0x000003B5, 0x61726170, 
-0x0000006D, 0x00040005, 0x000003B7, 0x61726170, 0x0000006D, 0x00040005, 0x000003B9, 0x61726170, 
-0x0000006D, 0x00040005, 0x000003BB, 0x61726170, 0x0000006D, 0x00040005, 0x000003C1, 0x61726170, 
-0x0000006D, 0x00040005, 0x000003C3, 0x61726170, 0x0000006D, 0x00040005, 0x000003C5, 0x61726170, 
-0x0000006D, 0x00040005, 0x000003C7, 0x61726170, 0x0000006D, 0x00040005, 0x000003CC, 0x75736572, 
-0x0000746C, 0x00030005, 0x000003CE, 0x00000069, 0x00040005, 0x000003DA, 0x6867696C, 0x00000074, 
-0x00040005, 0x000003EE, 0x756C6176, 0x00000065, 0x00030005, 0x000003F4, 0x0000004C, 0x00040005, 
-0x000003FA, 0x74736964, 0x00000000, 0x00040005, 0x000003FF, 0x65747461, 0x0000006E, 0x00050005, 
-0x00000406, 0x65747461, 0x7461756E, 0x006E6F69, 0x00030005, 0x0000041F, 0x0000004C, 0x00050005, 
-0x00000425, 0x6F747563, 0x6E416666, 0x00656C67, 0x00040005, 0x00000429, 0x74736964, 0x00000000, 
-0x00040005, 0x0000042E, 0x74656874, 0x00000061, 0x00040005, 0x00000434, 0x69737065, 0x006E6F6C, 
-0x00050005, 0x0000043A, 0x65747461, 0x7461756E, 0x006E6F69, 0x00060005, 0x0000044B, 0x63736163, 
-0x49656461, 0x7865646E, 0x00000000, 0x00040005, 0x0000044C, 0x61726170, 0x0000006D, 0x00040005, 
-0x00000455, 0x61726170, 0x0000006D, 0x00040005, 0x00000457, 0x61726170, 0x0000006D, 0x00040005, 
-0x00000459, 0x61726170, 0x0000006D, 0x00040005, 0x0000045D, 0x61726170, 0x0000006D, 0x00030005, 
-0x00000462, 0x0000694C, 0x00050005, 0x00000466, 0x6461724C, 0x636E6169, 0x00000065, 0x00030005, 
-0x0000046D, 0x0000684C, 0x00050005, 0x00000473, 0x6867696C, 0x4C6F4E74, 0x00000000, 0x00040005, 
-0x00000478, 0x61726170, 0x0000006D, 0x00030005, 0x0000047A, 0x00000068, 0x00050005, 0x00000480, 
-0x64616873, 0x5F676E69, 0x00566F4E, 0x00040005, 0x00000486, 0x61726170, 0x0000006D, 0x00030005, 
-0x00000488, 0x00566F4E, 0x00030005, 0x0000048A, 0x004C6F4E, 0x00040005, 0x0000048B, 0x61726170, 
-0x0000006D, 0x00030005, 0x0000048E, 0x00486F4E, 0x00040005, 0x00000493, 0x61726170, 0x0000006D, 
-0x00030005, 0x00000495, 0x00486F4C, 0x00040005, 0x00000499, 0x61726170, 0x0000006D, 0x00030005, 
-0x0000049B, 0x00006446, 0x00040005, 0x0000049D, 0x61726170, 0x0000006D, 0x00040005, 0x0000049F, 
-0x61726170, 0x0000006D, 0x00040005, 0x000004A1, 0x61726170, 0x0000006D, 0x00030005, 0x000004A4, 
-0x00007246, 0x00040005, 0x000004A8, 0x61726170, 0x0000006D, 0x00040005, 0x000004AA, 0x61726170, 
-0x0000006D, 0x00040005, 0x000004AC, 0x61726170, 0x0000006D, 0x00040005, 0x000004AE, 0x61726170, 
-0x0000006D, 0x00040005, 0x000004B1, 0x6F6C6F63, 0x00007275, 0x00040005, 0x000004BB, 0x61726170, 
-0x0000006D, 0x00040005, 0x000004BD, 0x61726170, 0x0000006D, 0x00050005, 0x000004CA, 0x61727269, 
-0x6E616964, 0x00006563, 0x00040005, 0x000004CE, 0x72724975, 0x0070614D, 0x00030005, 0x000004D4, 
-0x00000046, 0x00040005, 0x000004D5, 0x61726170, 0x0000006D, 0x00040005, 0x000004D7, 0x61726170, 
-0x0000006D, 0x00040005, 0x000004DA, 0x61726170, 0x0000006D, 0x00030005, 0x000004DE, 0x0000646B, 
-0x00050005, 0x000004E6, 0x66666964, 0x49657375, 0x00004C42, 0x00080005, 0x000004EC, 0x6E455F75, 
-0x64615276, 0x636E6169, 0x78655465, 0x6576654C, 0x0000736C, 0x00070005, 0x000004F0, 0x63657073, 
-0x72616C75, 0x61727249, 0x6E616964, 0x00006563, 0x00040005, 0x000004F1, 0x766E4575, 0x0070614D, 
-0x00050005, 0x000004FB, 0x63657073, 0x72616C75, 0x004C4249, 0x00050005, 0x0000050E, 0x43786574, 
-0x756F6C6F, 0x00000072, 0x00050005, 0x00000518, 0x6174656D, 0x63696C6C, 0x00000000, 0x00050005, 
-0x00000519, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x00000528, 0x00786574, 0x00030005, 
-0x0000054C, 0x00786574, 0x00050005, 0x0000056A, 0x6574616D, 0x6C616972, 0x00000000, 0x00050005, 
-0x0000057F, 0x6F4E5F75, 0x6C616D72, 0x0070614D, 0x00040005, 0x00000598, 0x61726170, 0x0000006D, 
-0x00030005, 0x0000059E, 0x00007675, 0x00060005, 0x000005A0, 0x465F6C67, 0x43676172, 0x64726F6F, 
-0x00000000, 0x00040005, 0x000005AB, 0x6F617373, 0x00000000, 0x00050005, 0x000005AC, 0x41535375, 
-0x70614D4F, 0x00000000, 0x00040005, 0x000005BB, 0x61726170, 0x0000006D, 0x00050005, 0x000005C0, 
-0x67756F72, 0x73656E68, 0x00003273, 0x00040005, 0x000005C4, 0x75646E64, 0x00000000, 0x00040005, 
-0x000005C8, 0x76646E64, 0x00000000, 0x00050005, 0x000005CC, 0x69726176, 0x65636E61, 0x00000000, 
-0x00070005, 0x000005D4, 0x6E72656B, 0x6F526C65, 0x6E686775, 0x32737365, 0x00000000, 0x00070005, 
-0x000005D9, 0x746C6966, 0x64657265, 0x67756F52, 0x73656E68, 0x00003273, 0x00040005, 0x000005DD, 
-0x61726170, 0x0000006D, 0x00040005, 0x000005E7, 0x6F507377, 0x00000073, 0x00050005, 0x000005F9, 
-0x44524275, 0x54554C46, 0x00000000, 0x00050005, 0x00000603, 0x6C666572, 0x61746365, 0x0065636E, 
-0x00040005, 0x00000604, 0x61726170, 0x0000006D, 0x00030005, 0x00000608, 0x00003046, 0x00040005, 
-0x0000060B, 0x61726170, 0x0000006D, 0x00040005, 0x0000060E, 0x61726170, 0x0000006D, 0x00040005, 
-0x00000621, 0x61726170, 0x0000006D, 0x00060005, 0x0000062B, 0x64616873, 0x6944776F, 0x6E617473, 
-0x00006563, 0x00070005, 0x0000062E, 0x6E617274, 0x69746973, 0x69446E6F, 0x6E617473, 0x00006563, 
-0x00040005, 0x00000631, 0x77656976, 0x00736F50, 0x00050005, 0x0000063A, 0x74736964, 0x65636E61, 
-0x00000000, 0x00030005, 0x00000648, 0x0000724C, 0x00070005, 0x00000652, 0x6867696C, 0x6E6F4374, 
-0x62697274, 0x6F697475, 0x0000006E, 0x00040005, 0x00000653, 0x61726170, 0x0000006D, 0x00040005, 
-0x00000656, 0x61726170, 0x0000006D, 0x00040005, 0x00000658, 0x61726170, 0x0000006D, 0x00060005, 
-0x0000065B, 0x436C6269, 0x72746E6F, 0x74756269, 0x006E6F69, 0x00040005, 0x0000065C, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000065F, 0x61726170, 0x0000006D, 0x00040005, 0x00000661, 0x61726170, 
-0x0000006D, 0x00050005, 0x00000664, 0x616E6966, 0x6C6F436C, 0x0072756F, 0x00050005, 0x0000066C, 
-0x4374756F, 0x726F6C6F, 0x00000000, 0x00060005, 0x000006AB, 0x63736163, 0x49656461, 0x7865646E, 
-0x00000000, 0x00040005, 0x000006AC, 0x61726170, 0x0000006D, 0x00050048, 0x000001DB, 0x00000000, 
-0x00000023, 0x00000000, 0x00050048, 0x000001DB, 0x00000001, 0x00000023, 0x00000010, 0x00050048, 
-0x000001DB, 0x00000002, 0x00000023, 0x00000014, 0x00050048, 0x000001DB, 0x00000003, 0x00000023, 
-0x00000018, 0x00050048, 0x000001DB, 0x00000004, 0x00000023, 0x0000001C, 0x00050048, 0x000001DB, 
-0x00000005, 0x00000023, 0x00000020, 0x00050048, 0x000001DB, 0x00000006, 0x00000023, 0x00000024, 
-0x00050048, 0x000001DB, 0x00000007, 0x00000023, 0x00000028, 0x00050048, 0x000001DB, 0x00000008, 
-0x00000023, 0x0000002C, 0x00050048, 0x000001DB, 0x00000009, 0x00000023, 0x00000030, 0x00050048, 
-0x000001DB, 0x0000000A, 0x00000023, 0x00000034, 0x00050048, 0x000001DB, 0x0000000B, 0x00000023, 
-0x00000038, 0x00050048, 0x000001DB, 0x0000000C, 0x00000023, 0x0000003C, 0x00030047, 0x000001DB, 
-0x00000002, 0x00040047, 0x000001DD, 0x00000022, 0x00000001, 0x00040047, 0x000001DD, 0x00000021, 
-0x00000006, 0x00040047, 0x000001F7, 0x00000022, 0x00000001, 0x00040047, 0x000001F7, 0x00000021, 
-0x00000000, 0x00040047, 0x000001FC, 0x0000001E, 0x00000000, 0x00040047, 0x0000021B, 0x00000022, 
-0x00000001, 0x00040047, 0x0000021B, 0x00000021, 0x00000001, 0x00040047, 0x00000237, 0x00000022, 
-0x00000001, 0x00040047, 0x00000237, 0x00000021, 0x00000002, 0x00040047, 0x0000024E, 0x00000022, 
-0x00000001, 0x00040047, 0x0000024E, 0x00000021, 0x00000004, 0x00040047, 0x0000026A, 0x00000022, 
-0x00000001, 0x00040047, 0x0000026A, 0x00000021, 0x00000005, 0x00050048, 0x000002A3, 0x00000000, 
-0x00000023, 0x00000000, 0x00050048, 0x000002A3, 0x00000001, 0x00000023, 0x00000010, 0x00050048, 
-0x000002A3, 0x00000002, 0x00000023, 0x00000020, 0x00050048, 0x000002A3, 0x00000003, 0x00000023, 
-0x00000030, 0x00050048, 0x000002A3, 0x00000004, 0x00000023, 0x00000034, 0x00050048, 0x000002A3, 
-0x00000005, 0x00000023, 0x00000038, 0x00050048, 0x000002A3, 0x00000006, 0x00000023, 0x0000003C, 
-0x00040047, 0x000002A5, 0x00000006, 0x00000040, 0x00040047, 0x000002A8, 0x00000006, 0x00000040, 
-0x00040047, 0x000002A9, 0x00000006, 0x00000010, 0x00050048, 0x000002AA, 0x00000000, 0x00000023, 
-0x00000000, 0x00040048, 0x000002AA, 0x00000001, 0x00000005, 0x00050048, 0x000002AA, 0x00000001, 
-0x00000023, 0x00000800, 0x00050048, 0x000002AA, 0x00000001, 0x00000007, 0x00000010, 0x00040048, 
-0x000002AA, 0x00000002, 0x00000005, 0x00050048, 0x000002AA, 0x00000002, 0x00000023, 0x00000900, 
-0x00050048, 0x000002AA, 0x00000002, 0x00000007, 0x00000010, 0x00040048, 0x000002AA, 0x00000003, 
-0x00000005, 0x00050048, 0x000002AA, 0x00000003, 0x00000023, 0x00000940, 0x00050048, 0x000002AA, 
-0x00000003, 0x00000007, 0x00000010, 0x00040048, 0x000002AA, 0x00000004, 0x00000005, 0x00050048, 
-0x000002AA, 0x00000004, 0x00000023, 0x00000980, 0x00050048, 0x000002AA, 0x00000004, 0x00000007, 
-0x00000010, 0x00050048, 0x000002AA, 0x00000005, 0x00000023, 0x000009C0, 0x00050048, 0x000002AA, 
-0x00000006, 0x00000023, 0x000009D0, 0x00050048, 0x000002AA, 0x00000007, 0x00000023, 0x00000A10, 
-0x00050048, 0x000002AA, 0x00000008, 0x00000023, 0x00000A14, 0x00050048, 0x000002AA, 0x00000009, 
-0x00000023, 0x00000A18, 0x00050048, 0x000002AA, 0x0000000A, 0x00000023, 0x00000A1C, 0x00050048, 
-0x000002AA, 0x0000000B, 0x00000023, 0x00000A20, 0x00050048, 0x000002AA, 0x0000000C, 0x00000023, 
-0x00000A24, 0x00050048, 0x000002AA, 0x0000000D, 0x00000023, 0x00000A28, 0x00050048, 0x000002AA, 
-0x0000000E, 0x00000023, 0x00000A2C, 0x00050048, 0x000002AA, 0x0000000F, 0x00000023, 0x00000A30, 
-0x00050048, 0x000002AA, 0x00000010, 0x00000023, 0x00000A34, 0x00050048, 0x000002AA, 0x00000011, 
-0x00000023, 0x00000A38, 0x00050048, 0x000002AA, 0x00000012, 0x00000023, 0x00000A3C, 0x00030047, 
-0x000002AA, 0x00000002, 0x00040047, 0x000002AC, 0x00000022, 0x00000002, 0x00040047, 0x000002AC, 
-0x00000021, 0x00000005, 0x00040047, 0x0000034A, 0x00000022, 0x00000002, 0x00040047, 0x0000034A, 
-0x00000021, 0x00000003, 0x00040047, 0x000004CE, 0x00000022, 0x00000002, 0x00040047, 0x000004CE, 
-0x00000021, 0x00000002, 0x00040047, 0x000004F1, 0x00000022, 0x00000002, 0x00040047, 0x000004F1, 
-0x00000021, 0x00000001, 0x00040047, 0x0000057F, 0x00000022, 0x00000001, 0x00040047, 0x0000057F, 
-0x00000021, 0x00000003, 0x00040047, 0x000005A0, 0x0000000B, 0x0000000F, 0x00040047, 0x000005AC, 
-0x00000022, 0x00000002, 0x00040047, 0x000005AC, 0x00000021, 0x00000004, 0x00040047, 0x000005F9, 
-0x00000022, 0x00000002, 0x00040047, 0x000005F9, 0x00000021, 0x00000000, 0x00040047, 0x0000066C, 
-0x0000001E, 0x00000000, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00030016, 
-0x00000006, 0x00000020, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040021, 0x00000008, 
-0x00000006, 0x00000007, 0x00040017, 0x0000000C, 0x00000006, 0x00000003, 0x00040020, 0x0000000D, 
-0x00000007, 0x0000000C, 0x00040021, 0x0000000E, 0x0000000C, 0x0000000D, 0x00040017, 0x00000012, 
-0x00000006, 0x00000004, 0x00040020, 0x00000013, 0x00000007, 0x00000012, 0x00040021, 0x00000014, 
-0x00000012, 0x00000013, 0x00070021, 0x0000001B, 0x00000006, 0x00000007, 0x00000007, 0x0000000C, 
-0x0000000C, 0x00060021, 0x00000022, 0x0000000C, 0x0000000C, 0x00000007, 0x00000007, 0x00060021, 
-0x00000028, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00070021, 0x0000002E, 0x00000006, 
-0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00050021, 0x0000003A, 0x00000006, 0x00000007, 
-0x00000007, 0x00050021, 0x00000048, 0x0000000C, 0x00000012, 0x00000007, 0x00060021, 0x0000004D, 
-0x0000000C, 0x00000012, 0x00000007, 0x00000007, 0x00050021, 0x00000064, 0x0000000C, 0x0000000C, 
-0x00000007, 0x00060021, 0x00000069, 0x0000000C, 0x0000000D, 0x00000007, 0x00000007, 0x00030021, 
-0x0000006F, 0x00000012, 0x00030021, 0x00000072, 0x0000000C, 0x00030021, 0x00000075, 0x00000006, 
-0x00040017, 0x0000007D, 0x00000006, 0x00000002, 0x00040020, 0x0000007E, 0x00000007, 0x0000007D, 
-0x00040021, 0x0000007F, 0x00000006, 0x0000007E, 0x00040015, 0x00000083, 0x00000020, 0x00000001, 
-0x00040020, 0x00000084, 0x00000007, 0x00000083, 0x00060021, 0x00000085, 0x0000007D, 0x00000084, 
-0x00000084, 0x00000007, 0x00060021, 0x0000008B, 0x00000006, 0x0000000D, 0x0000000D, 0x00000084, 
-0x00090019, 0x00000091, 0x00000006, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 
-0x00000000, 0x0003001B, 0x00000092, 0x00000091, 0x00040020, 0x00000093, 0x00000000, 0x00000092, 
-0x000A0021, 0x00000094, 0x00000006, 0x00000093, 0x00000013, 0x00000007, 0x0000000D, 0x0000000D, 
-0x0000000D, 0x00000084, 0x00040021, 0x0000009E, 0x00000083, 0x0000000D, 0x00070021, 0x000000A2, 
-0x00000006, 0x0000000D, 0x00000084, 0x0000000D, 0x0000000D, 0x000F001E, 0x000000A9, 0x00000012, 
-0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000000C, 0x0000000C, 0x00000006, 0x0000000C, 
-0x00000006, 0x0000000C, 0x0000000C, 0x0000007D, 0x0009001E, 0x000000AA, 0x00000012, 0x00000012, 
-0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x000A0021, 0x000000AB, 0x0000000C, 
-0x000000A9, 0x000000AA, 0x0000000C, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00070021, 
-0x000000B5, 0x0000000C, 0x000000A9, 0x00000007, 0x00000007, 0x00000007, 0x00040020, 0x000000C5, 
-0x00000007, 0x000000A9, 0x00060021, 0x000000C6, 0x0000000C, 0x0000000D, 0x0000000D, 0x000000C5, 
-0x00040020, 0x000000D1, 0x00000006, 0x00000006, 0x0004003B, 0x000000D1, 0x000000D2, 0x00000006, 
-0x0004002B, 0x00000006, 0x000000D3, 0x3F800000, 0x0004003B, 0x000000D1, 0x000000D4, 0x00000006, 
-0x0004002B, 0x00000006, 0x000000D5, 0x3FCF1BBD, 0x0004002B, 0x00000006, 0x000000E2, 0x400CCCCD, 
-0x0006002C, 0x0000000C, 0x000000E3, 0x000000E2, 0x000000E2, 0x000000E2, 0x00040015, 0x000000EB, 
-0x00000020, 0x00000000, 0x0004002B, 0x000000EB, 0x000000EC, 0x00000003, 0x0004002B, 0x00000006, 
-0x000000F6, 0x00000000, 0x0004002B, 0x00000006, 0x0000010E, 0x3EA2F983, 0x0004002B, 0x00000006, 
-0x00000111, 0x477FE000, 0x0004002B, 0x00000006, 0x00000126, 0x40A00000, 0x0004002B, 0x00000006, 
-0x0000012D, 0x3F000000, 0x0004002B, 0x00000006, 0x0000012E, 0x40000000, 0x0004002B, 0x00000006, 
-0x00000172, 0x3F7FF972, 0x0004002B, 0x00000006, 0x0000018D, 0x38D1B717, 0x0004002B, 0x00000006, 
-0x000001A2, 0x3E23D70A, 0x0004002B, 0x00000006, 0x000001BF, 0x41840000, 0x0006002C, 0x0000000C, 
-0x000001C0, 0x000001BF, 0x000001BF, 0x000001BF, 0x000F001E, 0x000001DB, 0x00000012, 0x00000006, 
-0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-0x00000006, 0x00000006, 0x00000006, 0x00040020, 0x000001DC, 0x00000002, 0x000001DB, 0x0004003B, 
-0x000001DC, 0x000001DD, 0x00000002, 0x0004002B, 0x00000083, 0x000001DE, 0x00000005, 0x00040020, 
-0x000001DF, 0x00000002, 0x00000006, 0x0004002B, 0x00000006, 0x000001E2, 0x3D4CCCCD, 0x00020014, 
-0x000001E3, 0x0004002B, 0x00000083, 0x000001E7, 0x00000000, 0x00040020, 0x000001E8, 0x00000002, 
-0x00000012, 0x00090019, 0x000001F4, 0x00000006, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 
-0x00000001, 0x00000000, 0x0003001B, 0x000001F5, 0x000001F4, 0x00040020, 0x000001F6, 0x00000000, 
-0x000001F5, 0x0004003B, 0x000001F6, 0x000001F7, 0x00000000, 0x00040018, 0x000001F9, 0x0000000C, 
-0x00000003, 0x0007001E, 0x000001FA, 0x0000000C, 0x0000007D, 0x00000012, 0x0000000C, 0x000001F9, 
-0x00040020, 0x000001FB, 0x00000001, 0x000001FA, 0x0004003B, 0x000001FB, 0x000001FC, 0x00000001, 
-0x0004002B, 0x00000083, 0x000001FD, 0x00000001, 0x00040020, 0x000001FE, 0x00000001, 0x0000007D, 
-0x0004002B, 0x00000083, 0x00000208, 0x00000006, 0x0004002B, 0x00000083, 0x0000020E, 0x00000002, 
-0x0004003B, 0x000001F6, 0x0000021B, 0x00000000, 0x0004002B, 0x00000083, 0x00000226, 0x00000007, 
-0x0004003B, 0x000001F6, 0x00000237, 0x00000000, 0x0004002B, 0x000000EB, 0x0000023C, 0x00000000, 
-0x0004002B, 0x00000083, 0x00000242, 0x0000000A, 0x0004003B, 0x000001F6, 0x0000024E, 0x00000000, 
-0x0004002B, 0x00000083, 0x00000258, 0x00000009, 0x0004002B, 0x00000083, 0x0000025E, 0x00000004, 
-0x0004003B, 0x000001F6, 0x0000026A, 0x00000000, 0x0004002B, 0x00000006, 0x00000277, 0x414FD639, 
-0x0004002B, 0x00000006, 0x00000278, 0x429C774C, 0x0005002C, 0x0000007D, 0x00000279, 0x00000277, 
-0x00000278, 0x0004002B, 0x00000006, 0x0000027C, 0x472AEE8C, 0x0004002B, 0x00000006, 0x00000282, 
-0x4019999A, 0x0009001E, 0x000002A3, 0x00000012, 0x00000012, 0x00000012, 0x00000006, 0x00000006, 
-0x00000006, 0x00000006, 0x0004002B, 0x000000EB, 0x000002A4, 0x00000020, 0x0004001C, 0x000002A5, 
-0x000002A3, 0x000002A4, 0x00040018, 0x000002A6, 0x00000012, 0x00000004, 0x0004002B, 0x000000EB, 
+0x00070006, 0x000002AA, 0x00000000, 0x64616853, 0x7254776F, 0x66736E61, 0x006D726F, 0x00060006, 
+0x000002AA, 0x00000001, 0x77656956, 0x7274614D, 0x00007869, 0x00060006, 0x000002AA, 0x00000002, 
+0x6867694C, 0x65695674, 0x00000077, 0x00060006, 0x000002AA, 0x00000003, 0x73616942, 0x7274614D, 
+0x00007869, 0x00070006, 0x000002AA, 0x00000004, 0x73756C43, 0x50726574, 0x566A6F72, 0x00776569, 
+0x00070006, 0x000002AA, 0x00000005, 0x73756C43, 0x43726574, 0x746E756F, 0x00000000, 0x00080006, 
+0x000002AA, 0x00000006, 0x73756C43, 0x44726574, 0x68747065, 0x61726150, 0x0000736D, 0x00070006, 
+0x000002AA, 0x00000007, 0x656D6163, 0x6F506172, 0x69746973, 0x00006E6F, 0x00060006, 0x000002AA, 
+0x00000008, 0x696C7053, 0x70654474, 0x00736874, 0x00060006, 0x000002AA, 0x00000009, 0x6867694C, 
+0x7A695374, 0x00000065, 0x00070006, 0x000002AA, 0x0000000A, 0x5378614D, 0x6F646168, 0x73694477, 
+0x00000074, 0x00060006, 0x000002AA, 0x0000000B, 0x64616853, 0x6146776F, 0x00006564, 0x00060006, 
+0x000002AA, 0x0000000C, 0x63736143, 0x46656461, 0x00656461, 0x00090006, 0x000002AA, 0x0000000D, 
+0x65726944, 0x6F697463, 0x4C6C616E, 0x74686769, 0x6E756F43, 0x00000074, 0x00060006, 0x000002AA, 
+0x0000000E, 0x64616853, 0x6F43776F, 0x00746E75, 0x00050006, 0x000002AA, 0x0000000F, 0x65646F4D, 
+0x00000000, 0x00060006, 0x000002AA, 0x00000010, 0x4D766E45, 0x6F437069, 0x00746E75, 0x00060006, 
+0x000002AA, 0x00000011, 0x74696E49, 0x426C6169, 0x00736169, 0x00050006, 0x000002AA, 0x00000012, 
+0x74646957, 0x00000068, 0x00050006, 0x000002AA, 0x00000013, 0x67696548, 0x00007468, 0x00070006, 
+0x000002AA, 0x00000014, 0x64616873, 0x6E45776F, 0x656C6261, 0x00000064, 0x00030005, 0x000002AC, 
+0x006F6275, 0x00040005, 0x000002B0, 0x73616962, 0x00000000, 0x00040005, 0x000002BC, 0x73616962, 
+0x00000000, 0x00040005, 0x000002BD, 0x61726170, 0x0000006D, 0x00040005, 0x000002BF, 0x61726170, 
+0x0000006D, 0x00040005, 0x000002C1, 0x61726170, 0x0000006D, 0x00030005, 0x000002C4, 0x006D7573, 
+0x00040005, 0x000002C5, 0x73696F6E, 0x00000065, 0x00040005, 0x000002C6, 0x61726170, 0x0000006D, 
+0x00030005, 0x000002CA, 0x00000069, 0x00040005, 0x000002D3, 0x7366666F, 0x00007465, 0x00040005, 
+0x000002D4, 0x61726170, 0x0000006D, 0x00040005, 0x000002D6, 0x61726170, 0x0000006D, 0x00040005, 
+0x000002D7, 0x61726170, 0x0000006D, 0x00030005, 0x000002DD, 0x0000007A, 0x00060005, 0x000002FA, 
+0x63736163, 0x49656461, 0x7865646E, 0x00000000, 0x00040005, 0x000002FB, 0x77656976, 0x00736F50, 
+0x00030005, 0x00000305, 0x00000069, 0x00050005, 0x00000321, 0x64616873, 0x6F43776F, 0x0064726F, 
+0x00040005, 0x00000333, 0x5241454E, 0x00000000, 0x00050005, 0x00000335, 0x61527675, 0x73756964, 
+0x00000000, 0x00040005, 0x00000340, 0x77656976, 0x00736F50, 0x00060005, 0x00000349, 0x64616873, 
+0x6D41776F, 0x746E756F, 0x00000000, 0x00050005, 0x0000034A, 0x61685375, 0x4D776F64, 0x00007061, 
+0x00040005, 0x0000034B, 0x61726170, 0x0000006D, 0x00040005, 0x0000034D, 0x61726170, 0x0000006D, 
+0x00040005, 0x0000034F, 0x61726170, 0x0000006D, 0x00040005, 0x00000351, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000353, 0x61726170, 0x0000006D, 0x00040005, 0x00000355, 0x61726170, 0x0000006D, 
+0x00050005, 0x00000358, 0x63736163, 0x46656461, 0x00656461, 0x00050005, 0x00000365, 0x63736163, 
+0x4E656461, 0x00747865, 0x00060005, 0x0000037F, 0x64616873, 0x6D41776F, 0x746E756F, 0x00000031, 
+0x00040005, 0x00000380, 0x61726170, 0x0000006D, 0x00040005, 0x00000382, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000384, 0x61726170, 0x0000006D, 0x00040005, 0x00000386, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000388, 0x61726170, 0x0000006D, 0x00040005, 0x0000038A, 0x61726170, 0x0000006D, 
+0x00030005, 0x00000398, 0x00000044, 0x00040005, 0x0000039A, 0x61726170, 0x0000006D, 0x00040005, 
+0x0000039C, 0x61726170, 0x0000006D, 0x00030005, 0x0000039F, 0x00000056, 0x00040005, 0x000003A0, 
+0x61726170, 0x0000006D, 0x00040005, 0x000003A2, 0x61726170, 0x0000006D, 0x00040005, 0x000003A4, 
+0x61726170, 0x0000006D, 0x00030005, 0x000003A7, 0x00000046, 0x00040005, 0x000003A9, 0x61726170, 
+0x0000006D, 0x00040005, 0x000003B5, 0x61726170, 0x0000006D, 0x00040005, 0x000003B7, 0x61726170, 
+0x0000006D, 0x00040005, 0x000003B9, 0x61726170, 0x0000006D, 0x00040005, 0x000003BB, 0x61726170, 
+0x0000006D, 0x00040005, 0x000003C1, 0x61726170, 0x0000006D, 0x00040005, 0x000003C3, 0x61726170, 
+0x0000006D, 0x00040005, 0x000003C5, 0x61726170, 0x0000006D, 0x00040005, 0x000003C7, 0x61726170, 
+0x0000006D, 0x00040005, 0x000003CC, 0x75736572, 0x0000746C, 0x00030005, 0x000003CE, 0x00000069, 
+0x00040005, 0x000003DA, 0x6867696C, 0x00000074, 0x00040005, 0x000003EE, 0x756C6176, 0x00000065, 
+0x00030005, 0x000003F4, 0x0000004C, 0x00040005, 0x000003FA, 0x74736964, 0x00000000, 0x00040005, 
+0x000003FF, 0x65747461, 0x0000006E, 0x00050005, 0x00000406, 0x65747461, 0x7461756E, 0x006E6F69, 
+0x00030005, 0x0000041F, 0x0000004C, 0x00050005, 0x00000425, 0x6F747563, 0x6E416666, 0x00656C67, 
+0x00040005, 0x00000429, 0x74736964, 0x00000000, 0x00040005, 0x0000042E, 0x74656874, 0x00000061, 
+0x00040005, 0x00000434, 0x69737065, 0x006E6F6C, 0x00050005, 0x0000043A, 0x65747461, 0x7461756E, 
+0x006E6F69, 0x00060005, 0x0000044B, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 0x00040005, 
+0x0000044C, 0x61726170, 0x0000006D, 0x00040005, 0x00000455, 0x61726170, 0x0000006D, 0x00040005, 
+0x00000457, 0x61726170, 0x0000006D, 0x00040005, 0x00000459, 0x61726170, 0x0000006D, 0x00040005, 
+0x0000045D, 0x61726170, 0x0000006D, 0x00030005, 0x00000462, 0x0000694C, 0x00050005, 0x00000466, 
+0x6461724C, 0x636E6169, 0x00000065, 0x00030005, 0x0000046D, 0x0000684C, 0x00050005, 0x00000473, 
+0x6867696C, 0x4C6F4E74, 0x00000000, 0x00040005, 0x00000478, 0x61726170, 0x0000006D, 0x00030005, 
+0x0000047A, 0x00000068, 0x00050005, 0x00000480, 0x64616873, 0x5F676E69, 0x00566F4E, 0x00040005, 
+0x00000486, 0x61726170, 0x0000006D, 0x00030005, 0x00000488, 0x00566F4E, 0x00030005, 0x0000048A, 
+0x004C6F4E, 0x00040005, 0x0000048B, 0x61726170, 0x0000006D, 0x00030005, 0x0000048E, 0x00486F4E, 
+0x00040005, 0x00000493, 0x61726170, 0x0000006D, 0x00030005, 0x00000495, 0x00486F4C, 0x00040005, 
+0x00000499, 0x61726170, 0x0000006D, 0x00030005, 0x0000049B, 0x00006446, 0x00040005, 0x0000049D, 
+0x61726170, 0x0000006D, 0x00040005, 0x0000049F, 0x61726170, 0x0000006D, 0x00040005, 0x000004A1, 
+0x61726170, 0x0000006D, 0x00030005, 0x000004A4, 0x00007246, 0x00040005, 0x000004A8, 0x61726170, 
+0x0000006D, 0x00040005, 0x000004AA, 0x61726170, 0x0000006D, 0x00040005, 0x000004AC, 0x61726170, 
+0x0000006D, 0x00040005, 0x000004AE, 0x61726170, 0x0000006D, 0x00040005, 0x000004B1, 0x6F6C6F63, 
+0x00007275, 0x00040005, 0x000004BB, 0x61726170, 0x0000006D, 0x00040005, 0x000004BD, 0x61726170, 
+0x0000006D, 0x00050005, 0x000004CA, 0x61727269, 0x6E616964, 0x00006563, 0x00040005, 0x000004CE, 
+0x72724975, 0x0070614D, 0x00030005, 0x000004D4, 0x00000046, 0x00040005, 0x000004D5, 0x61726170, 
+0x0000006D, 0x00040005, 0x000004D7, 0x61726170, 0x0000006D, 0x00040005, 0x000004DA, 0x61726170, 
+0x0000006D, 0x00030005, 0x000004DE, 0x0000646B, 0x00050005, 0x000004E6, 0x66666964, 0x49657375, 
+0x00004C42, 0x00080005, 0x000004EC, 0x6E455F75, 0x64615276, 0x636E6169, 0x78655465, 0x6576654C, 
+0x0000736C, 0x00070005, 0x000004F0, 0x63657073, 0x72616C75, 0x61727249, 0x6E616964, 0x00006563, 
+0x00040005, 0x000004F1, 0x766E4575, 0x0070614D, 0x00050005, 0x000004FB, 0x63657073, 0x72616C75, 
+0x004C4249, 0x00050005, 0x0000050E, 0x43786574, 0x756F6C6F, 0x00000072, 0x00050005, 0x00000518, 
+0x6174656D, 0x63696C6C, 0x00000000, 0x00050005, 0x00000519, 0x67756F72, 0x73656E68, 0x00000073, 
+0x00030005, 0x00000528, 0x00786574, 0x00030005, 0x0000054C, 0x00786574, 0x00050005, 0x0000056A, 
+0x6574616D, 0x6C616972, 0x00000000, 0x00050005, 0x0000057F, 0x6F4E5F75, 0x6C616D72, 0x0070614D, 
+0x00040005, 0x00000598, 0x61726170, 0x0000006D, 0x00030005, 0x0000059E, 0x00007675, 0x00060005, 
+0x000005A0, 0x465F6C67, 0x43676172, 0x64726F6F, 0x00000000, 0x00040005, 0x000005AB, 0x6F617373, 
+0x00000000, 0x00050005, 0x000005AC, 0x41535375, 0x70614D4F, 0x00000000, 0x00040005, 0x000005BB, 
+0x61726170, 0x0000006D, 0x00050005, 0x000005C0, 0x67756F72, 0x73656E68, 0x00003273, 0x00040005, 
+0x000005C4, 0x75646E64, 0x00000000, 0x00040005, 0x000005C8, 0x76646E64, 0x00000000, 0x00050005, 
+0x000005CC, 0x69726176, 0x65636E61, 0x00000000, 0x00070005, 0x000005D4, 0x6E72656B, 0x6F526C65, 
+0x6E686775, 0x32737365, 0x00000000, 0x00070005, 0x000005D9, 0x746C6966, 0x64657265, 0x67756F52, 
+0x73656E68, 0x00003273, 0x00040005, 0x000005DD, 0x61726170, 0x0000006D, 0x00040005, 0x000005E7, 
+0x6F507377, 0x00000073, 0x00050005, 0x000005F9, 0x44524275, 0x54554C46, 0x00000000, 0x00050005, 
+0x00000603, 0x6C666572, 0x61746365, 0x0065636E, 0x00040005, 0x00000604, 0x61726170, 0x0000006D, 
+0x00030005, 0x00000608, 0x00003046, 0x00040005, 0x0000060B, 0x61726170, 0x0000006D, 0x00040005, 
+0x0000060E, 0x61726170, 0x0000006D, 0x00040005, 0x00000621, 0x61726170, 0x0000006D, 0x00060005, 
+0x0000062B, 0x64616873, 0x6944776F, 0x6E617473, 0x00006563, 0x00070005, 0x0000062E, 0x6E617274, 
+0x69746973, 0x69446E6F, 0x6E617473, 0x00006563, 0x00040005, 0x00000631, 0x77656976, 0x00736F50, 
+0x00050005, 0x0000063A, 0x74736964, 0x65636E61, 0x00000000, 0x00030005, 0x00000648, 0x0000724C, 
+0x00070005, 0x00000652, 0x6867696C, 0x6E6F4374, 0x62697274, 0x6F697475, 0x0000006E, 0x00040005, 
+0x00000653, 0x61726170, 0x0000006D, 0x00040005, 0x00000656, 0x61726170, 0x0000006D, 0x00040005, 
+0x00000658, 0x61726170, 0x0000006D, 0x00060005, 0x0000065B, 0x436C6269, 0x72746E6F, 0x74756269, 
+0x006E6F69, 0x00040005, 0x0000065C, 0x61726170, 0x0000006D, 0x00040005, 0x0000065F, 0x61726170, 
+0x0000006D, 0x00040005, 0x00000661, 0x61726170, 0x0000006D, 0x00050005, 0x00000664, 0x616E6966, 
+0x6C6F436C, 0x0072756F, 0x00050005, 0x0000066C, 0x4374756F, 0x726F6C6F, 0x00000000, 0x00060005, 
+0x000006AB, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 0x00040005, 0x000006AC, 0x61726170, 
+0x0000006D, 0x00050048, 0x000001DB, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000001DB, 
+0x00000001, 0x00000023, 0x00000010, 0x00050048, 0x000001DB, 0x00000002, 0x00000023, 0x00000014, 
+0x00050048, 0x000001DB, 0x00000003, 0x00000023, 0x00000018, 0x00050048, 0x000001DB, 0x00000004, 
+0x00000023, 0x0000001C, 0x00050048, 0x000001DB, 0x00000005, 0x00000023, 0x00000020, 0x00050048, 
+0x000001DB, 0x00000006, 0x00000023, 0x00000024, 0x00050048, 0x000001DB, 0x00000007, 0x00000023, 
+0x00000028, 0x00050048, 0x000001DB, 0x00000008, 0x00000023, 0x0000002C, 0x00050048, 0x000001DB, 
+0x00000009, 0x00000023, 0x00000030, 0x00050048, 0x000001DB, 0x0000000A, 0x00000023, 0x00000034, 
+0x00050048, 0x000001DB, 0x0000000B, 0x00000023, 0x00000038, 0x00050048, 0x000001DB, 0x0000000C, 
+0x00000023, 0x0000003C, 0x00030047, 0x000001DB, 0x00000002, 0x00040047, 0x000001DD, 0x00000022, 
+0x00000001, 0x00040047, 0x000001DD, 0x00000021, 0x00000006, 0x00040047, 0x000001F7, 0x00000022, 
+0x00000001, 0x00040047, 0x000001F7, 0x00000021, 0x00000000, 0x00040047, 0x000001FC, 0x0000001E, 
+0x00000000, 0x00040047, 0x0000021B, 0x00000022, 0x00000001, 0x00040047, 0x0000021B, 0x00000021, 
+0x00000001, 0x00040047, 0x00000237, 0x00000022, 0x00000001, 0x00040047, 0x00000237, 0x00000021, 
+0x00000002, 0x00040047, 0x0000024E, 0x00000022, 0x00000001, 0x00040047, 0x0000024E, 0x00000021, 
+0x00000004, 0x00040047, 0x0000026A, 0x00000022, 0x00000001, 0x00040047, 0x0000026A, 0x00000021, 
+0x00000005, 0x00050048, 0x000002A3, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000002A3, 
+0x00000001, 0x00000023, 0x00000010, 0x00050048, 0x000002A3, 0x00000002, 0x00000023, 0x00000020, 
+0x00050048, 0x000002A3, 0x00000003, 0x00000023, 0x00000030, 0x00050048, 0x000002A3, 0x00000004, 
+0x00000023, 0x00000034, 0x00050048, 0x000002A3, 0x00000005, 0x00000023, 0x00000038, 0x00050048, 
+0x000002A3, 0x00000006, 0x00000023, 0x0000003C, 0x00040047, 0x000002A8, 0x00000006, 0x00000040, 
+0x00040047, 0x000002A9, 0x00000006, 0x00000010, 0x00040048, 0x000002AA, 0x00000000, 0x00000005, 
+0x00050048, 0x000002AA, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000002AA, 0x00000000, 
+0x00000007, 0x00000010, 0x00040048, 0x000002AA, 0x00000001, 0x00000005, 0x00050048, 0x000002AA, 
+0x00000001, 0x00000023, 0x00000100, 0x00050048, 0x000002AA, 0x00000001, 0x00000007, 0x00000010, 
+0x00040048, 0x000002AA, 0x00000002, 0x00000005, 0x00050048, 0x000002AA, 0x00000002, 0x00000023, 
+0x00000140, 0x00050048, 0x000002AA, 0x00000002, 0x00000007, 0x00000010, 0x00040048, 0x000002AA, 
+0x00000003, 0x00000005, 0x00050048, 0x000002AA, 0x00000003, 0x00000023, 0x00000180, 0x00050048, 
+0x000002AA, 0x00000003, 0x00000007, 0x00000010, 0x00040048, 0x000002AA, 0x00000004, 0x00000005, 
+0x00050048, 0x000002AA, 0x00000004, 0x00000023, 0x000001C0, 0x00050048, 0x000002AA, 0x00000004, 
+0x00000007, 0x00000010, 0x00050048, 0x000002AA, 0x00000005, 0x00000023, 0x00000200, 0x00050048, 
+0x000002AA, 0x00000006, 0x00000023, 0x00000210, 0x00050048, 0x000002AA, 0x00000007, 0x00000023, 
+0x00000220, 0x00050048, 0x000002AA, 0x00000008, 0x00000023, 0x00000230, 0x00050048, 0x000002AA, 
+0x00000009, 0x00000023, 0x00000270, 0x00050048, 0x000002AA, 0x0000000A, 0x00000023, 0x00000274, 
+0x00050048, 0x000002AA, 0x0000000B, 0x00000023, 0x00000278, 0x00050048, 0x000002AA, 0x0000000C, 
+0x00000023, 0x0000027C, 0x00050048, 0x000002AA, 0x0000000D, 0x00000023, 0x00000280, 0x00050048, 
+0x000002AA, 0x0000000E, 0x00000023, 0x00000284, 0x00050048, 0x000002AA, 0x0000000F, 0x00000023, 
+0x00000288, 0x00050048, 0x000002AA, 0x00000010, 0x00000023, 0x0000028C, 0x00050048, 0x000002AA, 
+0x00000011, 0x00000023, 0x00000290, 0x00050048, 0x000002AA, 0x00000012, 0x00000023, 0x00000294, 
+0x00050048, 0x000002AA, 0x00000013, 0x00000023, 0x00000298, 0x00050048, 0x000002AA, 0x00000014, 
+0x00000023, 0x0000029C, 0x00030047, 0x000002AA, 0x00000002, 0x00050005, 0x000007D1, 0x6867694C, 
+0x66754274, 0x00726566, 0x00050006, 0x000007D1, 0x00000000, 0x6867696C, 0x00007374, 0x00050005, 
+0x000007D2, 0x6867696C, 0x66754274, 0x00726566, 0x00050005, 0x000007D3, 0x73756C43, 0x47726574, 
+0x00646972, 0x00060006, 0x000007D3, 0x00000000, 0x73756C63, 0x73726574, 0x00000000, 0x00050005, 
+0x000007D4, 0x73756C63, 0x47726574, 0x00646972, 0x00070005, 0x000007D5, 0x73756C43, 0x4C726574, 
+0x74686769, 0x69646E49, 0x00736563, 0x00050006, 0x000007D5, 0x00000000, 0x69646E69, 0x00736563, 
+0x00060005, 0x000007D6, 0x73756C63, 0x4C726574, 0x74686769, 0x00000073, 0x00040047, 0x000007D7, 
+0x00000006, 0x00000040, 0x00040048, 0x000007D1, 0x00000000, 0x00000018, 0x00050048, 0x000007D1, 
+0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000007D1, 0x00000003, 0x00040047, 0x000007D2, 
+0x00000022, 0x00000002, 0x00040047, 0x000007D2, 0x00000021, 0x00000006, 0x00040047, 0x000007D8, 
+0x00000006, 0x00000008, 0x00040048, 0x000007D3, 0x00000000, 0x00000018, 0x00050048, 0x000007D3, 
+0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000007D3, 0x00000003, 0x00040047, 0x000007D4, 
+0x00000022, 0x00000002, 0x00040047, 0x000007D4, 0x00000021, 0x00000007, 0x00040047, 0x000007D9, 
+0x00000006, 0x00000004, 0x00040048, 0x000007D5, 0x00000000, 0x00000018, 0x00050048, 0x000007D5, 
+0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000007D5, 0x00000003, 0x00040047, 0x000007D6, 
+0x00000022, 0x00000002, 0x00040047, 0x000007D6, 0x00000021, 0x00000008, 0x00040047, 0x000002AC, 
+0x00000022, 0x00000002, 0x00040047, 0x000002AC, 0x00000021, 0x00000005, 0x00040047, 0x0000034A, 
+0x00000022, 0x00000002, 0x00040047, 0x0000034A, 0x00000021, 0x00000003, 0x00040047, 0x000004CE, 
+0x00000022, 0x00000002, 0x00040047, 0x000004CE, 0x00000021, 0x00000002, 0x00040047, 0x000004F1, 
+0x00000022, 0x00000002, 0x00040047, 0x000004F1, 0x00000021, 0x00000001, 0x00040047, 0x0000057F, 
+0x00000022, 0x00000001, 0x00040047, 0x0000057F, 0x00000021, 0x00000003, 0x00040047, 0x000005A0, 
+0x0000000B, 0x0000000F, 0x00040047, 0x000005AC, 0x00000022, 0x00000002, 0x00040047, 0x000005AC, 
+0x00000021, 0x00000004, 0x00040047, 0x000005F9, 0x00000022, 0x00000002, 0x00040047, 0x000005F9, 
+0x00000021, 0x00000000, 0x00040047, 0x0000066C, 0x0000001E, 0x00000000, 0x00020013, 0x00000002, 
+0x00030021, 0x00000003, 0x00000002, 0x00030016, 0x00000006, 0x00000020, 0x00040020, 0x00000007, 
+0x00000007, 0x00000006, 0x00040021, 0x00000008, 0x00000006, 0x00000007, 0x00040017, 0x0000000C, 
+0x00000006, 0x00000003, 0x00040020, 0x0000000D, 0x00000007, 0x0000000C, 0x00040021, 0x0000000E, 
+0x0000000C, 0x0000000D, 0x00040017, 0x00000012, 0x00000006, 0x00000004, 0x00040020, 0x00000013, 
+0x00000007, 0x00000012, 0x00040021, 0x00000014, 0x00000012, 0x00000013, 0x00070021, 0x0000001B, 
+0x00000006, 0x00000007, 0x00000007, 0x0000000C, 0x0000000C, 0x00060021, 0x00000022, 0x0000000C, 
+0x0000000C, 0x00000007, 0x00000007, 0x00060021, 0x00000028, 0x00000006, 0x00000007, 0x00000007, 
+0x00000007, 0x00070021, 0x0000002E, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 
+0x00050021, 0x0000003A, 0x00000006, 0x00000007, 0x00000007, 0x00050021, 0x00000048, 0x0000000C, 
+0x00000012, 0x00000007, 0x00060021, 0x0000004D, 0x0000000C, 0x00000012, 0x00000007, 0x00000007, 
+0x00050021, 0x00000064, 0x0000000C, 0x0000000C, 0x00000007, 0x00060021, 0x00000069, 0x0000000C, 
+0x0000000D, 0x00000007, 0x00000007, 0x00030021, 0x0000006F, 0x00000012, 0x00030021, 0x00000072, 
+0x0000000C, 0x00030021, 0x00000075, 0x00000006, 0x00040017, 0x0000007D, 0x00000006, 0x00000002, 
+0x00040020, 0x0000007E, 0x00000007, 0x0000007D, 0x00040021, 0x0000007F, 0x00000006, 0x0000007E, 
+0x00040015, 0x00000083, 0x00000020, 0x00000001, 0x00040020, 0x00000084, 0x00000007, 0x00000083, 
+0x00060021, 0x00000085, 0x0000007D, 0x00000084, 0x00000084, 0x00000007, 0x00060021, 0x0000008B, 
+0x00000006, 0x0000000D, 0x0000000D, 0x00000084, 0x00090019, 0x00000091, 0x00000006, 0x00000001, 
+0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x00000092, 0x00000091, 
+0x00040020, 0x00000093, 0x00000000, 0x00000092, 0x000A0021, 0x00000094, 0x00000006, 0x00000093, 
+0x00000013, 0x00000007, 0x0000000D, 0x0000000D, 0x0000000D, 0x00000084, 0x00040021, 0x0000009E, 
+0x00000083, 0x0000000D, 0x00070021, 0x000000A2, 0x00000006, 0x0000000D, 0x00000084, 0x0000000D, 
+0x0000000D, 0x000F001E, 0x000000A9, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
+0x0000000C, 0x0000000C, 0x00000006, 0x0000000C, 0x00000006, 0x0000000C, 0x0000000C, 0x0000007D, 
+0x0009001E, 0x000000AA, 0x00000012, 0x00000012, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 
+0x00000006, 0x000A0021, 0x000000AB, 0x0000000C, 0x000000A9, 0x000000AA, 0x0000000C, 0x00000007, 
+0x00000007, 0x00000007, 0x00000007, 0x00070021, 0x000000B5, 0x0000000C, 0x000000A9, 0x00000007, 
+0x00000007, 0x00000007, 0x00040020, 0x000000C5, 0x00000007, 0x000000A9, 0x00060021, 0x000000C6, 
+0x0000000C, 0x0000000D, 0x0000000D, 0x000000C5, 0x00040020, 0x000000D1, 0x00000006, 0x00000006, 
+0x0004003B, 0x000000D1, 0x000000D2, 0x00000006, 0x0004002B, 0x00000006, 0x000000D3, 0x3F800000, 
+0x0004003B, 0x000000D1, 0x000000D4, 0x00000006, 0x0004002B, 0x00000006, 0x000000D5, 0x3FCF1BBD, 
+0x0004002B, 0x00000006, 0x000000E2, 0x400CCCCD, 0x0006002C, 0x0000000C, 0x000000E3, 0x000000E2, 
+0x000000E2, 0x000000E2, 0x00040015, 0x000000EB, 0x00000020, 0x00000000, 0x0004002B, 0x000000EB, 
+0x000000EC, 0x00000003, 0x0004002B, 0x00000006, 0x000000F6, 0x00000000, 0x0004002B, 0x00000006, 
+0x0000010E, 0x3EA2F983, 0x0004002B, 0x00000006, 0x00000111, 0x477FE000, 0x0004002B, 0x00000006, 
+0x00000126, 0x40A00000, 0x0004002B, 0x00000006, 0x0000012D, 0x3F000000, 0x0004002B, 0x00000006, 
+0x0000012E, 0x40000000, 0x0004002B, 0x00000006, 0x00000172, 0x3F7FF972, 0x0004002B, 0x00000006, 
+0x0000018D, 0x38D1B717, 0x0004002B, 0x00000006, 0x000001A2, 0x3E23D70A, 0x0004002B, 0x00000006, 
+0x000001BF, 0x41840000, 0x0006002C, 0x0000000C, 0x000001C0, 0x000001BF, 0x000001BF, 0x000001BF, 
+0x000F001E, 0x000001DB, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
+0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00040020, 
+0x000001DC, 0x00000002, 0x000001DB, 0x0004003B, 0x000001DC, 0x000001DD, 0x00000002, 0x0004002B, 
+0x00000083, 0x000001DE, 0x00000005, 0x00040020, 0x000001DF, 0x00000002, 0x00000006, 0x0004002B, 
+0x00000006, 0x000001E2, 0x3D4CCCCD, 0x00020014, 0x000001E3, 0x0004002B, 0x00000083, 0x000001E7, 
+0x00000000, 0x00040020, 0x000001E8, 0x00000002, 0x00000012, 0x00090019, 0x000001F4, 0x00000006, 
+0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x000001F5, 
+0x000001F4, 0x00040020, 0x000001F6, 0x00000000, 0x000001F5, 0x0004003B, 0x000001F6, 0x000001F7, 
+0x00000000, 0x00040018, 0x000001F9, 0x0000000C, 0x00000003, 0x0007001E, 0x000001FA, 0x0000000C, 
+0x0000007D, 0x00000012, 0x0000000C, 0x000001F9, 0x00040020, 0x000001FB, 0x00000001, 0x000001FA, 
+0x0004003B, 0x000001FB, 0x000001FC, 0x00000001, 0x0004002B, 0x00000083, 0x000001FD, 0x00000001, 
+0x00040020, 0x000001FE, 0x00000001, 0x0000007D, 0x0004002B, 0x00000083, 0x00000208, 0x00000006, 
+0x0004002B, 0x00000083, 0x0000020E, 0x00000002, 0x0004003B, 0x000001F6, 0x0000021B, 0x00000000, 
+0x0004002B, 0x00000083, 0x00000226, 0x00000007, 0x0004003B, 0x000001F6, 0x00000237, 0x00000000, 
+0x0004002B, 0x000000EB, 0x0000023C, 0x00000000, 0x0004002B, 0x00000083, 0x00000242, 0x0000000A, 
+0x0004003B, 0x000001F6, 0x0000024E, 0x00000000, 0x0004002B, 0x00000083, 0x00000258, 0x00000009, 
+0x0004002B, 0x00000083, 0x0000025E, 0x00000004, 0x0004003B, 0x000001F6, 0x0000026A, 0x00000000, 
+0x0004002B, 0x00000006, 0x00000277, 0x414FD639, 0x0004002B, 0x00000006, 0x00000278, 0x429C774C, 
+0x0005002C, 0x0000007D, 0x00000279, 0x00000277, 0x00000278, 0x0004002B, 0x00000006, 0x0000027C, 
+0x472AEE8C, 0x0004002B, 0x00000006, 0x00000282, 0x4019999A, 0x0009001E, 0x000002A3, 0x00000012, 
+0x00000012, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0004002B, 0x000000EB, 
+0x000002A4, 0x00000020, 0x00040018, 0x000002A6, 0x00000012, 0x00000004, 0x0004002B, 0x000000EB, 
 0x000002A7, 0x00000004, 0x0004001C, 0x000002A8, 0x000002A6, 0x000002A7, 0x0004001C, 0x000002A9, 
-0x00000012, 0x000002A7, 0x0015001E, 0x000002AA, 0x000002A5, 0x000002A8, 0x000002A6, 0x000002A6, 
-0x000002A6, 0x00000012, 0x000002A9, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000083, 
-0x00000083, 0x00000083, 0x00000083, 0x00000006, 0x00000006, 0x00000006, 0x00000083, 0x00040020, 
-0x000002AB, 0x00000002, 0x000002AA, 0x0004003B, 0x000002AB, 0x000002AC, 0x00000002, 0x0004002B, 
+0x00000012, 0x000002A7, 0x00040017, 0x000007DA, 0x000000EB, 0x00000002, 0x00040017, 0x000007DB, 
+0x000000EB, 0x00000004, 0x0017001E, 0x000002AA, 0x000002A8, 0x000002A6, 0x000002A6, 0x000002A6, 
+0x000002A6, 0x000007DB, 0x00000012, 0x00000012, 0x000002A9, 0x00000006, 0x00000006, 0x00000006, 
+0x00000006, 0x00000083, 0x00000083, 0x00000083, 0x00000083, 0x00000006, 0x00000006, 0x00000006, 
+0x00000083, 0x00040020, 0x000002AB, 0x00000002, 0x000002AA, 0x0004003B, 0x000002AB, 0x000002AC, 
+0x00000002, 0x0004002B, 0x00000083, 0x000007DC, 0x00000013, 0x0004002B, 0x00000083, 0x000007DD, 
+0x00000014, 0x0003001D, 0x000007D7, 0x000002A3, 0x0003001E, 0x000007D1, 0x000007D7, 0x00040020, 
+0x000007DE, 0x00000002, 0x000007D1, 0x0004003B, 0x000007DE, 0x000007D2, 0x00000002, 0x0003001D, 
+0x000007D8, 0x000007DA, 0x0003001E, 0x000007D3, 0x000007D8, 0x00040020, 0x000007DF, 0x00000002, 
+0x000007D3, 0x0004003B, 0x000007DF, 0x000007D4, 0x00000002, 0x0003001D, 0x000007D9, 0x000000EB, 
+0x0003001E, 0x000007D5, 0x000007D9, 0x00040020, 0x000007E0, 0x00000002, 0x000007D5, 0x0004003B, 
+0x000007E0, 0x000007D6, 0x00000002, 0x00040020, 0x000007E1, 0x00000002, 0x000007DB, 0x00040020, 
+0x000007E2, 0x00000002, 0x000007DA, 0x00040020, 0x000007E3, 0x00000002, 0x000000EB, 0x00040020, 
+0x000007E4, 0x00000007, 0x000000EB, 0x0004002B, 0x00000006, 0x000007E5, 0x38D1B717, 0x0004002B, 
 0x00000083, 0x000002AD, 0x0000000F, 0x0004002B, 0x00000083, 0x000002D1, 0x00000008, 0x0004002B, 
 0x00000006, 0x000002DA, 0x442F0000, 0x0004002B, 0x000000EB, 0x000002EA, 0x00000002, 0x0004002B, 
 0x00000006, 0x000002F6, 0x41000000, 0x00040020, 0x000002FC, 0x00000002, 0x000002A6, 0x0004002B, 
@@ -647,705 +676,753 @@ constexpr std::array<uint32_t, 12160> spirv_ForwardPBRfragspv = {
 0x0000057B, 0x000300F7, 0x0000057E, 0x00000000, 0x000400FA, 0x0000057C, 0x0000057D, 0x0000057E, 
 0x000200F8, 0x0000057D, 0x0004003D, 0x000001F5, 0x00000580, 0x0000057F, 0x00050041, 0x000001FE, 
 0x00000581, 0x000001FC, 0x000001FD, 0x0004003D, 0x0000007D, 0x00000582, 0x00000581, 0x00050057, 
-0x00000012, 0x00000583, 0x00000580, 0x00000582, 0x0008004F, 0x0000000C, 0x00000584, 0x00000583, 
-0x00000583, 0x00000000, 0x00000001, 0x00000002, 0x0005008E, 0x0000000C, 0x00000585, 0x00000584, 
-0x0000012E, 0x00060050, 0x0000000C, 0x00000586, 0x000000D3, 0x000000D3, 0x000000D3, 0x00050083, 
-0x0000000C, 0x00000587, 0x00000585, 0x00000586, 0x0006000C, 0x0000000C, 0x00000588, 0x00000001, 
-0x00000045, 0x00000587, 0x00050041, 0x0000000D, 0x00000589, 0x0000056A, 0x00000208, 0x0003003E, 
-0x00000589, 0x00000588, 0x00050041, 0x0000058A, 0x0000058B, 0x000001FC, 0x0000025E, 0x0004003D, 
-0x000001F9, 0x0000058C, 0x0000058B, 0x00050041, 0x0000000D, 0x0000058D, 0x0000056A, 0x00000208, 
-0x0004003D, 0x0000000C, 0x0000058E, 0x0000058D, 0x00050091, 0x0000000C, 0x0000058F, 0x0000058C, 
-0x0000058E, 0x0006000C, 0x0000000C, 0x00000590, 0x00000001, 0x00000045, 0x0000058F, 0x00050041, 
-0x0000000D, 0x00000591, 0x0000056A, 0x00000208, 0x0003003E, 0x00000591, 0x00000590, 0x00050041, 
-0x0000000D, 0x00000592, 0x0000056A, 0x00000208, 0x0004003D, 0x0000000C, 0x00000593, 0x00000592, 
-0x0006000C, 0x0000000C, 0x00000594, 0x00000001, 0x00000045, 0x00000593, 0x00050041, 0x0000000D, 
-0x00000595, 0x0000056A, 0x00000208, 0x0003003E, 0x00000595, 0x00000594, 0x000200F9, 0x0000057E, 
-0x000200F8, 0x0000057E, 0x00040039, 0x00000006, 0x00000596, 0x00000078, 0x00050041, 0x00000007, 
-0x00000597, 0x0000056A, 0x00000226, 0x0003003E, 0x00000597, 0x00000596, 0x00050041, 0x00000013, 
-0x00000599, 0x0000056A, 0x000001E7, 0x0004003D, 0x00000012, 0x0000059A, 0x00000599, 0x0008004F, 
-0x0000000C, 0x0000059B, 0x0000059A, 0x0000059A, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 
-0x00000598, 0x0000059B, 0x00050039, 0x0000000C, 0x0000059C, 0x0000007B, 0x00000598, 0x00050041, 
-0x0000000D, 0x0000059D, 0x0000056A, 0x000001DE, 0x0003003E, 0x0000059D, 0x0000059C, 0x0004003D, 
-0x00000012, 0x000005A1, 0x000005A0, 0x0007004F, 0x0000007D, 0x000005A2, 0x000005A1, 0x000005A1, 
-0x00000000, 0x00000001, 0x00050041, 0x000001DF, 0x000005A4, 0x000002AC, 0x000005A3, 0x0004003D, 
-0x00000006, 0x000005A5, 0x000005A4, 0x00050041, 0x000001DF, 0x000005A7, 0x000002AC, 0x000005A6, 
-0x0004003D, 0x00000006, 0x000005A8, 0x000005A7, 0x00050050, 0x0000007D, 0x000005A9, 0x000005A5, 
-0x000005A8, 0x00050088, 0x0000007D, 0x000005AA, 0x000005A2, 0x000005A9, 0x0003003E, 0x0000059E, 
-0x000005AA, 0x0004003D, 0x000001F5, 0x000005AD, 0x000005AC, 0x0004003D, 0x0000007D, 0x000005AE, 
-0x0000059E, 0x00050057, 0x00000012, 0x000005AF, 0x000005AD, 0x000005AE, 0x00050051, 0x00000006, 
-0x000005B0, 0x000005AF, 0x00000000, 0x0003003E, 0x000005AB, 0x000005B0, 0x0004003D, 0x00000006, 
-0x000005B1, 0x000005AB, 0x00050041, 0x00000013, 0x000005B2, 0x0000056A, 0x000001E7, 0x0004003D, 
-0x00000012, 0x000005B3, 0x000005B2, 0x0005008E, 0x00000012, 0x000005B4, 0x000005B3, 0x000005B1, 
-0x00050041, 0x00000013, 0x000005B5, 0x0000056A, 0x000001E7, 0x0003003E, 0x000005B5, 0x000005B4, 
-0x00050041, 0x00000007, 0x000005B6, 0x0000056A, 0x000003E6, 0x0004003D, 0x00000006, 0x000005B7, 
-0x000005B6, 0x0008000C, 0x00000006, 0x000005B9, 0x00000001, 0x0000002B, 0x000005B7, 0x000005B8, 
-0x000000D3, 0x00050041, 0x00000007, 0x000005BA, 0x0000056A, 0x000003E6, 0x0003003E, 0x000005BA, 
-0x000005B9, 0x00050041, 0x00000007, 0x000005BC, 0x0000056A, 0x0000020E, 0x0004003D, 0x00000006, 
-0x000005BD, 0x000005BC, 0x0003003E, 0x000005BB, 0x000005BD, 0x00050039, 0x00000006, 0x000005BE, 
-0x00000057, 0x000005BB, 0x00050041, 0x00000007, 0x000005BF, 0x0000056A, 0x0000020E, 0x0003003E, 
-0x000005BF, 0x000005BE, 0x0004003D, 0x00000006, 0x000005C1, 0x00000519, 0x0004003D, 0x00000006, 
-0x000005C2, 0x00000519, 0x00050085, 0x00000006, 0x000005C3, 0x000005C1, 0x000005C2, 0x0003003E, 
-0x000005C0, 0x000005C3, 0x00050041, 0x0000000D, 0x000005C5, 0x0000056A, 0x00000208, 0x0004003D, 
-0x0000000C, 0x000005C6, 0x000005C5, 0x000400CF, 0x0000000C, 0x000005C7, 0x000005C6, 0x0003003E, 
-0x000005C4, 0x000005C7, 0x00050041, 0x0000000D, 0x000005C9, 0x0000056A, 0x00000208, 0x0004003D, 
-0x0000000C, 0x000005CA, 0x000005C9, 0x000400D0, 0x0000000C, 0x000005CB, 0x000005CA, 0x0003003E, 
-0x000005C8, 0x000005CB, 0x0004003D, 0x0000000C, 0x000005CD, 0x000005C4, 0x0004003D, 0x0000000C, 
-0x000005CE, 0x000005C4, 0x00050094, 0x00000006, 0x000005CF, 0x000005CD, 0x000005CE, 0x0004003D, 
-0x0000000C, 0x000005D0, 0x000005C8, 0x0004003D, 0x0000000C, 0x000005D1, 0x000005C8, 0x00050094, 
-0x00000006, 0x000005D2, 0x000005D0, 0x000005D1, 0x00050081, 0x00000006, 0x000005D3, 0x000005CF, 
-0x000005D2, 0x0003003E, 0x000005CC, 0x000005D3, 0x0004003D, 0x00000006, 0x000005D5, 0x000005CC, 
-0x00050085, 0x00000006, 0x000005D6, 0x000005D5, 0x000000D3, 0x0007000C, 0x00000006, 0x000005D8, 
-0x00000001, 0x00000025, 0x000005D6, 0x000005D7, 0x0003003E, 0x000005D4, 0x000005D8, 0x0004003D, 
-0x00000006, 0x000005DA, 0x000005C0, 0x0004003D, 0x00000006, 0x000005DB, 0x000005D4, 0x00050081, 
-0x00000006, 0x000005DC, 0x000005DA, 0x000005DB, 0x0003003E, 0x000005DD, 0x000005DC, 0x00050039, 
-0x00000006, 0x000005DE, 0x00000019, 0x000005DD, 0x0003003E, 0x000005D9, 0x000005DE, 0x0004003D, 
-0x00000006, 0x000005DF, 0x000005D9, 0x0006000C, 0x00000006, 0x000005E0, 0x00000001, 0x0000001F, 
-0x000005DF, 0x00050041, 0x00000007, 0x000005E1, 0x0000056A, 0x0000020E, 0x0003003E, 0x000005E1, 
-0x000005E0, 0x00050041, 0x00000007, 0x000005E2, 0x0000056A, 0x0000020E, 0x0004003D, 0x00000006, 
-0x000005E3, 0x000005E2, 0x0008000C, 0x00000006, 0x000005E5, 0x00000001, 0x0000002B, 0x000005E3, 
-0x000005E4, 0x000000D3, 0x00050041, 0x00000007, 0x000005E6, 0x0000056A, 0x0000020E, 0x0003003E, 
-0x000005E6, 0x000005E5, 0x00050041, 0x0000059F, 0x000005E8, 0x000001FC, 0x0000020E, 0x0004003D, 
-0x00000012, 0x000005E9, 0x000005E8, 0x0008004F, 0x0000000C, 0x000005EA, 0x000005E9, 0x000005E9, 
-0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000005E7, 0x000005EA, 0x00050041, 0x000001E8, 
-0x000005EB, 0x000002AC, 0x000001DE, 0x0004003D, 0x00000012, 0x000005EC, 0x000005EB, 0x0008004F, 
-0x0000000C, 0x000005ED, 0x000005EC, 0x000005EC, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 
-0x0000000C, 0x000005EE, 0x000005E7, 0x00050083, 0x0000000C, 0x000005EF, 0x000005ED, 0x000005EE, 
-0x0006000C, 0x0000000C, 0x000005F0, 0x00000001, 0x00000045, 0x000005EF, 0x00050041, 0x0000000D, 
-0x000005F1, 0x0000056A, 0x000002D1, 0x0003003E, 0x000005F1, 0x000005F0, 0x00050041, 0x0000000D, 
-0x000005F2, 0x0000056A, 0x00000208, 0x0004003D, 0x0000000C, 0x000005F3, 0x000005F2, 0x00050041, 
-0x0000000D, 0x000005F4, 0x0000056A, 0x000002D1, 0x0004003D, 0x0000000C, 0x000005F5, 0x000005F4, 
-0x00050094, 0x00000006, 0x000005F6, 0x000005F3, 0x000005F5, 0x0007000C, 0x00000006, 0x000005F7, 
-0x00000001, 0x00000028, 0x000005F6, 0x0000018D, 0x00050041, 0x00000007, 0x000005F8, 0x0000056A, 
-0x00000258, 0x0003003E, 0x000005F8, 0x000005F7, 0x0004003D, 0x000001F5, 0x000005FA, 0x000005F9, 
-0x00050041, 0x00000007, 0x000005FB, 0x0000056A, 0x00000258, 0x0004003D, 0x00000006, 0x000005FC, 
-0x000005FB, 0x00050041, 0x00000007, 0x000005FD, 0x0000056A, 0x000003E6, 0x0004003D, 0x00000006, 
-0x000005FE, 0x000005FD, 0x00050050, 0x0000007D, 0x000005FF, 0x000005FC, 0x000005FE, 0x00050057, 
-0x00000012, 0x00000600, 0x000005FA, 0x000005FF, 0x0007004F, 0x0000007D, 0x00000601, 0x00000600, 
-0x00000600, 0x00000000, 0x00000001, 0x00050041, 0x0000007E, 0x00000602, 0x0000056A, 0x0000030C, 
-0x0003003E, 0x00000602, 0x00000601, 0x00050041, 0x00000007, 0x00000605, 0x0000056A, 0x0000025E, 
-0x0004003D, 0x00000006, 0x00000606, 0x00000605, 0x0003003E, 0x00000604, 0x00000606, 0x00050039, 
-0x00000006, 0x00000607, 0x00000054, 0x00000604, 0x0003003E, 0x00000603, 0x00000607, 0x00050041, 
-0x00000013, 0x00000609, 0x0000056A, 0x000001E7, 0x0004003D, 0x00000012, 0x0000060A, 0x00000609, 
-0x00050041, 0x00000007, 0x0000060C, 0x0000056A, 0x000001FD, 0x0004003D, 0x00000006, 0x0000060D, 
-0x0000060C, 0x0003003E, 0x0000060B, 0x0000060D, 0x0004003D, 0x00000006, 0x0000060F, 0x00000603, 
-0x0003003E, 0x0000060E, 0x0000060F, 0x00070039, 0x0000000C, 0x00000610, 0x00000051, 0x0000060A, 
-0x0000060B, 0x0000060E, 0x0003003E, 0x00000608, 0x00000610, 0x0004003D, 0x0000000C, 0x00000611, 
-0x00000608, 0x00050041, 0x0000000D, 0x00000612, 0x0000056A, 0x00000242, 0x0003003E, 0x00000612, 
-0x00000611, 0x00050041, 0x0000000D, 0x00000613, 0x0000056A, 0x00000242, 0x0004003D, 0x0000000C, 
-0x00000614, 0x00000613, 0x00060041, 0x00000007, 0x00000616, 0x0000056A, 0x0000030C, 0x00000501, 
-0x0004003D, 0x00000006, 0x00000617, 0x00000616, 0x0007000C, 0x00000006, 0x00000618, 0x00000001, 
-0x00000028, 0x00000615, 0x00000617, 0x00050088, 0x00000006, 0x00000619, 0x000000D3, 0x00000618, 
-0x00050083, 0x00000006, 0x0000061A, 0x00000619, 0x000000D3, 0x0005008E, 0x0000000C, 0x0000061B, 
-0x00000614, 0x0000061A, 0x00060050, 0x0000000C, 0x0000061C, 0x000000D3, 0x000000D3, 0x000000D3, 
-0x00050081, 0x0000000C, 0x0000061D, 0x0000061C, 0x0000061B, 0x00050041, 0x0000000D, 0x0000061E, 
-0x0000056A, 0x000003D5, 0x0003003E, 0x0000061E, 0x0000061D, 0x00050041, 0x00000013, 0x0000061F, 
-0x0000056A, 0x000001E7, 0x0004003D, 0x00000012, 0x00000620, 0x0000061F, 0x00050041, 0x00000007, 
-0x00000622, 0x0000056A, 0x000001FD, 0x0004003D, 0x00000006, 0x00000623, 0x00000622, 0x0003003E, 
-0x00000621, 0x00000623, 0x00060039, 0x0000000C, 0x00000624, 0x0000004B, 0x00000620, 0x00000621, 
-0x00060041, 0x00000007, 0x00000625, 0x0000056A, 0x000001E7, 0x0000023C, 0x00050051, 0x00000006, 
-0x00000626, 0x00000624, 0x00000000, 0x0003003E, 0x00000625, 0x00000626, 0x00060041, 0x00000007, 
-0x00000627, 0x0000056A, 0x000001E7, 0x00000501, 0x00050051, 0x00000006, 0x00000628, 0x00000624, 
-0x00000001, 0x0003003E, 0x00000627, 0x00000628, 0x00060041, 0x00000007, 0x00000629, 0x0000056A, 
-0x000001E7, 0x000002EA, 0x00050051, 0x00000006, 0x0000062A, 0x00000624, 0x00000002, 0x0003003E, 
-0x00000629, 0x0000062A, 0x00050041, 0x000001DF, 0x0000062C, 0x000002AC, 0x000002D1, 0x0004003D, 
-0x00000006, 0x0000062D, 0x0000062C, 0x0003003E, 0x0000062B, 0x0000062D, 0x00050041, 0x000001DF, 
-0x0000062F, 0x000002AC, 0x00000258, 0x0004003D, 0x00000006, 0x00000630, 0x0000062F, 0x0003003E, 
-0x0000062E, 0x00000630, 0x00050041, 0x000002FC, 0x00000632, 0x000002AC, 0x0000020E, 0x0004003D, 
-0x000002A6, 0x00000633, 0x00000632, 0x0004003D, 0x0000000C, 0x00000634, 0x000005E7, 0x00050051, 
-0x00000006, 0x00000635, 0x00000634, 0x00000000, 0x00050051, 0x00000006, 0x00000636, 0x00000634, 
-0x00000001, 0x00050051, 0x00000006, 0x00000637, 0x00000634, 0x00000002, 0x00070050, 0x00000012, 
-0x00000638, 0x00000635, 0x00000636, 0x00000637, 0x000000D3, 0x00050091, 0x00000012, 0x00000639, 
-0x00000633, 0x00000638, 0x0003003E, 0x00000631, 0x00000639, 0x0004003D, 0x00000012, 0x0000063B, 
-0x00000631, 0x0006000C, 0x00000006, 0x0000063C, 0x00000001, 0x00000042, 0x0000063B, 0x0003003E, 
-0x0000063A, 0x0000063C, 0x0004003D, 0x00000006, 0x0000063D, 0x0000063A, 0x0004003D, 0x00000006, 
-0x0000063E, 0x0000062B, 0x0004003D, 0x00000006, 0x0000063F, 0x0000062E, 0x00050083, 0x00000006, 
-0x00000640, 0x0000063E, 0x0000063F, 0x00050083, 0x00000006, 0x00000641, 0x0000063D, 0x00000640, 
-0x0003003E, 0x000000D2, 0x00000641, 0x0004003D, 0x00000006, 0x00000642, 0x0000062E, 0x0004003D, 
-0x00000006, 0x00000643, 0x000000D2, 0x00050088, 0x00000006, 0x00000644, 0x00000643, 0x00000642, 
-0x0003003E, 0x000000D2, 0x00000644, 0x0004003D, 0x00000006, 0x00000645, 0x000000D2, 0x00050083, 
-0x00000006, 0x00000646, 0x000000D3, 0x00000645, 0x0008000C, 0x00000006, 0x00000647, 0x00000001, 
-0x0000002B, 0x00000646, 0x000000F6, 0x000000D3, 0x0003003E, 0x000000D2, 0x00000647, 0x00050041, 
-0x00000007, 0x00000649, 0x0000056A, 0x00000258, 0x0004003D, 0x00000006, 0x0000064A, 0x00000649, 
-0x00050085, 0x00000006, 0x0000064B, 0x0000012E, 0x0000064A, 0x00050041, 0x0000000D, 0x0000064C, 
-0x0000056A, 0x00000208, 0x0004003D, 0x0000000C, 0x0000064D, 0x0000064C, 0x0005008E, 0x0000000C, 
-0x0000064E, 0x0000064D, 0x0000064B, 0x00050041, 0x0000000D, 0x0000064F, 0x0000056A, 0x000002D1, 
-0x0004003D, 0x0000000C, 0x00000650, 0x0000064F, 0x00050083, 0x0000000C, 0x00000651, 0x0000064E, 
-0x00000650, 0x0003003E, 0x00000648, 0x00000651, 0x00050041, 0x0000000D, 0x00000654, 0x0000056A, 
-0x00000242, 0x0004003D, 0x0000000C, 0x00000655, 0x00000654, 0x0003003E, 0x00000653, 0x00000655, 
-0x0004003D, 0x0000000C, 0x00000657, 0x000005E7, 0x0003003E, 0x00000656, 0x00000657, 0x0004003D, 
-0x000000A9, 0x00000659, 0x0000056A, 0x0003003E, 0x00000658, 0x00000659, 0x00070039, 0x0000000C, 
-0x0000065A, 0x000000CA, 0x00000653, 0x00000656, 0x00000658, 0x0003003E, 0x00000652, 0x0000065A, 
-0x00050041, 0x0000000D, 0x0000065D, 0x0000056A, 0x00000242, 0x0004003D, 0x0000000C, 0x0000065E, 
-0x0000065D, 0x0003003E, 0x0000065C, 0x0000065E, 0x0004003D, 0x0000000C, 0x00000660, 0x00000648, 
-0x0003003E, 0x0000065F, 0x00000660, 0x0004003D, 0x000000A9, 0x00000662, 0x0000056A, 0x0003003E, 
-0x00000661, 0x00000662, 0x00070039, 0x0000000C, 0x00000663, 0x000000CF, 0x0000065C, 0x0000065F, 
-0x00000661, 0x0003003E, 0x0000065B, 0x00000663, 0x0004003D, 0x0000000C, 0x00000665, 0x00000652, 
-0x0004003D, 0x0000000C, 0x00000666, 0x0000065B, 0x00050081, 0x0000000C, 0x00000667, 0x00000665, 
-0x00000666, 0x00050041, 0x0000000D, 0x00000668, 0x0000056A, 0x000001DE, 0x0004003D, 0x0000000C, 
-0x00000669, 0x00000668, 0x00050081, 0x0000000C, 0x0000066A, 0x00000667, 0x00000669, 0x0003003E, 
-0x00000664, 0x0000066A, 0x0004003D, 0x0000000C, 0x0000066D, 0x00000664, 0x00050051, 0x00000006, 
-0x0000066E, 0x0000066D, 0x00000000, 0x00050051, 0x00000006, 0x0000066F, 0x0000066D, 0x00000001, 
-0x00050051, 0x00000006, 0x00000670, 0x0000066D, 0x00000002, 0x00070050, 0x00000012, 0x00000671, 
-0x0000066E, 0x0000066F, 0x00000670, 0x000000D3, 0x0003003E, 0x0000066C, 0x00000671, 0x00050041, 
-0x0000030D, 0x00000673, 0x000002AC, 0x00000672, 0x0004003D, 0x00000083, 0x00000674, 0x00000673, 
-0x000500AD, 0x000001E3, 0x00000675, 0x00000674, 0x000001E7, 0x000300F7, 0x00000677, 0x00000000, 
-0x000400FA, 0x00000675, 0x00000676, 0x00000677, 0x000200F8, 0x00000676, 0x00050041, 0x0000030D, 
-0x00000678, 0x000002AC, 0x00000672, 0x0004003D, 0x00000083, 0x00000679, 0x00000678, 0x000300F7, 
-0x00000681, 0x00000000, 0x001100FB, 0x00000679, 0x00000681, 0x00000001, 0x0000067A, 0x00000002, 
-0x0000067B, 0x00000003, 0x0000067C, 0x00000004, 0x0000067D, 0x00000005, 0x0000067E, 0x00000006, 
-0x0000067F, 0x00000007, 0x00000680, 0x000200F8, 0x0000067A, 0x00050041, 0x00000013, 0x00000682, 
-0x0000056A, 0x000001E7, 0x0004003D, 0x00000012, 0x00000683, 0x00000682, 0x0003003E, 0x0000066C, 
-0x00000683, 0x000200F9, 0x00000681, 0x000200F8, 0x0000067B, 0x00050041, 0x00000007, 0x00000685, 
-0x0000056A, 0x000001FD, 0x0004003D, 0x00000006, 0x00000686, 0x00000685, 0x00060050, 0x0000000C, 
-0x00000687, 0x00000686, 0x00000686, 0x00000686, 0x00050051, 0x00000006, 0x00000688, 0x00000687, 
-0x00000000, 0x00050051, 0x00000006, 0x00000689, 0x00000687, 0x00000001, 0x00050051, 0x00000006, 
-0x0000068A, 0x00000687, 0x00000002, 0x00070050, 0x00000012, 0x0000068B, 0x00000688, 0x00000689, 
-0x0000068A, 0x000000D3, 0x0003003E, 0x0000066C, 0x0000068B, 0x000200F9, 0x00000681, 0x000200F8, 
-0x0000067C, 0x00050041, 0x00000007, 0x0000068D, 0x0000056A, 0x000003E6, 0x0004003D, 0x00000006, 
-0x0000068E, 0x0000068D, 0x00060050, 0x0000000C, 0x0000068F, 0x0000068E, 0x0000068E, 0x0000068E, 
-0x00050051, 0x00000006, 0x00000690, 0x0000068F, 0x00000000, 0x00050051, 0x00000006, 0x00000691, 
-0x0000068F, 0x00000001, 0x00050051, 0x00000006, 0x00000692, 0x0000068F, 0x00000002, 0x00070050, 
-0x00000012, 0x00000693, 0x00000690, 0x00000691, 0x00000692, 0x000000D3, 0x0003003E, 0x0000066C, 
-0x00000693, 0x000200F9, 0x00000681, 0x000200F8, 0x0000067D, 0x00050041, 0x00000007, 0x00000695, 
-0x0000056A, 0x00000226, 0x0004003D, 0x00000006, 0x00000696, 0x00000695, 0x00060050, 0x0000000C, 
-0x00000697, 0x00000696, 0x00000696, 0x00000696, 0x00050051, 0x00000006, 0x00000698, 0x00000697, 
-0x00000000, 0x00050051, 0x00000006, 0x00000699, 0x00000697, 0x00000001, 0x00050051, 0x00000006, 
-0x0000069A, 0x00000697, 0x00000002, 0x00070050, 0x00000012, 0x0000069B, 0x00000698, 0x00000699, 
-0x0000069A, 0x000000D3, 0x0003003E, 0x0000066C, 0x0000069B, 0x000200F9, 0x00000681, 0x000200F8, 
-0x0000067E, 0x00050041, 0x0000000D, 0x0000069D, 0x0000056A, 0x000001DE, 0x0004003D, 0x0000000C, 
-0x0000069E, 0x0000069D, 0x00050051, 0x00000006, 0x0000069F, 0x0000069E, 0x00000000, 0x00050051, 
-0x00000006, 0x000006A0, 0x0000069E, 0x00000001, 0x00050051, 0x00000006, 0x000006A1, 0x0000069E, 
-0x00000002, 0x00070050, 0x00000012, 0x000006A2, 0x0000069F, 0x000006A0, 0x000006A1, 0x000000D3, 
-0x0003003E, 0x0000066C, 0x000006A2, 0x000200F9, 0x00000681, 0x000200F8, 0x0000067F, 0x00050041, 
-0x0000000D, 0x000006A4, 0x0000056A, 0x00000208, 0x0004003D, 0x0000000C, 0x000006A5, 0x000006A4, 
-0x00050051, 0x00000006, 0x000006A6, 0x000006A5, 0x00000000, 0x00050051, 0x00000006, 0x000006A7, 
-0x000006A5, 0x00000001, 0x00050051, 0x00000006, 0x000006A8, 0x000006A5, 0x00000002, 0x00070050, 
-0x00000012, 0x000006A9, 0x000006A6, 0x000006A7, 0x000006A8, 0x000000D3, 0x0003003E, 0x0000066C, 
-0x000006A9, 0x000200F9, 0x00000681, 0x000200F8, 0x00000680, 0x0004003D, 0x0000000C, 0x000006AD, 
-0x000005E7, 0x0003003E, 0x000006AC, 0x000006AD, 0x00050039, 0x00000083, 0x000006AE, 0x000000A0, 
-0x000006AC, 0x0003003E, 0x000006AB, 0x000006AE, 0x0004003D, 0x00000083, 0x000006AF, 0x000006AB, 
-0x000300F7, 0x000006B4, 0x00000000, 0x000B00FB, 0x000006AF, 0x000006B4, 0x00000000, 0x000006B0, 
-0x00000001, 0x000006B1, 0x00000002, 0x000006B2, 0x00000003, 0x000006B3, 0x000200F8, 0x000006B0, 
-0x0004003D, 0x00000012, 0x000006B5, 0x0000066C, 0x00050085, 0x00000012, 0x000006B9, 0x000006B5, 
-0x000006B8, 0x0003003E, 0x0000066C, 0x000006B9, 0x000200F9, 0x000006B4, 0x000200F8, 0x000006B1, 
-0x0004003D, 0x00000012, 0x000006BB, 0x0000066C, 0x00050085, 0x00000012, 0x000006BD, 0x000006BB, 
-0x000006BC, 0x0003003E, 0x0000066C, 0x000006BD, 0x000200F9, 0x000006B4, 0x000200F8, 0x000006B2, 
-0x0004003D, 0x00000012, 0x000006BF, 0x0000066C, 0x00050085, 0x00000012, 0x000006C1, 0x000006BF, 
-0x000006C0, 0x0003003E, 0x0000066C, 0x000006C1, 0x000200F9, 0x000006B4, 0x000200F8, 0x000006B3, 
-0x0004003D, 0x00000012, 0x000006C3, 0x0000066C, 0x00050085, 0x00000012, 0x000006C5, 0x000006C3, 
-0x000006C4, 0x0003003E, 0x0000066C, 0x000006C5, 0x000200F9, 0x000006B4, 0x000200F8, 0x000006B4, 
-0x000200F9, 0x00000681, 0x000200F8, 0x00000681, 0x000200F9, 0x00000677, 0x000200F8, 0x00000677, 
-0x000100FD, 0x00010038, 0x00050036, 0x00000006, 0x0000000A, 0x00000000, 0x00000008, 0x00030037, 
-0x00000007, 0x00000009, 0x000200F8, 0x0000000B, 0x0004003B, 0x00000007, 0x000000D6, 0x00000007, 
-0x0004003D, 0x00000006, 0x000000D7, 0x00000009, 0x0004003D, 0x00000006, 0x000000D8, 0x00000009, 
-0x00050085, 0x00000006, 0x000000D9, 0x000000D7, 0x000000D8, 0x0003003E, 0x000000D6, 0x000000D9, 
-0x0004003D, 0x00000006, 0x000000DA, 0x000000D6, 0x0004003D, 0x00000006, 0x000000DB, 0x000000D6, 
-0x00050085, 0x00000006, 0x000000DC, 0x000000DA, 0x000000DB, 0x0004003D, 0x00000006, 0x000000DD, 
-0x00000009, 0x00050085, 0x00000006, 0x000000DE, 0x000000DC, 0x000000DD, 0x000200FE, 0x000000DE, 
-0x00010038, 0x00050036, 0x0000000C, 0x00000010, 0x00000000, 0x0000000E, 0x00030037, 0x0000000D, 
-0x0000000F, 0x000200F8, 0x00000011, 0x0004003D, 0x0000000C, 0x000000E1, 0x0000000F, 0x0007000C, 
-0x0000000C, 0x000000E4, 0x00000001, 0x0000001A, 0x000000E1, 0x000000E3, 0x000200FE, 0x000000E4, 
-0x00010038, 0x00050036, 0x00000012, 0x00000016, 0x00000000, 0x00000014, 0x00030037, 0x00000013, 
-0x00000015, 0x000200F8, 0x00000017, 0x0004003B, 0x0000000D, 0x000000E7, 0x00000007, 0x0004003D, 
-0x00000012, 0x000000E8, 0x00000015, 0x0008004F, 0x0000000C, 0x000000E9, 0x000000E8, 0x000000E8, 
-0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000000E7, 0x000000E9, 0x00050039, 0x0000000C, 
-0x000000EA, 0x00000010, 0x000000E7, 0x00050041, 0x00000007, 0x000000ED, 0x00000015, 0x000000EC, 
-0x0004003D, 0x00000006, 0x000000EE, 0x000000ED, 0x00050051, 0x00000006, 0x000000EF, 0x000000EA, 
-0x00000000, 0x00050051, 0x00000006, 0x000000F0, 0x000000EA, 0x00000001, 0x00050051, 0x00000006, 
-0x000000F1, 0x000000EA, 0x00000002, 0x00070050, 0x00000012, 0x000000F2, 0x000000EF, 0x000000F0, 
-0x000000F1, 0x000000EE, 0x000200FE, 0x000000F2, 0x00010038, 0x00050036, 0x00000006, 0x00000019, 
-0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000018, 0x000200F8, 0x0000001A, 0x0004003D, 
-0x00000006, 0x000000F5, 0x00000018, 0x0008000C, 0x00000006, 0x000000F7, 0x00000001, 0x0000002B, 
-0x000000F5, 0x000000F6, 0x000000D3, 0x000200FE, 0x000000F7, 0x00010038, 0x00050036, 0x00000006, 
-0x00000020, 0x00000000, 0x0000001B, 0x00030037, 0x00000007, 0x0000001C, 0x00030037, 0x00000007, 
-0x0000001D, 0x00030037, 0x0000000C, 0x0000001E, 0x00030037, 0x0000000C, 0x0000001F, 0x000200F8, 
-0x00000021, 0x0004003B, 0x0000000D, 0x000000FA, 0x00000007, 0x0004003B, 0x00000007, 0x000000FC, 
-0x00000007, 0x0004003B, 0x00000007, 0x00000100, 0x00000007, 0x0004003B, 0x00000007, 0x0000010A, 
-0x00000007, 0x0007000C, 0x0000000C, 0x000000FB, 0x00000001, 0x00000044, 0x0000001E, 0x0000001F, 
-0x0003003E, 0x000000FA, 0x000000FB, 0x0004003D, 0x00000006, 0x000000FD, 0x0000001D, 0x0004003D, 
-0x00000006, 0x000000FE, 0x0000001C, 0x00050085, 0x00000006, 0x000000FF, 0x000000FD, 0x000000FE, 
-0x0003003E, 0x000000FC, 0x000000FF, 0x0004003D, 0x00000006, 0x00000101, 0x0000001C, 0x0004003D, 
-0x0000000C, 0x00000102, 0x000000FA, 0x0004003D, 0x0000000C, 0x00000103, 0x000000FA, 0x00050094, 
-0x00000006, 0x00000104, 0x00000102, 0x00000103, 0x0004003D, 0x00000006, 0x00000105, 0x000000FC, 
-0x0004003D, 0x00000006, 0x00000106, 0x000000FC, 0x00050085, 0x00000006, 0x00000107, 0x00000105, 
-0x00000106, 0x00050081, 0x00000006, 0x00000108, 0x00000104, 0x00000107, 0x00050088, 0x00000006, 
-0x00000109, 0x00000101, 0x00000108, 0x0003003E, 0x00000100, 0x00000109, 0x0004003D, 0x00000006, 
-0x0000010B, 0x00000100, 0x0004003D, 0x00000006, 0x0000010C, 0x00000100, 0x00050085, 0x00000006, 
-0x0000010D, 0x0000010B, 0x0000010C, 0x00050085, 0x00000006, 0x0000010F, 0x0000010D, 0x0000010E, 
-0x0003003E, 0x0000010A, 0x0000010F, 0x0004003D, 0x00000006, 0x00000110, 0x0000010A, 0x0007000C, 
-0x00000006, 0x00000112, 0x00000001, 0x00000025, 0x00000110, 0x00000111, 0x000200FE, 0x00000112, 
-0x00010038, 0x00050036, 0x0000000C, 0x00000026, 0x00000000, 0x00000022, 0x00030037, 0x0000000C, 
-0x00000023, 0x00030037, 0x00000007, 0x00000024, 0x00030037, 0x00000007, 0x00000025, 0x000200F8, 
-0x00000027, 0x0004003B, 0x00000007, 0x0000011A, 0x00000007, 0x0004003D, 0x00000006, 0x00000115, 
-0x00000024, 0x00060050, 0x0000000C, 0x00000116, 0x00000115, 0x00000115, 0x00000115, 0x00050083, 
-0x0000000C, 0x00000117, 0x00000116, 0x00000023, 0x0004003D, 0x00000006, 0x00000118, 0x00000025, 
-0x00050083, 0x00000006, 0x00000119, 0x000000D3, 0x00000118, 0x0003003E, 0x0000011A, 0x00000119, 
-0x00050039, 0x00000006, 0x0000011B, 0x0000000A, 0x0000011A, 0x0005008E, 0x0000000C, 0x0000011C, 
-0x00000117, 0x0000011B, 0x00050081, 0x0000000C, 0x0000011D, 0x00000023, 0x0000011C, 0x000200FE, 
-0x0000011D, 0x00010038, 0x00050036, 0x00000006, 0x0000002C, 0x00000000, 0x00000028, 0x00030037, 
-0x00000007, 0x00000029, 0x00030037, 0x00000007, 0x0000002A, 0x00030037, 0x00000007, 0x0000002B, 
-0x000200F8, 0x0000002D, 0x0004003D, 0x00000006, 0x00000120, 0x0000002A, 0x0004003D, 0x00000006, 
-0x00000121, 0x0000002B, 0x0004003D, 0x00000006, 0x00000122, 0x0000002A, 0x00050083, 0x00000006, 
-0x00000123, 0x00000121, 0x00000122, 0x0004003D, 0x00000006, 0x00000124, 0x00000029, 0x00050083, 
-0x00000006, 0x00000125, 0x000000D3, 0x00000124, 0x0007000C, 0x00000006, 0x00000127, 0x00000001, 
-0x0000001A, 0x00000125, 0x00000126, 0x00050085, 0x00000006, 0x00000128, 0x00000123, 0x00000127, 
-0x00050081, 0x00000006, 0x00000129, 0x00000120, 0x00000128, 0x000200FE, 0x00000129, 0x00010038, 
-0x00050036, 0x00000006, 0x00000033, 0x00000000, 0x0000002E, 0x00030037, 0x00000007, 0x0000002F, 
-0x00030037, 0x00000007, 0x00000030, 0x00030037, 0x00000007, 0x00000031, 0x00030037, 0x00000007, 
-0x00000032, 0x000200F8, 0x00000034, 0x0004003B, 0x00000007, 0x0000012C, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000136, 0x00000007, 0x0004003B, 0x00000007, 0x00000137, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000138, 0x00000007, 0x0004003B, 0x00000007, 0x0000013A, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000013D, 0x00000007, 0x0004003B, 0x00000007, 0x0000013E, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000013F, 0x00000007, 0x0004003B, 0x00000007, 0x00000141, 0x00000007, 0x0004003D, 
-0x00000006, 0x0000012F, 0x0000002F, 0x00050085, 0x00000006, 0x00000130, 0x0000012E, 0x0000012F, 
-0x0004003D, 0x00000006, 0x00000131, 0x00000032, 0x00050085, 0x00000006, 0x00000132, 0x00000130, 
-0x00000131, 0x0004003D, 0x00000006, 0x00000133, 0x00000032, 0x00050085, 0x00000006, 0x00000134, 
-0x00000132, 0x00000133, 0x00050081, 0x00000006, 0x00000135, 0x0000012D, 0x00000134, 0x0003003E, 
-0x0000012C, 0x00000135, 0x0003003E, 0x00000137, 0x000000D3, 0x0004003D, 0x00000006, 0x00000139, 
-0x0000012C, 0x0003003E, 0x00000138, 0x00000139, 0x0004003D, 0x00000006, 0x0000013B, 0x00000031, 
-0x0003003E, 0x0000013A, 0x0000013B, 0x00070039, 0x00000006, 0x0000013C, 0x0000002C, 0x00000137, 
-0x00000138, 0x0000013A, 0x0003003E, 0x00000136, 0x0000013C, 0x0003003E, 0x0000013E, 0x000000D3, 
-0x0004003D, 0x00000006, 0x00000140, 0x0000012C, 0x0003003E, 0x0000013F, 0x00000140, 0x0004003D, 
-0x00000006, 0x00000142, 0x00000030, 0x0003003E, 0x00000141, 0x00000142, 0x00070039, 0x00000006, 
-0x00000143, 0x0000002C, 0x0000013E, 0x0000013F, 0x00000141, 0x0003003E, 0x0000013D, 0x00000143, 
-0x0004003D, 0x00000006, 0x00000144, 0x00000136, 0x0004003D, 0x00000006, 0x00000145, 0x0000013D, 
-0x00050085, 0x00000006, 0x00000146, 0x00000144, 0x00000145, 0x00050085, 0x00000006, 0x00000147, 
-0x00000146, 0x0000010E, 0x000200FE, 0x00000147, 0x00010038, 0x00050036, 0x00000006, 0x00000038, 
-0x00000000, 0x00000028, 0x00030037, 0x00000007, 0x00000035, 0x00030037, 0x00000007, 0x00000036, 
-0x00030037, 0x00000007, 0x00000037, 0x000200F8, 0x00000039, 0x0004003B, 0x00000007, 0x0000014A, 
-0x00000007, 0x0004003B, 0x00000007, 0x0000014E, 0x00000007, 0x0004003B, 0x00000007, 0x0000015C, 
-0x00000007, 0x0004003D, 0x00000006, 0x0000014B, 0x00000037, 0x0004003D, 0x00000006, 0x0000014C, 
-0x00000037, 0x00050085, 0x00000006, 0x0000014D, 0x0000014B, 0x0000014C, 0x0003003E, 0x0000014A, 
-0x0000014D, 0x0004003D, 0x00000006, 0x0000014F, 0x00000035, 0x0004003D, 0x00000006, 0x00000150, 
-0x00000036, 0x0004007F, 0x00000006, 0x00000151, 0x00000150, 0x0004003D, 0x00000006, 0x00000152, 
-0x0000014A, 0x00050085, 0x00000006, 0x00000153, 0x00000151, 0x00000152, 0x0004003D, 0x00000006, 
-0x00000154, 0x00000036, 0x00050081, 0x00000006, 0x00000155, 0x00000153, 0x00000154, 0x0004003D, 
-0x00000006, 0x00000156, 0x00000036, 0x00050085, 0x00000006, 0x00000157, 0x00000155, 0x00000156, 
-0x0004003D, 0x00000006, 0x00000158, 0x0000014A, 0x00050081, 0x00000006, 0x00000159, 0x00000157, 
-0x00000158, 0x0006000C, 0x00000006, 0x0000015A, 0x00000001, 0x0000001F, 0x00000159, 0x00050085, 
-0x00000006, 0x0000015B, 0x0000014F, 0x0000015A, 0x0003003E, 0x0000014E, 0x0000015B, 0x0004003D, 
-0x00000006, 0x0000015D, 0x00000036, 0x0004003D, 0x00000006, 0x0000015E, 0x00000035, 0x0004007F, 
-0x00000006, 0x0000015F, 0x0000015E, 0x0004003D, 0x00000006, 0x00000160, 0x0000014A, 0x00050085, 
-0x00000006, 0x00000161, 0x0000015F, 0x00000160, 0x0004003D, 0x00000006, 0x00000162, 0x00000035, 
-0x00050081, 0x00000006, 0x00000163, 0x00000161, 0x00000162, 0x0004003D, 0x00000006, 0x00000164, 
-0x00000035, 0x00050085, 0x00000006, 0x00000165, 0x00000163, 0x00000164, 0x0004003D, 0x00000006, 
-0x00000166, 0x0000014A, 0x00050081, 0x00000006, 0x00000167, 0x00000165, 0x00000166, 0x0006000C, 
-0x00000006, 0x00000168, 0x00000001, 0x0000001F, 0x00000167, 0x00050085, 0x00000006, 0x00000169, 
-0x0000015D, 0x00000168, 0x0003003E, 0x0000015C, 0x00000169, 0x0004003D, 0x00000006, 0x0000016A, 
-0x0000015C, 0x0004003D, 0x00000006, 0x0000016B, 0x0000014E, 0x00050081, 0x00000006, 0x0000016C, 
-0x0000016A, 0x0000016B, 0x00050088, 0x00000006, 0x0000016D, 0x0000012D, 0x0000016C, 0x000200FE, 
-0x0000016D, 0x00010038, 0x00050036, 0x00000006, 0x0000003D, 0x00000000, 0x0000003A, 0x00030037, 
-0x00000007, 0x0000003B, 0x00030037, 0x00000007, 0x0000003C, 0x000200F8, 0x0000003E, 0x0004003B, 
-0x00000007, 0x00000170, 0x00000007, 0x0004003B, 0x00000007, 0x00000176, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000017A, 0x00000007, 0x0004003D, 0x00000006, 0x00000171, 0x0000003C, 0x0007000C, 
-0x00000006, 0x00000173, 0x00000001, 0x00000025, 0x00000171, 0x00000172, 0x00050083, 0x00000006, 
-0x00000174, 0x000000D3, 0x00000173, 0x0006000C, 0x00000006, 0x00000175, 0x00000001, 0x00000020, 
-0x00000174, 0x0003003E, 0x00000170, 0x00000175, 0x0004003D, 0x00000006, 0x00000177, 0x0000003B, 
-0x0004003D, 0x00000006, 0x00000178, 0x00000170, 0x00050085, 0x00000006, 0x00000179, 0x00000177, 
-0x00000178, 0x0003003E, 0x0000017A, 0x00000179, 0x00050039, 0x00000006, 0x0000017B, 0x00000019, 
-0x0000017A, 0x0003003E, 0x00000176, 0x0000017B, 0x0004003D, 0x00000006, 0x0000017C, 0x00000176, 
-0x0004003D, 0x00000006, 0x0000017D, 0x00000176, 0x00050085, 0x00000006, 0x0000017E, 0x0000017C, 
-0x0000017D, 0x000200FE, 0x0000017E, 0x00010038, 0x00050036, 0x00000006, 0x00000043, 0x00000000, 
-0x0000002E, 0x00030037, 0x00000007, 0x0000003F, 0x00030037, 0x00000007, 0x00000040, 0x00030037, 
-0x00000007, 0x00000041, 0x00030037, 0x00000007, 0x00000042, 0x000200F8, 0x00000044, 0x0004003B, 
-0x00000007, 0x00000181, 0x00000007, 0x0004003B, 0x00000007, 0x00000183, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000185, 0x00000007, 0x0004003B, 0x00000007, 0x00000187, 0x00000007, 0x0004003D, 
-0x00000006, 0x00000182, 0x0000003F, 0x0003003E, 0x00000181, 0x00000182, 0x0004003D, 0x00000006, 
-0x00000184, 0x00000040, 0x0003003E, 0x00000183, 0x00000184, 0x0004003D, 0x00000006, 0x00000186, 
-0x00000041, 0x0003003E, 0x00000185, 0x00000186, 0x0004003D, 0x00000006, 0x00000188, 0x00000042, 
-0x0003003E, 0x00000187, 0x00000188, 0x00080039, 0x00000006, 0x00000189, 0x00000033, 0x00000181, 
-0x00000183, 0x00000185, 0x00000187, 0x000200FE, 0x00000189, 0x00010038, 0x00050036, 0x00000006, 
-0x00000046, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000045, 0x000200F8, 0x00000047, 
-0x0004003D, 0x00000006, 0x0000018C, 0x00000045, 0x0007000C, 0x00000006, 0x0000018E, 0x00000001, 
-0x00000028, 0x0000018C, 0x0000018D, 0x000200FE, 0x0000018E, 0x00010038, 0x00050036, 0x0000000C, 
-0x0000004B, 0x00000000, 0x00000048, 0x00030037, 0x00000012, 0x00000049, 0x00030037, 0x00000007, 
-0x0000004A, 0x000200F8, 0x0000004C, 0x0008004F, 0x0000000C, 0x00000191, 0x00000049, 0x00000049, 
-0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x00000006, 0x00000192, 0x0000004A, 0x00050083, 
-0x00000006, 0x00000193, 0x000000D3, 0x00000192, 0x0005008E, 0x0000000C, 0x00000194, 0x00000191, 
-0x00000193, 0x000200FE, 0x00000194, 0x00010038, 0x00050036, 0x0000000C, 0x00000051, 0x00000000, 
-0x0000004D, 0x00030037, 0x00000012, 0x0000004E, 0x00030037, 0x00000007, 0x0000004F, 0x00030037, 
-0x00000007, 0x00000050, 0x000200F8, 0x00000052, 0x0008004F, 0x0000000C, 0x00000197, 0x0000004E, 
-0x0000004E, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x00000006, 0x00000198, 0x0000004F, 
-0x0005008E, 0x0000000C, 0x00000199, 0x00000197, 0x00000198, 0x0004003D, 0x00000006, 0x0000019A, 
-0x00000050, 0x0004003D, 0x00000006, 0x0000019B, 0x0000004F, 0x00050083, 0x00000006, 0x0000019C, 
-0x000000D3, 0x0000019B, 0x00050085, 0x00000006, 0x0000019D, 0x0000019A, 0x0000019C, 0x00060050, 
-0x0000000C, 0x0000019E, 0x0000019D, 0x0000019D, 0x0000019D, 0x00050081, 0x0000000C, 0x0000019F, 
-0x00000199, 0x0000019E, 0x000200FE, 0x0000019F, 0x00010038, 0x00050036, 0x00000006, 0x00000054, 
-0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000053, 0x000200F8, 0x00000055, 0x0004003D, 
-0x00000006, 0x000001A3, 0x00000053, 0x00050085, 0x00000006, 0x000001A4, 0x000001A2, 0x000001A3, 
-0x0004003D, 0x00000006, 0x000001A5, 0x00000053, 0x00050085, 0x00000006, 0x000001A6, 0x000001A4, 
-0x000001A5, 0x000200FE, 0x000001A6, 0x00010038, 0x00050036, 0x00000006, 0x00000057, 0x00000000, 
-0x00000008, 0x00030037, 0x00000007, 0x00000056, 0x000200F8, 0x00000058, 0x0004003D, 0x00000006, 
-0x000001A9, 0x00000056, 0x0004003D, 0x00000006, 0x000001AA, 0x00000056, 0x00050085, 0x00000006, 
-0x000001AB, 0x000001A9, 0x000001AA, 0x000200FE, 0x000001AB, 0x00010038, 0x00050036, 0x00000006, 
-0x0000005D, 0x00000000, 0x0000001B, 0x00030037, 0x00000007, 0x00000059, 0x00030037, 0x00000007, 
-0x0000005A, 0x00030037, 0x0000000C, 0x0000005B, 0x00030037, 0x0000000C, 0x0000005C, 0x000200F8, 
-0x0000005E, 0x0004003B, 0x00000007, 0x000001AE, 0x00000007, 0x0004003B, 0x00000007, 0x000001B0, 
-0x00000007, 0x0004003D, 0x00000006, 0x000001AF, 0x00000059, 0x0003003E, 0x000001AE, 0x000001AF, 
-0x0004003D, 0x00000006, 0x000001B1, 0x0000005A, 0x0003003E, 0x000001B0, 0x000001B1, 0x00080039, 
-0x00000006, 0x000001B2, 0x00000020, 0x000001AE, 0x000001B0, 0x0000005C, 0x0000005B, 0x000200FE, 
-0x000001B2, 0x00010038, 0x00050036, 0x00000006, 0x00000062, 0x00000000, 0x00000028, 0x00030037, 
-0x00000007, 0x0000005F, 0x00030037, 0x00000007, 0x00000060, 0x00030037, 0x00000007, 0x00000061, 
-0x000200F8, 0x00000063, 0x0004003B, 0x00000007, 0x000001B5, 0x00000007, 0x0004003B, 0x00000007, 
-0x000001B7, 0x00000007, 0x0004003B, 0x00000007, 0x000001B9, 0x00000007, 0x0004003D, 0x00000006, 
-0x000001B6, 0x0000005F, 0x0003003E, 0x000001B5, 0x000001B6, 0x0004003D, 0x00000006, 0x000001B8, 
-0x00000060, 0x0003003E, 0x000001B7, 0x000001B8, 0x0004003D, 0x00000006, 0x000001BA, 0x00000061, 
-0x0003003E, 0x000001B9, 0x000001BA, 0x00070039, 0x00000006, 0x000001BB, 0x00000038, 0x000001B5, 
-0x000001B7, 0x000001B9, 0x000200FE, 0x000001BB, 0x00010038, 0x00050036, 0x0000000C, 0x00000067, 
-0x00000000, 0x00000064, 0x00030037, 0x0000000C, 0x00000065, 0x00030037, 0x00000007, 0x00000066, 
-0x000200F8, 0x00000068, 0x0004003B, 0x00000007, 0x000001BE, 0x00000007, 0x0004003B, 0x00000007, 
-0x000001C2, 0x00000007, 0x0004003B, 0x00000007, 0x000001C4, 0x00000007, 0x0004003B, 0x00000007, 
-0x000001C6, 0x00000007, 0x00050094, 0x00000006, 0x000001C1, 0x00000065, 0x000001C0, 0x0003003E, 
-0x000001C2, 0x000001C1, 0x00050039, 0x00000006, 0x000001C3, 0x00000019, 0x000001C2, 0x0003003E, 
-0x000001BE, 0x000001C3, 0x0004003D, 0x00000006, 0x000001C5, 0x000001BE, 0x0003003E, 0x000001C4, 
-0x000001C5, 0x0004003D, 0x00000006, 0x000001C7, 0x00000066, 0x0003003E, 0x000001C6, 0x000001C7, 
-0x00070039, 0x0000000C, 0x000001C8, 0x00000026, 0x00000065, 0x000001C4, 0x000001C6, 0x000200FE, 
-0x000001C8, 0x00010038, 0x00050036, 0x0000000C, 0x0000006D, 0x00000000, 0x00000069, 0x00030037, 
-0x0000000D, 0x0000006A, 0x00030037, 0x00000007, 0x0000006B, 0x00030037, 0x00000007, 0x0000006C, 
-0x000200F8, 0x0000006E, 0x0004003D, 0x0000000C, 0x000001CB, 0x0000006A, 0x0004003D, 0x00000006, 
-0x000001CC, 0x0000006C, 0x00050083, 0x00000006, 0x000001CD, 0x000000D3, 0x000001CC, 0x00060050, 
-0x0000000C, 0x000001CE, 0x000001CD, 0x000001CD, 0x000001CD, 0x0004003D, 0x0000000C, 0x000001CF, 
-0x0000006A, 0x0007000C, 0x0000000C, 0x000001D0, 0x00000001, 0x00000028, 0x000001CE, 0x000001CF, 
-0x0004003D, 0x0000000C, 0x000001D1, 0x0000006A, 0x00050083, 0x0000000C, 0x000001D2, 0x000001D0, 
-0x000001D1, 0x0004003D, 0x00000006, 0x000001D3, 0x0000006B, 0x00050083, 0x00000006, 0x000001D4, 
-0x000000D3, 0x000001D3, 0x0007000C, 0x00000006, 0x000001D5, 0x00000001, 0x00000028, 0x000001D4, 
-0x000000F6, 0x0007000C, 0x00000006, 0x000001D6, 0x00000001, 0x0000001A, 0x000001D5, 0x00000126, 
-0x0005008E, 0x0000000C, 0x000001D7, 0x000001D2, 0x000001D6, 0x00050081, 0x0000000C, 0x000001D8, 
-0x000001CB, 0x000001D7, 0x000200FE, 0x000001D8, 0x00010038, 0x00050036, 0x00000012, 0x00000070, 
-0x00000000, 0x0000006F, 0x000200F8, 0x00000071, 0x0004003B, 0x00000013, 0x00000202, 0x00000007, 
-0x00050041, 0x000001DF, 0x000001E0, 0x000001DD, 0x000001DE, 0x0004003D, 0x00000006, 0x000001E1, 
-0x000001E0, 0x000500B8, 0x000001E3, 0x000001E4, 0x000001E1, 0x000001E2, 0x000300F7, 0x000001E6, 
-0x00000000, 0x000400FA, 0x000001E4, 0x000001E5, 0x000001E6, 0x000200F8, 0x000001E5, 0x00050041, 
-0x000001E8, 0x000001E9, 0x000001DD, 0x000001E7, 0x0004003D, 0x00000012, 0x000001EA, 0x000001E9, 
-0x000200FE, 0x000001EA, 0x000200F8, 0x000001E6, 0x00050041, 0x000001DF, 0x000001EC, 0x000001DD, 
-0x000001DE, 0x0004003D, 0x00000006, 0x000001ED, 0x000001EC, 0x00050083, 0x00000006, 0x000001EE, 
-0x000000D3, 0x000001ED, 0x00050041, 0x000001E8, 0x000001EF, 0x000001DD, 0x000001E7, 0x0004003D, 
-0x00000012, 0x000001F0, 0x000001EF, 0x0005008E, 0x00000012, 0x000001F1, 0x000001F0, 0x000001EE, 
-0x00050041, 0x000001DF, 0x000001F2, 0x000001DD, 0x000001DE, 0x0004003D, 0x00000006, 0x000001F3, 
-0x000001F2, 0x0004003D, 0x000001F5, 0x000001F8, 0x000001F7, 0x00050041, 0x000001FE, 0x000001FF, 
-0x000001FC, 0x000001FD, 0x0004003D, 0x0000007D, 0x00000200, 0x000001FF, 0x00050057, 0x00000012, 
-0x00000201, 0x000001F8, 0x00000200, 0x0003003E, 0x00000202, 0x00000201, 0x00050039, 0x00000012, 
-0x00000203, 0x00000016, 0x00000202, 0x0005008E, 0x00000012, 0x00000204, 0x00000203, 0x000001F3, 
-0x00050081, 0x00000012, 0x00000205, 0x000001F1, 0x00000204, 0x000200FE, 0x00000205, 0x00010038, 
-0x00050036, 0x0000000C, 0x00000073, 0x00000000, 0x00000072, 0x000200F8, 0x00000074, 0x00050041, 
-0x000001DF, 0x00000209, 0x000001DD, 0x00000208, 0x0004003D, 0x00000006, 0x0000020A, 0x00000209, 
-0x000500B8, 0x000001E3, 0x0000020B, 0x0000020A, 0x000001E2, 0x000300F7, 0x0000020D, 0x00000000, 
-0x000400FA, 0x0000020B, 0x0000020C, 0x0000020D, 0x000200F8, 0x0000020C, 0x00050041, 0x000001DF, 
-0x0000020F, 0x000001DD, 0x0000020E, 0x0004003D, 0x00000006, 0x00000210, 0x0000020F, 0x00060050, 
-0x0000000C, 0x00000211, 0x00000210, 0x00000210, 0x00000210, 0x000200FE, 0x00000211, 0x000200F8, 
-0x0000020D, 0x00050041, 0x000001DF, 0x00000213, 0x000001DD, 0x00000208, 0x0004003D, 0x00000006, 
-0x00000214, 0x00000213, 0x00050083, 0x00000006, 0x00000215, 0x000000D3, 0x00000214, 0x00050041, 
-0x000001DF, 0x00000216, 0x000001DD, 0x0000020E, 0x0004003D, 0x00000006, 0x00000217, 0x00000216, 
-0x00050085, 0x00000006, 0x00000218, 0x00000215, 0x00000217, 0x00050041, 0x000001DF, 0x00000219, 
-0x000001DD, 0x00000208, 0x0004003D, 0x00000006, 0x0000021A, 0x00000219, 0x0004003D, 0x000001F5, 
-0x0000021C, 0x0000021B, 0x00050041, 0x000001FE, 0x0000021D, 0x000001FC, 0x000001FD, 0x0004003D, 
-0x0000007D, 0x0000021E, 0x0000021D, 0x00050057, 0x00000012, 0x0000021F, 0x0000021C, 0x0000021E, 
-0x0008004F, 0x0000000C, 0x00000220, 0x0000021F, 0x0000021F, 0x00000000, 0x00000001, 0x00000002, 
-0x0005008E, 0x0000000C, 0x00000221, 0x00000220, 0x0000021A, 0x00060050, 0x0000000C, 0x00000222, 
-0x00000218, 0x00000218, 0x00000218, 0x00050081, 0x0000000C, 0x00000223, 0x00000222, 0x00000221, 
-0x000200FE, 0x00000223, 0x00010038, 0x00050036, 0x00000006, 0x00000076, 0x00000000, 0x00000075, 
-0x000200F8, 0x00000077, 0x00050041, 0x000001DF, 0x00000227, 0x000001DD, 0x00000226, 0x0004003D, 
-0x00000006, 0x00000228, 0x00000227, 0x000500B8, 0x000001E3, 0x00000229, 0x00000228, 0x000001E2, 
-0x000300F7, 0x0000022B, 0x00000000, 0x000400FA, 0x00000229, 0x0000022A, 0x0000022B, 0x000200F8, 
-0x0000022A, 0x00050041, 0x000001DF, 0x0000022C, 0x000001DD, 0x000001FD, 0x0004003D, 0x00000006, 
-0x0000022D, 0x0000022C, 0x000200FE, 0x0000022D, 0x000200F8, 0x0000022B, 0x00050041, 0x000001DF, 
-0x0000022F, 0x000001DD, 0x00000226, 0x0004003D, 0x00000006, 0x00000230, 0x0000022F, 0x00050083, 
-0x00000006, 0x00000231, 0x000000D3, 0x00000230, 0x00050041, 0x000001DF, 0x00000232, 0x000001DD, 
-0x000001FD, 0x0004003D, 0x00000006, 0x00000233, 0x00000232, 0x00050085, 0x00000006, 0x00000234, 
-0x00000231, 0x00000233, 0x00050041, 0x000001DF, 0x00000235, 0x000001DD, 0x00000226, 0x0004003D, 
-0x00000006, 0x00000236, 0x00000235, 0x0004003D, 0x000001F5, 0x00000238, 0x00000237, 0x00050041, 
-0x000001FE, 0x00000239, 0x000001FC, 0x000001FD, 0x0004003D, 0x0000007D, 0x0000023A, 0x00000239, 
-0x00050057, 0x00000012, 0x0000023B, 0x00000238, 0x0000023A, 0x00050051, 0x00000006, 0x0000023D, 
-0x0000023B, 0x00000000, 0x00050085, 0x00000006, 0x0000023E, 0x00000236, 0x0000023D, 0x00050081, 
-0x00000006, 0x0000023F, 0x00000234, 0x0000023E, 0x000200FE, 0x0000023F, 0x00010038, 0x00050036, 
-0x00000006, 0x00000078, 0x00000000, 0x00000075, 0x000200F8, 0x00000079, 0x00050041, 0x000001DF, 
-0x00000243, 0x000001DD, 0x00000242, 0x0004003D, 0x00000006, 0x00000244, 0x00000243, 0x000500B8, 
-0x000001E3, 0x00000245, 0x00000244, 0x000001E2, 0x000300F7, 0x00000247, 0x00000000, 0x000400FA, 
-0x00000245, 0x00000246, 0x00000247, 0x000200F8, 0x00000246, 0x000200FE, 0x000000D3, 0x000200F8, 
-0x00000247, 0x00050041, 0x000001DF, 0x00000249, 0x000001DD, 0x00000242, 0x0004003D, 0x00000006, 
-0x0000024A, 0x00000249, 0x00050083, 0x00000006, 0x0000024B, 0x000000D3, 0x0000024A, 0x00050041, 
-0x000001DF, 0x0000024C, 0x000001DD, 0x00000242, 0x0004003D, 0x00000006, 0x0000024D, 0x0000024C, 
-0x0004003D, 0x000001F5, 0x0000024F, 0x0000024E, 0x00050041, 0x000001FE, 0x00000250, 0x000001FC, 
-0x000001FD, 0x0004003D, 0x0000007D, 0x00000251, 0x00000250, 0x00050057, 0x00000012, 0x00000252, 
-0x0000024F, 0x00000251, 0x00050051, 0x00000006, 0x00000253, 0x00000252, 0x00000000, 0x00050085, 
-0x00000006, 0x00000254, 0x0000024D, 0x00000253, 0x00050081, 0x00000006, 0x00000255, 0x0000024B, 
-0x00000254, 0x000200FE, 0x00000255, 0x00010038, 0x00050036, 0x0000000C, 0x0000007B, 0x00000000, 
-0x0000000E, 0x00030037, 0x0000000D, 0x0000007A, 0x000200F8, 0x0000007C, 0x0004003B, 0x0000000D, 
-0x0000026F, 0x00000007, 0x00050041, 0x000001DF, 0x00000259, 0x000001DD, 0x00000258, 0x0004003D, 
-0x00000006, 0x0000025A, 0x00000259, 0x000500B8, 0x000001E3, 0x0000025B, 0x0000025A, 0x000001E2, 
-0x000300F7, 0x0000025D, 0x00000000, 0x000400FA, 0x0000025B, 0x0000025C, 0x0000025D, 0x000200F8, 
-0x0000025C, 0x00050041, 0x000001DF, 0x0000025F, 0x000001DD, 0x0000025E, 0x0004003D, 0x00000006, 
-0x00000260, 0x0000025F, 0x0004003D, 0x0000000C, 0x00000261, 0x0000007A, 0x0005008E, 0x0000000C, 
-0x00000262, 0x00000261, 0x00000260, 0x000200FE, 0x00000262, 0x000200F8, 0x0000025D, 0x00050041, 
-0x000001DF, 0x00000264, 0x000001DD, 0x0000025E, 0x0004003D, 0x00000006, 0x00000265, 0x00000264, 
-0x0004003D, 0x0000000C, 0x00000266, 0x0000007A, 0x0005008E, 0x0000000C, 0x00000267, 0x00000266, 
-0x00000265, 0x00050041, 0x000001DF, 0x00000268, 0x000001DD, 0x00000258, 0x0004003D, 0x00000006, 
-0x00000269, 0x00000268, 0x0004003D, 0x000001F5, 0x0000026B, 0x0000026A, 0x00050041, 0x000001FE, 
-0x0000026C, 0x000001FC, 0x000001FD, 0x0004003D, 0x0000007D, 0x0000026D, 0x0000026C, 0x00050057, 
-0x00000012, 0x0000026E, 0x0000026B, 0x0000026D, 0x0008004F, 0x0000000C, 0x00000270, 0x0000026E, 
-0x0000026E, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x0000026F, 0x00000270, 0x00050039, 
-0x0000000C, 0x00000271, 0x00000010, 0x0000026F, 0x0005008E, 0x0000000C, 0x00000272, 0x00000271, 
-0x00000269, 0x00050081, 0x0000000C, 0x00000273, 0x00000267, 0x00000272, 0x000200FE, 0x00000273, 
-0x00010038, 0x00050036, 0x00000006, 0x00000081, 0x00000000, 0x0000007F, 0x00030037, 0x0000007E, 
-0x00000080, 0x000200F8, 0x00000082, 0x0004003D, 0x0000007D, 0x00000276, 0x00000080, 0x00050094, 
-0x00000006, 0x0000027A, 0x00000276, 0x00000279, 0x0006000C, 0x00000006, 0x0000027B, 0x00000001, 
-0x0000000D, 0x0000027A, 0x00050085, 0x00000006, 0x0000027D, 0x0000027B, 0x0000027C, 0x0006000C, 
-0x00000006, 0x0000027E, 0x00000001, 0x0000000A, 0x0000027D, 0x000200FE, 0x0000027E, 0x00010038, 
-0x00050036, 0x0000007D, 0x00000089, 0x00000000, 0x00000085, 0x00030037, 0x00000084, 0x00000086, 
-0x00030037, 0x00000084, 0x00000087, 0x00030037, 0x00000007, 0x00000088, 0x000200F8, 0x0000008A, 
-0x0004003B, 0x00000007, 0x00000281, 0x00000007, 0x0004003B, 0x00000007, 0x00000283, 0x00000007, 
-0x0004003B, 0x00000007, 0x0000028C, 0x00000007, 0x0004003B, 0x00000007, 0x00000293, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000296, 0x00000007, 0x0003003E, 0x00000281, 0x00000282, 0x0004003D, 
-0x00000083, 0x00000284, 0x00000086, 0x0004006F, 0x00000006, 0x00000285, 0x00000284, 0x00050081, 
-0x00000006, 0x00000286, 0x00000285, 0x0000012D, 0x0006000C, 0x00000006, 0x00000287, 0x00000001, 
-0x0000001F, 0x00000286, 0x0004003D, 0x00000083, 0x00000288, 0x00000087, 0x0004006F, 0x00000006, 
-0x00000289, 0x00000288, 0x0006000C, 0x00000006, 0x0000028A, 0x00000001, 0x0000001F, 0x00000289, 
-0x00050088, 0x00000006, 0x0000028B, 0x00000287, 0x0000028A, 0x0003003E, 0x00000283, 0x0000028B, 
-0x0004003D, 0x00000083, 0x0000028D, 0x00000086, 0x0004006F, 0x00000006, 0x0000028E, 0x0000028D, 
-0x0004003D, 0x00000006, 0x0000028F, 0x00000281, 0x00050085, 0x00000006, 0x00000290, 0x0000028E, 
-0x0000028F, 0x0004003D, 0x00000006, 0x00000291, 0x00000088, 0x00050081, 0x00000006, 0x00000292, 
-0x00000290, 0x00000291, 0x0003003E, 0x0000028C, 0x00000292, 0x0004003D, 0x00000006, 0x00000294, 
-0x0000028C, 0x0006000C, 0x00000006, 0x00000295, 0x00000001, 0x0000000D, 0x00000294, 0x0003003E, 
-0x00000293, 0x00000295, 0x0004003D, 0x00000006, 0x00000297, 0x0000028C, 0x0006000C, 0x00000006, 
-0x00000298, 0x00000001, 0x0000000E, 0x00000297, 0x0003003E, 0x00000296, 0x00000298, 0x0004003D, 
-0x00000006, 0x00000299, 0x00000283, 0x0004003D, 0x00000006, 0x0000029A, 0x00000296, 0x00050085, 
-0x00000006, 0x0000029B, 0x00000299, 0x0000029A, 0x0004003D, 0x00000006, 0x0000029C, 0x00000283, 
-0x0004003D, 0x00000006, 0x0000029D, 0x00000293, 0x00050085, 0x00000006, 0x0000029E, 0x0000029C, 
-0x0000029D, 0x00050050, 0x0000007D, 0x0000029F, 0x0000029B, 0x0000029E, 0x000200FE, 0x0000029F, 
-0x00010038, 0x00050036, 0x00000006, 0x0000008F, 0x00000000, 0x0000008B, 0x00030037, 0x0000000D, 
-0x0000008C, 0x00030037, 0x0000000D, 0x0000008D, 0x00030037, 0x00000084, 0x0000008E, 0x000200F8, 
-0x00000090, 0x0004003B, 0x00000007, 0x000002A2, 0x00000007, 0x0004003B, 0x00000007, 0x000002B0, 
-0x00000007, 0x00050041, 0x000001DF, 0x000002AE, 0x000002AC, 0x000002AD, 0x0004003D, 0x00000006, 
-0x000002AF, 0x000002AE, 0x0003003E, 0x000002A2, 0x000002AF, 0x0004003D, 0x00000006, 0x000002B1, 
-0x000002A2, 0x0004003D, 0x0000000C, 0x000002B2, 0x0000008D, 0x0004003D, 0x0000000C, 0x000002B3, 
-0x0000008C, 0x00050094, 0x00000006, 0x000002B4, 0x000002B2, 0x000002B3, 0x00050083, 0x00000006, 
-0x000002B5, 0x000000D3, 0x000002B4, 0x00050085, 0x00000006, 0x000002B6, 0x000002B1, 0x000002B5, 
-0x0004003D, 0x00000006, 0x000002B7, 0x000002A2, 0x0007000C, 0x00000006, 0x000002B8, 0x00000001, 
-0x00000028, 0x000002B6, 0x000002B7, 0x0003003E, 0x000002B0, 0x000002B8, 0x0004003D, 0x00000006, 
-0x000002B9, 0x000002B0, 0x000200FE, 0x000002B9, 0x00010038, 0x00050036, 0x00000006, 0x0000009C, 
-0x00000000, 0x00000094, 0x00030037, 0x00000093, 0x00000095, 0x00030037, 0x00000013, 0x00000096, 
-0x00030037, 0x00000007, 0x00000097, 0x00030037, 0x0000000D, 0x00000098, 0x00030037, 0x0000000D, 
-0x00000099, 0x00030037, 0x0000000D, 0x0000009A, 0x00030037, 0x00000084, 0x0000009B, 0x000200F8, 
-0x0000009D, 0x0004003B, 0x00000007, 0x000002BC, 0x00000007, 0x0004003B, 0x0000000D, 0x000002BD, 
-0x00000007, 0x0004003B, 0x0000000D, 0x000002BF, 0x00000007, 0x0004003B, 0x00000084, 0x000002C1, 
-0x00000007, 0x0004003B, 0x00000007, 0x000002C4, 0x00000007, 0x0004003B, 0x00000007, 0x000002C5, 
-0x00000007, 0x0004003B, 0x0000007E, 0x000002C6, 0x00000007, 0x0004003B, 0x00000084, 0x000002CA, 
-0x00000007, 0x0004003B, 0x0000007E, 0x000002D3, 0x00000007, 0x0004003B, 0x00000084, 0x000002D4, 
-0x00000007, 0x0004003B, 0x00000084, 0x000002D6, 0x00000007, 0x0004003B, 0x00000007, 0x000002D7, 
-0x00000007, 0x0004003B, 0x00000007, 0x000002DD, 0x00000007, 0x0004003D, 0x0000000C, 0x000002BE, 
-0x00000098, 0x0003003E, 0x000002BD, 0x000002BE, 0x0004003D, 0x0000000C, 0x000002C0, 0x00000099, 
-0x0003003E, 0x000002BF, 0x000002C0, 0x0004003D, 0x00000083, 0x000002C2, 0x0000009B, 0x0003003E, 
-0x000002C1, 0x000002C2, 0x00070039, 0x00000006, 0x000002C3, 0x0000008F, 0x000002BD, 0x000002BF, 
-0x000002C1, 0x0003003E, 0x000002BC, 0x000002C3, 0x0003003E, 0x000002C4, 0x000000F6, 0x0004003D, 
-0x0000000C, 0x000002C7, 0x0000009A, 0x0007004F, 0x0000007D, 0x000002C8, 0x000002C7, 0x000002C7, 
-0x00000000, 0x00000001, 0x0003003E, 0x000002C6, 0x000002C8, 0x00050039, 0x00000006, 0x000002C9, 
-0x00000081, 0x000002C6, 0x0003003E, 0x000002C5, 0x000002C9, 0x0003003E, 0x000002CA, 0x000001E7, 
-0x000200F9, 0x000002CB, 0x000200F8, 0x000002CB, 0x000400F6, 0x000002CD, 0x000002CE, 0x00000000, 
-0x000200F9, 0x000002CF, 0x000200F8, 0x000002CF, 0x0004003D, 0x00000083, 0x000002D0, 0x000002CA, 
-0x000500B1, 0x000001E3, 0x000002D2, 0x000002D0, 0x000002D1, 0x000400FA, 0x000002D2, 0x000002CC, 
-0x000002CD, 0x000200F8, 0x000002CC, 0x0004003D, 0x00000083, 0x000002D5, 0x000002CA, 0x0003003E, 
-0x000002D4, 0x000002D5, 0x0003003E, 0x000002D6, 0x000002D1, 0x0004003D, 0x00000006, 0x000002D8, 
-0x000002C5, 0x0003003E, 0x000002D7, 0x000002D8, 0x00070039, 0x0000007D, 0x000002D9, 0x00000089, 
-0x000002D4, 0x000002D6, 0x000002D7, 0x00050050, 0x0000007D, 0x000002DB, 0x000002DA, 0x000002DA, 
-0x00050088, 0x0000007D, 0x000002DC, 0x000002D9, 0x000002DB, 0x0003003E, 0x000002D3, 0x000002DC, 
-0x0004003D, 0x00000092, 0x000002DE, 0x00000095, 0x0004003D, 0x00000012, 0x000002DF, 0x00000096, 
-0x0007004F, 0x0000007D, 0x000002E0, 0x000002DF, 0x000002DF, 0x00000000, 0x00000001, 0x0004003D, 
-0x0000007D, 0x000002E1, 0x000002D3, 0x00050081, 0x0000007D, 0x000002E2, 0x000002E0, 0x000002E1, 
-0x0004003D, 0x00000083, 0x000002E3, 0x0000009B, 0x0004006F, 0x00000006, 0x000002E4, 0x000002E3, 
-0x00050051, 0x00000006, 0x000002E5, 0x000002E2, 0x00000000, 0x00050051, 0x00000006, 0x000002E6, 
-0x000002E2, 0x00000001, 0x00060050, 0x0000000C, 0x000002E7, 0x000002E5, 0x000002E6, 0x000002E4, 
-0x00050057, 0x00000012, 0x000002E8, 0x000002DE, 0x000002E7, 0x00050051, 0x00000006, 0x000002E9, 
-0x000002E8, 0x00000000, 0x0003003E, 0x000002DD, 0x000002E9, 0x00050041, 0x00000007, 0x000002EB, 
-0x00000096, 0x000002EA, 0x0004003D, 0x00000006, 0x000002EC, 0x000002EB, 0x0004003D, 0x00000006, 
-0x000002ED, 0x000002BC, 0x00050083, 0x00000006, 0x000002EE, 0x000002EC, 0x000002ED, 0x0004003D, 
-0x00000006, 0x000002EF, 0x000002DD, 0x0007000C, 0x00000006, 0x000002F0, 0x00000001, 0x00000030, 
-0x000002EE, 0x000002EF, 0x0004003D, 0x00000006, 0x000002F1, 0x000002C4, 0x00050081, 0x00000006, 
-0x000002F2, 0x000002F1, 0x000002F0, 0x0003003E, 0x000002C4, 0x000002F2, 0x000200F9, 0x000002CE, 
-0x000200F8, 0x000002CE, 0x0004003D, 0x00000083, 0x000002F3, 0x000002CA, 0x00050080, 0x00000083, 
-0x000002F4, 0x000002F3, 0x000001FD, 0x0003003E, 0x000002CA, 0x000002F4, 0x000200F9, 0x000002CB, 
-0x000200F8, 0x000002CD, 0x0004003D, 0x00000006, 0x000002F5, 0x000002C4, 0x00050088, 0x00000006, 
-0x000002F7, 0x000002F5, 0x000002F6, 0x000200FE, 0x000002F7, 0x00010038, 0x00050036, 0x00000083, 
-0x000000A0, 0x00000000, 0x0000009E, 0x00030037, 0x0000000D, 0x0000009F, 0x000200F8, 0x000000A1, 
-0x0004003B, 0x00000084, 0x000002FA, 0x00000007, 0x0004003B, 0x00000013, 0x000002FB, 0x00000007, 
-0x0004003B, 0x00000084, 0x00000305, 0x00000007, 0x0003003E, 0x000002FA, 0x000001E7, 0x00050041, 
-0x000002FC, 0x000002FD, 0x000002AC, 0x0000020E, 0x0004003D, 0x000002A6, 0x000002FE, 0x000002FD, 
-0x0004003D, 0x0000000C, 0x000002FF, 0x0000009F, 0x00050051, 0x00000006, 0x00000300, 0x000002FF, 
-0x00000000, 0x00050051, 0x00000006, 0x00000301, 0x000002FF, 0x00000001, 0x00050051, 0x00000006, 
-0x00000302, 0x000002FF, 0x00000002, 0x00070050, 0x00000012, 0x00000303, 0x00000300, 0x00000301, 
-0x00000302, 0x000000D3, 0x00050091, 0x00000012, 0x00000304, 0x000002FE, 0x00000303, 0x0003003E, 
-0x000002FB, 0x00000304, 0x0003003E, 0x00000305, 0x000001E7, 0x000200F9, 0x00000306, 0x000200F8, 
-0x00000306, 0x000400F6, 0x00000308, 0x00000309, 0x00000000, 0x000200F9, 0x0000030A, 0x000200F8, 
-0x0000030A, 0x0004003D, 0x00000083, 0x0000030B, 0x00000305, 0x00050041, 0x0000030D, 0x0000030E, 
-0x000002AC, 0x0000030C, 0x0004003D, 0x00000083, 0x0000030F, 0x0000030E, 0x00050082, 0x00000083, 
-0x00000310, 0x0000030F, 0x000001FD, 0x000500B1, 0x000001E3, 0x00000311, 0x0000030B, 0x00000310, 
-0x000400FA, 0x00000311, 0x00000307, 0x00000308, 0x000200F8, 0x00000307, 0x00050041, 0x00000007, 
-0x00000312, 0x000002FB, 0x000002EA, 0x0004003D, 0x00000006, 0x00000313, 0x00000312, 0x0004003D, 
-0x00000083, 0x00000314, 0x00000305, 0x00070041, 0x000001DF, 0x00000315, 0x000002AC, 0x00000208, 
-0x00000314, 0x0000023C, 0x0004003D, 0x00000006, 0x00000316, 0x00000315, 0x000500B8, 0x000001E3, 
-0x00000317, 0x00000313, 0x00000316, 0x000300F7, 0x00000319, 0x00000000, 0x000400FA, 0x00000317, 
-0x00000318, 0x00000319, 0x000200F8, 0x00000318, 0x0004003D, 0x00000083, 0x0000031A, 0x00000305, 
-0x00050080, 0x00000083, 0x0000031B, 0x0000031A, 0x000001FD, 0x0003003E, 0x000002FA, 0x0000031B, 
-0x000200F9, 0x00000319, 0x000200F8, 0x00000319, 0x000200F9, 0x00000309, 0x000200F8, 0x00000309, 
-0x0004003D, 0x00000083, 0x0000031C, 0x00000305, 0x00050080, 0x00000083, 0x0000031D, 0x0000031C, 
-0x000001FD, 0x0003003E, 0x00000305, 0x0000031D, 0x000200F9, 0x00000306, 0x000200F8, 0x00000308, 
-0x0004003D, 0x00000083, 0x0000031E, 0x000002FA, 0x000200FE, 0x0000031E, 0x00010038, 0x00050036, 
-0x00000006, 0x000000A7, 0x00000000, 0x000000A2, 0x00030037, 0x0000000D, 0x000000A3, 0x00030037, 
-0x00000084, 0x000000A4, 0x00030037, 0x0000000D, 0x000000A5, 0x00030037, 0x0000000D, 0x000000A6, 
-0x000200F8, 0x000000A8, 0x0004003B, 0x00000013, 0x00000321, 0x00000007, 0x0004003B, 0x00000007, 
-0x00000333, 0x00000007, 0x0004003B, 0x00000007, 0x00000335, 0x00000007, 0x0004003B, 0x00000013, 
-0x00000340, 0x00000007, 0x0004003B, 0x00000007, 0x00000349, 0x00000007, 0x0004003B, 0x00000013, 
-0x0000034B, 0x00000007, 0x0004003B, 0x00000007, 0x0000034D, 0x00000007, 0x0004003B, 0x0000000D, 
-0x0000034F, 0x00000007, 0x0004003B, 0x0000000D, 0x00000351, 0x00000007, 0x0004003B, 0x0000000D, 
-0x00000353, 0x00000007, 0x0004003B, 0x00000084, 0x00000355, 0x00000007, 0x0004003B, 0x00000007, 
-0x00000358, 0x00000007, 0x0004003B, 0x00000084, 0x00000365, 0x00000007, 0x0004003B, 0x00000007, 
-0x0000037F, 0x00000007, 0x0004003B, 0x00000013, 0x00000380, 0x00000007, 0x0004003B, 0x00000007, 
-0x00000382, 0x00000007, 0x0004003B, 0x0000000D, 0x00000384, 0x00000007, 0x0004003B, 0x0000000D, 
-0x00000386, 0x00000007, 0x0004003B, 0x0000000D, 0x00000388, 0x00000007, 0x0004003B, 0x00000084, 
-0x0000038A, 0x00000007, 0x00050041, 0x000002FC, 0x00000322, 0x000002AC, 0x0000025E, 0x0004003D, 
-0x000002A6, 0x00000323, 0x00000322, 0x0004003D, 0x00000083, 0x00000324, 0x000000A4, 0x00060041, 
-0x000002FC, 0x00000325, 0x000002AC, 0x000001FD, 0x00000324, 0x0004003D, 0x000002A6, 0x00000326, 
-0x00000325, 0x00050092, 0x000002A6, 0x00000327, 0x00000323, 0x00000326, 0x0004003D, 0x0000000C, 
-0x00000328, 0x000000A3, 0x00050051, 0x00000006, 0x00000329, 0x00000328, 0x00000000, 0x00050051, 
-0x00000006, 0x0000032A, 0x00000328, 0x00000001, 0x00050051, 0x00000006, 0x0000032B, 0x00000328, 
-0x00000002, 0x00070050, 0x00000012, 0x0000032C, 0x00000329, 0x0000032A, 0x0000032B, 0x000000D3, 
-0x00050091, 0x00000012, 0x0000032D, 0x00000327, 0x0000032C, 0x0003003E, 0x00000321, 0x0000032D, 
-0x0004003D, 0x00000012, 0x0000032E, 0x00000321, 0x00050041, 0x00000007, 0x0000032F, 0x00000321, 
-0x000000EC, 0x0004003D, 0x00000006, 0x00000330, 0x0000032F, 0x00050088, 0x00000006, 0x00000331, 
-0x000000D3, 0x00000330, 0x0005008E, 0x00000012, 0x00000332, 0x0000032E, 0x00000331, 0x0003003E, 
-0x00000321, 0x00000332, 0x0003003E, 0x00000333, 0x00000334, 0x00050041, 0x000001DF, 0x00000336, 
-0x000002AC, 0x00000226, 0x0004003D, 0x00000006, 0x00000337, 0x00000336, 0x0004003D, 0x00000006, 
-0x00000338, 0x00000333, 0x00050085, 0x00000006, 0x00000339, 0x00000337, 0x00000338, 0x00050041, 
-0x00000007, 0x0000033A, 0x00000321, 0x000002EA, 0x0004003D, 0x00000006, 0x0000033B, 0x0000033A, 
-0x00050088, 0x00000006, 0x0000033C, 0x00000339, 0x0000033B, 0x0003003E, 0x00000335, 0x0000033C, 
-0x0004003D, 0x00000006, 0x0000033D, 0x00000335, 0x0007000C, 0x00000006, 0x0000033F, 0x00000001, 
-0x00000025, 0x0000033D, 0x0000033E, 0x0003003E, 0x00000335, 0x0000033F, 0x00050041, 0x000002FC, 
-0x00000341, 0x000002AC, 0x0000020E, 0x0004003D, 0x000002A6, 0x00000342, 0x00000341, 0x0004003D, 
-0x0000000C, 0x00000343, 0x000000A3, 0x00050051, 0x00000006, 0x00000344, 0x00000343, 0x00000000, 
-0x00050051, 0x00000006, 0x00000345, 0x00000343, 0x00000001, 0x00050051, 0x00000006, 0x00000346, 
-0x00000343, 0x00000002, 0x00070050, 0x00000012, 0x00000347, 0x00000344, 0x00000345, 0x00000346, 
-0x000000D3, 0x00050091, 0x00000012, 0x00000348, 0x00000342, 0x00000347, 0x0003003E, 0x00000340, 
-0x00000348, 0x0003003E, 0x00000349, 0x000000D3, 0x0004003D, 0x00000012, 0x0000034C, 0x00000321, 
-0x0003003E, 0x0000034B, 0x0000034C, 0x0004003D, 0x00000006, 0x0000034E, 0x00000335, 0x0003003E, 
-0x0000034D, 0x0000034E, 0x0004003D, 0x0000000C, 0x00000350, 0x000000A5, 0x0003003E, 0x0000034F, 
-0x00000350, 0x0004003D, 0x0000000C, 0x00000352, 0x000000A6, 0x0003003E, 0x00000351, 0x00000352, 
-0x0004003D, 0x0000000C, 0x00000354, 0x000000A3, 0x0003003E, 0x00000353, 0x00000354, 0x0004003D, 
-0x00000083, 0x00000356, 0x000000A4, 0x0003003E, 0x00000355, 0x00000356, 0x000B0039, 0x00000006, 
-0x00000357, 0x0000009C, 0x0000034A, 0x0000034B, 0x0000034D, 0x0000034F, 0x00000351, 0x00000353, 
-0x00000355, 0x0003003E, 0x00000349, 0x00000357, 0x0004003D, 0x00000083, 0x00000359, 0x000000A4, 
-0x00070041, 0x000001DF, 0x0000035A, 0x000002AC, 0x00000208, 0x00000359, 0x0000023C, 0x0004003D, 
-0x00000006, 0x0000035B, 0x0000035A, 0x00050041, 0x000001DF, 0x0000035C, 0x000002AC, 0x00000242, 
-0x0004003D, 0x00000006, 0x0000035D, 0x0000035C, 0x00050081, 0x00000006, 0x0000035E, 0x0000035B, 
-0x0000035D, 0x0004003D, 0x00000083, 0x0000035F, 0x000000A4, 0x00070041, 0x000001DF, 0x00000360, 
-0x000002AC, 0x00000208, 0x0000035F, 0x0000023C, 0x0004003D, 0x00000006, 0x00000361, 0x00000360, 
-0x00050041, 0x00000007, 0x00000362, 0x00000340, 0x000002EA, 0x0004003D, 0x00000006, 0x00000363, 
-0x00000362, 0x0008000C, 0x00000006, 0x00000364, 0x00000001, 0x00000031, 0x0000035E, 0x00000361, 
-0x00000363, 0x0003003E, 0x00000358, 0x00000364, 0x0004003D, 0x00000083, 0x00000366, 0x000000A4, 
-0x00050080, 0x00000083, 0x00000367, 0x00000366, 0x000001FD, 0x0003003E, 0x00000365, 0x00000367, 
-0x0004003D, 0x00000006, 0x00000368, 0x00000358, 0x000500BA, 0x000001E3, 0x00000369, 0x00000368, 
-0x000000F6, 0x000300F7, 0x0000036B, 0x00000000, 0x000400FA, 0x00000369, 0x0000036A, 0x0000036B, 
-0x000200F8, 0x0000036A, 0x0004003D, 0x00000083, 0x0000036C, 0x00000365, 0x00050041, 0x0000030D, 
-0x0000036D, 0x000002AC, 0x0000030C, 0x0004003D, 0x00000083, 0x0000036E, 0x0000036D, 0x000500B1, 
-0x000001E3, 0x0000036F, 0x0000036C, 0x0000036E, 0x000200F9, 0x0000036B, 0x000200F8, 0x0000036B, 
-0x000700F5, 0x000001E3, 0x00000370, 0x00000369, 0x000000A8, 0x0000036F, 0x0000036A, 0x000300F7, 
-0x00000372, 0x00000000, 0x000400FA, 0x00000370, 0x00000371, 0x00000372, 0x000200F8, 0x00000371, 
-0x00050041, 0x000002FC, 0x00000373, 0x000002AC, 0x0000025E, 0x0004003D, 0x000002A6, 0x00000374, 
-0x00000373, 0x0004003D, 0x00000083, 0x00000375, 0x00000365, 0x00060041, 0x000002FC, 0x00000376, 
-0x000002AC, 0x000001FD, 0x00000375, 0x0004003D, 0x000002A6, 0x00000377, 0x00000376, 0x00050092, 
-0x000002A6, 0x00000378, 0x00000374, 0x00000377, 0x0004003D, 0x0000000C, 0x00000379, 0x000000A3, 
-0x00050051, 0x00000006, 0x0000037A, 0x00000379, 0x00000000, 0x00050051, 0x00000006, 0x0000037B, 
-0x00000379, 0x00000001, 0x00050051, 0x00000006, 0x0000037C, 0x00000379, 0x00000002, 0x00070050, 
-0x00000012, 0x0000037D, 0x0000037A, 0x0000037B, 0x0000037C, 0x000000D3, 0x00050091, 0x00000012, 
-0x0000037E, 0x00000378, 0x0000037D, 0x0003003E, 0x00000321, 0x0000037E, 0x0004003D, 0x00000012, 
-0x00000381, 0x00000321, 0x0003003E, 0x00000380, 0x00000381, 0x0004003D, 0x00000006, 0x00000383, 
-0x00000335, 0x0003003E, 0x00000382, 0x00000383, 0x0004003D, 0x0000000C, 0x00000385, 0x000000A5, 
-0x0003003E, 0x00000384, 0x00000385, 0x0004003D, 0x0000000C, 0x00000387, 0x000000A6, 0x0003003E, 
-0x00000386, 0x00000387, 0x0004003D, 0x0000000C, 0x00000389, 0x000000A3, 0x0003003E, 0x00000388, 
-0x00000389, 0x0004003D, 0x00000083, 0x0000038B, 0x00000365, 0x0003003E, 0x0000038A, 0x0000038B, 
-0x000B0039, 0x00000006, 0x0000038C, 0x0000009C, 0x0000034A, 0x00000380, 0x00000382, 0x00000384, 
-0x00000386, 0x00000388, 0x0000038A, 0x0003003E, 0x0000037F, 0x0000038C, 0x0004003D, 0x00000006, 
-0x0000038D, 0x00000349, 0x0004003D, 0x00000006, 0x0000038E, 0x0000037F, 0x0004003D, 0x00000006, 
-0x0000038F, 0x00000358, 0x0008000C, 0x00000006, 0x00000390, 0x00000001, 0x0000002E, 0x0000038D, 
-0x0000038E, 0x0000038F, 0x0003003E, 0x00000349, 0x00000390, 0x000200F9, 0x00000372, 0x000200F8, 
-0x00000372, 0x0004003D, 0x00000006, 0x00000391, 0x00000349, 0x00050083, 0x00000006, 0x00000392, 
-0x000000D3, 0x00000391, 0x0004003D, 0x00000006, 0x00000393, 0x000000D2, 0x00050085, 0x00000006, 
-0x00000394, 0x00000392, 0x00000393, 0x00050083, 0x00000006, 0x00000395, 0x000000D3, 0x00000394, 
-0x000200FE, 0x00000395, 0x00010038, 0x00050036, 0x0000000C, 0x000000B3, 0x00000000, 0x000000AB, 
-0x00030037, 0x000000A9, 0x000000AC, 0x00030037, 0x000000AA, 0x000000AD, 0x00030037, 0x0000000C, 
-0x000000AE, 0x00030037, 0x00000007, 0x000000AF, 0x00030037, 0x00000007, 0x000000B0, 0x00030037, 
-0x00000007, 0x000000B1, 0x00030037, 0x00000007, 0x000000B2, 0x000200F8, 0x000000B4, 0x0004003B, 
-0x00000007, 0x00000398, 0x00000007, 0x0004003B, 0x00000007, 0x0000039A, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000039C, 0x00000007, 0x0004003B, 0x00000007, 0x0000039F, 0x00000007, 0x0004003B, 
-0x00000007, 0x000003A0, 0x00000007, 0x0004003B, 0x00000007, 0x000003A2, 0x00000007, 0x0004003B, 
-0x00000007, 0x000003A4, 0x00000007, 0x0004003B, 0x0000000D, 0x000003A7, 0x00000007, 0x0004003B, 
-0x00000007, 0x000003A9, 0x00000007, 0x00050051, 0x0000000C, 0x00000399, 0x000000AC, 0x00000006, 
-0x00050051, 0x00000006, 0x0000039B, 0x000000AC, 0x00000002, 0x0003003E, 0x0000039A, 0x0000039B, 
-0x0004003D, 0x00000006, 0x0000039D, 0x000000B1, 0x0003003E, 0x0000039C, 0x0000039D, 0x00080039, 
-0x00000006, 0x0000039E, 0x0000005D, 0x0000039A, 0x0000039C, 0x00000399, 0x000000AE, 0x0003003E, 
-0x00000398, 0x0000039E, 0x00050051, 0x00000006, 0x000003A1, 0x000000AC, 0x00000002, 0x0003003E, 
-0x000003A0, 0x000003A1, 0x0004003D, 0x00000006, 0x000003A3, 0x000000AF, 0x0003003E, 0x000003A2, 
-0x000003A3, 0x0004003D, 0x00000006, 0x000003A5, 0x000000B0, 0x0003003E, 0x000003A4, 0x000003A5, 
-0x00070039, 0x00000006, 0x000003A6, 0x00000062, 0x000003A0, 0x000003A2, 0x000003A4, 0x0003003E, 
-0x0000039F, 0x000003A6, 0x00050051, 0x0000000C, 0x000003A8, 0x000000AC, 0x0000000A, 0x0004003D, 
-0x00000006, 0x000003AA, 0x000000B2, 0x0003003E, 0x000003A9, 0x000003AA, 0x00060039, 0x0000000C, 
-0x000003AB, 0x00000067, 0x000003A8, 0x000003A9, 0x0003003E, 0x000003A7, 0x000003AB, 0x0004003D, 
-0x00000006, 0x000003AC, 0x00000398, 0x0004003D, 0x00000006, 0x000003AD, 0x0000039F, 0x00050085, 
-0x00000006, 0x000003AE, 0x000003AC, 0x000003AD, 0x0004003D, 0x0000000C, 0x000003AF, 0x000003A7, 
-0x0005008E, 0x0000000C, 0x000003B0, 0x000003AF, 0x000003AE, 0x000200FE, 0x000003B0, 0x00010038, 
-0x00050036, 0x0000000C, 0x000000BA, 0x00000000, 0x000000B5, 0x00030037, 0x000000A9, 0x000000B6, 
-0x00030037, 0x00000007, 0x000000B7, 0x00030037, 0x00000007, 0x000000B8, 0x00030037, 0x00000007, 
-0x000000B9, 0x000200F8, 0x000000BB, 0x0004003B, 0x00000007, 0x000003B5, 0x00000007, 0x0004003B, 
-0x00000007, 0x000003B7, 0x00000007, 0x0004003B, 0x00000007, 0x000003B9, 0x00000007, 0x0004003B, 
-0x00000007, 0x000003BB, 0x00000007, 0x00050051, 0x00000012, 0x000003B3, 0x000000B6, 0x00000000, 
-0x0008004F, 0x0000000C, 0x000003B4, 0x000003B3, 0x000003B3, 0x00000000, 0x00000001, 0x00000002, 
-0x00050051, 0x00000006, 0x000003B6, 0x000000B6, 0x00000002, 0x0003003E, 0x000003B5, 0x000003B6, 
-0x0004003D, 0x00000006, 0x000003B8, 0x000000B7, 0x0003003E, 0x000003B7, 0x000003B8, 0x0004003D, 
-0x00000006, 0x000003BA, 0x000000B8, 0x0003003E, 0x000003B9, 0x000003BA, 0x0004003D, 0x00000006, 
-0x000003BC, 0x000000B9, 0x0003003E, 0x000003BB, 0x000003BC, 0x00080039, 0x00000006, 0x000003BD, 
-0x00000043, 0x000003B5, 0x000003B7, 0x000003B9, 0x000003BB, 0x0005008E, 0x0000000C, 0x000003BE, 
-0x000003B4, 0x000003BD, 0x000200FE, 0x000003BE, 0x00010038, 0x00050036, 0x0000000C, 0x000000C3, 
-0x00000000, 0x000000AB, 0x00030037, 0x000000A9, 0x000000BC, 0x00030037, 0x000000AA, 0x000000BD, 
-0x00030037, 0x0000000C, 0x000000BE, 0x00030037, 0x00000007, 0x000000BF, 0x00030037, 0x00000007, 
-0x000000C0, 0x00030037, 0x00000007, 0x000000C1, 0x00030037, 0x00000007, 0x000000C2, 0x000200F8, 
-0x000000C4, 0x0004003B, 0x00000007, 0x000003C1, 0x00000007, 0x0004003B, 0x00000007, 0x000003C3, 
-0x00000007, 0x0004003B, 0x00000007, 0x000003C5, 0x00000007, 0x0004003B, 0x00000007, 0x000003C7, 
-0x00000007, 0x0004003D, 0x00000006, 0x000003C2, 0x000000BF, 0x0003003E, 0x000003C1, 0x000003C2, 
-0x0004003D, 0x00000006, 0x000003C4, 0x000000C0, 0x0003003E, 0x000003C3, 0x000003C4, 0x0004003D, 
-0x00000006, 0x000003C6, 0x000000C1, 0x0003003E, 0x000003C5, 0x000003C6, 0x0004003D, 0x00000006, 
-0x000003C8, 0x000000C2, 0x0003003E, 0x000003C7, 0x000003C8, 0x000B0039, 0x0000000C, 0x000003C9, 
-0x000000B3, 0x000000BC, 0x000000BD, 0x000000BE, 0x000003C1, 0x000003C3, 0x000003C5, 0x000003C7, 
-0x000200FE, 0x000003C9, 0x00010038, 0x00050036, 0x0000000C, 0x000000CA, 0x00000000, 0x000000C6, 
-0x00030037, 0x0000000D, 0x000000C7, 0x00030037, 0x0000000D, 0x000000C8, 0x00030037, 0x000000C5, 
-0x000000C9, 0x000200F8, 0x000000CB, 0x0004003B, 0x0000000D, 0x000003CC, 0x00000007, 0x0004003B, 
-0x00000084, 0x000003CE, 0x00000007, 0x0004003B, 0x000003D9, 0x000003DA, 0x00000007, 0x0004003B, 
-0x00000007, 0x000003EE, 0x00000007, 0x0004003B, 0x0000000D, 0x000003F4, 0x00000007, 0x0004003B, 
-0x00000007, 0x000003FA, 0x00000007, 0x0004003B, 0x00000007, 0x000003FF, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000406, 0x00000007, 0x0004003B, 0x0000000D, 0x0000041F, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000425, 0x00000007, 0x0004003B, 0x00000007, 0x00000429, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000042E, 0x00000007, 0x0004003B, 0x00000007, 0x00000434, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000043A, 0x00000007, 0x0004003B, 0x00000084, 0x0000044B, 0x00000007, 0x0004003B, 
-0x0000000D, 0x0000044C, 0x00000007, 0x0004003B, 0x0000000D, 0x00000455, 0x00000007, 0x0004003B, 
-0x00000084, 0x00000457, 0x00000007, 0x0004003B, 0x0000000D, 0x00000459, 0x00000007, 0x0004003B, 
-0x0000000D, 0x0000045D, 0x00000007, 0x0004003B, 0x0000000D, 0x00000462, 0x00000007, 0x0004003B, 
-0x0000000D, 0x00000466, 0x00000007, 0x0004003B, 0x0000000D, 0x0000046D, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000473, 0x00000007, 0x0004003B, 0x00000007, 0x00000478, 0x00000007, 0x0004003B, 
-0x0000000D, 0x0000047A, 0x00000007, 0x0004003B, 0x00000007, 0x00000480, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000486, 0x00000007, 0x0004003B, 0x00000007, 0x00000488, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000048A, 0x00000007, 0x0004003B, 0x00000007, 0x0000048B, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000048E, 0x00000007, 0x0004003B, 0x00000007, 0x00000493, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000495, 0x00000007, 0x0004003B, 0x00000007, 0x00000499, 0x00000007, 0x0004003B, 
-0x0000000D, 0x0000049B, 0x00000007, 0x0004003B, 0x00000007, 0x0000049D, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000049F, 0x00000007, 0x0004003B, 0x00000007, 0x000004A1, 0x00000007, 0x0004003B, 
-0x0000000D, 0x000004A4, 0x00000007, 0x0004003B, 0x00000007, 0x000004A8, 0x00000007, 0x0004003B, 
-0x00000007, 0x000004AA, 0x00000007, 0x0004003B, 0x00000007, 0x000004AC, 0x00000007, 0x0004003B, 
-0x00000007, 0x000004AE, 0x00000007, 0x0004003B, 0x0000000D, 0x000004B1, 0x00000007, 0x0004003B, 
-0x00000007, 0x000004BB, 0x00000007, 0x0004003B, 0x00000007, 0x000004BD, 0x00000007, 0x0003003E, 
-0x000003CC, 0x000003CD, 0x0003003E, 0x000003CE, 0x000001E7, 0x000200F9, 0x000003CF, 0x000200F8, 
-0x000003CF, 0x000400F6, 0x000003D1, 0x000003D2, 0x00000000, 0x000200F9, 0x000003D3, 0x000200F8, 
-0x000003D3, 0x0004003D, 0x00000083, 0x000003D4, 0x000003CE, 0x00050041, 0x0000030D, 0x000003D6, 
-0x000002AC, 0x000003D5, 0x0004003D, 0x00000083, 0x000003D7, 0x000003D6, 0x000500B1, 0x000001E3, 
-0x000003D8, 0x000003D4, 0x000003D7, 0x000400FA, 0x000003D8, 0x000003D0, 0x000003D1, 0x000200F8, 
-0x000003D0, 0x0004003D, 0x00000083, 0x000003DB, 0x000003CE, 0x00060041, 0x000003DC, 0x000003DD, 
-0x000002AC, 0x000001E7, 0x000003DB, 0x0004003D, 0x000002A3, 0x000003DE, 0x000003DD, 0x00050051, 
+0x00000012, 0x00000583, 0x00000580, 0x00000582, 0x0007004F, 0x0000007D, 0x000007C8, 0x00000583, 
+0x00000583, 0x00000000, 0x00000001, 0x0005008E, 0x0000007D, 0x000007C9, 0x000007C8, 0x0000012E, 
+0x00050050, 0x0000007D, 0x000007CA, 0x000000D3, 0x000000D3, 0x00050083, 0x0000007D, 0x000007CB, 
+0x000007C9, 0x000007CA, 0x00050094, 0x00000006, 0x000007CC, 0x000007CB, 0x000007CB, 0x00050083, 
+0x00000006, 0x000007CD, 0x000000D3, 0x000007CC, 0x0008000C, 0x00000006, 0x000007CE, 0x00000001, 
+0x0000002B, 0x000007CD, 0x000000F6, 0x000000D3, 0x0006000C, 0x00000006, 0x000007CF, 0x00000001, 
+0x0000001F, 0x000007CE, 0x00050050, 0x0000000C, 0x000007D0, 0x000007CB, 0x000007CF, 0x0006000C, 
+0x0000000C, 0x00000588, 0x00000001, 0x00000045, 0x000007D0, 0x00050041, 0x0000000D, 0x00000589, 
+0x0000056A, 0x00000208, 0x0003003E, 0x00000589, 0x00000588, 0x00050041, 0x0000058A, 0x0000058B, 
+0x000001FC, 0x0000025E, 0x0004003D, 0x000001F9, 0x0000058C, 0x0000058B, 0x00050041, 0x0000000D, 
+0x0000058D, 0x0000056A, 0x00000208, 0x0004003D, 0x0000000C, 0x0000058E, 0x0000058D, 0x00050091, 
+0x0000000C, 0x0000058F, 0x0000058C, 0x0000058E, 0x0006000C, 0x0000000C, 0x00000590, 0x00000001, 
+0x00000045, 0x0000058F, 0x00050041, 0x0000000D, 0x00000591, 0x0000056A, 0x00000208, 0x0003003E, 
+0x00000591, 0x00000590, 0x00050041, 0x0000000D, 0x00000592, 0x0000056A, 0x00000208, 0x0004003D, 
+0x0000000C, 0x00000593, 0x00000592, 0x0006000C, 0x0000000C, 0x00000594, 0x00000001, 0x00000045, 
+0x00000593, 0x00050041, 0x0000000D, 0x00000595, 0x0000056A, 0x00000208, 0x0003003E, 0x00000595, 
+0x00000594, 0x000200F9, 0x0000057E, 0x000200F8, 0x0000057E, 0x00040039, 0x00000006, 0x00000596, 
+0x00000078, 0x00050041, 0x00000007, 0x00000597, 0x0000056A, 0x00000226, 0x0003003E, 0x00000597, 
+0x00000596, 0x00050041, 0x00000013, 0x00000599, 0x0000056A, 0x000001E7, 0x0004003D, 0x00000012, 
+0x0000059A, 0x00000599, 0x0008004F, 0x0000000C, 0x0000059B, 0x0000059A, 0x0000059A, 0x00000000, 
+0x00000001, 0x00000002, 0x0003003E, 0x00000598, 0x0000059B, 0x00050039, 0x0000000C, 0x0000059C, 
+0x0000007B, 0x00000598, 0x00050041, 0x0000000D, 0x0000059D, 0x0000056A, 0x000001DE, 0x0003003E, 
+0x0000059D, 0x0000059C, 0x0004003D, 0x00000012, 0x000005A1, 0x000005A0, 0x0007004F, 0x0000007D, 
+0x000005A2, 0x000005A1, 0x000005A1, 0x00000000, 0x00000001, 0x00050041, 0x000001DF, 0x000005A4, 
+0x000002AC, 0x0000044F, 0x0004003D, 0x00000006, 0x000005A5, 0x000005A4, 0x00050041, 0x000001DF, 
+0x000005A7, 0x000002AC, 0x000007DC, 0x0004003D, 0x00000006, 0x000005A8, 0x000005A7, 0x00050050, 
+0x0000007D, 0x000005A9, 0x000005A5, 0x000005A8, 0x00050088, 0x0000007D, 0x000005AA, 0x000005A2, 
+0x000005A9, 0x0003003E, 0x0000059E, 0x000005AA, 0x0004003D, 0x000001F5, 0x000005AD, 0x000005AC, 
+0x0004003D, 0x0000007D, 0x000005AE, 0x0000059E, 0x00050057, 0x00000012, 0x000005AF, 0x000005AD, 
+0x000005AE, 0x00050051, 0x00000006, 0x000005B0, 0x000005AF, 0x00000000, 0x0003003E, 0x000005AB, 
+0x000005B0, 0x0004003D, 0x00000006, 0x000005B1, 0x000005AB, 0x00050041, 0x00000013, 0x000005B2, 
+0x0000056A, 0x000001E7, 0x0004003D, 0x00000012, 0x000005B3, 0x000005B2, 0x0005008E, 0x00000012, 
+0x000005B4, 0x000005B3, 0x000005B1, 0x00050041, 0x00000013, 0x000005B5, 0x0000056A, 0x000001E7, 
+0x0003003E, 0x000005B5, 0x000005B4, 0x00050041, 0x00000007, 0x000005B6, 0x0000056A, 0x000003E6, 
+0x0004003D, 0x00000006, 0x000005B7, 0x000005B6, 0x0008000C, 0x00000006, 0x000005B9, 0x00000001, 
+0x0000002B, 0x000005B7, 0x000005B8, 0x000000D3, 0x00050041, 0x00000007, 0x000005BA, 0x0000056A, 
+0x000003E6, 0x0003003E, 0x000005BA, 0x000005B9, 0x00050041, 0x00000007, 0x000005BC, 0x0000056A, 
+0x0000020E, 0x0004003D, 0x00000006, 0x000005BD, 0x000005BC, 0x0003003E, 0x000005BB, 0x000005BD, 
+0x00050039, 0x00000006, 0x000005BE, 0x00000057, 0x000005BB, 0x00050041, 0x00000007, 0x000005BF, 
+0x0000056A, 0x0000020E, 0x0003003E, 0x000005BF, 0x000005BE, 0x0004003D, 0x00000006, 0x000005C1, 
+0x00000519, 0x0004003D, 0x00000006, 0x000005C2, 0x00000519, 0x00050085, 0x00000006, 0x000005C3, 
+0x000005C1, 0x000005C2, 0x0003003E, 0x000005C0, 0x000005C3, 0x00050041, 0x0000000D, 0x000005C5, 
+0x0000056A, 0x00000208, 0x0004003D, 0x0000000C, 0x000005C6, 0x000005C5, 0x000400CF, 0x0000000C, 
+0x000005C7, 0x000005C6, 0x0003003E, 0x000005C4, 0x000005C7, 0x00050041, 0x0000000D, 0x000005C9, 
+0x0000056A, 0x00000208, 0x0004003D, 0x0000000C, 0x000005CA, 0x000005C9, 0x000400D0, 0x0000000C, 
+0x000005CB, 0x000005CA, 0x0003003E, 0x000005C8, 0x000005CB, 0x0004003D, 0x0000000C, 0x000005CD, 
+0x000005C4, 0x0004003D, 0x0000000C, 0x000005CE, 0x000005C4, 0x00050094, 0x00000006, 0x000005CF, 
+0x000005CD, 0x000005CE, 0x0004003D, 0x0000000C, 0x000005D0, 0x000005C8, 0x0004003D, 0x0000000C, 
+0x000005D1, 0x000005C8, 0x00050094, 0x00000006, 0x000005D2, 0x000005D0, 0x000005D1, 0x00050081, 
+0x00000006, 0x000005D3, 0x000005CF, 0x000005D2, 0x0003003E, 0x000005CC, 0x000005D3, 0x0004003D, 
+0x00000006, 0x000005D5, 0x000005CC, 0x00050085, 0x00000006, 0x000005D6, 0x000005D5, 0x000000D3, 
+0x0007000C, 0x00000006, 0x000005D8, 0x00000001, 0x00000025, 0x000005D6, 0x000005D7, 0x0003003E, 
+0x000005D4, 0x000005D8, 0x0004003D, 0x00000006, 0x000005DA, 0x000005C0, 0x0004003D, 0x00000006, 
+0x000005DB, 0x000005D4, 0x00050081, 0x00000006, 0x000005DC, 0x000005DA, 0x000005DB, 0x0003003E, 
+0x000005DD, 0x000005DC, 0x00050039, 0x00000006, 0x000005DE, 0x00000019, 0x000005DD, 0x0003003E, 
+0x000005D9, 0x000005DE, 0x0004003D, 0x00000006, 0x000005DF, 0x000005D9, 0x0006000C, 0x00000006, 
+0x000005E0, 0x00000001, 0x0000001F, 0x000005DF, 0x00050041, 0x00000007, 0x000005E1, 0x0000056A, 
+0x0000020E, 0x0003003E, 0x000005E1, 0x000005E0, 0x00050041, 0x00000007, 0x000005E2, 0x0000056A, 
+0x0000020E, 0x0004003D, 0x00000006, 0x000005E3, 0x000005E2, 0x0008000C, 0x00000006, 0x000005E5, 
+0x00000001, 0x0000002B, 0x000005E3, 0x000005E4, 0x000000D3, 0x00050041, 0x00000007, 0x000005E6, 
+0x0000056A, 0x0000020E, 0x0003003E, 0x000005E6, 0x000005E5, 0x00050041, 0x0000059F, 0x000005E8, 
+0x000001FC, 0x0000020E, 0x0004003D, 0x00000012, 0x000005E9, 0x000005E8, 0x0008004F, 0x0000000C, 
+0x000005EA, 0x000005E9, 0x000005E9, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000005E7, 
+0x000005EA, 0x00050041, 0x000001E8, 0x000005EB, 0x000002AC, 0x00000226, 0x0004003D, 0x00000012, 
+0x000005EC, 0x000005EB, 0x0008004F, 0x0000000C, 0x000005ED, 0x000005EC, 0x000005EC, 0x00000000, 
+0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x000005EE, 0x000005E7, 0x00050083, 0x0000000C, 
+0x000005EF, 0x000005ED, 0x000005EE, 0x0006000C, 0x0000000C, 0x000005F0, 0x00000001, 0x00000045, 
+0x000005EF, 0x00050041, 0x0000000D, 0x000005F1, 0x0000056A, 0x000002D1, 0x0003003E, 0x000005F1, 
+0x000005F0, 0x00050041, 0x0000000D, 0x000005F2, 0x0000056A, 0x00000208, 0x0004003D, 0x0000000C, 
+0x000005F3, 0x000005F2, 0x00050041, 0x0000000D, 0x000005F4, 0x0000056A, 0x000002D1, 0x0004003D, 
+0x0000000C, 0x000005F5, 0x000005F4, 0x00050094, 0x00000006, 0x000005F6, 0x000005F3, 0x000005F5, 
+0x0007000C, 0x00000006, 0x000005F7, 0x00000001, 0x00000028, 0x000005F6, 0x0000018D, 0x00050041, 
+0x00000007, 0x000005F8, 0x0000056A, 0x00000258, 0x0003003E, 0x000005F8, 0x000005F7, 0x0004003D, 
+0x000001F5, 0x000005FA, 0x000005F9, 0x00050041, 0x00000007, 0x000005FB, 0x0000056A, 0x00000258, 
+0x0004003D, 0x00000006, 0x000005FC, 0x000005FB, 0x00050041, 0x00000007, 0x000005FD, 0x0000056A, 
+0x000003E6, 0x0004003D, 0x00000006, 0x000005FE, 0x000005FD, 0x00050050, 0x0000007D, 0x000005FF, 
+0x000005FC, 0x000005FE, 0x00050057, 0x00000012, 0x00000600, 0x000005FA, 0x000005FF, 0x0007004F, 
+0x0000007D, 0x00000601, 0x00000600, 0x00000600, 0x00000000, 0x00000001, 0x00050041, 0x0000007E, 
+0x00000602, 0x0000056A, 0x0000030C, 0x0003003E, 0x00000602, 0x00000601, 0x00050041, 0x00000007, 
+0x00000605, 0x0000056A, 0x0000025E, 0x0004003D, 0x00000006, 0x00000606, 0x00000605, 0x0003003E, 
+0x00000604, 0x00000606, 0x00050039, 0x00000006, 0x00000607, 0x00000054, 0x00000604, 0x0003003E, 
+0x00000603, 0x00000607, 0x00050041, 0x00000013, 0x00000609, 0x0000056A, 0x000001E7, 0x0004003D, 
+0x00000012, 0x0000060A, 0x00000609, 0x00050041, 0x00000007, 0x0000060C, 0x0000056A, 0x000001FD, 
+0x0004003D, 0x00000006, 0x0000060D, 0x0000060C, 0x0003003E, 0x0000060B, 0x0000060D, 0x0004003D, 
+0x00000006, 0x0000060F, 0x00000603, 0x0003003E, 0x0000060E, 0x0000060F, 0x00070039, 0x0000000C, 
+0x00000610, 0x00000051, 0x0000060A, 0x0000060B, 0x0000060E, 0x0003003E, 0x00000608, 0x00000610, 
+0x0004003D, 0x0000000C, 0x00000611, 0x00000608, 0x00050041, 0x0000000D, 0x00000612, 0x0000056A, 
+0x00000242, 0x0003003E, 0x00000612, 0x00000611, 0x00050041, 0x0000000D, 0x00000613, 0x0000056A, 
+0x00000242, 0x0004003D, 0x0000000C, 0x00000614, 0x00000613, 0x00060041, 0x00000007, 0x00000616, 
+0x0000056A, 0x0000030C, 0x00000501, 0x0004003D, 0x00000006, 0x00000617, 0x00000616, 0x0007000C, 
+0x00000006, 0x00000618, 0x00000001, 0x00000028, 0x00000615, 0x00000617, 0x00050088, 0x00000006, 
+0x00000619, 0x000000D3, 0x00000618, 0x00050083, 0x00000006, 0x0000061A, 0x00000619, 0x000000D3, 
+0x0005008E, 0x0000000C, 0x0000061B, 0x00000614, 0x0000061A, 0x00060050, 0x0000000C, 0x0000061C, 
+0x000000D3, 0x000000D3, 0x000000D3, 0x00050081, 0x0000000C, 0x0000061D, 0x0000061C, 0x0000061B, 
+0x00050041, 0x0000000D, 0x0000061E, 0x0000056A, 0x000003D5, 0x0003003E, 0x0000061E, 0x0000061D, 
+0x00050041, 0x00000013, 0x0000061F, 0x0000056A, 0x000001E7, 0x0004003D, 0x00000012, 0x00000620, 
+0x0000061F, 0x00050041, 0x00000007, 0x00000622, 0x0000056A, 0x000001FD, 0x0004003D, 0x00000006, 
+0x00000623, 0x00000622, 0x0003003E, 0x00000621, 0x00000623, 0x00060039, 0x0000000C, 0x00000624, 
+0x0000004B, 0x00000620, 0x00000621, 0x00060041, 0x00000007, 0x00000625, 0x0000056A, 0x000001E7, 
+0x0000023C, 0x00050051, 0x00000006, 0x00000626, 0x00000624, 0x00000000, 0x0003003E, 0x00000625, 
+0x00000626, 0x00060041, 0x00000007, 0x00000627, 0x0000056A, 0x000001E7, 0x00000501, 0x00050051, 
+0x00000006, 0x00000628, 0x00000624, 0x00000001, 0x0003003E, 0x00000627, 0x00000628, 0x00060041, 
+0x00000007, 0x00000629, 0x0000056A, 0x000001E7, 0x000002EA, 0x00050051, 0x00000006, 0x0000062A, 
+0x00000624, 0x00000002, 0x0003003E, 0x00000629, 0x0000062A, 0x00050041, 0x000001DF, 0x0000062C, 
+0x000002AC, 0x00000242, 0x0004003D, 0x00000006, 0x0000062D, 0x0000062C, 0x0003003E, 0x0000062B, 
+0x0000062D, 0x00050041, 0x000001DF, 0x0000062F, 0x000002AC, 0x000003D5, 0x0004003D, 0x00000006, 
+0x00000630, 0x0000062F, 0x0003003E, 0x0000062E, 0x00000630, 0x00050041, 0x000002FC, 0x00000632, 
+0x000002AC, 0x000001FD, 0x0004003D, 0x000002A6, 0x00000633, 0x00000632, 0x0004003D, 0x0000000C, 
+0x00000634, 0x000005E7, 0x00050051, 0x00000006, 0x00000635, 0x00000634, 0x00000000, 0x00050051, 
+0x00000006, 0x00000636, 0x00000634, 0x00000001, 0x00050051, 0x00000006, 0x00000637, 0x00000634, 
+0x00000002, 0x00070050, 0x00000012, 0x00000638, 0x00000635, 0x00000636, 0x00000637, 0x000000D3, 
+0x00050091, 0x00000012, 0x00000639, 0x00000633, 0x00000638, 0x0003003E, 0x00000631, 0x00000639, 
+0x0004003D, 0x00000012, 0x0000063B, 0x00000631, 0x0006000C, 0x00000006, 0x0000063C, 0x00000001, 
+0x00000042, 0x0000063B, 0x0003003E, 0x0000063A, 0x0000063C, 0x0004003D, 0x00000006, 0x0000063D, 
+0x0000063A, 0x0004003D, 0x00000006, 0x0000063E, 0x0000062B, 0x0004003D, 0x00000006, 0x0000063F, 
+0x0000062E, 0x00050083, 0x00000006, 0x00000640, 0x0000063E, 0x0000063F, 0x00050083, 0x00000006, 
+0x00000641, 0x0000063D, 0x00000640, 0x0003003E, 0x000000D2, 0x00000641, 0x0004003D, 0x00000006, 
+0x00000642, 0x0000062E, 0x0004003D, 0x00000006, 0x00000643, 0x000000D2, 0x00050088, 0x00000006, 
+0x00000644, 0x00000643, 0x00000642, 0x0003003E, 0x000000D2, 0x00000644, 0x0004003D, 0x00000006, 
+0x00000645, 0x000000D2, 0x00050083, 0x00000006, 0x00000646, 0x000000D3, 0x00000645, 0x0008000C, 
+0x00000006, 0x00000647, 0x00000001, 0x0000002B, 0x00000646, 0x000000F6, 0x000000D3, 0x0003003E, 
+0x000000D2, 0x00000647, 0x00050041, 0x00000007, 0x00000649, 0x0000056A, 0x00000258, 0x0004003D, 
+0x00000006, 0x0000064A, 0x00000649, 0x00050085, 0x00000006, 0x0000064B, 0x0000012E, 0x0000064A, 
+0x00050041, 0x0000000D, 0x0000064C, 0x0000056A, 0x00000208, 0x0004003D, 0x0000000C, 0x0000064D, 
+0x0000064C, 0x0005008E, 0x0000000C, 0x0000064E, 0x0000064D, 0x0000064B, 0x00050041, 0x0000000D, 
+0x0000064F, 0x0000056A, 0x000002D1, 0x0004003D, 0x0000000C, 0x00000650, 0x0000064F, 0x00050083, 
+0x0000000C, 0x00000651, 0x0000064E, 0x00000650, 0x0003003E, 0x00000648, 0x00000651, 0x00050041, 
+0x0000000D, 0x00000654, 0x0000056A, 0x00000242, 0x0004003D, 0x0000000C, 0x00000655, 0x00000654, 
+0x0003003E, 0x00000653, 0x00000655, 0x0004003D, 0x0000000C, 0x00000657, 0x000005E7, 0x0003003E, 
+0x00000656, 0x00000657, 0x0004003D, 0x000000A9, 0x00000659, 0x0000056A, 0x0003003E, 0x00000658, 
+0x00000659, 0x00070039, 0x0000000C, 0x0000065A, 0x000000CA, 0x00000653, 0x00000656, 0x00000658, 
+0x0003003E, 0x00000652, 0x0000065A, 0x00050041, 0x0000000D, 0x0000065D, 0x0000056A, 0x00000242, 
+0x0004003D, 0x0000000C, 0x0000065E, 0x0000065D, 0x0003003E, 0x0000065C, 0x0000065E, 0x0004003D, 
+0x0000000C, 0x00000660, 0x00000648, 0x0003003E, 0x0000065F, 0x00000660, 0x0004003D, 0x000000A9, 
+0x00000662, 0x0000056A, 0x0003003E, 0x00000661, 0x00000662, 0x00070039, 0x0000000C, 0x00000663, 
+0x000000CF, 0x0000065C, 0x0000065F, 0x00000661, 0x0003003E, 0x0000065B, 0x00000663, 0x0004003D, 
+0x0000000C, 0x00000665, 0x00000652, 0x0004003D, 0x0000000C, 0x00000666, 0x0000065B, 0x00050081, 
+0x0000000C, 0x00000667, 0x00000665, 0x00000666, 0x00050041, 0x0000000D, 0x00000668, 0x0000056A, 
+0x000001DE, 0x0004003D, 0x0000000C, 0x00000669, 0x00000668, 0x00050081, 0x0000000C, 0x0000066A, 
+0x00000667, 0x00000669, 0x0003003E, 0x00000664, 0x0000066A, 0x0004003D, 0x0000000C, 0x0000066D, 
+0x00000664, 0x00050051, 0x00000006, 0x0000066E, 0x0000066D, 0x00000000, 0x00050051, 0x00000006, 
+0x0000066F, 0x0000066D, 0x00000001, 0x00050051, 0x00000006, 0x00000670, 0x0000066D, 0x00000002, 
+0x00070050, 0x00000012, 0x00000671, 0x0000066E, 0x0000066F, 0x00000670, 0x000000D3, 0x0003003E, 
+0x0000066C, 0x00000671, 0x00050041, 0x0000030D, 0x00000673, 0x000002AC, 0x000002AD, 0x0004003D, 
+0x00000083, 0x00000674, 0x00000673, 0x000500AD, 0x000001E3, 0x00000675, 0x00000674, 0x000001E7, 
+0x000300F7, 0x00000677, 0x00000000, 0x000400FA, 0x00000675, 0x00000676, 0x00000677, 0x000200F8, 
+0x00000676, 0x00050041, 0x0000030D, 0x00000678, 0x000002AC, 0x000002AD, 0x0004003D, 0x00000083, 
+0x00000679, 0x00000678, 0x000300F7, 0x00000681, 0x00000000, 0x001100FB, 0x00000679, 0x00000681, 
+0x00000001, 0x0000067A, 0x00000002, 0x0000067B, 0x00000003, 0x0000067C, 0x00000004, 0x0000067D, 
+0x00000005, 0x0000067E, 0x00000006, 0x0000067F, 0x00000007, 0x00000680, 0x000200F8, 0x0000067A, 
+0x00050041, 0x00000013, 0x00000682, 0x0000056A, 0x000001E7, 0x0004003D, 0x00000012, 0x00000683, 
+0x00000682, 0x0003003E, 0x0000066C, 0x00000683, 0x000200F9, 0x00000681, 0x000200F8, 0x0000067B, 
+0x00050041, 0x00000007, 0x00000685, 0x0000056A, 0x000001FD, 0x0004003D, 0x00000006, 0x00000686, 
+0x00000685, 0x00060050, 0x0000000C, 0x00000687, 0x00000686, 0x00000686, 0x00000686, 0x00050051, 
+0x00000006, 0x00000688, 0x00000687, 0x00000000, 0x00050051, 0x00000006, 0x00000689, 0x00000687, 
+0x00000001, 0x00050051, 0x00000006, 0x0000068A, 0x00000687, 0x00000002, 0x00070050, 0x00000012, 
+0x0000068B, 0x00000688, 0x00000689, 0x0000068A, 0x000000D3, 0x0003003E, 0x0000066C, 0x0000068B, 
+0x000200F9, 0x00000681, 0x000200F8, 0x0000067C, 0x00050041, 0x00000007, 0x0000068D, 0x0000056A, 
+0x000003E6, 0x0004003D, 0x00000006, 0x0000068E, 0x0000068D, 0x00060050, 0x0000000C, 0x0000068F, 
+0x0000068E, 0x0000068E, 0x0000068E, 0x00050051, 0x00000006, 0x00000690, 0x0000068F, 0x00000000, 
+0x00050051, 0x00000006, 0x00000691, 0x0000068F, 0x00000001, 0x00050051, 0x00000006, 0x00000692, 
+0x0000068F, 0x00000002, 0x00070050, 0x00000012, 0x00000693, 0x00000690, 0x00000691, 0x00000692, 
+0x000000D3, 0x0003003E, 0x0000066C, 0x00000693, 0x000200F9, 0x00000681, 0x000200F8, 0x0000067D, 
+0x00050041, 0x00000007, 0x00000695, 0x0000056A, 0x00000226, 0x0004003D, 0x00000006, 0x00000696, 
+0x00000695, 0x00060050, 0x0000000C, 0x00000697, 0x00000696, 0x00000696, 0x00000696, 0x00050051, 
+0x00000006, 0x00000698, 0x00000697, 0x00000000, 0x00050051, 0x00000006, 0x00000699, 0x00000697, 
+0x00000001, 0x00050051, 0x00000006, 0x0000069A, 0x00000697, 0x00000002, 0x00070050, 0x00000012, 
+0x0000069B, 0x00000698, 0x00000699, 0x0000069A, 0x000000D3, 0x0003003E, 0x0000066C, 0x0000069B, 
+0x000200F9, 0x00000681, 0x000200F8, 0x0000067E, 0x00050041, 0x0000000D, 0x0000069D, 0x0000056A, 
+0x000001DE, 0x0004003D, 0x0000000C, 0x0000069E, 0x0000069D, 0x00050051, 0x00000006, 0x0000069F, 
+0x0000069E, 0x00000000, 0x00050051, 0x00000006, 0x000006A0, 0x0000069E, 0x00000001, 0x00050051, 
+0x00000006, 0x000006A1, 0x0000069E, 0x00000002, 0x00070050, 0x00000012, 0x000006A2, 0x0000069F, 
+0x000006A0, 0x000006A1, 0x000000D3, 0x0003003E, 0x0000066C, 0x000006A2, 0x000200F9, 0x00000681, 
+0x000200F8, 0x0000067F, 0x00050041, 0x0000000D, 0x000006A4, 0x0000056A, 0x00000208, 0x0004003D, 
+0x0000000C, 0x000006A5, 0x000006A4, 0x00050051, 0x00000006, 0x000006A6, 0x000006A5, 0x00000000, 
+0x00050051, 0x00000006, 0x000006A7, 0x000006A5, 0x00000001, 0x00050051, 0x00000006, 0x000006A8, 
+0x000006A5, 0x00000002, 0x00070050, 0x00000012, 0x000006A9, 0x000006A6, 0x000006A7, 0x000006A8, 
+0x000000D3, 0x0003003E, 0x0000066C, 0x000006A9, 0x000200F9, 0x00000681, 0x000200F8, 0x00000680, 
+0x0004003D, 0x0000000C, 0x000006AD, 0x000005E7, 0x0003003E, 0x000006AC, 0x000006AD, 0x00050039, 
+0x00000083, 0x000006AE, 0x000000A0, 0x000006AC, 0x0003003E, 0x000006AB, 0x000006AE, 0x0004003D, 
+0x00000083, 0x000006AF, 0x000006AB, 0x000300F7, 0x000006B4, 0x00000000, 0x000B00FB, 0x000006AF, 
+0x000006B4, 0x00000000, 0x000006B0, 0x00000001, 0x000006B1, 0x00000002, 0x000006B2, 0x00000003, 
+0x000006B3, 0x000200F8, 0x000006B0, 0x0004003D, 0x00000012, 0x000006B5, 0x0000066C, 0x00050085, 
+0x00000012, 0x000006B9, 0x000006B5, 0x000006B8, 0x0003003E, 0x0000066C, 0x000006B9, 0x000200F9, 
+0x000006B4, 0x000200F8, 0x000006B1, 0x0004003D, 0x00000012, 0x000006BB, 0x0000066C, 0x00050085, 
+0x00000012, 0x000006BD, 0x000006BB, 0x000006BC, 0x0003003E, 0x0000066C, 0x000006BD, 0x000200F9, 
+0x000006B4, 0x000200F8, 0x000006B2, 0x0004003D, 0x00000012, 0x000006BF, 0x0000066C, 0x00050085, 
+0x00000012, 0x000006C1, 0x000006BF, 0x000006C0, 0x0003003E, 0x0000066C, 0x000006C1, 0x000200F9, 
+0x000006B4, 0x000200F8, 0x000006B3, 0x0004003D, 0x00000012, 0x000006C3, 0x0000066C, 0x00050085, 
+0x00000012, 0x000006C5, 0x000006C3, 0x000006C4, 0x0003003E, 0x0000066C, 0x000006C5, 0x000200F9, 
+0x000006B4, 0x000200F8, 0x000006B4, 0x000200F9, 0x00000681, 0x000200F8, 0x00000681, 0x000200F9, 
+0x00000677, 0x000200F8, 0x00000677, 0x000100FD, 0x00010038, 0x00050036, 0x00000006, 0x0000000A, 
+0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000009, 0x000200F8, 0x0000000B, 0x0004003B, 
+0x00000007, 0x000000D6, 0x00000007, 0x0004003D, 0x00000006, 0x000000D7, 0x00000009, 0x0004003D, 
+0x00000006, 0x000000D8, 0x00000009, 0x00050085, 0x00000006, 0x000000D9, 0x000000D7, 0x000000D8, 
+0x0003003E, 0x000000D6, 0x000000D9, 0x0004003D, 0x00000006, 0x000000DA, 0x000000D6, 0x0004003D, 
+0x00000006, 0x000000DB, 0x000000D6, 0x00050085, 0x00000006, 0x000000DC, 0x000000DA, 0x000000DB, 
+0x0004003D, 0x00000006, 0x000000DD, 0x00000009, 0x00050085, 0x00000006, 0x000000DE, 0x000000DC, 
+0x000000DD, 0x000200FE, 0x000000DE, 0x00010038, 0x00050036, 0x0000000C, 0x00000010, 0x00000000, 
+0x0000000E, 0x00030037, 0x0000000D, 0x0000000F, 0x000200F8, 0x00000011, 0x0004003D, 0x0000000C, 
+0x000000E1, 0x0000000F, 0x0007000C, 0x0000000C, 0x000000E4, 0x00000001, 0x0000001A, 0x000000E1, 
+0x000000E3, 0x000200FE, 0x000000E4, 0x00010038, 0x00050036, 0x00000012, 0x00000016, 0x00000000, 
+0x00000014, 0x00030037, 0x00000013, 0x00000015, 0x000200F8, 0x00000017, 0x0004003B, 0x0000000D, 
+0x000000E7, 0x00000007, 0x0004003D, 0x00000012, 0x000000E8, 0x00000015, 0x0008004F, 0x0000000C, 
+0x000000E9, 0x000000E8, 0x000000E8, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000000E7, 
+0x000000E9, 0x00050039, 0x0000000C, 0x000000EA, 0x00000010, 0x000000E7, 0x00050041, 0x00000007, 
+0x000000ED, 0x00000015, 0x000000EC, 0x0004003D, 0x00000006, 0x000000EE, 0x000000ED, 0x00050051, 
+0x00000006, 0x000000EF, 0x000000EA, 0x00000000, 0x00050051, 0x00000006, 0x000000F0, 0x000000EA, 
+0x00000001, 0x00050051, 0x00000006, 0x000000F1, 0x000000EA, 0x00000002, 0x00070050, 0x00000012, 
+0x000000F2, 0x000000EF, 0x000000F0, 0x000000F1, 0x000000EE, 0x000200FE, 0x000000F2, 0x00010038, 
+0x00050036, 0x00000006, 0x00000019, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000018, 
+0x000200F8, 0x0000001A, 0x0004003D, 0x00000006, 0x000000F5, 0x00000018, 0x0008000C, 0x00000006, 
+0x000000F7, 0x00000001, 0x0000002B, 0x000000F5, 0x000000F6, 0x000000D3, 0x000200FE, 0x000000F7, 
+0x00010038, 0x00050036, 0x00000006, 0x00000020, 0x00000000, 0x0000001B, 0x00030037, 0x00000007, 
+0x0000001C, 0x00030037, 0x00000007, 0x0000001D, 0x00030037, 0x0000000C, 0x0000001E, 0x00030037, 
+0x0000000C, 0x0000001F, 0x000200F8, 0x00000021, 0x0004003B, 0x0000000D, 0x000000FA, 0x00000007, 
+0x0004003B, 0x00000007, 0x000000FC, 0x00000007, 0x0004003B, 0x00000007, 0x00000100, 0x00000007, 
+0x0004003B, 0x00000007, 0x0000010A, 0x00000007, 0x0007000C, 0x0000000C, 0x000000FB, 0x00000001, 
+0x00000044, 0x0000001E, 0x0000001F, 0x0003003E, 0x000000FA, 0x000000FB, 0x0004003D, 0x00000006, 
+0x000000FD, 0x0000001D, 0x0004003D, 0x00000006, 0x000000FE, 0x0000001C, 0x00050085, 0x00000006, 
+0x000000FF, 0x000000FD, 0x000000FE, 0x0003003E, 0x000000FC, 0x000000FF, 0x0004003D, 0x00000006, 
+0x00000101, 0x0000001C, 0x0004003D, 0x0000000C, 0x00000102, 0x000000FA, 0x0004003D, 0x0000000C, 
+0x00000103, 0x000000FA, 0x00050094, 0x00000006, 0x00000104, 0x00000102, 0x00000103, 0x0004003D, 
+0x00000006, 0x00000105, 0x000000FC, 0x0004003D, 0x00000006, 0x00000106, 0x000000FC, 0x00050085, 
+0x00000006, 0x00000107, 0x00000105, 0x00000106, 0x00050081, 0x00000006, 0x00000108, 0x00000104, 
+0x00000107, 0x00050088, 0x00000006, 0x00000109, 0x00000101, 0x00000108, 0x0003003E, 0x00000100, 
+0x00000109, 0x0004003D, 0x00000006, 0x0000010B, 0x00000100, 0x0004003D, 0x00000006, 0x0000010C, 
+0x00000100, 0x00050085, 0x00000006, 0x0000010D, 0x0000010B, 0x0000010C, 0x00050085, 0x00000006, 
+0x0000010F, 0x0000010D, 0x0000010E, 0x0003003E, 0x0000010A, 0x0000010F, 0x0004003D, 0x00000006, 
+0x00000110, 0x0000010A, 0x0007000C, 0x00000006, 0x00000112, 0x00000001, 0x00000025, 0x00000110, 
+0x00000111, 0x000200FE, 0x00000112, 0x00010038, 0x00050036, 0x0000000C, 0x00000026, 0x00000000, 
+0x00000022, 0x00030037, 0x0000000C, 0x00000023, 0x00030037, 0x00000007, 0x00000024, 0x00030037, 
+0x00000007, 0x00000025, 0x000200F8, 0x00000027, 0x0004003B, 0x00000007, 0x0000011A, 0x00000007, 
+0x0004003D, 0x00000006, 0x00000115, 0x00000024, 0x00060050, 0x0000000C, 0x00000116, 0x00000115, 
+0x00000115, 0x00000115, 0x00050083, 0x0000000C, 0x00000117, 0x00000116, 0x00000023, 0x0004003D, 
+0x00000006, 0x00000118, 0x00000025, 0x00050083, 0x00000006, 0x00000119, 0x000000D3, 0x00000118, 
+0x0003003E, 0x0000011A, 0x00000119, 0x00050039, 0x00000006, 0x0000011B, 0x0000000A, 0x0000011A, 
+0x0005008E, 0x0000000C, 0x0000011C, 0x00000117, 0x0000011B, 0x00050081, 0x0000000C, 0x0000011D, 
+0x00000023, 0x0000011C, 0x000200FE, 0x0000011D, 0x00010038, 0x00050036, 0x00000006, 0x0000002C, 
+0x00000000, 0x00000028, 0x00030037, 0x00000007, 0x00000029, 0x00030037, 0x00000007, 0x0000002A, 
+0x00030037, 0x00000007, 0x0000002B, 0x000200F8, 0x0000002D, 0x0004003D, 0x00000006, 0x00000120, 
+0x0000002A, 0x0004003D, 0x00000006, 0x00000121, 0x0000002B, 0x0004003D, 0x00000006, 0x00000122, 
+0x0000002A, 0x00050083, 0x00000006, 0x00000123, 0x00000121, 0x00000122, 0x0004003D, 0x00000006, 
+0x00000124, 0x00000029, 0x00050083, 0x00000006, 0x00000125, 0x000000D3, 0x00000124, 0x0007000C, 
+0x00000006, 0x00000127, 0x00000001, 0x0000001A, 0x00000125, 0x00000126, 0x00050085, 0x00000006, 
+0x00000128, 0x00000123, 0x00000127, 0x00050081, 0x00000006, 0x00000129, 0x00000120, 0x00000128, 
+0x000200FE, 0x00000129, 0x00010038, 0x00050036, 0x00000006, 0x00000033, 0x00000000, 0x0000002E, 
+0x00030037, 0x00000007, 0x0000002F, 0x00030037, 0x00000007, 0x00000030, 0x00030037, 0x00000007, 
+0x00000031, 0x00030037, 0x00000007, 0x00000032, 0x000200F8, 0x00000034, 0x0004003B, 0x00000007, 
+0x0000012C, 0x00000007, 0x0004003B, 0x00000007, 0x00000136, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000137, 0x00000007, 0x0004003B, 0x00000007, 0x00000138, 0x00000007, 0x0004003B, 0x00000007, 
+0x0000013A, 0x00000007, 0x0004003B, 0x00000007, 0x0000013D, 0x00000007, 0x0004003B, 0x00000007, 
+0x0000013E, 0x00000007, 0x0004003B, 0x00000007, 0x0000013F, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000141, 0x00000007, 0x0004003D, 0x00000006, 0x0000012F, 0x0000002F, 0x00050085, 0x00000006, 
+0x00000130, 0x0000012E, 0x0000012F, 0x0004003D, 0x00000006, 0x00000131, 0x00000032, 0x00050085, 
+0x00000006, 0x00000132, 0x00000130, 0x00000131, 0x0004003D, 0x00000006, 0x00000133, 0x00000032, 
+0x00050085, 0x00000006, 0x00000134, 0x00000132, 0x00000133, 0x00050081, 0x00000006, 0x00000135, 
+0x0000012D, 0x00000134, 0x0003003E, 0x0000012C, 0x00000135, 0x0003003E, 0x00000137, 0x000000D3, 
+0x0004003D, 0x00000006, 0x00000139, 0x0000012C, 0x0003003E, 0x00000138, 0x00000139, 0x0004003D, 
+0x00000006, 0x0000013B, 0x00000031, 0x0003003E, 0x0000013A, 0x0000013B, 0x00070039, 0x00000006, 
+0x0000013C, 0x0000002C, 0x00000137, 0x00000138, 0x0000013A, 0x0003003E, 0x00000136, 0x0000013C, 
+0x0003003E, 0x0000013E, 0x000000D3, 0x0004003D, 0x00000006, 0x00000140, 0x0000012C, 0x0003003E, 
+0x0000013F, 0x00000140, 0x0004003D, 0x00000006, 0x00000142, 0x00000030, 0x0003003E, 0x00000141, 
+0x00000142, 0x00070039, 0x00000006, 0x00000143, 0x0000002C, 0x0000013E, 0x0000013F, 0x00000141, 
+0x0003003E, 0x0000013D, 0x00000143, 0x0004003D, 0x00000006, 0x00000144, 0x00000136, 0x0004003D, 
+0x00000006, 0x00000145, 0x0000013D, 0x00050085, 0x00000006, 0x00000146, 0x00000144, 0x00000145, 
+0x00050085, 0x00000006, 0x00000147, 0x00000146, 0x0000010E, 0x000200FE, 0x00000147, 0x00010038, 
+0x00050036, 0x00000006, 0x00000038, 0x00000000, 0x00000028, 0x00030037, 0x00000007, 0x00000035, 
+0x00030037, 0x00000007, 0x00000036, 0x00030037, 0x00000007, 0x00000037, 0x000200F8, 0x00000039, 
+0x0004003B, 0x00000007, 0x0000014A, 0x00000007, 0x0004003B, 0x00000007, 0x0000014E, 0x00000007, 
+0x0004003B, 0x00000007, 0x0000015C, 0x00000007, 0x0004003D, 0x00000006, 0x0000014B, 0x00000037, 
+0x0004003D, 0x00000006, 0x0000014C, 0x00000037, 0x00050085, 0x00000006, 0x0000014D, 0x0000014B, 
+0x0000014C, 0x0003003E, 0x0000014A, 0x0000014D, 0x0004003D, 0x00000006, 0x0000014F, 0x00000035, 
+0x0004003D, 0x00000006, 0x00000150, 0x00000036, 0x0004007F, 0x00000006, 0x00000151, 0x00000150, 
+0x0004003D, 0x00000006, 0x00000152, 0x0000014A, 0x00050085, 0x00000006, 0x00000153, 0x00000151, 
+0x00000152, 0x0004003D, 0x00000006, 0x00000154, 0x00000036, 0x00050081, 0x00000006, 0x00000155, 
+0x00000153, 0x00000154, 0x0004003D, 0x00000006, 0x00000156, 0x00000036, 0x00050085, 0x00000006, 
+0x00000157, 0x00000155, 0x00000156, 0x0004003D, 0x00000006, 0x00000158, 0x0000014A, 0x00050081, 
+0x00000006, 0x00000159, 0x00000157, 0x00000158, 0x0006000C, 0x00000006, 0x0000015A, 0x00000001, 
+0x0000001F, 0x00000159, 0x00050085, 0x00000006, 0x0000015B, 0x0000014F, 0x0000015A, 0x0003003E, 
+0x0000014E, 0x0000015B, 0x0004003D, 0x00000006, 0x0000015D, 0x00000036, 0x0004003D, 0x00000006, 
+0x0000015E, 0x00000035, 0x0004007F, 0x00000006, 0x0000015F, 0x0000015E, 0x0004003D, 0x00000006, 
+0x00000160, 0x0000014A, 0x00050085, 0x00000006, 0x00000161, 0x0000015F, 0x00000160, 0x0004003D, 
+0x00000006, 0x00000162, 0x00000035, 0x00050081, 0x00000006, 0x00000163, 0x00000161, 0x00000162, 
+0x0004003D, 0x00000006, 0x00000164, 0x00000035, 0x00050085, 0x00000006, 0x00000165, 0x00000163, 
+0x00000164, 0x0004003D, 0x00000006, 0x00000166, 0x0000014A, 0x00050081, 0x00000006, 0x00000167, 
+0x00000165, 0x00000166, 0x0006000C, 0x00000006, 0x00000168, 0x00000001, 0x0000001F, 0x00000167, 
+0x00050085, 0x00000006, 0x00000169, 0x0000015D, 0x00000168, 0x0003003E, 0x0000015C, 0x00000169, 
+0x0004003D, 0x00000006, 0x0000016A, 0x0000015C, 0x0004003D, 0x00000006, 0x0000016B, 0x0000014E, 
+0x00050081, 0x00000006, 0x0000016C, 0x0000016A, 0x0000016B, 0x00050088, 0x00000006, 0x0000016D, 
+0x0000012D, 0x0000016C, 0x000200FE, 0x0000016D, 0x00010038, 0x00050036, 0x00000006, 0x0000003D, 
+0x00000000, 0x0000003A, 0x00030037, 0x00000007, 0x0000003B, 0x00030037, 0x00000007, 0x0000003C, 
+0x000200F8, 0x0000003E, 0x0004003B, 0x00000007, 0x00000170, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000176, 0x00000007, 0x0004003B, 0x00000007, 0x0000017A, 0x00000007, 0x0004003D, 0x00000006, 
+0x00000171, 0x0000003C, 0x0007000C, 0x00000006, 0x00000173, 0x00000001, 0x00000025, 0x00000171, 
+0x00000172, 0x00050083, 0x00000006, 0x00000174, 0x000000D3, 0x00000173, 0x0006000C, 0x00000006, 
+0x00000175, 0x00000001, 0x00000020, 0x00000174, 0x0003003E, 0x00000170, 0x00000175, 0x0004003D, 
+0x00000006, 0x00000177, 0x0000003B, 0x0004003D, 0x00000006, 0x00000178, 0x00000170, 0x00050085, 
+0x00000006, 0x00000179, 0x00000177, 0x00000178, 0x0003003E, 0x0000017A, 0x00000179, 0x00050039, 
+0x00000006, 0x0000017B, 0x00000019, 0x0000017A, 0x0003003E, 0x00000176, 0x0000017B, 0x0004003D, 
+0x00000006, 0x0000017C, 0x00000176, 0x0004003D, 0x00000006, 0x0000017D, 0x00000176, 0x00050085, 
+0x00000006, 0x0000017E, 0x0000017C, 0x0000017D, 0x000200FE, 0x0000017E, 0x00010038, 0x00050036, 
+0x00000006, 0x00000043, 0x00000000, 0x0000002E, 0x00030037, 0x00000007, 0x0000003F, 0x00030037, 
+0x00000007, 0x00000040, 0x00030037, 0x00000007, 0x00000041, 0x00030037, 0x00000007, 0x00000042, 
+0x000200F8, 0x00000044, 0x0004003B, 0x00000007, 0x00000181, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000183, 0x00000007, 0x0004003B, 0x00000007, 0x00000185, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000187, 0x00000007, 0x0004003D, 0x00000006, 0x00000182, 0x0000003F, 0x0003003E, 0x00000181, 
+0x00000182, 0x0004003D, 0x00000006, 0x00000184, 0x00000040, 0x0003003E, 0x00000183, 0x00000184, 
+0x0004003D, 0x00000006, 0x00000186, 0x00000041, 0x0003003E, 0x00000185, 0x00000186, 0x0004003D, 
+0x00000006, 0x00000188, 0x00000042, 0x0003003E, 0x00000187, 0x00000188, 0x00080039, 0x00000006, 
+0x00000189, 0x00000033, 0x00000181, 0x00000183, 0x00000185, 0x00000187, 0x000200FE, 0x00000189, 
+0x00010038, 0x00050036, 0x00000006, 0x00000046, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 
+0x00000045, 0x000200F8, 0x00000047, 0x0004003D, 0x00000006, 0x0000018C, 0x00000045, 0x0007000C, 
+0x00000006, 0x0000018E, 0x00000001, 0x00000028, 0x0000018C, 0x0000018D, 0x000200FE, 0x0000018E, 
+0x00010038, 0x00050036, 0x0000000C, 0x0000004B, 0x00000000, 0x00000048, 0x00030037, 0x00000012, 
+0x00000049, 0x00030037, 0x00000007, 0x0000004A, 0x000200F8, 0x0000004C, 0x0008004F, 0x0000000C, 
+0x00000191, 0x00000049, 0x00000049, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x00000006, 
+0x00000192, 0x0000004A, 0x00050083, 0x00000006, 0x00000193, 0x000000D3, 0x00000192, 0x0005008E, 
+0x0000000C, 0x00000194, 0x00000191, 0x00000193, 0x000200FE, 0x00000194, 0x00010038, 0x00050036, 
+0x0000000C, 0x00000051, 0x00000000, 0x0000004D, 0x00030037, 0x00000012, 0x0000004E, 0x00030037, 
+0x00000007, 0x0000004F, 0x00030037, 0x00000007, 0x00000050, 0x000200F8, 0x00000052, 0x0008004F, 
+0x0000000C, 0x00000197, 0x0000004E, 0x0000004E, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 
+0x00000006, 0x00000198, 0x0000004F, 0x0005008E, 0x0000000C, 0x00000199, 0x00000197, 0x00000198, 
+0x0004003D, 0x00000006, 0x0000019A, 0x00000050, 0x0004003D, 0x00000006, 0x0000019B, 0x0000004F, 
+0x00050083, 0x00000006, 0x0000019C, 0x000000D3, 0x0000019B, 0x00050085, 0x00000006, 0x0000019D, 
+0x0000019A, 0x0000019C, 0x00060050, 0x0000000C, 0x0000019E, 0x0000019D, 0x0000019D, 0x0000019D, 
+0x00050081, 0x0000000C, 0x0000019F, 0x00000199, 0x0000019E, 0x000200FE, 0x0000019F, 0x00010038, 
+0x00050036, 0x00000006, 0x00000054, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000053, 
+0x000200F8, 0x00000055, 0x0004003D, 0x00000006, 0x000001A3, 0x00000053, 0x00050085, 0x00000006, 
+0x000001A4, 0x000001A2, 0x000001A3, 0x0004003D, 0x00000006, 0x000001A5, 0x00000053, 0x00050085, 
+0x00000006, 0x000001A6, 0x000001A4, 0x000001A5, 0x000200FE, 0x000001A6, 0x00010038, 0x00050036, 
+0x00000006, 0x00000057, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000056, 0x000200F8, 
+0x00000058, 0x0004003D, 0x00000006, 0x000001A9, 0x00000056, 0x0004003D, 0x00000006, 0x000001AA, 
+0x00000056, 0x00050085, 0x00000006, 0x000001AB, 0x000001A9, 0x000001AA, 0x000200FE, 0x000001AB, 
+0x00010038, 0x00050036, 0x00000006, 0x0000005D, 0x00000000, 0x0000001B, 0x00030037, 0x00000007, 
+0x00000059, 0x00030037, 0x00000007, 0x0000005A, 0x00030037, 0x0000000C, 0x0000005B, 0x00030037, 
+0x0000000C, 0x0000005C, 0x000200F8, 0x0000005E, 0x0004003B, 0x00000007, 0x000001AE, 0x00000007, 
+0x0004003B, 0x00000007, 0x000001B0, 0x00000007, 0x0004003D, 0x00000006, 0x000001AF, 0x00000059, 
+0x0003003E, 0x000001AE, 0x000001AF, 0x0004003D, 0x00000006, 0x000001B1, 0x0000005A, 0x0003003E, 
+0x000001B0, 0x000001B1, 0x00080039, 0x00000006, 0x000001B2, 0x00000020, 0x000001AE, 0x000001B0, 
+0x0000005C, 0x0000005B, 0x000200FE, 0x000001B2, 0x00010038, 0x00050036, 0x00000006, 0x00000062, 
+0x00000000, 0x00000028, 0x00030037, 0x00000007, 0x0000005F, 0x00030037, 0x00000007, 0x00000060, 
+0x00030037, 0x00000007, 0x00000061, 0x000200F8, 0x00000063, 0x0004003B, 0x00000007, 0x000001B5, 
+0x00000007, 0x0004003B, 0x00000007, 0x000001B7, 0x00000007, 0x0004003B, 0x00000007, 0x000001B9, 
+0x00000007, 0x0004003D, 0x00000006, 0x000001B6, 0x0000005F, 0x0003003E, 0x000001B5, 0x000001B6, 
+0x0004003D, 0x00000006, 0x000001B8, 0x00000060, 0x0003003E, 0x000001B7, 0x000001B8, 0x0004003D, 
+0x00000006, 0x000001BA, 0x00000061, 0x0003003E, 0x000001B9, 0x000001BA, 0x00070039, 0x00000006, 
+0x000001BB, 0x00000038, 0x000001B5, 0x000001B7, 0x000001B9, 0x000200FE, 0x000001BB, 0x00010038, 
+0x00050036, 0x0000000C, 0x00000067, 0x00000000, 0x00000064, 0x00030037, 0x0000000C, 0x00000065, 
+0x00030037, 0x00000007, 0x00000066, 0x000200F8, 0x00000068, 0x0004003B, 0x00000007, 0x000001BE, 
+0x00000007, 0x0004003B, 0x00000007, 0x000001C2, 0x00000007, 0x0004003B, 0x00000007, 0x000001C4, 
+0x00000007, 0x0004003B, 0x00000007, 0x000001C6, 0x00000007, 0x00050094, 0x00000006, 0x000001C1, 
+0x00000065, 0x000001C0, 0x0003003E, 0x000001C2, 0x000001C1, 0x00050039, 0x00000006, 0x000001C3, 
+0x00000019, 0x000001C2, 0x0003003E, 0x000001BE, 0x000001C3, 0x0004003D, 0x00000006, 0x000001C5, 
+0x000001BE, 0x0003003E, 0x000001C4, 0x000001C5, 0x0004003D, 0x00000006, 0x000001C7, 0x00000066, 
+0x0003003E, 0x000001C6, 0x000001C7, 0x00070039, 0x0000000C, 0x000001C8, 0x00000026, 0x00000065, 
+0x000001C4, 0x000001C6, 0x000200FE, 0x000001C8, 0x00010038, 0x00050036, 0x0000000C, 0x0000006D, 
+0x00000000, 0x00000069, 0x00030037, 0x0000000D, 0x0000006A, 0x00030037, 0x00000007, 0x0000006B, 
+0x00030037, 0x00000007, 0x0000006C, 0x000200F8, 0x0000006E, 0x0004003D, 0x0000000C, 0x000001CB, 
+0x0000006A, 0x0004003D, 0x00000006, 0x000001CC, 0x0000006C, 0x00050083, 0x00000006, 0x000001CD, 
+0x000000D3, 0x000001CC, 0x00060050, 0x0000000C, 0x000001CE, 0x000001CD, 0x000001CD, 0x000001CD, 
+0x0004003D, 0x0000000C, 0x000001CF, 0x0000006A, 0x0007000C, 0x0000000C, 0x000001D0, 0x00000001, 
+0x00000028, 0x000001CE, 0x000001CF, 0x0004003D, 0x0000000C, 0x000001D1, 0x0000006A, 0x00050083, 
+0x0000000C, 0x000001D2, 0x000001D0, 0x000001D1, 0x0004003D, 0x00000006, 0x000001D3, 0x0000006B, 
+0x00050083, 0x00000006, 0x000001D4, 0x000000D3, 0x000001D3, 0x0007000C, 0x00000006, 0x000001D5, 
+0x00000001, 0x00000028, 0x000001D4, 0x000000F6, 0x0007000C, 0x00000006, 0x000001D6, 0x00000001, 
+0x0000001A, 0x000001D5, 0x00000126, 0x0005008E, 0x0000000C, 0x000001D7, 0x000001D2, 0x000001D6, 
+0x00050081, 0x0000000C, 0x000001D8, 0x000001CB, 0x000001D7, 0x000200FE, 0x000001D8, 0x00010038, 
+0x00050036, 0x00000012, 0x00000070, 0x00000000, 0x0000006F, 0x000200F8, 0x00000071, 0x0004003B, 
+0x00000013, 0x00000202, 0x00000007, 0x00050041, 0x000001DF, 0x000001E0, 0x000001DD, 0x000001DE, 
+0x0004003D, 0x00000006, 0x000001E1, 0x000001E0, 0x000500B8, 0x000001E3, 0x000001E4, 0x000001E1, 
+0x000001E2, 0x000300F7, 0x000001E6, 0x00000000, 0x000400FA, 0x000001E4, 0x000001E5, 0x000001E6, 
+0x000200F8, 0x000001E5, 0x00050041, 0x000001E8, 0x000001E9, 0x000001DD, 0x000001E7, 0x0004003D, 
+0x00000012, 0x000001EA, 0x000001E9, 0x000200FE, 0x000001EA, 0x000200F8, 0x000001E6, 0x00050041, 
+0x000001DF, 0x000001EC, 0x000001DD, 0x000001DE, 0x0004003D, 0x00000006, 0x000001ED, 0x000001EC, 
+0x00050083, 0x00000006, 0x000001EE, 0x000000D3, 0x000001ED, 0x00050041, 0x000001E8, 0x000001EF, 
+0x000001DD, 0x000001E7, 0x0004003D, 0x00000012, 0x000001F0, 0x000001EF, 0x0005008E, 0x00000012, 
+0x000001F1, 0x000001F0, 0x000001EE, 0x00050041, 0x000001DF, 0x000001F2, 0x000001DD, 0x000001DE, 
+0x0004003D, 0x00000006, 0x000001F3, 0x000001F2, 0x0004003D, 0x000001F5, 0x000001F8, 0x000001F7, 
+0x00050041, 0x000001FE, 0x000001FF, 0x000001FC, 0x000001FD, 0x0004003D, 0x0000007D, 0x00000200, 
+0x000001FF, 0x00050057, 0x00000012, 0x00000201, 0x000001F8, 0x00000200, 0x0003003E, 0x00000202, 
+0x00000201, 0x00050039, 0x00000012, 0x00000203, 0x00000016, 0x00000202, 0x0005008E, 0x00000012, 
+0x00000204, 0x00000203, 0x000001F3, 0x00050081, 0x00000012, 0x00000205, 0x000001F1, 0x00000204, 
+0x000200FE, 0x00000205, 0x00010038, 0x00050036, 0x0000000C, 0x00000073, 0x00000000, 0x00000072, 
+0x000200F8, 0x00000074, 0x00050041, 0x000001DF, 0x00000209, 0x000001DD, 0x00000208, 0x0004003D, 
+0x00000006, 0x0000020A, 0x00000209, 0x000500B8, 0x000001E3, 0x0000020B, 0x0000020A, 0x000001E2, 
+0x000300F7, 0x0000020D, 0x00000000, 0x000400FA, 0x0000020B, 0x0000020C, 0x0000020D, 0x000200F8, 
+0x0000020C, 0x00050041, 0x000001DF, 0x0000020F, 0x000001DD, 0x0000020E, 0x0004003D, 0x00000006, 
+0x00000210, 0x0000020F, 0x00060050, 0x0000000C, 0x00000211, 0x00000210, 0x00000210, 0x00000210, 
+0x000200FE, 0x00000211, 0x000200F8, 0x0000020D, 0x00050041, 0x000001DF, 0x00000213, 0x000001DD, 
+0x00000208, 0x0004003D, 0x00000006, 0x00000214, 0x00000213, 0x00050083, 0x00000006, 0x00000215, 
+0x000000D3, 0x00000214, 0x00050041, 0x000001DF, 0x00000216, 0x000001DD, 0x0000020E, 0x0004003D, 
+0x00000006, 0x00000217, 0x00000216, 0x00050085, 0x00000006, 0x00000218, 0x00000215, 0x00000217, 
+0x00050041, 0x000001DF, 0x00000219, 0x000001DD, 0x00000208, 0x0004003D, 0x00000006, 0x0000021A, 
+0x00000219, 0x0004003D, 0x000001F5, 0x0000021C, 0x0000021B, 0x00050041, 0x000001FE, 0x0000021D, 
+0x000001FC, 0x000001FD, 0x0004003D, 0x0000007D, 0x0000021E, 0x0000021D, 0x00050057, 0x00000012, 
+0x0000021F, 0x0000021C, 0x0000021E, 0x0008004F, 0x0000000C, 0x00000220, 0x0000021F, 0x0000021F, 
+0x00000000, 0x00000001, 0x00000002, 0x0005008E, 0x0000000C, 0x00000221, 0x00000220, 0x0000021A, 
+0x00060050, 0x0000000C, 0x00000222, 0x00000218, 0x00000218, 0x00000218, 0x00050081, 0x0000000C, 
+0x00000223, 0x00000222, 0x00000221, 0x000200FE, 0x00000223, 0x00010038, 0x00050036, 0x00000006, 
+0x00000076, 0x00000000, 0x00000075, 0x000200F8, 0x00000077, 0x00050041, 0x000001DF, 0x00000227, 
+0x000001DD, 0x00000226, 0x0004003D, 0x00000006, 0x00000228, 0x00000227, 0x000500B8, 0x000001E3, 
+0x00000229, 0x00000228, 0x000001E2, 0x000300F7, 0x0000022B, 0x00000000, 0x000400FA, 0x00000229, 
+0x0000022A, 0x0000022B, 0x000200F8, 0x0000022A, 0x00050041, 0x000001DF, 0x0000022C, 0x000001DD, 
+0x000001FD, 0x0004003D, 0x00000006, 0x0000022D, 0x0000022C, 0x000200FE, 0x0000022D, 0x000200F8, 
+0x0000022B, 0x00050041, 0x000001DF, 0x0000022F, 0x000001DD, 0x00000226, 0x0004003D, 0x00000006, 
+0x00000230, 0x0000022F, 0x00050083, 0x00000006, 0x00000231, 0x000000D3, 0x00000230, 0x00050041, 
+0x000001DF, 0x00000232, 0x000001DD, 0x000001FD, 0x0004003D, 0x00000006, 0x00000233, 0x00000232, 
+0x00050085, 0x00000006, 0x00000234, 0x00000231, 0x00000233, 0x00050041, 0x000001DF, 0x00000235, 
+0x000001DD, 0x00000226, 0x0004003D, 0x00000006, 0x00000236, 0x00000235, 0x0004003D, 0x000001F5, 
+0x00000238, 0x00000237, 0x00050041, 0x000001FE, 0x00000239, 0x000001FC, 0x000001FD, 0x0004003D, 
+0x0000007D, 0x0000023A, 0x00000239, 0x00050057, 0x00000012, 0x0000023B, 0x00000238, 0x0000023A, 
+0x00050051, 0x00000006, 0x0000023D, 0x0000023B, 0x00000000, 0x00050085, 0x00000006, 0x0000023E, 
+0x00000236, 0x0000023D, 0x00050081, 0x00000006, 0x0000023F, 0x00000234, 0x0000023E, 0x000200FE, 
+0x0000023F, 0x00010038, 0x00050036, 0x00000006, 0x00000078, 0x00000000, 0x00000075, 0x000200F8, 
+0x00000079, 0x00050041, 0x000001DF, 0x00000243, 0x000001DD, 0x00000242, 0x0004003D, 0x00000006, 
+0x00000244, 0x00000243, 0x000500B8, 0x000001E3, 0x00000245, 0x00000244, 0x000001E2, 0x000300F7, 
+0x00000247, 0x00000000, 0x000400FA, 0x00000245, 0x00000246, 0x00000247, 0x000200F8, 0x00000246, 
+0x000200FE, 0x000000D3, 0x000200F8, 0x00000247, 0x00050041, 0x000001DF, 0x00000249, 0x000001DD, 
+0x00000242, 0x0004003D, 0x00000006, 0x0000024A, 0x00000249, 0x00050083, 0x00000006, 0x0000024B, 
+0x000000D3, 0x0000024A, 0x00050041, 0x000001DF, 0x0000024C, 0x000001DD, 0x00000242, 0x0004003D, 
+0x00000006, 0x0000024D, 0x0000024C, 0x0004003D, 0x000001F5, 0x0000024F, 0x0000024E, 0x00050041, 
+0x000001FE, 0x00000250, 0x000001FC, 0x000001FD, 0x0004003D, 0x0000007D, 0x00000251, 0x00000250, 
+0x00050057, 0x00000012, 0x00000252, 0x0000024F, 0x00000251, 0x00050051, 0x00000006, 0x00000253, 
+0x00000252, 0x00000000, 0x00050085, 0x00000006, 0x00000254, 0x0000024D, 0x00000253, 0x00050081, 
+0x00000006, 0x00000255, 0x0000024B, 0x00000254, 0x000200FE, 0x00000255, 0x00010038, 0x00050036, 
+0x0000000C, 0x0000007B, 0x00000000, 0x0000000E, 0x00030037, 0x0000000D, 0x0000007A, 0x000200F8, 
+0x0000007C, 0x0004003B, 0x0000000D, 0x0000026F, 0x00000007, 0x00050041, 0x000001DF, 0x00000259, 
+0x000001DD, 0x00000258, 0x0004003D, 0x00000006, 0x0000025A, 0x00000259, 0x000500B8, 0x000001E3, 
+0x0000025B, 0x0000025A, 0x000001E2, 0x000300F7, 0x0000025D, 0x00000000, 0x000400FA, 0x0000025B, 
+0x0000025C, 0x0000025D, 0x000200F8, 0x0000025C, 0x00050041, 0x000001DF, 0x0000025F, 0x000001DD, 
+0x0000025E, 0x0004003D, 0x00000006, 0x00000260, 0x0000025F, 0x0004003D, 0x0000000C, 0x00000261, 
+0x0000007A, 0x0005008E, 0x0000000C, 0x00000262, 0x00000261, 0x00000260, 0x000200FE, 0x00000262, 
+0x000200F8, 0x0000025D, 0x00050041, 0x000001DF, 0x00000264, 0x000001DD, 0x0000025E, 0x0004003D, 
+0x00000006, 0x00000265, 0x00000264, 0x0004003D, 0x0000000C, 0x00000266, 0x0000007A, 0x0005008E, 
+0x0000000C, 0x00000267, 0x00000266, 0x00000265, 0x00050041, 0x000001DF, 0x00000268, 0x000001DD, 
+0x00000258, 0x0004003D, 0x00000006, 0x00000269, 0x00000268, 0x0004003D, 0x000001F5, 0x0000026B, 
+0x0000026A, 0x00050041, 0x000001FE, 0x0000026C, 0x000001FC, 0x000001FD, 0x0004003D, 0x0000007D, 
+0x0000026D, 0x0000026C, 0x00050057, 0x00000012, 0x0000026E, 0x0000026B, 0x0000026D, 0x0008004F, 
+0x0000000C, 0x00000270, 0x0000026E, 0x0000026E, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 
+0x0000026F, 0x00000270, 0x00050039, 0x0000000C, 0x00000271, 0x00000010, 0x0000026F, 0x0005008E, 
+0x0000000C, 0x00000272, 0x00000271, 0x00000269, 0x00050081, 0x0000000C, 0x00000273, 0x00000267, 
+0x00000272, 0x000200FE, 0x00000273, 0x00010038, 0x00050036, 0x00000006, 0x00000081, 0x00000000, 
+0x0000007F, 0x00030037, 0x0000007E, 0x00000080, 0x000200F8, 0x00000082, 0x0004003D, 0x0000007D, 
+0x00000276, 0x00000080, 0x00050094, 0x00000006, 0x0000027A, 0x00000276, 0x00000279, 0x0006000C, 
+0x00000006, 0x0000027B, 0x00000001, 0x0000000D, 0x0000027A, 0x00050085, 0x00000006, 0x0000027D, 
+0x0000027B, 0x0000027C, 0x0006000C, 0x00000006, 0x0000027E, 0x00000001, 0x0000000A, 0x0000027D, 
+0x000200FE, 0x0000027E, 0x00010038, 0x00050036, 0x0000007D, 0x00000089, 0x00000000, 0x00000085, 
+0x00030037, 0x00000084, 0x00000086, 0x00030037, 0x00000084, 0x00000087, 0x00030037, 0x00000007, 
+0x00000088, 0x000200F8, 0x0000008A, 0x0004003B, 0x00000007, 0x00000281, 0x00000007, 0x0004003B, 
+0x00000007, 0x00000283, 0x00000007, 0x0004003B, 0x00000007, 0x0000028C, 0x00000007, 0x0004003B, 
+0x00000007, 0x00000293, 0x00000007, 0x0004003B, 0x00000007, 0x00000296, 0x00000007, 0x0003003E, 
+0x00000281, 0x00000282, 0x0004003D, 0x00000083, 0x00000284, 0x00000086, 0x0004006F, 0x00000006, 
+0x00000285, 0x00000284, 0x00050081, 0x00000006, 0x00000286, 0x00000285, 0x0000012D, 0x0006000C, 
+0x00000006, 0x00000287, 0x00000001, 0x0000001F, 0x00000286, 0x0004003D, 0x00000083, 0x00000288, 
+0x00000087, 0x0004006F, 0x00000006, 0x00000289, 0x00000288, 0x0006000C, 0x00000006, 0x0000028A, 
+0x00000001, 0x0000001F, 0x00000289, 0x00050088, 0x00000006, 0x0000028B, 0x00000287, 0x0000028A, 
+0x0003003E, 0x00000283, 0x0000028B, 0x0004003D, 0x00000083, 0x0000028D, 0x00000086, 0x0004006F, 
+0x00000006, 0x0000028E, 0x0000028D, 0x0004003D, 0x00000006, 0x0000028F, 0x00000281, 0x00050085, 
+0x00000006, 0x00000290, 0x0000028E, 0x0000028F, 0x0004003D, 0x00000006, 0x00000291, 0x00000088, 
+0x00050081, 0x00000006, 0x00000292, 0x00000290, 0x00000291, 0x0003003E, 0x0000028C, 0x00000292, 
+0x0004003D, 0x00000006, 0x00000294, 0x0000028C, 0x0006000C, 0x00000006, 0x00000295, 0x00000001, 
+0x0000000D, 0x00000294, 0x0003003E, 0x00000293, 0x00000295, 0x0004003D, 0x00000006, 0x00000297, 
+0x0000028C, 0x0006000C, 0x00000006, 0x00000298, 0x00000001, 0x0000000E, 0x00000297, 0x0003003E, 
+0x00000296, 0x00000298, 0x0004003D, 0x00000006, 0x00000299, 0x00000283, 0x0004003D, 0x00000006, 
+0x0000029A, 0x00000296, 0x00050085, 0x00000006, 0x0000029B, 0x00000299, 0x0000029A, 0x0004003D, 
+0x00000006, 0x0000029C, 0x00000283, 0x0004003D, 0x00000006, 0x0000029D, 0x00000293, 0x00050085, 
+0x00000006, 0x0000029E, 0x0000029C, 0x0000029D, 0x00050050, 0x0000007D, 0x0000029F, 0x0000029B, 
+0x0000029E, 0x000200FE, 0x0000029F, 0x00010038, 0x00050036, 0x00000006, 0x0000008F, 0x00000000, 
+0x0000008B, 0x00030037, 0x0000000D, 0x0000008C, 0x00030037, 0x0000000D, 0x0000008D, 0x00030037, 
+0x00000084, 0x0000008E, 0x000200F8, 0x00000090, 0x0004003B, 0x00000007, 0x000002A2, 0x00000007, 
+0x0004003B, 0x00000007, 0x000002B0, 0x00000007, 0x00050041, 0x000001DF, 0x000002AE, 0x000002AC, 
+0x000005A6, 0x0004003D, 0x00000006, 0x000002AF, 0x000002AE, 0x0003003E, 0x000002A2, 0x000002AF, 
+0x0004003D, 0x00000006, 0x000002B1, 0x000002A2, 0x0004003D, 0x0000000C, 0x000002B2, 0x0000008D, 
+0x0004003D, 0x0000000C, 0x000002B3, 0x0000008C, 0x00050094, 0x00000006, 0x000002B4, 0x000002B2, 
+0x000002B3, 0x00050083, 0x00000006, 0x000002B5, 0x000000D3, 0x000002B4, 0x00050085, 0x00000006, 
+0x000002B6, 0x000002B1, 0x000002B5, 0x0004003D, 0x00000006, 0x000002B7, 0x000002A2, 0x0007000C, 
+0x00000006, 0x000002B8, 0x00000001, 0x00000028, 0x000002B6, 0x000002B7, 0x0003003E, 0x000002B0, 
+0x000002B8, 0x0004003D, 0x00000006, 0x000002B9, 0x000002B0, 0x000200FE, 0x000002B9, 0x00010038, 
+0x00050036, 0x00000006, 0x0000009C, 0x00000000, 0x00000094, 0x00030037, 0x00000093, 0x00000095, 
+0x00030037, 0x00000013, 0x00000096, 0x00030037, 0x00000007, 0x00000097, 0x00030037, 0x0000000D, 
+0x00000098, 0x00030037, 0x0000000D, 0x00000099, 0x00030037, 0x0000000D, 0x0000009A, 0x00030037, 
+0x00000084, 0x0000009B, 0x000200F8, 0x0000009D, 0x0004003B, 0x00000007, 0x000002BC, 0x00000007, 
+0x0004003B, 0x0000000D, 0x000002BD, 0x00000007, 0x0004003B, 0x0000000D, 0x000002BF, 0x00000007, 
+0x0004003B, 0x00000084, 0x000002C1, 0x00000007, 0x0004003B, 0x00000007, 0x000002C4, 0x00000007, 
+0x0004003B, 0x00000007, 0x000002C5, 0x00000007, 0x0004003B, 0x0000007E, 0x000002C6, 0x00000007, 
+0x0004003B, 0x00000084, 0x000002CA, 0x00000007, 0x0004003B, 0x0000007E, 0x000002D3, 0x00000007, 
+0x0004003B, 0x00000084, 0x000002D4, 0x00000007, 0x0004003B, 0x00000084, 0x000002D6, 0x00000007, 
+0x0004003B, 0x00000007, 0x000002D7, 0x00000007, 0x0004003B, 0x00000007, 0x000002DD, 0x00000007, 
+0x0004003D, 0x0000000C, 0x000002BE, 0x00000098, 0x0003003E, 0x000002BD, 0x000002BE, 0x0004003D, 
+0x0000000C, 0x000002C0, 0x00000099, 0x0003003E, 0x000002BF, 0x000002C0, 0x0004003D, 0x00000083, 
+0x000002C2, 0x0000009B, 0x0003003E, 0x000002C1, 0x000002C2, 0x00070039, 0x00000006, 0x000002C3, 
+0x0000008F, 0x000002BD, 0x000002BF, 0x000002C1, 0x0003003E, 0x000002BC, 0x000002C3, 0x0003003E, 
+0x000002C4, 0x000000F6, 0x0004003D, 0x0000000C, 0x000002C7, 0x0000009A, 0x0007004F, 0x0000007D, 
+0x000002C8, 0x000002C7, 0x000002C7, 0x00000000, 0x00000001, 0x0003003E, 0x000002C6, 0x000002C8, 
+0x00050039, 0x00000006, 0x000002C9, 0x00000081, 0x000002C6, 0x0003003E, 0x000002C5, 0x000002C9, 
+0x0003003E, 0x000002CA, 0x000001E7, 0x000200F9, 0x000002CB, 0x000200F8, 0x000002CB, 0x000400F6, 
+0x000002CD, 0x000002CE, 0x00000000, 0x000200F9, 0x000002CF, 0x000200F8, 0x000002CF, 0x0004003D, 
+0x00000083, 0x000002D0, 0x000002CA, 0x000500B1, 0x000001E3, 0x000002D2, 0x000002D0, 0x000002D1, 
+0x000400FA, 0x000002D2, 0x000002CC, 0x000002CD, 0x000200F8, 0x000002CC, 0x0004003D, 0x00000083, 
+0x000002D5, 0x000002CA, 0x0003003E, 0x000002D4, 0x000002D5, 0x0003003E, 0x000002D6, 0x000002D1, 
+0x0004003D, 0x00000006, 0x000002D8, 0x000002C5, 0x0003003E, 0x000002D7, 0x000002D8, 0x00070039, 
+0x0000007D, 0x000002D9, 0x00000089, 0x000002D4, 0x000002D6, 0x000002D7, 0x00050050, 0x0000007D, 
+0x000002DB, 0x000002DA, 0x000002DA, 0x00050088, 0x0000007D, 0x000002DC, 0x000002D9, 0x000002DB, 
+0x0003003E, 0x000002D3, 0x000002DC, 0x0004003D, 0x00000092, 0x000002DE, 0x00000095, 0x0004003D, 
+0x00000012, 0x000002DF, 0x00000096, 0x0007004F, 0x0000007D, 0x000002E0, 0x000002DF, 0x000002DF, 
+0x00000000, 0x00000001, 0x0004003D, 0x0000007D, 0x000002E1, 0x000002D3, 0x00050081, 0x0000007D, 
+0x000002E2, 0x000002E0, 0x000002E1, 0x0004003D, 0x00000083, 0x000002E3, 0x0000009B, 0x0004006F, 
+0x00000006, 0x000002E4, 0x000002E3, 0x00050051, 0x00000006, 0x000002E5, 0x000002E2, 0x00000000, 
+0x00050051, 0x00000006, 0x000002E6, 0x000002E2, 0x00000001, 0x00060050, 0x0000000C, 0x000002E7, 
+0x000002E5, 0x000002E6, 0x000002E4, 0x00050057, 0x00000012, 0x000002E8, 0x000002DE, 0x000002E7, 
+0x00050051, 0x00000006, 0x000002E9, 0x000002E8, 0x00000000, 0x0003003E, 0x000002DD, 0x000002E9, 
+0x00050041, 0x00000007, 0x000002EB, 0x00000096, 0x000002EA, 0x0004003D, 0x00000006, 0x000002EC, 
+0x000002EB, 0x0004003D, 0x00000006, 0x000002ED, 0x000002BC, 0x00050083, 0x00000006, 0x000002EE, 
+0x000002EC, 0x000002ED, 0x0004003D, 0x00000006, 0x000002EF, 0x000002DD, 0x0007000C, 0x00000006, 
+0x000002F0, 0x00000001, 0x00000030, 0x000002EE, 0x000002EF, 0x0004003D, 0x00000006, 0x000002F1, 
+0x000002C4, 0x00050081, 0x00000006, 0x000002F2, 0x000002F1, 0x000002F0, 0x0003003E, 0x000002C4, 
+0x000002F2, 0x000200F9, 0x000002CE, 0x000200F8, 0x000002CE, 0x0004003D, 0x00000083, 0x000002F3, 
+0x000002CA, 0x00050080, 0x00000083, 0x000002F4, 0x000002F3, 0x000001FD, 0x0003003E, 0x000002CA, 
+0x000002F4, 0x000200F9, 0x000002CB, 0x000200F8, 0x000002CD, 0x0004003D, 0x00000006, 0x000002F5, 
+0x000002C4, 0x00050088, 0x00000006, 0x000002F7, 0x000002F5, 0x000002F6, 0x000200FE, 0x000002F7, 
+0x00010038, 0x00050036, 0x00000083, 0x000000A0, 0x00000000, 0x0000009E, 0x00030037, 0x0000000D, 
+0x0000009F, 0x000200F8, 0x000000A1, 0x0004003B, 0x00000084, 0x000002FA, 0x00000007, 0x0004003B, 
+0x00000013, 0x000002FB, 0x00000007, 0x0004003B, 0x00000084, 0x00000305, 0x00000007, 0x0003003E, 
+0x000002FA, 0x000001E7, 0x00050041, 0x000002FC, 0x000002FD, 0x000002AC, 0x000001FD, 0x0004003D, 
+0x000002A6, 0x000002FE, 0x000002FD, 0x0004003D, 0x0000000C, 0x000002FF, 0x0000009F, 0x00050051, 
+0x00000006, 0x00000300, 0x000002FF, 0x00000000, 0x00050051, 0x00000006, 0x00000301, 0x000002FF, 
+0x00000001, 0x00050051, 0x00000006, 0x00000302, 0x000002FF, 0x00000002, 0x00070050, 0x00000012, 
+0x00000303, 0x00000300, 0x00000301, 0x00000302, 0x000000D3, 0x00050091, 0x00000012, 0x00000304, 
+0x000002FE, 0x00000303, 0x0003003E, 0x000002FB, 0x00000304, 0x0003003E, 0x00000305, 0x000001E7, 
+0x000200F9, 0x00000306, 0x000200F8, 0x00000306, 0x000400F6, 0x00000308, 0x00000309, 0x00000000, 
+0x000200F9, 0x0000030A, 0x000200F8, 0x0000030A, 0x0004003D, 0x00000083, 0x0000030B, 0x00000305, 
+0x00050041, 0x0000030D, 0x0000030E, 0x000002AC, 0x000004ED, 0x0004003D, 0x00000083, 0x0000030F, 
+0x0000030E, 0x00050082, 0x00000083, 0x00000310, 0x0000030F, 0x000001FD, 0x000500B1, 0x000001E3, 
+0x00000311, 0x0000030B, 0x00000310, 0x000400FA, 0x00000311, 0x00000307, 0x00000308, 0x000200F8, 
+0x00000307, 0x00050041, 0x00000007, 0x00000312, 0x000002FB, 0x000002EA, 0x0004003D, 0x00000006, 
+0x00000313, 0x00000312, 0x0004003D, 0x00000083, 0x00000314, 0x00000305, 0x00070041, 0x000001DF, 
+0x00000315, 0x000002AC, 0x000002D1, 0x00000314, 0x0000023C, 0x0004003D, 0x00000006, 0x00000316, 
+0x00000315, 0x000500B8, 0x000001E3, 0x00000317, 0x00000313, 0x00000316, 0x000300F7, 0x00000319, 
+0x00000000, 0x000400FA, 0x00000317, 0x00000318, 0x00000319, 0x000200F8, 0x00000318, 0x0004003D, 
+0x00000083, 0x0000031A, 0x00000305, 0x00050080, 0x00000083, 0x0000031B, 0x0000031A, 0x000001FD, 
+0x0003003E, 0x000002FA, 0x0000031B, 0x000200F9, 0x00000319, 0x000200F8, 0x00000319, 0x000200F9, 
+0x00000309, 0x000200F8, 0x00000309, 0x0004003D, 0x00000083, 0x0000031C, 0x00000305, 0x00050080, 
+0x00000083, 0x0000031D, 0x0000031C, 0x000001FD, 0x0003003E, 0x00000305, 0x0000031D, 0x000200F9, 
+0x00000306, 0x000200F8, 0x00000308, 0x0004003D, 0x00000083, 0x0000031E, 0x000002FA, 0x000200FE, 
+0x0000031E, 0x00010038, 0x00050036, 0x00000006, 0x000000A7, 0x00000000, 0x000000A2, 0x00030037, 
+0x0000000D, 0x000000A3, 0x00030037, 0x00000084, 0x000000A4, 0x00030037, 0x0000000D, 0x000000A5, 
+0x00030037, 0x0000000D, 0x000000A6, 0x000200F8, 0x000000A8, 0x0004003B, 0x00000013, 0x00000321, 
+0x00000007, 0x0004003B, 0x00000007, 0x00000333, 0x00000007, 0x0004003B, 0x00000007, 0x00000335, 
+0x00000007, 0x0004003B, 0x00000013, 0x00000340, 0x00000007, 0x0004003B, 0x00000007, 0x00000349, 
+0x00000007, 0x0004003B, 0x00000013, 0x0000034B, 0x00000007, 0x0004003B, 0x00000007, 0x0000034D, 
+0x00000007, 0x0004003B, 0x0000000D, 0x0000034F, 0x00000007, 0x0004003B, 0x0000000D, 0x00000351, 
+0x00000007, 0x0004003B, 0x0000000D, 0x00000353, 0x00000007, 0x0004003B, 0x00000084, 0x00000355, 
+0x00000007, 0x0004003B, 0x00000007, 0x00000358, 0x00000007, 0x0004003B, 0x00000084, 0x00000365, 
+0x00000007, 0x0004003B, 0x00000007, 0x0000037F, 0x00000007, 0x0004003B, 0x00000013, 0x00000380, 
+0x00000007, 0x0004003B, 0x00000007, 0x00000382, 0x00000007, 0x0004003B, 0x0000000D, 0x00000384, 
+0x00000007, 0x0004003B, 0x0000000D, 0x00000386, 0x00000007, 0x0004003B, 0x0000000D, 0x00000388, 
+0x00000007, 0x0004003B, 0x00000084, 0x0000038A, 0x00000007, 0x00050041, 0x000002FC, 0x00000322, 
+0x000002AC, 0x000003E6, 0x0004003D, 0x000002A6, 0x00000323, 0x00000322, 0x0004003D, 0x00000083, 
+0x00000324, 0x000000A4, 0x00060041, 0x000002FC, 0x00000325, 0x000002AC, 0x000001E7, 0x00000324, 
+0x0004003D, 0x000002A6, 0x00000326, 0x00000325, 0x00050092, 0x000002A6, 0x00000327, 0x00000323, 
+0x00000326, 0x0004003D, 0x0000000C, 0x00000328, 0x000000A3, 0x00050051, 0x00000006, 0x00000329, 
+0x00000328, 0x00000000, 0x00050051, 0x00000006, 0x0000032A, 0x00000328, 0x00000001, 0x00050051, 
+0x00000006, 0x0000032B, 0x00000328, 0x00000002, 0x00070050, 0x00000012, 0x0000032C, 0x00000329, 
+0x0000032A, 0x0000032B, 0x000000D3, 0x00050091, 0x00000012, 0x0000032D, 0x00000327, 0x0000032C, 
+0x0003003E, 0x00000321, 0x0000032D, 0x0004003D, 0x00000012, 0x0000032E, 0x00000321, 0x00050041, 
+0x00000007, 0x0000032F, 0x00000321, 0x000000EC, 0x0004003D, 0x00000006, 0x00000330, 0x0000032F, 
+0x00050088, 0x00000006, 0x00000331, 0x000000D3, 0x00000330, 0x0005008E, 0x00000012, 0x00000332, 
+0x0000032E, 0x00000331, 0x0003003E, 0x00000321, 0x00000332, 0x0003003E, 0x00000333, 0x00000334, 
+0x00050041, 0x000001DF, 0x00000336, 0x000002AC, 0x00000258, 0x0004003D, 0x00000006, 0x00000337, 
+0x00000336, 0x0004003D, 0x00000006, 0x00000338, 0x00000333, 0x00050085, 0x00000006, 0x00000339, 
+0x00000337, 0x00000338, 0x00050041, 0x00000007, 0x0000033A, 0x00000321, 0x000002EA, 0x0004003D, 
+0x00000006, 0x0000033B, 0x0000033A, 0x00050088, 0x00000006, 0x0000033C, 0x00000339, 0x0000033B, 
+0x0003003E, 0x00000335, 0x0000033C, 0x0004003D, 0x00000006, 0x0000033D, 0x00000335, 0x0007000C, 
+0x00000006, 0x0000033F, 0x00000001, 0x00000025, 0x0000033D, 0x0000033E, 0x0003003E, 0x00000335, 
+0x0000033F, 0x00050041, 0x000002FC, 0x00000341, 0x000002AC, 0x000001FD, 0x0004003D, 0x000002A6, 
+0x00000342, 0x00000341, 0x0004003D, 0x0000000C, 0x00000343, 0x000000A3, 0x00050051, 0x00000006, 
+0x00000344, 0x00000343, 0x00000000, 0x00050051, 0x00000006, 0x00000345, 0x00000343, 0x00000001, 
+0x00050051, 0x00000006, 0x00000346, 0x00000343, 0x00000002, 0x00070050, 0x00000012, 0x00000347, 
+0x00000344, 0x00000345, 0x00000346, 0x000000D3, 0x00050091, 0x00000012, 0x00000348, 0x00000342, 
+0x00000347, 0x0003003E, 0x00000340, 0x00000348, 0x0003003E, 0x00000349, 0x000000D3, 0x0004003D, 
+0x00000012, 0x0000034C, 0x00000321, 0x0003003E, 0x0000034B, 0x0000034C, 0x0004003D, 0x00000006, 
+0x0000034E, 0x00000335, 0x0003003E, 0x0000034D, 0x0000034E, 0x0004003D, 0x0000000C, 0x00000350, 
+0x000000A5, 0x0003003E, 0x0000034F, 0x00000350, 0x0004003D, 0x0000000C, 0x00000352, 0x000000A6, 
+0x0003003E, 0x00000351, 0x00000352, 0x0004003D, 0x0000000C, 0x00000354, 0x000000A3, 0x0003003E, 
+0x00000353, 0x00000354, 0x0004003D, 0x00000083, 0x00000356, 0x000000A4, 0x0003003E, 0x00000355, 
+0x00000356, 0x000B0039, 0x00000006, 0x00000357, 0x0000009C, 0x0000034A, 0x0000034B, 0x0000034D, 
+0x0000034F, 0x00000351, 0x00000353, 0x00000355, 0x0003003E, 0x00000349, 0x00000357, 0x0004003D, 
+0x00000083, 0x00000359, 0x000000A4, 0x00070041, 0x000001DF, 0x0000035A, 0x000002AC, 0x000002D1, 
+0x00000359, 0x0000023C, 0x0004003D, 0x00000006, 0x0000035B, 0x0000035A, 0x00050041, 0x000001DF, 
+0x0000035C, 0x000002AC, 0x0000030C, 0x0004003D, 0x00000006, 0x0000035D, 0x0000035C, 0x00050081, 
+0x00000006, 0x0000035E, 0x0000035B, 0x0000035D, 0x0004003D, 0x00000083, 0x0000035F, 0x000000A4, 
+0x00070041, 0x000001DF, 0x00000360, 0x000002AC, 0x000002D1, 0x0000035F, 0x0000023C, 0x0004003D, 
+0x00000006, 0x00000361, 0x00000360, 0x00050041, 0x00000007, 0x00000362, 0x00000340, 0x000002EA, 
+0x0004003D, 0x00000006, 0x00000363, 0x00000362, 0x0008000C, 0x00000006, 0x00000364, 0x00000001, 
+0x00000031, 0x0000035E, 0x00000361, 0x00000363, 0x0003003E, 0x00000358, 0x00000364, 0x0004003D, 
+0x00000083, 0x00000366, 0x000000A4, 0x00050080, 0x00000083, 0x00000367, 0x00000366, 0x000001FD, 
+0x0003003E, 0x00000365, 0x00000367, 0x0004003D, 0x00000006, 0x00000368, 0x00000358, 0x000500BA, 
+0x000001E3, 0x00000369, 0x00000368, 0x000000F6, 0x000300F7, 0x0000036B, 0x00000000, 0x000400FA, 
+0x00000369, 0x0000036A, 0x0000036B, 0x000200F8, 0x0000036A, 0x0004003D, 0x00000083, 0x0000036C, 
+0x00000365, 0x00050041, 0x0000030D, 0x0000036D, 0x000002AC, 0x000004ED, 0x0004003D, 0x00000083, 
+0x0000036E, 0x0000036D, 0x000500B1, 0x000001E3, 0x0000036F, 0x0000036C, 0x0000036E, 0x000200F9, 
+0x0000036B, 0x000200F8, 0x0000036B, 0x000700F5, 0x000001E3, 0x00000370, 0x00000369, 0x000000A8, 
+0x0000036F, 0x0000036A, 0x000300F7, 0x00000372, 0x00000000, 0x000400FA, 0x00000370, 0x00000371, 
+0x00000372, 0x000200F8, 0x00000371, 0x00050041, 0x000002FC, 0x00000373, 0x000002AC, 0x000003E6, 
+0x0004003D, 0x000002A6, 0x00000374, 0x00000373, 0x0004003D, 0x00000083, 0x00000375, 0x00000365, 
+0x00060041, 0x000002FC, 0x00000376, 0x000002AC, 0x000001E7, 0x00000375, 0x0004003D, 0x000002A6, 
+0x00000377, 0x00000376, 0x00050092, 0x000002A6, 0x00000378, 0x00000374, 0x00000377, 0x0004003D, 
+0x0000000C, 0x00000379, 0x000000A3, 0x00050051, 0x00000006, 0x0000037A, 0x00000379, 0x00000000, 
+0x00050051, 0x00000006, 0x0000037B, 0x00000379, 0x00000001, 0x00050051, 0x00000006, 0x0000037C, 
+0x00000379, 0x00000002, 0x00070050, 0x00000012, 0x0000037D, 0x0000037A, 0x0000037B, 0x0000037C, 
+0x000000D3, 0x00050091, 0x00000012, 0x0000037E, 0x00000378, 0x0000037D, 0x0003003E, 0x00000321, 
+0x0000037E, 0x0004003D, 0x00000012, 0x00000381, 0x00000321, 0x0003003E, 0x00000380, 0x00000381, 
+0x0004003D, 0x00000006, 0x00000383, 0x00000335, 0x0003003E, 0x00000382, 0x00000383, 0x0004003D, 
+0x0000000C, 0x00000385, 0x000000A5, 0x0003003E, 0x00000384, 0x00000385, 0x0004003D, 0x0000000C, 
+0x00000387, 0x000000A6, 0x0003003E, 0x00000386, 0x00000387, 0x0004003D, 0x0000000C, 0x00000389, 
+0x000000A3, 0x0003003E, 0x00000388, 0x00000389, 0x0004003D, 0x00000083, 0x0000038B, 0x00000365, 
+0x0003003E, 0x0000038A, 0x0000038B, 0x000B0039, 0x00000006, 0x0000038C, 0x0000009C, 0x0000034A, 
+0x00000380, 0x00000382, 0x00000384, 0x00000386, 0x00000388, 0x0000038A, 0x0003003E, 0x0000037F, 
+0x0000038C, 0x0004003D, 0x00000006, 0x0000038D, 0x00000349, 0x0004003D, 0x00000006, 0x0000038E, 
+0x0000037F, 0x0004003D, 0x00000006, 0x0000038F, 0x00000358, 0x0008000C, 0x00000006, 0x00000390, 
+0x00000001, 0x0000002E, 0x0000038D, 0x0000038E, 0x0000038F, 0x0003003E, 0x00000349, 0x00000390, 
+0x000200F9, 0x00000372, 0x000200F8, 0x00000372, 0x0004003D, 0x00000006, 0x00000391, 0x00000349, 
+0x00050083, 0x00000006, 0x00000392, 0x000000D3, 0x00000391, 0x0004003D, 0x00000006, 0x00000393, 
+0x000000D2, 0x00050085, 0x00000006, 0x00000394, 0x00000392, 0x00000393, 0x00050083, 0x00000006, 
+0x00000395, 0x000000D3, 0x00000394, 0x000200FE, 0x00000395, 0x00010038, 0x00050036, 0x0000000C, 
+0x000000B3, 0x00000000, 0x000000AB, 0x00030037, 0x000000A9, 0x000000AC, 0x00030037, 0x000000AA, 
+0x000000AD, 0x00030037, 0x0000000C, 0x000000AE, 0x00030037, 0x00000007, 0x000000AF, 0x00030037, 
+0x00000007, 0x000000B0, 0x00030037, 0x00000007, 0x000000B1, 0x00030037, 0x00000007, 0x000000B2, 
+0x000200F8, 0x000000B4, 0x0004003B, 0x00000007, 0x00000398, 0x00000007, 0x0004003B, 0x00000007, 
+0x0000039A, 0x00000007, 0x0004003B, 0x00000007, 0x0000039C, 0x00000007, 0x0004003B, 0x00000007, 
+0x0000039F, 0x00000007, 0x0004003B, 0x00000007, 0x000003A0, 0x00000007, 0x0004003B, 0x00000007, 
+0x000003A2, 0x00000007, 0x0004003B, 0x00000007, 0x000003A4, 0x00000007, 0x0004003B, 0x0000000D, 
+0x000003A7, 0x00000007, 0x0004003B, 0x00000007, 0x000003A9, 0x00000007, 0x00050051, 0x0000000C, 
+0x00000399, 0x000000AC, 0x00000006, 0x00050051, 0x00000006, 0x0000039B, 0x000000AC, 0x00000002, 
+0x0003003E, 0x0000039A, 0x0000039B, 0x0004003D, 0x00000006, 0x0000039D, 0x000000B1, 0x0003003E, 
+0x0000039C, 0x0000039D, 0x00080039, 0x00000006, 0x0000039E, 0x0000005D, 0x0000039A, 0x0000039C, 
+0x00000399, 0x000000AE, 0x0003003E, 0x00000398, 0x0000039E, 0x00050051, 0x00000006, 0x000003A1, 
+0x000000AC, 0x00000002, 0x0003003E, 0x000003A0, 0x000003A1, 0x0004003D, 0x00000006, 0x000003A3, 
+0x000000AF, 0x0003003E, 0x000003A2, 0x000003A3, 0x0004003D, 0x00000006, 0x000003A5, 0x000000B0, 
+0x0003003E, 0x000003A4, 0x000003A5, 0x00070039, 0x00000006, 0x000003A6, 0x00000062, 0x000003A0, 
+0x000003A2, 0x000003A4, 0x0003003E, 0x0000039F, 0x000003A6, 0x00050051, 0x0000000C, 0x000003A8, 
+0x000000AC, 0x0000000A, 0x0004003D, 0x00000006, 0x000003AA, 0x000000B2, 0x0003003E, 0x000003A9, 
+0x000003AA, 0x00060039, 0x0000000C, 0x000003AB, 0x00000067, 0x000003A8, 0x000003A9, 0x0003003E, 
+0x000003A7, 0x000003AB, 0x0004003D, 0x00000006, 0x000003AC, 0x00000398, 0x0004003D, 0x00000006, 
+0x000003AD, 0x0000039F, 0x00050085, 0x00000006, 0x000003AE, 0x000003AC, 0x000003AD, 0x0004003D, 
+0x0000000C, 0x000003AF, 0x000003A7, 0x0005008E, 0x0000000C, 0x000003B0, 0x000003AF, 0x000003AE, 
+0x000200FE, 0x000003B0, 0x00010038, 0x00050036, 0x0000000C, 0x000000BA, 0x00000000, 0x000000B5, 
+0x00030037, 0x000000A9, 0x000000B6, 0x00030037, 0x00000007, 0x000000B7, 0x00030037, 0x00000007, 
+0x000000B8, 0x00030037, 0x00000007, 0x000000B9, 0x000200F8, 0x000000BB, 0x0004003B, 0x00000007, 
+0x000003B5, 0x00000007, 0x0004003B, 0x00000007, 0x000003B7, 0x00000007, 0x0004003B, 0x00000007, 
+0x000003B9, 0x00000007, 0x0004003B, 0x00000007, 0x000003BB, 0x00000007, 0x00050051, 0x00000012, 
+0x000003B3, 0x000000B6, 0x00000000, 0x0008004F, 0x0000000C, 0x000003B4, 0x000003B3, 0x000003B3, 
+0x00000000, 0x00000001, 0x00000002, 0x00050051, 0x00000006, 0x000003B6, 0x000000B6, 0x00000002, 
+0x0003003E, 0x000003B5, 0x000003B6, 0x0004003D, 0x00000006, 0x000003B8, 0x000000B7, 0x0003003E, 
+0x000003B7, 0x000003B8, 0x0004003D, 0x00000006, 0x000003BA, 0x000000B8, 0x0003003E, 0x000003B9, 
+0x000003BA, 0x0004003D, 0x00000006, 0x000003BC, 0x000000B9, 0x0003003E, 0x000003BB, 0x000003BC, 
+0x00080039, 0x00000006, 0x000003BD, 0x00000043, 0x000003B5, 0x000003B7, 0x000003B9, 0x000003BB, 
+0x0005008E, 0x0000000C, 0x000003BE, 0x000003B4, 0x000003BD, 0x000200FE, 0x000003BE, 0x00010038, 
+0x00050036, 0x0000000C, 0x000000C3, 0x00000000, 0x000000AB, 0x00030037, 0x000000A9, 0x000000BC, 
+0x00030037, 0x000000AA, 0x000000BD, 0x00030037, 0x0000000C, 0x000000BE, 0x00030037, 0x00000007, 
+0x000000BF, 0x00030037, 0x00000007, 0x000000C0, 0x00030037, 0x00000007, 0x000000C1, 0x00030037, 
+0x00000007, 0x000000C2, 0x000200F8, 0x000000C4, 0x0004003B, 0x00000007, 0x000003C1, 0x00000007, 
+0x0004003B, 0x00000007, 0x000003C3, 0x00000007, 0x0004003B, 0x00000007, 0x000003C5, 0x00000007, 
+0x0004003B, 0x00000007, 0x000003C7, 0x00000007, 0x0004003D, 0x00000006, 0x000003C2, 0x000000BF, 
+0x0003003E, 0x000003C1, 0x000003C2, 0x0004003D, 0x00000006, 0x000003C4, 0x000000C0, 0x0003003E, 
+0x000003C3, 0x000003C4, 0x0004003D, 0x00000006, 0x000003C6, 0x000000C1, 0x0003003E, 0x000003C5, 
+0x000003C6, 0x0004003D, 0x00000006, 0x000003C8, 0x000000C2, 0x0003003E, 0x000003C7, 0x000003C8, 
+0x000B0039, 0x0000000C, 0x000003C9, 0x000000B3, 0x000000BC, 0x000000BD, 0x000000BE, 0x000003C1, 
+0x000003C3, 0x000003C5, 0x000003C7, 0x000200FE, 0x000003C9, 0x00010038, 0x00050036, 0x0000000C, 
+0x000000CA, 0x00000000, 0x000000C6, 0x00030037, 0x0000000D, 0x000000C7, 0x00030037, 0x0000000D, 
+0x000000C8, 0x00030037, 0x000000C5, 0x000000C9, 0x000200F8, 0x000000CB, 0x0004003B, 0x0000000D, 
+0x000003CC, 0x00000007, 0x0004003B, 0x000007E4, 0x000007E6, 0x00000007, 0x0004003B, 0x00000084, 
+0x000003CE, 0x00000007, 0x0004003B, 0x000003D9, 0x000003DA, 0x00000007, 0x0004003B, 0x00000007, 
+0x000003EE, 0x00000007, 0x0004003B, 0x0000000D, 0x000003F4, 0x00000007, 0x0004003B, 0x00000007, 
+0x000003FA, 0x00000007, 0x0004003B, 0x00000007, 0x000003FF, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000406, 0x00000007, 0x0004003B, 0x0000000D, 0x0000041F, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000425, 0x00000007, 0x0004003B, 0x00000007, 0x00000429, 0x00000007, 0x0004003B, 0x00000007, 
+0x0000042E, 0x00000007, 0x0004003B, 0x00000007, 0x00000434, 0x00000007, 0x0004003B, 0x00000007, 
+0x0000043A, 0x00000007, 0x0004003B, 0x00000084, 0x0000044B, 0x00000007, 0x0004003B, 0x0000000D, 
+0x0000044C, 0x00000007, 0x0004003B, 0x0000000D, 0x00000455, 0x00000007, 0x0004003B, 0x00000084, 
+0x00000457, 0x00000007, 0x0004003B, 0x0000000D, 0x00000459, 0x00000007, 0x0004003B, 0x0000000D, 
+0x0000045D, 0x00000007, 0x0004003B, 0x0000000D, 0x00000462, 0x00000007, 0x0004003B, 0x0000000D, 
+0x00000466, 0x00000007, 0x0004003B, 0x0000000D, 0x0000046D, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000473, 0x00000007, 0x0004003B, 0x00000007, 0x00000478, 0x00000007, 0x0004003B, 0x0000000D, 
+0x0000047A, 0x00000007, 0x0004003B, 0x00000007, 0x00000480, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000486, 0x00000007, 0x0004003B, 0x00000007, 0x00000488, 0x00000007, 0x0004003B, 0x00000007, 
+0x0000048A, 0x00000007, 0x0004003B, 0x00000007, 0x0000048B, 0x00000007, 0x0004003B, 0x00000007, 
+0x0000048E, 0x00000007, 0x0004003B, 0x00000007, 0x00000493, 0x00000007, 0x0004003B, 0x00000007, 
+0x00000495, 0x00000007, 0x0004003B, 0x00000007, 0x00000499, 0x00000007, 0x0004003B, 0x0000000D, 
+0x0000049B, 0x00000007, 0x0004003B, 0x00000007, 0x0000049D, 0x00000007, 0x0004003B, 0x00000007, 
+0x0000049F, 0x00000007, 0x0004003B, 0x00000007, 0x000004A1, 0x00000007, 0x0004003B, 0x0000000D, 
+0x000004A4, 0x00000007, 0x0004003B, 0x00000007, 0x000004A8, 0x00000007, 0x0004003B, 0x00000007, 
+0x000004AA, 0x00000007, 0x0004003B, 0x00000007, 0x000004AC, 0x00000007, 0x0004003B, 0x00000007, 
+0x000004AE, 0x00000007, 0x0004003B, 0x0000000D, 0x000004B1, 0x00000007, 0x0004003B, 0x00000007, 
+0x000004BB, 0x00000007, 0x0004003B, 0x00000007, 0x000004BD, 0x00000007, 0x0003003E, 0x000003CC, 
+0x000003CD, 0x0003003E, 0x000003CE, 0x000001E7, 0x0004003D, 0x0000000C, 0x000007E7, 0x000000C8, 
+0x00050051, 0x00000006, 0x000007E8, 0x000007E7, 0x00000000, 0x00050051, 0x00000006, 0x000007E9, 
+0x000007E7, 0x00000001, 0x00050051, 0x00000006, 0x000007EA, 0x000007E7, 0x00000002, 0x00070050, 
+0x00000012, 0x000007EB, 0x000007E8, 0x000007E9, 0x000007EA, 0x000000D3, 0x00050041, 0x000002FC, 
+0x000007EC, 0x000002AC, 0x0000025E, 0x0004003D, 0x000002A6, 0x000007ED, 0x000007EC, 0x00050091, 
+0x00000012, 0x000007EE, 0x000007ED, 0x000007EB, 0x0007004F, 0x0000007D, 0x000007EF, 0x000007EE, 
+0x000007EE, 0x00000000, 0x00000001, 0x00050051, 0x00000006, 0x000007F0, 0x000007EE, 0x00000003, 
+0x00050050, 0x0000007D, 0x000007F1, 0x000007F0, 0x000007F0, 0x00050088, 0x0000007D, 0x000007F2, 
+0x000007EF, 0x000007F1, 0x0005008E, 0x0000007D, 0x000007F3, 0x000007F2, 0x0000012D, 0x00050050, 
+0x0000007D, 0x000007F4, 0x0000012D, 0x0000012D, 0x00050081, 0x0000007D, 0x000007F5, 0x000007F3, 
+0x000007F4, 0x00050041, 0x000007E1, 0x000007F6, 0x000002AC, 0x000001DE, 0x0004003D, 0x000007DB, 
+0x000007F7, 0x000007F6, 0x0007004F, 0x000007DA, 0x000007F8, 0x000007F7, 0x000007F7, 0x00000000, 
+0x00000001, 0x00040070, 0x0000007D, 0x000007F9, 0x000007F8, 0x00050085, 0x0000007D, 0x000007FA, 
+0x000007F5, 0x000007F9, 0x00050050, 0x0000007D, 0x000007FB, 0x000000F6, 0x000000F6, 0x00050050, 
+0x0000007D, 0x000007FC, 0x000000D3, 0x000000D3, 0x00050083, 0x0000007D, 0x000007FD, 0x000007F9, 
+0x000007FC, 0x0008000C, 0x0000007D, 0x000007FE, 0x00000001, 0x0000002B, 0x000007FA, 0x000007FB, 
+0x000007FD, 0x0004006D, 0x000007DA, 0x000007FF, 0x000007FE, 0x00050041, 0x000002FC, 0x00000800, 
+0x000002AC, 0x000001FD, 0x0004003D, 0x000002A6, 0x00000801, 0x00000800, 0x00050091, 0x00000012, 
+0x00000802, 0x00000801, 0x000007EB, 0x00050051, 0x00000006, 0x00000803, 0x00000802, 0x00000002, 
+0x0004007F, 0x00000006, 0x00000804, 0x00000803, 0x0007000C, 0x00000006, 0x00000805, 0x00000001, 
+0x00000028, 0x00000804, 0x000007E5, 0x0006000C, 0x00000006, 0x00000806, 0x00000001, 0x0000001C, 
+0x00000805, 0x00050041, 0x000001E8, 0x00000807, 0x000002AC, 0x00000208, 0x0004003D, 0x00000012, 
+0x00000808, 0x00000807, 0x00050051, 0x00000006, 0x00000809, 0x00000808, 0x00000000, 0x00050051, 
+0x00000006, 0x0000080A, 0x00000808, 0x00000001, 0x00050085, 0x00000006, 0x0000080B, 0x00000806, 
+0x00000809, 0x00050081, 0x00000006, 0x0000080C, 0x0000080B, 0x0000080A, 0x00050051, 0x000000EB, 
+0x0000080D, 0x000007F7, 0x00000002, 0x00040070, 0x00000006, 0x0000080E, 0x0000080D, 0x00050083, 
+0x00000006, 0x0000080F, 0x0000080E, 0x000000D3, 0x0008000C, 0x00000006, 0x00000810, 0x00000001, 
+0x0000002B, 0x0000080C, 0x000000F6, 0x0000080F, 0x0004006D, 0x000000EB, 0x00000811, 0x00000810, 
+0x00050051, 0x000000EB, 0x00000812, 0x000007F7, 0x00000000, 0x00050051, 0x000000EB, 0x00000813, 
+0x000007F7, 0x00000001, 0x00050051, 0x000000EB, 0x00000814, 0x000007FF, 0x00000000, 0x00050051, 
+0x000000EB, 0x00000815, 0x000007FF, 0x00000001, 0x00050084, 0x000000EB, 0x00000816, 0x00000811, 
+0x00000813, 0x00050080, 0x000000EB, 0x00000817, 0x00000816, 0x00000815, 0x00050084, 0x000000EB, 
+0x00000818, 0x00000817, 0x00000812, 0x00050080, 0x000000EB, 0x00000819, 0x00000818, 0x00000814, 
+0x00060041, 0x000007E2, 0x0000081A, 0x000007D4, 0x000001E7, 0x00000819, 0x0004003D, 0x000007DA, 
+0x0000081B, 0x0000081A, 0x00050051, 0x000000EB, 0x0000081C, 0x0000081B, 0x00000000, 0x00050051, 
+0x000000EB, 0x0000081D, 0x0000081B, 0x00000001, 0x00050041, 0x0000030D, 0x0000081E, 0x000002AC, 
+0x00000672, 0x0004003D, 0x00000083, 0x0000081F, 0x0000081E, 0x0004007C, 0x000000EB, 0x00000820, 
+0x0000081F, 0x00050080, 0x000000EB, 0x00000821, 0x00000820, 0x0000081D, 0x0004007C, 0x00000083, 
+0x00000822, 0x00000821, 0x000200F9, 0x000003CF, 0x000200F8, 0x000003CF, 0x000400F6, 0x000003D1, 
+0x000003D2, 0x00000000, 0x000200F9, 0x000003D3, 0x000200F8, 0x000003D3, 0x0004003D, 0x00000083, 
+0x000003D4, 0x000003CE, 0x000500B1, 0x000001E3, 0x000003D8, 0x000003D4, 0x00000822, 0x000400FA, 
+0x000003D8, 0x000003D0, 0x000003D1, 0x000200F8, 0x000003D0, 0x0004003D, 0x00000083, 0x000003DB, 
+0x000003CE, 0x000500B1, 0x000001E3, 0x00000823, 0x000003DB, 0x0000081F, 0x000300F7, 0x00000824, 
+0x00000000, 0x000400FA, 0x00000823, 0x00000825, 0x00000826, 0x000200F8, 0x00000825, 0x0004007C, 
+0x000000EB, 0x00000827, 0x000003DB, 0x0003003E, 0x000007E6, 0x00000827, 0x000200F9, 0x00000824, 
+0x000200F8, 0x00000826, 0x0004007C, 0x000000EB, 0x00000828, 0x000003DB, 0x00050080, 0x000000EB, 
+0x00000829, 0x0000081C, 0x00000828, 0x00050082, 0x000000EB, 0x0000082A, 0x00000829, 0x00000820, 
+0x00060041, 0x000007E3, 0x0000082B, 0x000007D6, 0x000001E7, 0x0000082A, 0x0004003D, 0x000000EB, 
+0x0000082C, 0x0000082B, 0x0003003E, 0x000007E6, 0x0000082C, 0x000200F9, 0x00000824, 0x000200F8, 
+0x00000824, 0x0004003D, 0x000000EB, 0x0000082D, 0x000007E6, 0x00060041, 0x000003DC, 0x000003DD, 
+0x000007D2, 0x000001E7, 0x0000082D, 0x0004003D, 0x000002A3, 0x000003DE, 0x000003DD, 0x00050051, 
 0x00000012, 0x000003DF, 0x000003DE, 0x00000000, 0x00050041, 0x00000013, 0x000003E0, 0x000003DA, 
 0x000001E7, 0x0003003E, 0x000003E0, 0x000003DF, 0x00050051, 0x00000012, 0x000003E1, 0x000003DE, 
 0x00000001, 0x00050041, 0x00000013, 0x000003E2, 0x000003DA, 0x000001FD, 0x0003003E, 0x000003E2, 
@@ -1411,119 +1488,125 @@ constexpr std::array<uint32_t, 12160> spirv_ForwardPBRfragspv = {
 0x00050081, 0x00000006, 0x00000444, 0x00000443, 0x000000D3, 0x00050088, 0x00000006, 0x00000445, 
 0x00000441, 0x00000444, 0x0004003D, 0x00000006, 0x00000446, 0x0000043A, 0x00050085, 0x00000006, 
 0x00000447, 0x00000446, 0x00000445, 0x0003003E, 0x0000043A, 0x00000447, 0x0004003D, 0x00000006, 
-0x00000448, 0x0000043A, 0x0008000C, 0x00000006, 0x00000449, 0x00000001, 0x0000002B, 0x00000448, 
-0x000000F6, 0x000000D3, 0x0003003E, 0x000003EE, 0x00000449, 0x000200F9, 0x0000041E, 0x000200F8, 
-0x0000044A, 0x0004003D, 0x0000000C, 0x0000044D, 0x000000C8, 0x0003003E, 0x0000044C, 0x0000044D, 
-0x00050039, 0x00000083, 0x0000044E, 0x000000A0, 0x0000044C, 0x0003003E, 0x0000044B, 0x0000044E, 
-0x00050041, 0x0000030D, 0x00000450, 0x000002AC, 0x0000044F, 0x0004003D, 0x00000083, 0x00000451, 
-0x00000450, 0x000500AD, 0x000001E3, 0x00000452, 0x00000451, 0x000001E7, 0x000300F7, 0x00000454, 
-0x00000000, 0x000400FA, 0x00000452, 0x00000453, 0x00000461, 0x000200F8, 0x00000453, 0x0004003D, 
-0x0000000C, 0x00000456, 0x000000C8, 0x0003003E, 0x00000455, 0x00000456, 0x0004003D, 0x00000083, 
-0x00000458, 0x0000044B, 0x0003003E, 0x00000457, 0x00000458, 0x00050041, 0x00000013, 0x0000045A, 
-0x000003DA, 0x0000020E, 0x0004003D, 0x00000012, 0x0000045B, 0x0000045A, 0x0008004F, 0x0000000C, 
-0x0000045C, 0x0000045B, 0x0000045B, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x00000459, 
-0x0000045C, 0x00050041, 0x0000000D, 0x0000045E, 0x000000C9, 0x00000208, 0x0004003D, 0x0000000C, 
-0x0000045F, 0x0000045E, 0x0003003E, 0x0000045D, 0x0000045F, 0x00080039, 0x00000006, 0x00000460, 
-0x000000A7, 0x00000455, 0x00000457, 0x00000459, 0x0000045D, 0x0003003E, 0x000003EE, 0x00000460, 
-0x000200F9, 0x00000454, 0x000200F8, 0x00000461, 0x0003003E, 0x000003EE, 0x000000D3, 0x000200F9, 
-0x00000454, 0x000200F8, 0x00000454, 0x000200F9, 0x0000041E, 0x000200F8, 0x0000041E, 0x000200F9, 
-0x000003F3, 0x000200F8, 0x000003F3, 0x00050041, 0x00000013, 0x00000463, 0x000003DA, 0x0000020E, 
-0x0004003D, 0x00000012, 0x00000464, 0x00000463, 0x0008004F, 0x0000000C, 0x00000465, 0x00000464, 
-0x00000464, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x00000462, 0x00000465, 0x00050041, 
-0x00000013, 0x00000467, 0x000003DA, 0x000001E7, 0x0004003D, 0x00000012, 0x00000468, 0x00000467, 
-0x0008004F, 0x0000000C, 0x00000469, 0x00000468, 0x00000468, 0x00000000, 0x00000001, 0x00000002, 
-0x00050041, 0x00000007, 0x0000046A, 0x000003DA, 0x000003E6, 0x0004003D, 0x00000006, 0x0000046B, 
-0x0000046A, 0x0005008E, 0x0000000C, 0x0000046C, 0x00000469, 0x0000046B, 0x0003003E, 0x00000466, 
-0x0000046C, 0x0004003D, 0x0000000C, 0x0000046E, 0x00000462, 0x00050041, 0x0000000D, 0x0000046F, 
-0x000000C9, 0x000002D1, 0x0004003D, 0x0000000C, 0x00000470, 0x0000046F, 0x00050081, 0x0000000C, 
-0x00000471, 0x0000046E, 0x00000470, 0x0006000C, 0x0000000C, 0x00000472, 0x00000001, 0x00000045, 
-0x00000471, 0x0003003E, 0x0000046D, 0x00000472, 0x00050041, 0x0000000D, 0x00000474, 0x000000C9, 
-0x00000208, 0x0004003D, 0x0000000C, 0x00000475, 0x00000474, 0x0004003D, 0x0000000C, 0x00000476, 
-0x00000462, 0x00050094, 0x00000006, 0x00000477, 0x00000475, 0x00000476, 0x0003003E, 0x00000478, 
-0x00000477, 0x00050039, 0x00000006, 0x00000479, 0x00000019, 0x00000478, 0x0003003E, 0x00000473, 
-0x00000479, 0x00050041, 0x0000000D, 0x0000047B, 0x000000C9, 0x000002D1, 0x0004003D, 0x0000000C, 
-0x0000047C, 0x0000047B, 0x0004003D, 0x0000000C, 0x0000047D, 0x00000462, 0x00050081, 0x0000000C, 
-0x0000047E, 0x0000047C, 0x0000047D, 0x0006000C, 0x0000000C, 0x0000047F, 0x00000001, 0x00000045, 
-0x0000047E, 0x0003003E, 0x0000047A, 0x0000047F, 0x00050041, 0x0000000D, 0x00000481, 0x000000C9, 
-0x00000208, 0x0004003D, 0x0000000C, 0x00000482, 0x00000481, 0x00050041, 0x0000000D, 0x00000483, 
-0x000000C9, 0x000002D1, 0x0004003D, 0x0000000C, 0x00000484, 0x00000483, 0x00050094, 0x00000006, 
-0x00000485, 0x00000482, 0x00000484, 0x0003003E, 0x00000486, 0x00000485, 0x00050039, 0x00000006, 
-0x00000487, 0x00000046, 0x00000486, 0x0003003E, 0x00000480, 0x00000487, 0x0004003D, 0x00000006, 
-0x00000489, 0x00000480, 0x0003003E, 0x00000488, 0x00000489, 0x0004003D, 0x00000006, 0x0000048C, 
-0x00000473, 0x0003003E, 0x0000048B, 0x0000048C, 0x00050039, 0x00000006, 0x0000048D, 0x00000019, 
-0x0000048B, 0x0003003E, 0x0000048A, 0x0000048D, 0x00050041, 0x0000000D, 0x0000048F, 0x000000C9, 
-0x00000208, 0x0004003D, 0x0000000C, 0x00000490, 0x0000048F, 0x0004003D, 0x0000000C, 0x00000491, 
-0x0000047A, 0x00050094, 0x00000006, 0x00000492, 0x00000490, 0x00000491, 0x0003003E, 0x00000493, 
-0x00000492, 0x00050039, 0x00000006, 0x00000494, 0x00000019, 0x00000493, 0x0003003E, 0x0000048E, 
-0x00000494, 0x0004003D, 0x0000000C, 0x00000496, 0x00000462, 0x0004003D, 0x0000000C, 0x00000497, 
-0x0000047A, 0x00050094, 0x00000006, 0x00000498, 0x00000496, 0x00000497, 0x0003003E, 0x00000499, 
-0x00000498, 0x00050039, 0x00000006, 0x0000049A, 0x00000019, 0x00000499, 0x0003003E, 0x00000495, 
-0x0000049A, 0x0004003D, 0x000000A9, 0x0000049C, 0x000000C9, 0x0004003D, 0x00000006, 0x0000049E, 
-0x00000488, 0x0003003E, 0x0000049D, 0x0000049E, 0x0004003D, 0x00000006, 0x000004A0, 0x0000048A, 
-0x0003003E, 0x0000049F, 0x000004A0, 0x0004003D, 0x00000006, 0x000004A2, 0x00000495, 0x0003003E, 
-0x000004A1, 0x000004A2, 0x00080039, 0x0000000C, 0x000004A3, 0x000000BA, 0x0000049C, 0x0000049D, 
-0x0000049F, 0x000004A1, 0x0003003E, 0x0000049B, 0x000004A3, 0x0004003D, 0x000000A9, 0x000004A5, 
-0x000000C9, 0x0004003D, 0x000000AA, 0x000004A6, 0x000003DA, 0x0004003D, 0x0000000C, 0x000004A7, 
-0x0000047A, 0x0004003D, 0x00000006, 0x000004A9, 0x00000488, 0x0003003E, 0x000004A8, 0x000004A9, 
-0x0004003D, 0x00000006, 0x000004AB, 0x0000048A, 0x0003003E, 0x000004AA, 0x000004AB, 0x0004003D, 
-0x00000006, 0x000004AD, 0x0000048E, 0x0003003E, 0x000004AC, 0x000004AD, 0x0004003D, 0x00000006, 
-0x000004AF, 0x00000495, 0x0003003E, 0x000004AE, 0x000004AF, 0x000B0039, 0x0000000C, 0x000004B0, 
-0x000000C3, 0x000004A5, 0x000004A6, 0x000004A7, 0x000004A8, 0x000004AA, 0x000004AC, 0x000004AE, 
-0x0003003E, 0x000004A4, 0x000004B0, 0x0004003D, 0x0000000C, 0x000004B2, 0x0000049B, 0x0004003D, 
-0x0000000C, 0x000004B3, 0x000004A4, 0x00050081, 0x0000000C, 0x000004B4, 0x000004B2, 0x000004B3, 
-0x0003003E, 0x000004B1, 0x000004B4, 0x0004003D, 0x0000000C, 0x000004B5, 0x000004B1, 0x0004003D, 
-0x0000000C, 0x000004B6, 0x00000466, 0x00050085, 0x0000000C, 0x000004B7, 0x000004B5, 0x000004B6, 
-0x0004003D, 0x00000006, 0x000004B8, 0x000003EE, 0x0004003D, 0x00000006, 0x000004B9, 0x0000048A, 
-0x00050085, 0x00000006, 0x000004BA, 0x000004B8, 0x000004B9, 0x0004003D, 0x00000006, 0x000004BC, 
-0x0000048A, 0x0003003E, 0x000004BB, 0x000004BC, 0x00050041, 0x00000007, 0x000004BE, 0x000000C9, 
-0x00000226, 0x0004003D, 0x00000006, 0x000004BF, 0x000004BE, 0x0003003E, 0x000004BD, 0x000004BF, 
-0x00060039, 0x00000006, 0x000004C0, 0x0000003D, 0x000004BB, 0x000004BD, 0x00050085, 0x00000006, 
-0x000004C1, 0x000004BA, 0x000004C0, 0x0005008E, 0x0000000C, 0x000004C2, 0x000004B7, 0x000004C1, 
-0x0004003D, 0x0000000C, 0x000004C3, 0x000003CC, 0x00050081, 0x0000000C, 0x000004C4, 0x000004C3, 
-0x000004C2, 0x0003003E, 0x000003CC, 0x000004C4, 0x000200F9, 0x000003D2, 0x000200F8, 0x000003D2, 
-0x0004003D, 0x00000083, 0x000004C5, 0x000003CE, 0x00050080, 0x00000083, 0x000004C6, 0x000004C5, 
-0x000001FD, 0x0003003E, 0x000003CE, 0x000004C6, 0x000200F9, 0x000003CF, 0x000200F8, 0x000003D1, 
-0x0004003D, 0x0000000C, 0x000004C7, 0x000003CC, 0x000200FE, 0x000004C7, 0x00010038, 0x00050036, 
-0x0000000C, 0x000000CF, 0x00000000, 0x000000C6, 0x00030037, 0x0000000D, 0x000000CC, 0x00030037, 
-0x0000000D, 0x000000CD, 0x00030037, 0x000000C5, 0x000000CE, 0x000200F8, 0x000000D0, 0x0004003B, 
-0x0000000D, 0x000004CA, 0x00000007, 0x0004003B, 0x0000000D, 0x000004D4, 0x00000007, 0x0004003B, 
-0x0000000D, 0x000004D5, 0x00000007, 0x0004003B, 0x00000007, 0x000004D7, 0x00000007, 0x0004003B, 
-0x00000007, 0x000004DA, 0x00000007, 0x0004003B, 0x0000000D, 0x000004DE, 0x00000007, 0x0004003B, 
-0x0000000D, 0x000004E6, 0x00000007, 0x0004003B, 0x00000084, 0x000004EC, 0x00000007, 0x0004003B, 
-0x0000000D, 0x000004F0, 0x00000007, 0x0004003B, 0x0000000D, 0x000004FB, 0x00000007, 0x0004003D, 
-0x000004CC, 0x000004CF, 0x000004CE, 0x00050041, 0x0000000D, 0x000004D0, 0x000000CE, 0x00000208, 
-0x0004003D, 0x0000000C, 0x000004D1, 0x000004D0, 0x00050057, 0x00000012, 0x000004D2, 0x000004CF, 
-0x000004D1, 0x0008004F, 0x0000000C, 0x000004D3, 0x000004D2, 0x000004D2, 0x00000000, 0x00000001, 
-0x00000002, 0x0003003E, 0x000004CA, 0x000004D3, 0x0004003D, 0x0000000C, 0x000004D6, 0x000000CC, 
-0x0003003E, 0x000004D5, 0x000004D6, 0x00050041, 0x00000007, 0x000004D8, 0x000000CE, 0x00000258, 
-0x0004003D, 0x00000006, 0x000004D9, 0x000004D8, 0x0003003E, 0x000004D7, 0x000004D9, 0x00050041, 
-0x00000007, 0x000004DB, 0x000000CE, 0x0000020E, 0x0004003D, 0x00000006, 0x000004DC, 0x000004DB, 
-0x0003003E, 0x000004DA, 0x000004DC, 0x00070039, 0x0000000C, 0x000004DD, 0x0000006D, 0x000004D5, 
-0x000004D7, 0x000004DA, 0x0003003E, 0x000004D4, 0x000004DD, 0x0004003D, 0x0000000C, 0x000004DF, 
-0x000004D4, 0x00060050, 0x0000000C, 0x000004E0, 0x000000D3, 0x000000D3, 0x000000D3, 0x00050083, 
-0x0000000C, 0x000004E1, 0x000004E0, 0x000004DF, 0x00050041, 0x00000007, 0x000004E2, 0x000000CE, 
-0x000001FD, 0x0004003D, 0x00000006, 0x000004E3, 0x000004E2, 0x00050083, 0x00000006, 0x000004E4, 
-0x000000D3, 0x000004E3, 0x0005008E, 0x0000000C, 0x000004E5, 0x000004E1, 0x000004E4, 0x0003003E, 
-0x000004DE, 0x000004E5, 0x00050041, 0x00000013, 0x000004E7, 0x000000CE, 0x000001E7, 0x0004003D, 
-0x00000012, 0x000004E8, 0x000004E7, 0x0008004F, 0x0000000C, 0x000004E9, 0x000004E8, 0x000004E8, 
-0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x000004EA, 0x000004CA, 0x00050085, 
-0x0000000C, 0x000004EB, 0x000004E9, 0x000004EA, 0x0003003E, 0x000004E6, 0x000004EB, 0x00050041, 
-0x0000030D, 0x000004EE, 0x000002AC, 0x000004ED, 0x0004003D, 0x00000083, 0x000004EF, 0x000004EE, 
-0x0003003E, 0x000004EC, 0x000004EF, 0x0004003D, 0x000004CC, 0x000004F2, 0x000004F1, 0x0004003D, 
-0x0000000C, 0x000004F3, 0x000000CD, 0x00050041, 0x00000007, 0x000004F4, 0x000000CE, 0x000003E6, 
-0x0004003D, 0x00000006, 0x000004F5, 0x000004F4, 0x0004003D, 0x00000083, 0x000004F6, 0x000004EC, 
-0x0004006F, 0x00000006, 0x000004F7, 0x000004F6, 0x00050085, 0x00000006, 0x000004F8, 0x000004F5, 
-0x000004F7, 0x00070058, 0x00000012, 0x000004F9, 0x000004F2, 0x000004F3, 0x00000002, 0x000004F8, 
-0x0008004F, 0x0000000C, 0x000004FA, 0x000004F9, 0x000004F9, 0x00000000, 0x00000001, 0x00000002, 
-0x0003003E, 0x000004F0, 0x000004FA, 0x0004003D, 0x0000000C, 0x000004FC, 0x000004F0, 0x0004003D, 
-0x0000000C, 0x000004FD, 0x000004D4, 0x00060041, 0x00000007, 0x000004FE, 0x000000CE, 0x0000030C, 
-0x0000023C, 0x0004003D, 0x00000006, 0x000004FF, 0x000004FE, 0x0005008E, 0x0000000C, 0x00000500, 
-0x000004FD, 0x000004FF, 0x00060041, 0x00000007, 0x00000502, 0x000000CE, 0x0000030C, 0x00000501, 
-0x0004003D, 0x00000006, 0x00000503, 0x00000502, 0x00060050, 0x0000000C, 0x00000504, 0x00000503, 
-0x00000503, 0x00000503, 0x00050081, 0x0000000C, 0x00000505, 0x00000500, 0x00000504, 0x00050085, 
-0x0000000C, 0x00000506, 0x000004FC, 0x00000505, 0x0003003E, 0x000004FB, 0x00000506, 0x0004003D, 
-0x0000000C, 0x00000507, 0x000004DE, 0x0004003D, 0x0000000C, 0x00000508, 0x000004E6, 0x00050085, 
-0x0000000C, 0x00000509, 0x00000507, 0x00000508, 0x0004003D, 0x0000000C, 0x0000050A, 0x000004FB, 
-0x00050081, 0x0000000C, 0x0000050B, 0x00000509, 0x0000050A, 0x000200FE, 0x0000050B, 0x00010038, 
-
+0x0000082E, 0x00000429, 0x00050085, 0x00000006, 0x0000082F, 0x0000082E, 0x0000082E, 0x00050041, 
+0x00000007, 0x00000830, 0x000003DA, 0x0000025E, 0x0004003D, 0x00000006, 0x00000831, 0x00000830, 
+0x00050085, 0x00000006, 0x00000832, 0x00000831, 0x00000831, 0x00050088, 0x00000006, 0x00000833, 
+0x0000082F, 0x00000832, 0x00050083, 0x00000006, 0x00000834, 0x000000D3, 0x00000833, 0x0008000C, 
+0x00000006, 0x00000835, 0x00000001, 0x0000002B, 0x00000834, 0x000000F6, 0x000000D3, 0x0004003D, 
+0x00000006, 0x00000836, 0x0000043A, 0x00050085, 0x00000006, 0x00000837, 0x00000836, 0x00000835, 
+0x0003003E, 0x0000043A, 0x00000837, 0x0004003D, 0x00000006, 0x00000448, 0x0000043A, 0x0008000C, 
+0x00000006, 0x00000449, 0x00000001, 0x0000002B, 0x00000448, 0x000000F6, 0x000000D3, 0x0003003E, 
+0x000003EE, 0x00000449, 0x000200F9, 0x0000041E, 0x000200F8, 0x0000044A, 0x0004003D, 0x0000000C, 
+0x0000044D, 0x000000C8, 0x0003003E, 0x0000044C, 0x0000044D, 0x00050039, 0x00000083, 0x0000044E, 
+0x000000A0, 0x0000044C, 0x0003003E, 0x0000044B, 0x0000044E, 0x00050041, 0x0000030D, 0x00000450, 
+0x000002AC, 0x000007DD, 0x0004003D, 0x00000083, 0x00000451, 0x00000450, 0x000500AD, 0x000001E3, 
+0x00000452, 0x00000451, 0x000001E7, 0x000300F7, 0x00000454, 0x00000000, 0x000400FA, 0x00000452, 
+0x00000453, 0x00000461, 0x000200F8, 0x00000453, 0x0004003D, 0x0000000C, 0x00000456, 0x000000C8, 
+0x0003003E, 0x00000455, 0x00000456, 0x0004003D, 0x00000083, 0x00000458, 0x0000044B, 0x0003003E, 
+0x00000457, 0x00000458, 0x00050041, 0x00000013, 0x0000045A, 0x000003DA, 0x0000020E, 0x0004003D, 
+0x00000012, 0x0000045B, 0x0000045A, 0x0008004F, 0x0000000C, 0x0000045C, 0x0000045B, 0x0000045B, 
+0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x00000459, 0x0000045C, 0x00050041, 0x0000000D, 
+0x0000045E, 0x000000C9, 0x00000208, 0x0004003D, 0x0000000C, 0x0000045F, 0x0000045E, 0x0003003E, 
+0x0000045D, 0x0000045F, 0x00080039, 0x00000006, 0x00000460, 0x000000A7, 0x00000455, 0x00000457, 
+0x00000459, 0x0000045D, 0x0003003E, 0x000003EE, 0x00000460, 0x000200F9, 0x00000454, 0x000200F8, 
+0x00000461, 0x0003003E, 0x000003EE, 0x000000D3, 0x000200F9, 0x00000454, 0x000200F8, 0x00000454, 
+0x000200F9, 0x0000041E, 0x000200F8, 0x0000041E, 0x000200F9, 0x000003F3, 0x000200F8, 0x000003F3, 
+0x00050041, 0x00000013, 0x00000463, 0x000003DA, 0x0000020E, 0x0004003D, 0x00000012, 0x00000464, 
+0x00000463, 0x0008004F, 0x0000000C, 0x00000465, 0x00000464, 0x00000464, 0x00000000, 0x00000001, 
+0x00000002, 0x0003003E, 0x00000462, 0x00000465, 0x00050041, 0x00000013, 0x00000467, 0x000003DA, 
+0x000001E7, 0x0004003D, 0x00000012, 0x00000468, 0x00000467, 0x0008004F, 0x0000000C, 0x00000469, 
+0x00000468, 0x00000468, 0x00000000, 0x00000001, 0x00000002, 0x00050041, 0x00000007, 0x0000046A, 
+0x000003DA, 0x000003E6, 0x0004003D, 0x00000006, 0x0000046B, 0x0000046A, 0x0005008E, 0x0000000C, 
+0x0000046C, 0x00000469, 0x0000046B, 0x0003003E, 0x00000466, 0x0000046C, 0x0004003D, 0x0000000C, 
+0x0000046E, 0x00000462, 0x00050041, 0x0000000D, 0x0000046F, 0x000000C9, 0x000002D1, 0x0004003D, 
+0x0000000C, 0x00000470, 0x0000046F, 0x00050081, 0x0000000C, 0x00000471, 0x0000046E, 0x00000470, 
+0x0006000C, 0x0000000C, 0x00000472, 0x00000001, 0x00000045, 0x00000471, 0x0003003E, 0x0000046D, 
+0x00000472, 0x00050041, 0x0000000D, 0x00000474, 0x000000C9, 0x00000208, 0x0004003D, 0x0000000C, 
+0x00000475, 0x00000474, 0x0004003D, 0x0000000C, 0x00000476, 0x00000462, 0x00050094, 0x00000006, 
+0x00000477, 0x00000475, 0x00000476, 0x0003003E, 0x00000478, 0x00000477, 0x00050039, 0x00000006, 
+0x00000479, 0x00000019, 0x00000478, 0x0003003E, 0x00000473, 0x00000479, 0x00050041, 0x0000000D, 
+0x0000047B, 0x000000C9, 0x000002D1, 0x0004003D, 0x0000000C, 0x0000047C, 0x0000047B, 0x0004003D, 
+0x0000000C, 0x0000047D, 0x00000462, 0x00050081, 0x0000000C, 0x0000047E, 0x0000047C, 0x0000047D, 
+0x0006000C, 0x0000000C, 0x0000047F, 0x00000001, 0x00000045, 0x0000047E, 0x0003003E, 0x0000047A, 
+0x0000047F, 0x00050041, 0x0000000D, 0x00000481, 0x000000C9, 0x00000208, 0x0004003D, 0x0000000C, 
+0x00000482, 0x00000481, 0x00050041, 0x0000000D, 0x00000483, 0x000000C9, 0x000002D1, 0x0004003D, 
+0x0000000C, 0x00000484, 0x00000483, 0x00050094, 0x00000006, 0x00000485, 0x00000482, 0x00000484, 
+0x0003003E, 0x00000486, 0x00000485, 0x00050039, 0x00000006, 0x00000487, 0x00000046, 0x00000486, 
+0x0003003E, 0x00000480, 0x00000487, 0x0004003D, 0x00000006, 0x00000489, 0x00000480, 0x0003003E, 
+0x00000488, 0x00000489, 0x0004003D, 0x00000006, 0x0000048C, 0x00000473, 0x0003003E, 0x0000048B, 
+0x0000048C, 0x00050039, 0x00000006, 0x0000048D, 0x00000019, 0x0000048B, 0x0003003E, 0x0000048A, 
+0x0000048D, 0x00050041, 0x0000000D, 0x0000048F, 0x000000C9, 0x00000208, 0x0004003D, 0x0000000C, 
+0x00000490, 0x0000048F, 0x0004003D, 0x0000000C, 0x00000491, 0x0000047A, 0x00050094, 0x00000006, 
+0x00000492, 0x00000490, 0x00000491, 0x0003003E, 0x00000493, 0x00000492, 0x00050039, 0x00000006, 
+0x00000494, 0x00000019, 0x00000493, 0x0003003E, 0x0000048E, 0x00000494, 0x0004003D, 0x0000000C, 
+0x00000496, 0x00000462, 0x0004003D, 0x0000000C, 0x00000497, 0x0000047A, 0x00050094, 0x00000006, 
+0x00000498, 0x00000496, 0x00000497, 0x0003003E, 0x00000499, 0x00000498, 0x00050039, 0x00000006, 
+0x0000049A, 0x00000019, 0x00000499, 0x0003003E, 0x00000495, 0x0000049A, 0x0004003D, 0x000000A9, 
+0x0000049C, 0x000000C9, 0x0004003D, 0x00000006, 0x0000049E, 0x00000488, 0x0003003E, 0x0000049D, 
+0x0000049E, 0x0004003D, 0x00000006, 0x000004A0, 0x0000048A, 0x0003003E, 0x0000049F, 0x000004A0, 
+0x0004003D, 0x00000006, 0x000004A2, 0x00000495, 0x0003003E, 0x000004A1, 0x000004A2, 0x00080039, 
+0x0000000C, 0x000004A3, 0x000000BA, 0x0000049C, 0x0000049D, 0x0000049F, 0x000004A1, 0x0003003E, 
+0x0000049B, 0x000004A3, 0x0004003D, 0x000000A9, 0x000004A5, 0x000000C9, 0x0004003D, 0x000000AA, 
+0x000004A6, 0x000003DA, 0x0004003D, 0x0000000C, 0x000004A7, 0x0000047A, 0x0004003D, 0x00000006, 
+0x000004A9, 0x00000488, 0x0003003E, 0x000004A8, 0x000004A9, 0x0004003D, 0x00000006, 0x000004AB, 
+0x0000048A, 0x0003003E, 0x000004AA, 0x000004AB, 0x0004003D, 0x00000006, 0x000004AD, 0x0000048E, 
+0x0003003E, 0x000004AC, 0x000004AD, 0x0004003D, 0x00000006, 0x000004AF, 0x00000495, 0x0003003E, 
+0x000004AE, 0x000004AF, 0x000B0039, 0x0000000C, 0x000004B0, 0x000000C3, 0x000004A5, 0x000004A6, 
+0x000004A7, 0x000004A8, 0x000004AA, 0x000004AC, 0x000004AE, 0x0003003E, 0x000004A4, 0x000004B0, 
+0x0004003D, 0x0000000C, 0x000004B2, 0x0000049B, 0x0004003D, 0x0000000C, 0x000004B3, 0x000004A4, 
+0x00050081, 0x0000000C, 0x000004B4, 0x000004B2, 0x000004B3, 0x0003003E, 0x000004B1, 0x000004B4, 
+0x0004003D, 0x0000000C, 0x000004B5, 0x000004B1, 0x0004003D, 0x0000000C, 0x000004B6, 0x00000466, 
+0x00050085, 0x0000000C, 0x000004B7, 0x000004B5, 0x000004B6, 0x0004003D, 0x00000006, 0x000004B8, 
+0x000003EE, 0x0004003D, 0x00000006, 0x000004B9, 0x0000048A, 0x00050085, 0x00000006, 0x000004BA, 
+0x000004B8, 0x000004B9, 0x0004003D, 0x00000006, 0x000004BC, 0x0000048A, 0x0003003E, 0x000004BB, 
+0x000004BC, 0x00050041, 0x00000007, 0x000004BE, 0x000000C9, 0x00000226, 0x0004003D, 0x00000006, 
+0x000004BF, 0x000004BE, 0x0003003E, 0x000004BD, 0x000004BF, 0x00060039, 0x00000006, 0x000004C0, 
+0x0000003D, 0x000004BB, 0x000004BD, 0x00050085, 0x00000006, 0x000004C1, 0x000004BA, 0x000004C0, 
+0x0005008E, 0x0000000C, 0x000004C2, 0x000004B7, 0x000004C1, 0x0004003D, 0x0000000C, 0x000004C3, 
+0x000003CC, 0x00050081, 0x0000000C, 0x000004C4, 0x000004C3, 0x000004C2, 0x0003003E, 0x000003CC, 
+0x000004C4, 0x000200F9, 0x000003D2, 0x000200F8, 0x000003D2, 0x0004003D, 0x00000083, 0x000004C5, 
+0x000003CE, 0x00050080, 0x00000083, 0x000004C6, 0x000004C5, 0x000001FD, 0x0003003E, 0x000003CE, 
+0x000004C6, 0x000200F9, 0x000003CF, 0x000200F8, 0x000003D1, 0x0004003D, 0x0000000C, 0x000004C7, 
+0x000003CC, 0x000200FE, 0x000004C7, 0x00010038, 0x00050036, 0x0000000C, 0x000000CF, 0x00000000, 
+0x000000C6, 0x00030037, 0x0000000D, 0x000000CC, 0x00030037, 0x0000000D, 0x000000CD, 0x00030037, 
+0x000000C5, 0x000000CE, 0x000200F8, 0x000000D0, 0x0004003B, 0x0000000D, 0x000004CA, 0x00000007, 
+0x0004003B, 0x0000000D, 0x000004D4, 0x00000007, 0x0004003B, 0x0000000D, 0x000004D5, 0x00000007, 
+0x0004003B, 0x00000007, 0x000004D7, 0x00000007, 0x0004003B, 0x00000007, 0x000004DA, 0x00000007, 
+0x0004003B, 0x0000000D, 0x000004DE, 0x00000007, 0x0004003B, 0x0000000D, 0x000004E6, 0x00000007, 
+0x0004003B, 0x00000084, 0x000004EC, 0x00000007, 0x0004003B, 0x0000000D, 0x000004F0, 0x00000007, 
+0x0004003B, 0x0000000D, 0x000004FB, 0x00000007, 0x0004003D, 0x000004CC, 0x000004CF, 0x000004CE, 
+0x00050041, 0x0000000D, 0x000004D0, 0x000000CE, 0x00000208, 0x0004003D, 0x0000000C, 0x000004D1, 
+0x000004D0, 0x00050057, 0x00000012, 0x000004D2, 0x000004CF, 0x000004D1, 0x0008004F, 0x0000000C, 
+0x000004D3, 0x000004D2, 0x000004D2, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000004CA, 
+0x000004D3, 0x0004003D, 0x0000000C, 0x000004D6, 0x000000CC, 0x0003003E, 0x000004D5, 0x000004D6, 
+0x00050041, 0x00000007, 0x000004D8, 0x000000CE, 0x00000258, 0x0004003D, 0x00000006, 0x000004D9, 
+0x000004D8, 0x0003003E, 0x000004D7, 0x000004D9, 0x00050041, 0x00000007, 0x000004DB, 0x000000CE, 
+0x0000020E, 0x0004003D, 0x00000006, 0x000004DC, 0x000004DB, 0x0003003E, 0x000004DA, 0x000004DC, 
+0x00070039, 0x0000000C, 0x000004DD, 0x0000006D, 0x000004D5, 0x000004D7, 0x000004DA, 0x0003003E, 
+0x000004D4, 0x000004DD, 0x0004003D, 0x0000000C, 0x000004DF, 0x000004D4, 0x00060050, 0x0000000C, 
+0x000004E0, 0x000000D3, 0x000000D3, 0x000000D3, 0x00050083, 0x0000000C, 0x000004E1, 0x000004E0, 
+0x000004DF, 0x00050041, 0x00000007, 0x000004E2, 0x000000CE, 0x000001FD, 0x0004003D, 0x00000006, 
+0x000004E3, 0x000004E2, 0x00050083, 0x00000006, 0x000004E4, 0x000000D3, 0x000004E3, 0x0005008E, 
+0x0000000C, 0x000004E5, 0x000004E1, 0x000004E4, 0x0003003E, 0x000004DE, 0x000004E5, 0x00050041, 
+0x00000013, 0x000004E7, 0x000000CE, 0x000001E7, 0x0004003D, 0x00000012, 0x000004E8, 0x000004E7, 
+0x0008004F, 0x0000000C, 0x000004E9, 0x000004E8, 0x000004E8, 0x00000000, 0x00000001, 0x00000002, 
+0x0004003D, 0x0000000C, 0x000004EA, 0x000004CA, 0x00050085, 0x0000000C, 0x000004EB, 0x000004E9, 
+0x000004EA, 0x0003003E, 0x000004E6, 0x000004EB, 0x00050041, 0x0000030D, 0x000004EE, 0x000002AC, 
+0x000005A3, 0x0004003D, 0x00000083, 0x000004EF, 0x000004EE, 0x0003003E, 0x000004EC, 0x000004EF, 
+0x0004003D, 0x000004CC, 0x000004F2, 0x000004F1, 0x0004003D, 0x0000000C, 0x000004F3, 0x000000CD, 
+0x00050041, 0x00000007, 0x000004F4, 0x000000CE, 0x000003E6, 0x0004003D, 0x00000006, 0x000004F5, 
+0x000004F4, 0x0004003D, 0x00000083, 0x000004F6, 0x000004EC, 0x0004006F, 0x00000006, 0x000004F7, 
+0x000004F6, 0x00050085, 0x00000006, 0x000004F8, 0x000004F5, 0x000004F7, 0x00070058, 0x00000012, 
+0x000004F9, 0x000004F2, 0x000004F3, 0x00000002, 0x000004F8, 0x0008004F, 0x0000000C, 0x000004FA, 
+0x000004F9, 0x000004F9, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000004F0, 0x000004FA, 
+0x0004003D, 0x0000000C, 0x000004FC, 0x000004F0, 0x0004003D, 0x0000000C, 0x000004FD, 0x000004D4, 
+0x00060041, 0x00000007, 0x000004FE, 0x000000CE, 0x0000030C, 0x0000023C, 0x0004003D, 0x00000006, 
+0x000004FF, 0x000004FE, 0x0005008E, 0x0000000C, 0x00000500, 0x000004FD, 0x000004FF, 0x00060041, 
+0x00000007, 0x00000502, 0x000000CE, 0x0000030C, 0x00000501, 0x0004003D, 0x00000006, 0x00000503, 
+0x00000502, 0x00060050, 0x0000000C, 0x00000504, 0x00000503, 0x00000503, 0x00000503, 0x00050081, 
+0x0000000C, 0x00000505, 0x00000500, 0x00000504, 0x00050085, 0x0000000C, 0x00000506, 0x000004FC, 
+0x00000505, 0x0003003E, 0x000004FB, 0x00000506, 0x0004003D, 0x0000000C, 0x00000507, 0x000004DE, 
+0x0004003D, 0x0000000C, 0x00000508, 0x000004E6, 0x00050085, 0x0000000C, 0x00000509, 0x00000507, 
+0x00000508, 0x0004003D, 0x0000000C, 0x0000050A, 0x000004FB, 0x00050081, 0x0000000C, 0x0000050B, 
+0x00000509, 0x0000050A, 0x000200FE, 0x0000050B, 0x00010038, 
     };
\ No newline at end of file
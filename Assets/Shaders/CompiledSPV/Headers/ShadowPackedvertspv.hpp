@@ -0,0 +1,82 @@
+// Header generated by NekoEngine Editor
+
+#include <array>
+#include <cstdint>
+
+constexpr uint32_t spirv_ShadowPackedvertspv_size = 2336;
+constexpr std::array<uint32_t, 584> spirv_ShadowPackedvertspv = {
+    0x07230203, 0x00010000, 0x00000000, 0x0000004B, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+0x00000001, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
+0x000A000F, 0x00000000, 0x00000002, 0x6E69616D, 0x00000000, 0x00000003, 0x00000004, 0x00000005, 
+0x00000006, 0x00000007, 0x00030003, 0x00000002, 0x000001C2, 0x00090004, 0x415F4C47, 0x735F4252, 
+0x72617065, 0x5F657461, 0x64616873, 0x6F5F7265, 0x63656A62, 0x00007374, 0x00090004, 0x415F4C47, 
+0x735F4252, 0x69646168, 0x6C5F676E, 0x75676E61, 0x5F656761, 0x70303234, 0x006B6361, 0x000A0004, 
+0x475F4C47, 0x4C474F4F, 0x70635F45, 0x74735F70, 0x5F656C79, 0x656E696C, 0x7269645F, 0x69746365, 
+0x00006576, 0x00080004, 0x475F4C47, 0x4C474F4F, 0x6E695F45, 0x64756C63, 0x69645F65, 0x74636572, 
+0x00657669, 0x00040005, 0x00000002, 0x6E69616D, 0x00000000, 0x00050005, 0x00000004, 0x6F506E69, 
+0x69746973, 0x00006E6F, 0x00060005, 0x00000007, 0x6F4E6E69, 0x6C616D72, 0x676E6154, 0x00746E65, 
+0x00050005, 0x00000006, 0x65546E69, 0x6F6F4378, 0x00006472, 0x00060005, 0x00000008, 0x505F6C67, 
+0x65567265, 0x78657472, 0x00000000, 0x00060006, 0x00000008, 0x00000000, 0x505F6C67, 0x7469736F, 
+0x006E6F69, 0x00030005, 0x00000003, 0x00000000, 0x00050005, 0x00000009, 0x68737550, 0x736E6F43, 
+0x00007374, 0x00050005, 0x0000000A, 0x68737570, 0x736E6F43, 0x00007374, 0x00040005, 0x0000000B, 
+0x6A6F7270, 0x00000000, 0x00050005, 0x0000000C, 0x64616853, 0x6144776F, 0x00006174, 0x00070006, 
+0x0000000C, 0x00000000, 0x6867694C, 0x74614D74, 0x65636972, 0x00000073, 0x00030005, 0x0000000D, 
+0x006F6275, 0x00030005, 0x00000005, 0x00007675, 0x00060006, 0x00000009, 0x00000000, 0x6E617274, 
+0x726F6673, 0x0000006D, 0x00070006, 0x00000009, 0x00000001, 0x63736163, 0x49656461, 0x7865646E, 
+0x00000000, 0x00040006, 0x00000009, 0x00000002, 0x00003070, 0x00040006, 0x00000009, 0x00000003, 
+0x00003170, 0x00040006, 0x00000009, 0x00000004, 0x00003270, 0x00040047, 0x00000004, 0x0000001E, 
+0x00000000, 0x00040047, 0x00000007, 0x0000001E, 0x00000001, 0x00040047, 0x00000006, 0x0000001E, 
+0x00000002, 0x00050048, 0x00000008, 0x00000000, 0x0000000B, 0x00000000, 0x00030047, 0x00000008, 
+0x00000002, 0x00040048, 0x00000009, 0x00000000, 0x00000005, 0x00050048, 0x00000009, 0x00000000, 
+0x00000023, 0x00000000, 0x00050048, 0x00000009, 0x00000000, 0x00000007, 0x00000010, 0x00050048, 
+0x00000009, 0x00000001, 0x00000023, 0x00000040, 0x00050048, 0x00000009, 0x00000002, 0x00000023, 
+0x00000044, 0x00050048, 0x00000009, 0x00000003, 0x00000023, 0x00000048, 0x00050048, 0x00000009, 
+0x00000004, 0x00000023, 0x0000004C, 0x00030047, 0x00000009, 0x00000002, 0x00040047, 0x0000000E, 
+0x00000006, 0x00000040, 0x00040048, 0x0000000C, 0x00000000, 0x00000005, 0x00050048, 0x0000000C, 
+0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000000C, 0x00000000, 0x00000007, 0x00000010, 
+0x00030047, 0x0000000C, 0x00000002, 0x00040047, 0x0000000D, 0x00000022, 0x00000000, 0x00040047, 
+0x0000000D, 0x00000021, 0x00000000, 0x00040047, 0x00000005, 0x0000001E, 0x00000000, 0x00020013, 
+0x0000000F, 0x00030021, 0x00000010, 0x0000000F, 0x00030016, 0x00000011, 0x00000020, 0x00040017, 
+0x00000012, 0x00000011, 0x00000002, 0x00040017, 0x00000013, 0x00000011, 0x00000003, 0x00040017, 
+0x00000014, 0x00000011, 0x00000004, 0x00040018, 0x00000015, 0x00000013, 0x00000003, 0x00040018, 
+0x00000016, 0x00000014, 0x00000004, 0x00020014, 0x00000017, 0x00040015, 0x00000018, 0x00000020, 
+0x00000001, 0x00040015, 0x00000019, 0x00000020, 0x00000000, 0x0004002B, 0x00000018, 0x0000001A, 
+0x00000000, 0x0004002B, 0x00000018, 0x0000001B, 0x00000001, 0x0004002B, 0x00000018, 0x0000001C, 
+0x00000002, 0x0004002B, 0x00000018, 0x0000001D, 0x00000003, 0x0004002B, 0x00000018, 0x0000001E, 
+0x00000004, 0x0004002B, 0x00000011, 0x0000001F, 0x00000000, 0x0004002B, 0x00000011, 0x00000020, 
+0x3F800000, 0x0004002B, 0x00000011, 0x00000021, 0xBF800000, 0x0006002C, 0x00000013, 0x00000022, 
+0x00000020, 0x00000020, 0x00000020, 0x00040020, 0x00000023, 0x00000001, 0x00000014, 0x00040020, 
+0x00000024, 0x00000001, 0x00000012, 0x0004003B, 0x00000023, 0x00000004, 0x00000001, 0x0004003B, 
+0x00000023, 0x00000007, 0x00000001, 0x0004003B, 0x00000024, 0x00000006, 0x00000001, 0x0003001E, 
+0x00000008, 0x00000014, 0x00040020, 0x00000025, 0x00000003, 0x00000008, 0x0004003B, 0x00000025, 
+0x00000003, 0x00000003, 0x00040020, 0x00000026, 0x00000003, 0x00000014, 0x0007001E, 0x00000009, 
+0x00000016, 0x00000019, 0x00000011, 0x00000011, 0x00000011, 0x00040020, 0x00000027, 0x00000009, 
+0x00000016, 0x00040020, 0x00000028, 0x00000009, 0x00000009, 0x0004003B, 0x00000028, 0x0000000A, 
+0x00000009, 0x00040020, 0x00000029, 0x00000009, 0x00000019, 0x00040020, 0x0000002A, 0x00000007, 
+0x00000016, 0x0004002B, 0x00000019, 0x0000002B, 0x00000010, 0x0004001C, 0x0000000E, 0x00000016, 
+0x0000002B, 0x0003001E, 0x0000000C, 0x0000000E, 0x00040020, 0x0000002C, 0x00000002, 0x0000000C, 
+0x0004003B, 0x0000002C, 0x0000000D, 0x00000002, 0x00040020, 0x0000002D, 0x00000002, 0x00000016, 
+0x00040020, 0x0000002E, 0x00000003, 0x00000012, 0x0004003B, 0x0000002E, 0x00000005, 0x00000003, 
+0x00050036, 0x0000000F, 0x00000002, 0x00000000, 0x00000010, 0x000200F8, 0x0000002F, 0x0004003B, 
+0x0000002A, 0x0000000B, 0x00000007, 0x00050041, 0x00000029, 0x00000030, 0x0000000A, 0x0000001B, 
+0x0004003D, 0x00000019, 0x00000031, 0x00000030, 0x000300F7, 0x00000032, 0x00000000, 0x000900FB, 
+0x00000031, 0x00000033, 0x00000000, 0x00000034, 0x00000001, 0x00000035, 0x00000002, 0x00000036, 
+0x000200F8, 0x00000033, 0x00060041, 0x0000002D, 0x00000037, 0x0000000D, 0x0000001A, 0x0000001D, 
+0x0004003D, 0x00000016, 0x00000038, 0x00000037, 0x0003003E, 0x0000000B, 0x00000038, 0x000200F9, 
+0x00000032, 0x000200F8, 0x00000034, 0x00060041, 0x0000002D, 0x00000039, 0x0000000D, 0x0000001A, 
+0x0000001A, 0x0004003D, 0x00000016, 0x0000003A, 0x00000039, 0x0003003E, 0x0000000B, 0x0000003A, 
+0x000200F9, 0x00000032, 0x000200F8, 0x00000035, 0x00060041, 0x0000002D, 0x0000003B, 0x0000000D, 
+0x0000001A, 0x0000001B, 0x0004003D, 0x00000016, 0x0000003C, 0x0000003B, 0x0003003E, 0x0000000B, 
+0x0000003C, 0x000200F9, 0x00000032, 0x000200F8, 0x00000036, 0x00060041, 0x0000002D, 0x0000003D, 
+0x0000000D, 0x0000001A, 0x0000001C, 0x0004003D, 0x00000016, 0x0000003E, 0x0000003D, 0x0003003E, 
+0x0000000B, 0x0000003E, 0x000200F9, 0x00000032, 0x000200F8, 0x00000032, 0x0004003D, 0x00000016, 
+0x0000003F, 0x0000000B, 0x00050041, 0x00000027, 0x00000040, 0x0000000A, 0x0000001A, 0x0004003D, 
+0x00000016, 0x00000041, 0x00000040, 0x00050092, 0x00000016, 0x00000042, 0x0000003F, 0x00000041, 
+0x0004003D, 0x00000014, 0x00000043, 0x00000004, 0x00050051, 0x00000011, 0x00000044, 0x00000043, 
+0x00000000, 0x00050051, 0x00000011, 0x00000045, 0x00000043, 0x00000001, 0x00050051, 0x00000011, 
+0x00000046, 0x00000043, 0x00000002, 0x00070050, 0x00000014, 0x00000047, 0x00000044, 0x00000045, 
+0x00000046, 0x00000020, 0x00050091, 0x00000014, 0x00000048, 0x00000042, 0x00000047, 0x00050041, 
+0x00000026, 0x00000049, 0x00000003, 0x0000001A, 0x0003003E, 0x00000049, 0x00000048, 0x0004003D, 
+0x00000012, 0x0000004A, 0x00000006, 0x0003003E, 0x00000005, 0x0000004A, 0x000100FD, 0x00010038, 
+
+    };
\ No newline at end of file
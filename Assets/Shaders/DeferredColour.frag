@@ -85,7 +85,9 @@ vec3 GetNormalFromMap()
 	if (materialProperties.usingNormalMap < 0.1)
 		return normalize(fragNormal);
 
-	vec3 tangentNormal = texture(u_NormalMap, fragTexCoord).xyz * 2.0 - 1.0;
+	// Z is rebuilt from XY so two channel (BC5) normal maps work too
+	vec2 normalXY = texture(u_NormalMap, fragTexCoord).xy * 2.0 - 1.0;
+	vec3 tangentNormal = vec3(normalXY, sqrt(clamp(1.0 - dot(normalXY, normalXY), 0.0, 1.0)));
 
 	vec3 Q1 = dFdx(fragPosition.xyz);
 	vec3 Q2 = dFdy(fragPosition.xyz);
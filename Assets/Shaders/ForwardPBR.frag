@@ -14,7 +14,6 @@ struct VertexData
 
 layout(location = 0) in VertexData VertexOutput;
 
-#define MAX_LIGHTS 32
 #define MAX_SHADOWMAPS 4
 #define BLEND_SHADOW_CASCADES 1
 #define FILTER_SHADOWS 1
@@ -64,18 +63,20 @@ layout(set = 2, binding = 4) uniform sampler2D uSSAOMap;
 
 layout(set = 2, binding = 5) uniform UBOLight
 {
-	Light lights[MAX_LIGHTS];
 	mat4 ShadowTransform[MAX_SHADOWMAPS];
 	mat4 ViewMatrix;
 	mat4 LightView;
 	mat4 BiasMatrix;
+	mat4 ClusterProjView;
+	uvec4 ClusterCount;
+	vec4 ClusterDepthParams; // slice = log(view depth) * x + y
 	vec4 cameraPosition;
 	vec4 SplitDepths[MAX_SHADOWMAPS];
 	float LightSize;
 	float MaxShadowDist;
 	float ShadowFade;
 	float CascadeFade;
-	int LightCount;
+	int DirectionalLightCount;
 	int ShadowCount;
 	int Mode;
 	int EnvMipCount;
@@ -85,6 +86,23 @@ layout(set = 2, binding = 5) uniform UBOLight
 	int shadowEnabled;
 } ubo;
 
+// Directional lights first, then the clustered point and spot lights
+layout(std430, set = 2, binding = 6) readonly buffer LightBuffer
+{
+	Light lights[];
+} lightBuffer;
+
+// Offset and count into ClusterLightIndices per froxel, x fastest
+layout(std430, set = 2, binding = 7) readonly buffer ClusterGrid
+{
+	uvec2 clusters[];
+} clusterGrid;
+
+layout(std430, set = 2, binding = 8) readonly buffer ClusterLightIndices
+{
+	uint indices[];
+} clusterLights;
+
 layout(location = 0) out vec4 outColor;
 
 const float PBR_WORKFLOW_SEPARATE_TEXTURES = 0.0f;
@@ -151,7 +169,7 @@ vec3 GetNormalFromMap()
 	if (materialProperties.NormalMapFactor < 0.05)
 		return normalize(VertexOutput.Normal);
 
-	vec3 Normal = normalize(texture(u_NormalMap, VertexOutput.TexCoord).rgb * 2.0f - 1.0f);
+	vec3 Normal = normalize(UnpackNormalMap(texture(u_NormalMap, VertexOutput.TexCoord)));
 	return normalize(VertexOutput.WorldNormal * Normal);
 }
 
@@ -353,13 +371,29 @@ vec3 SpecularLobe(const Material material, const Light light, const vec3 h, floa
 
 #define NEW_LIGHTING 1
 
+uint GetClusterIndex(vec3 wsPos)
+{
+	vec4 clip = ubo.ClusterProjView * vec4(wsPos, 1.0);
+	vec2 ndc = clip.xy / clip.w;
+	uvec2 tile = uvec2(clamp((ndc * 0.5 + 0.5) * vec2(ubo.ClusterCount.xy), vec2(0.0), vec2(ubo.ClusterCount.xy) - 1.0));
+
+	float depth = max(-(ubo.ViewMatrix * vec4(wsPos, 1.0)).z, 0.0001);
+	uint slice = uint(clamp(log(depth) * ubo.ClusterDepthParams.x + ubo.ClusterDepthParams.y, 0.0, float(ubo.ClusterCount.z) - 1.0));
+
+	return (slice * ubo.ClusterCount.y + tile.y) * ubo.ClusterCount.x + tile.x;
+}
+
 vec3 Lighting(vec3 F0, vec3 wsPos, Material material)
 {
 	vec3 result = vec3(0.0);
 	
-	for(int i = 0; i < ubo.LightCount; i++)
+	uvec2 cluster = clusterGrid.clusters[GetClusterIndex(wsPos)];
+	uint lightCount = uint(ubo.DirectionalLightCount) + cluster.y;
+
+	for(uint i = 0; i < lightCount; i++)
 	{
-		Light light = ubo.lights[i];
+		uint lightIndex = i < uint(ubo.DirectionalLightCount) ? i : clusterLights.indices[cluster.x + i - uint(ubo.DirectionalLightCount)];
+		Light light = lightBuffer.lights[lightIndex];
 		float value = 0.0;
 		
 		if(light.type == 2.0)
@@ -390,6 +424,7 @@ vec3 Lighting(vec3 F0, vec3 wsPos, Material material)
 			float epsilon       = cutoffAngle - cutoffAngle * 0.9f;
 			float attenuation 	= ((theta - cutoffAngle) / epsilon); // atteunate when approaching the outer cone
 			attenuation         *= light.radius / (pow(dist, 2.0) + 1.0);//saturate(1.0f - dist / light.range);
+			attenuation         *= clamp(1.0 - (dist * dist) / (light.radius * light.radius), 0.0, 1.0); // Ends at the radius it is clustered with
 			//float intensity 	= attenuation * attenuation;
 			
 			// Erase light if there is no need to compute it
@@ -528,7 +563,7 @@ void main()
 	
 	if (materialProperties.NormalMapFactor > 0.04)
 	{
-		material.Normal = normalize(texture(u_NormalMap, VertexOutput.TexCoord).rgb * 2.0f - 1.0f);
+		material.Normal = normalize(UnpackNormalMap(texture(u_NormalMap, VertexOutput.TexCoord)));
 		material.Normal = normalize(VertexOutput.WorldNormal * material.Normal);
 		material.Normal = normalize(material.Normal);
 	}
@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ForwardPBRInstanced.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/ForwardPBR.frag.spv
+#shader end
\ No newline at end of file
@@ -0,0 +1,49 @@
+#version 450
+#include "PackedVertex.glslh"
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+
+layout(set = 0,binding = 0) uniform UBO 
+{    
+	mat4 projView;
+} cameraUBO;
+
+layout(push_constant) uniform PushConsts
+{
+	mat4 transform;
+} pushConsts;
+
+struct VertexData
+{
+	vec3 Colour;
+	vec2 TexCoord;
+	vec4 Position;
+	vec3 Normal;
+	mat3 WorldNormal;
+};
+
+layout(location = 0) out VertexData VertexOutput;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+void main() 
+{
+	VertexOutput.Position = pushConsts.transform * vec4(inPosition.xyz, 1.0);
+    gl_Position = cameraUBO.projView * VertexOutput.Position;
+
+	vec3 normal    = GetPackedNormal();
+	vec3 tangent   = GetPackedTangent();
+	vec3 bitangent = GetPackedBitangent(normal, tangent);
+
+	VertexOutput.Colour = vec3(1.0);
+	VertexOutput.TexCoord = inTexCoord;
+
+	// The transform carries the dequantise scale, normalise so it does not shorten the basis
+	mat3 transposeInv = transpose(inverse(mat3(pushConsts.transform)));
+    VertexOutput.Normal = normalize(transposeInv * normal);
+
+    VertexOutput.WorldNormal = mat3(normalize(transposeInv * tangent), normalize(transposeInv * bitangent), VertexOutput.Normal);
+}
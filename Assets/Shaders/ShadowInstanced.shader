@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ShadowInstanced.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/Shadow.frag.spv
+#shader end
\ No newline at end of file
@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ShadowPacked.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/Shadow.frag.spv
+#shader end
\ No newline at end of file
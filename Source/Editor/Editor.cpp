@@ -33,6 +33,7 @@
 #include "Panels/GameViewPanel.h"
 #include "Panels/ResourcePanel.h"
 #include "Panels/ApplicationInfoPanel.h"
+#include "Panels/ProfilerPanel.h"
 #include "spdlog/fmt/fmt.h"
 #include "Entity/EntityManager.h"
 #include "Asset/EmbedAsset.h"
@@ -223,6 +224,8 @@ namespace NekoEngine
         m_Panels.emplace_back(MakeShared<GameViewPanel>());
         m_Panels.emplace_back(MakeShared<InspectorPanel>());
         m_Panels.emplace_back(MakeShared<ApplicationInfoPanel>());
+        m_Panels.emplace_back(MakeShared<ProfilerPanel>());
+        m_Panels.back()->SetActive(false);
         m_Panels.emplace_back(MakeShared<SceneSettingsPanel>());
         m_Panels.emplace_back(MakeShared<HierarchyPanel>());
         m_Panels.emplace_back(MakeShared<EditorSettingsPanel>());
@@ -408,6 +411,9 @@ namespace NekoEngine
 
     RENDER_API StringToRenderAPI(const std::string& name)
     {
+        if(name == "Null" || name == "None")
+            return RENDER_API::NONE;
+
         return RENDER_API::VULKAN;
     }
 
@@ -1531,7 +1537,7 @@ namespace NekoEngine
 
         Platform = "Windows";
 
-        RenderAPI = "Vulkan";
+        RenderAPI = GraphicsContext::GetRenderAPI() == RENDER_API::NONE ? "Null" : "Vulkan";
 
         std::stringstream Title;
         Title << Platform << dash << RenderAPI << dash << Configuration << dash << level->GetName() << dash << gEngine->GetWindow()->GetTitle();
@@ -1880,20 +1886,24 @@ namespace NekoEngine
         {
             auto group = registry.group<ModelComponent>(entt::get<Transform>);
 
-            for(auto entity : group)
-            {
-                const auto& [model, trans] = group.get<ModelComponent, Transform>(entity);
-                auto& meshes               = model.model->GetMeshes();
-                for(auto mesh : meshes)
-                {
-                    if(mesh->IsActive())
-                    {
-                        auto& worldTransform = trans.GetWorldMatrix();
-                        auto bbCopy          = mesh->GetBoundingBox()->Transformed(worldTransform);
-                        DebugRenderer::DebugDraw(bbCopy, selectedColour, true);
-                    }
-                }
-            }
+            // Boxes are transformed on the job system, drawing stays here as the debug renderer's queues aren't thread safe
+            m_DebugBoxes.clear();
+            ParallelEach(group, 64, m_DebugBoxScratch, m_DebugBoxes, [&group](entt::entity entity, ArrayList<BoundingBox>& boxes)
+                         {
+                             const auto& [model, trans] = group.get<ModelComponent, Transform>(entity);
+                             auto& meshes               = model.model->GetMeshes();
+                             for(auto& mesh : meshes)
+                             {
+                                 if(mesh->IsActive())
+                                 {
+                                     auto& worldTransform = trans.GetWorldMatrix();
+                                     boxes.push_back(mesh->GetBoundingBox()->Transformed(worldTransform));
+                                 }
+                             }
+                         });
+
+            for(auto& box : m_DebugBoxes)
+                DebugRenderer::DebugDraw(box, selectedColour, true);
         }
 
 //        if(m_Settings.m_DebugDrawFlags & EditorDebugFlags::SpriteBoxes)
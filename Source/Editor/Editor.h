@@ -8,6 +8,8 @@
 #include "Renderable/EditorCamera.h"
 #include "Panels/FileBrowserPanel.h"
 #include "Utility/IniFile.h"
+#include "Math/BoundingBox.h"
+#include "JobSystem/ParallelEach.h"
 
 #define BIND_FILEBROWSER_FN(fn) [this](auto&&... args) -> decltype(auto) { \
     return this->fn(std::forward<decltype(args)>(args)...);                \
@@ -98,6 +100,10 @@ namespace NekoEngine
 
         std::unordered_map<size_t, const char*> m_ComponentIconMap;
 
+        // World space mesh bounds drawn by DebugDraw, kept to reuse the allocations
+        ParallelOutput<BoundingBox> m_DebugBoxScratch;
+        ArrayList<BoundingBox> m_DebugBoxes;
+
         FileBrowserPanel m_FileBrowserPanel;
         Camera* m_CurrentCamera = nullptr;
         EditorCameraController m_EditorCameraController;
@@ -227,7 +227,15 @@ namespace NekoEngine
 
                 ImGui::Text("Num Rendered Objects %u", SceneRendererStats.NumRenderedObjects);
                 ImGui::Text("Num Shadow Objects %u", SceneRendererStats.NumShadowObjects);
+                ImGui::Text("Shadow Cascades Drawn %u | Static Redrawn %u", SceneRendererStats.NumShadowCascadesDrawn,
+                            SceneRendererStats.NumShadowCascadesStatic);
                 ImGui::Text("Num Draw Calls  %u", SceneRendererStats.NumDrawCalls);
+                ImGui::Text("Binds Pipeline %u | Descriptor %u | Vertex Buffer %u", SceneRendererStats.NumPipelineBinds,
+                            SceneRendererStats.NumDescriptorBinds, SceneRendererStats.NumVertexBufferBinds);
+                ImGui::Text("Cull Bounds Updated %u", SceneRendererStats.NumCullBoundsUpdated);
+                ImGui::Text("Lights %u | Cluster Light Indices %u", SceneRendererStats.NumLights, SceneRendererStats.NumClusterLightIndices);
+                ImGui::Text("Occluders %u | Occlusion Culled %u", SceneRendererStats.NumOccluders, SceneRendererStats.NumOcclusionCulled);
+                ImGui::Text("Meshlets %u | Meshlets Culled %u", SceneRendererStats.NumMeshlets, SceneRendererStats.NumMeshletsCulled);
                 ImGui::Text("Used GPU Memory : %.1f mb | Total : %.1f mb", stats.UsedGPUMemory * 0.000001f, stats.TotalGPUMemory * 0.000001f);
 
                 if(ImGui::BeginPopupContextWindow())
@@ -10,6 +10,7 @@
 #include "StringUtility.h"
 #include "Renderable/Environment.h"
 #include "Component/ModelComponent.h"
+#include "Component/OccluderComponent.h"
 #include "Component/PrefabComponent.h"
 #include "Entity/EntityManager.h"
 
@@ -974,6 +975,28 @@ end
             ImGui::NextColumn();
         }
 
+        if(reg.get<NekoEngine::ModelComponent>(e).model)
+        {
+            ImGui::TextUnformatted("CPU Residency");
+
+            ImGui::NextColumn();
+            ImGui::PushItemWidth(-1);
+
+            const char* residencies[] = { "GPU Only", "Positions", "Full" };
+            int residency = (int)model.GetResidency();
+            if(ImGui::Combo("##Residency", &residency, residencies, IM_ARRAYSIZE(residencies)))
+                model.SetResidency((NekoEngine::MeshResidency)residency);
+            NekoEngine::ImGuiUtility::Tooltip("What the meshes keep on the CPU after upload, more than they hold is read back from the source file");
+
+            ImGui::PopItemWidth();
+            ImGui::NextColumn();
+
+            ImGui::TextUnformatted("Memory");
+            ImGui::NextColumn();
+            ImGui::Text("CPU %.1f KB, GPU %.1f KB", (double)model.GetCPUBytes() / 1024.0, (double)model.GetGPUBytes() / 1024.0);
+            ImGui::NextColumn();
+        }
+
         ImGui::Columns(1);
         ImGui::Separator();
         ImGui::PopStyleVar();
@@ -993,8 +1016,8 @@ end
         {
             for(const auto& mesh : meshes)
             {
-                if(!mesh->GetName().empty())
-                    ImGui::TextUnformatted(mesh->GetName().c_str());
+                ImGui::Text("%s : CPU %.1f KB, GPU %.1f KB", mesh->GetName().empty() ? "(unnamed)" : mesh->GetName().c_str(),
+                            (double)mesh->GetCPUBytes() / 1024.0, (double)mesh->GetGPUBytes() / 1024.0);
             }
             ImGui::TreePop();
         }
@@ -1302,6 +1325,21 @@ end
         ImGui::PopStyleVar();
     }
 
+    template <>
+    void ComponentEditorWidget<NekoEngine::OccluderComponent>(entt::registry& reg, entt::registry::entity_type e)
+    {
+        auto& occluder = reg.get<NekoEngine::OccluderComponent>(e);
+        ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(2, 2));
+        ImGui::Columns(2);
+        ImGui::Separator();
+
+        NekoEngine::ImGuiUtility::Property("Enabled", occluder.Enabled);
+
+        ImGui::Columns(1);
+        ImGui::Separator();
+        ImGui::PopStyleVar();
+    }
+
 
 }
 
@@ -1347,6 +1385,7 @@ namespace NekoEngine
         TRIVIAL_COMPONENT(LuaScriptComponent, "LuaScript");
         TRIVIAL_COMPONENT(Environment, "Environment");
         TRIVIAL_COMPONENT(DefaultCameraController, "Default Camera Controller");
+        TRIVIAL_COMPONENT(OccluderComponent, "Occluder");
     }
 
     void InspectorPanel::OnImGui()
@@ -0,0 +1,226 @@
+#include "ProfilerPanel.h"
+#include "GUI/ImGuiUtility.h"
+#include "ImGui/imgui.h"
+#include "ImGui/Plugins/implot/implot.h"
+#include "Profiler/Profiler.h"
+#include "Engine.h"
+#include "Math/Maths.h"
+#include <algorithm>
+
+namespace NekoEngine
+{
+#ifdef NekoEngine_PROFILE
+    namespace
+    {
+        struct ScopeTotal
+        {
+            const char* name = nullptr;
+            uint32_t thread  = 0;
+            uint32_t depth   = 0;
+            uint32_t calls   = 0;
+            double ms        = 0.0;
+        };
+
+        // Scopes of one frame added up per name and thread, in the order they were first opened
+        ArrayList<ScopeTotal> SumScopes(const ArrayList<ProfileEvent>& events)
+        {
+            ArrayList<const ProfileEvent*> sorted;
+            sorted.reserve(events.size());
+            for(auto &event: events)
+                sorted.push_back(&event);
+
+            std::stable_sort(sorted.begin(), sorted.end(), [](const ProfileEvent* a, const ProfileEvent* b)
+            {
+                return a->thread != b->thread ? a->thread < b->thread : a->begin < b->begin;
+            });
+
+            ArrayList<ScopeTotal> totals;
+            HashMap<String, uint32_t> lookup;
+            for(const ProfileEvent* event: sorted)
+            {
+                const String key = std::to_string(event->thread) + ":" + (event->name ? event->name : "?");
+                auto it = lookup.find(key);
+                if(it == lookup.end())
+                {
+                    it = lookup.emplace(key, (uint32_t)totals.size()).first;
+                    ScopeTotal &total = totals.emplace_back();
+                    total.name   = event->name ? event->name : "?";
+                    total.thread = event->thread;
+                    total.depth  = event->depth;
+                }
+
+                ScopeTotal &total = totals[it->second];
+                total.calls++;
+                total.ms += double(event->end - event->begin) * 1e-6;
+            }
+
+            return totals;
+        }
+
+        float GetGPUMs(const ProfileFrame& frame)
+        {
+            if(frame.gpuEvents.empty())
+                return 0.0f;
+
+            int64_t begin = frame.gpuEvents.front().begin;
+            int64_t end   = frame.gpuEvents.front().end;
+            for(auto &event: frame.gpuEvents)
+            {
+                begin = Maths::Min(begin, event.begin);
+                end   = Maths::Max(end, event.end);
+            }
+            return float(double(end - begin) * 1e-6);
+        }
+    }
+#endif
+
+    ProfilerPanel::ProfilerPanel()
+    {
+        m_Name       = "Profiler";
+        m_SimpleName = "Profiler";
+    }
+
+    void ProfilerPanel::OnImGui()
+    {
+        auto flags = ImGuiWindowFlags_NoCollapse;
+        if(ImGui::Begin(m_Name.c_str(), &m_Active, flags))
+        {
+            ImGuiUtility::PushID();
+
+#ifdef NekoEngine_PROFILE
+            const auto &history = Profiler::GetHistory();
+
+            bool paused = Profiler::IsPaused();
+            if(ImGui::Checkbox("Pause", &paused))
+                Profiler::SetPaused(paused);
+
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(100.0f);
+            ImGui::InputInt("##CaptureFrames", &m_CaptureFrames);
+            m_CaptureFrames = Maths::Max(m_CaptureFrames, 1);
+            ImGui::SameLine();
+            if(Profiler::IsCapturing())
+                ImGui::Text("Capturing, %u frames so far", Profiler::GetCapturedFrameCount());
+            else if(ImGui::Button("Capture Frames"))
+                Profiler::BeginCapture((uint32_t)m_CaptureFrames);
+
+            ImGui::Columns(2);
+            ImGui::TextUnformatted("Trace Path");
+            ImGui::NextColumn();
+            ImGuiUtility::InputText(m_TracePath);
+            ImGui::Columns(1);
+
+            if(ImGui::Button("Save Trace"))
+            {
+                if(Profiler::SaveChromeTrace(m_TracePath))
+                    LOG_FORMAT("Profiler trace saved to %s", m_TracePath.c_str());
+                else
+                    LOG_FORMAT("Failed to save profiler trace to %s", m_TracePath.c_str());
+            }
+            ImGui::SameLine();
+            ImGui::TextDisabled(Profiler::GetCapturedFrameCount() > 0 ? "(captured frames)" : "(recent frames)");
+
+            if(history.empty())
+            {
+                ImGui::TextUnformatted("No frames recorded yet");
+                ImGuiUtility::PopID();
+                ImGui::End();
+                return;
+            }
+
+            m_CPUTimes.clear();
+            m_GPUTimes.clear();
+            for(auto &frame: history)
+            {
+                m_CPUTimes.push_back((float)frame.GetMs());
+                m_GPUTimes.push_back(GetGPUMs(frame));
+            }
+
+            if(ImPlot::BeginPlot("Frame Times", ImVec2(-1, 200), 0))
+            {
+                ImPlot::SetupAxis(ImAxis_X1, nullptr, ImPlotAxisFlags_NoTickLabels);
+                ImPlot::SetupAxis(ImAxis_Y1, "ms", ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupAxisLimits(ImAxis_X1, 0, (double)Profiler::FrameHistory, ImGuiCond_Always);
+
+                ImPlot::PlotBars("CPU", m_CPUTimes.data(), (int)m_CPUTimes.size(), 0.8);
+                ImPlot::PlotLine("GPU", m_GPUTimes.data(), (int)m_GPUTimes.size());
+
+                const double selected = double(m_CPUTimes.size() - 1 - m_SelectedFrame);
+                ImPlot::PlotInfLines("##Selected", &selected, 1);
+                ImPlot::EndPlot();
+            }
+
+            const int lastFrame = (int)history.size() - 1;
+            m_SelectedFrame = Maths::Min(m_SelectedFrame, lastFrame);
+            ImGui::SliderInt("Frames Back", &m_SelectedFrame, 0, lastFrame);
+
+            const ProfileFrame &frame = history[lastFrame - m_SelectedFrame];
+            ImGui::Text("Frame %llu : %.3f ms CPU, %.3f ms GPU", (unsigned long long)frame.index, frame.GetMs(),
+                        GetGPUMs(frame));
+
+            const ArrayList<String> threadNames = Profiler::GetThreadNames();
+            auto tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+
+            if(ImGui::TreeNodeEx("CPU", ImGuiTreeNodeFlags_DefaultOpen))
+            {
+                const ArrayList<ScopeTotal> totals = SumScopes(frame.events);
+                if(ImGui::BeginTable("CPUScopes", 4, tableFlags, ImVec2(0, 300)))
+                {
+                    ImGui::TableSetupScrollFreeze(0, 1);
+                    ImGui::TableSetupColumn("Scope");
+                    ImGui::TableSetupColumn("Thread");
+                    ImGui::TableSetupColumn("Calls");
+                    ImGui::TableSetupColumn("ms");
+                    ImGui::TableHeadersRow();
+
+                    for(auto &total: totals)
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%*s%s", (int)total.depth * 2, "", total.name);
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(total.thread < threadNames.size() ? threadNames[total.thread].c_str() : "?");
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%u", total.calls);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.3f", total.ms);
+                    }
+
+                    ImGui::EndTable();
+                }
+                ImGui::TreePop();
+            }
+
+            if(ImGui::TreeNodeEx("GPU", ImGuiTreeNodeFlags_DefaultOpen))
+            {
+                if(frame.gpuEvents.empty())
+                    ImGui::TextDisabled("No timestamps, the backend does not support them");
+                else if(ImGui::BeginTable("GPUScopes", 2, tableFlags, ImVec2(0, 200)))
+                {
+                    ImGui::TableSetupScrollFreeze(0, 1);
+                    ImGui::TableSetupColumn("Pass");
+                    ImGui::TableSetupColumn("ms");
+                    ImGui::TableHeadersRow();
+
+                    for(auto &event: frame.gpuEvents)
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(event.name ? event.name : "?");
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.3f", double(event.end - event.begin) * 1e-6);
+                    }
+
+                    ImGui::EndTable();
+                }
+                ImGui::TreePop();
+            }
+#else
+            ImGui::TextWrapped("The profiler is compiled out, configure with --profiler=y to enable it.");
+#endif
+
+            ImGuiUtility::PopID();
+        }
+        ImGui::End();
+    }
+} // NekoEngine
@@ -0,0 +1,22 @@
+#pragma once
+#include "EditorPanel.h"
+namespace NekoEngine
+{
+
+    class ProfilerPanel : public EditorPanel
+    {
+    public:
+        ProfilerPanel();
+        ~ProfilerPanel() = default;
+
+        void OnImGui() override;
+
+    private:
+        std::vector<float> m_CPUTimes;
+        std::vector<float> m_GPUTimes;
+        std::string m_TracePath = "profile.json";
+        int m_CaptureFrames     = 120;
+        int m_SelectedFrame     = 0; // Frames back from the newest one
+    };
+
+} // NekoEngine
@@ -0,0 +1,273 @@
+#include "Profiler.h"
+
+#ifdef NekoEngine_PROFILE
+
+#include "File/FileSystem.h"
+#include "Math/Maths.h"
+#include <sstream>
+#include <iomanip>
+
+namespace NekoEngine
+{
+    std::atomic<bool> Profiler::s_Paused{false};
+
+    struct Profiler::State
+    {
+        std::mutex mutex; // Guards the ring list, names and pending GPU events, never taken while recording
+        ArrayList<UniquePtr<ThreadRing>> rings;
+        HashSet<String> names;
+        ArrayList<ProfileEvent> pendingGPU;
+
+        // Main thread only
+        Deque<ProfileFrame> history;
+        ArrayList<ProfileFrame> capture;
+        uint32_t captureRemaining = 0;
+        uint64_t frameIndex       = 0;
+        int64_t frameBegin        = 0;
+    };
+
+    Profiler::State& Profiler::GetState()
+    {
+        static State state;
+        return state;
+    }
+
+    namespace
+    {
+        void WriteJSONString(std::ostringstream& out, const char* text)
+        {
+            out << '"';
+            for(const char* c = text; *c; c++)
+            {
+                if(*c == '"' || *c == '\\')
+                    out << '\\' << *c;
+                else if((unsigned char)*c < 0x20)
+                    out << ' ';
+                else
+                    out << *c;
+            }
+            out << '"';
+        }
+
+        void WriteTraceEvent(std::ostringstream& out, const char* name, const char* category, int64_t begin, int64_t end,
+                             int64_t origin, uint32_t thread)
+        {
+            out << ",\n{\"name\":";
+            WriteJSONString(out, name ? name : "?");
+            out << ",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread
+                << ",\"ts\":" << double(begin - origin) * 1e-3 << ",\"dur\":" << double(Maths::Max(end - begin, int64_t(0))) * 1e-3 << '}';
+        }
+    }
+
+    Profiler::ThreadRing* Profiler::GetThreadRing()
+    {
+        thread_local ThreadRing* ring = nullptr;
+        if(ring)
+            return ring;
+
+        auto &state = GetState();
+        std::scoped_lock<std::mutex> lock(state.mutex);
+
+        ring = new ThreadRing();
+        ring->events.resize(RingSize);
+        ring->index = (uint32_t)state.rings.size();
+        ring->name  = "Thread " + std::to_string(ring->index);
+        state.rings.emplace_back(ring);
+        return ring;
+    }
+
+    void Profiler::SetThreadName(const String& name)
+    {
+        ThreadRing* ring = GetThreadRing();
+
+        std::scoped_lock<std::mutex> lock(GetState().mutex);
+        ring->name = name;
+    }
+
+    const char* Profiler::InternName(const String& name)
+    {
+        auto &state = GetState();
+        std::scoped_lock<std::mutex> lock(state.mutex);
+        return state.names.insert(name).first->c_str();
+    }
+
+    void Profiler::BeginEvent()
+    {
+        GetThreadRing()->depth++;
+    }
+
+    void Profiler::EndEvent(const char* name, int64_t begin)
+    {
+        const int64_t end = Now();
+        ThreadRing* ring = GetThreadRing();
+        ring->depth = ring->depth > 0 ? ring->depth - 1 : 0;
+
+        // Only this thread moves head, the main thread sees the event once the release store lands
+        const uint64_t head = ring->head.load(std::memory_order_relaxed);
+        ProfileEvent &event = ring->events[head & (RingSize - 1)];
+        event.name   = name;
+        event.begin  = begin;
+        event.end    = end;
+        event.depth  = ring->depth;
+        event.thread = ring->index;
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+
+    void Profiler::Drain(ThreadRing& ring, ArrayList<ProfileEvent>& events)
+    {
+        const uint64_t head  = ring.head.load(std::memory_order_acquire);
+        const uint64_t first = Maths::Max(ring.tail, head > RingSize ? head - RingSize : uint64_t(0));
+        const size_t start   = events.size();
+
+        for(uint64_t i = first; i < head; i++)
+            events.push_back(ring.events[i & (RingSize - 1)]);
+
+        // The owner keeps writing while this copies, anything it may have overwritten meanwhile is dropped
+        const uint64_t after = ring.head.load(std::memory_order_acquire);
+        if(after > RingSize && after - RingSize > first)
+        {
+            const size_t overwritten = (size_t)Maths::Min(after - RingSize - first, head - first);
+            events.erase(events.begin() + start, events.begin() + start + overwritten);
+        }
+
+        ring.tail = head;
+    }
+
+    void Profiler::SubmitGPUFrame(const ProfileEvent* events, uint32_t count)
+    {
+        auto &state = GetState();
+        std::scoped_lock<std::mutex> lock(state.mutex);
+        state.pendingGPU.assign(events, events + count);
+        for(auto &event: state.pendingGPU)
+            event.thread = GPUThread;
+    }
+
+    void Profiler::EndFrame()
+    {
+        auto &state = GetState();
+        const int64_t now = Now();
+
+        if(IsPaused() || state.frameBegin == 0)
+        {
+            state.frameBegin = now;
+            return;
+        }
+
+        ProfileFrame frame;
+        frame.index = state.frameIndex++;
+        frame.begin = state.frameBegin;
+        frame.end   = now;
+        state.frameBegin = now;
+
+        {
+            std::scoped_lock<std::mutex> lock(state.mutex);
+            for(auto &ring: state.rings)
+                Drain(*ring, frame.events);
+
+            frame.gpuEvents.swap(state.pendingGPU);
+        }
+
+        if(state.captureRemaining > 0)
+        {
+            state.capture.push_back(frame);
+            state.captureRemaining--;
+        }
+
+        state.history.push_back(std::move(frame));
+        if(state.history.size() > FrameHistory)
+            state.history.pop_front();
+    }
+
+    void Profiler::BeginCapture(uint32_t frameCount)
+    {
+        auto &state = GetState();
+        state.capture.clear();
+        state.capture.reserve(frameCount);
+        state.captureRemaining = frameCount;
+    }
+
+    bool Profiler::IsCapturing()
+    {
+        return GetState().captureRemaining > 0;
+    }
+
+    uint32_t Profiler::GetCapturedFrameCount()
+    {
+        return (uint32_t)GetState().capture.size();
+    }
+
+    const Deque<ProfileFrame>& Profiler::GetHistory()
+    {
+        return GetState().history;
+    }
+
+    ArrayList<String> Profiler::GetThreadNames()
+    {
+        auto &state = GetState();
+        std::scoped_lock<std::mutex> lock(state.mutex);
+
+        ArrayList<String> names;
+        for(auto &ring: state.rings)
+            names.push_back(ring->name);
+        return names;
+    }
+
+    bool Profiler::SaveChromeTrace(const String& path)
+    {
+        auto &state = GetState();
+        ArrayList<const ProfileFrame*> frames;
+        if(!state.capture.empty())
+        {
+            for(auto &frame: state.capture)
+                frames.push_back(&frame);
+        }
+        else
+        {
+            for(auto &frame: state.history)
+                frames.push_back(&frame);
+        }
+
+        if(frames.empty())
+            return false;
+
+        const ArrayList<String> threadNames = GetThreadNames();
+        const uint32_t frameThread = (uint32_t)threadNames.size();
+        const uint32_t gpuThread   = frameThread + 1;
+        const int64_t origin       = frames.front()->begin;
+
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"NekoEngine\"}}";
+
+        auto writeThreadName = [&out](uint32_t thread, const char* name)
+        {
+            out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread << ",\"args\":{\"name\":";
+            WriteJSONString(out, name);
+            out << "}}";
+        };
+
+        for(uint32_t i = 0; i < (uint32_t)threadNames.size(); i++)
+            writeThreadName(i, threadNames[i].c_str());
+        writeThreadName(frameThread, "Frames");
+        writeThreadName(gpuThread, "GPU");
+
+        for(const ProfileFrame* frame: frames)
+        {
+            const String frameName = "Frame " + std::to_string(frame->index);
+            WriteTraceEvent(out, frameName.c_str(), "Frame", frame->begin, frame->end, origin, frameThread);
+
+            for(auto &event: frame->events)
+                WriteTraceEvent(out, event.name, "CPU", event.begin, event.end, origin, event.thread);
+
+            for(auto &event: frame->gpuEvents)
+                WriteTraceEvent(out, event.name, "GPU", event.begin, event.end, origin, gpuThread);
+        }
+
+        out << "\n]}\n";
+        return FileSystem::WriteTextFile(path, out.str());
+    }
+
+} // NekoEngine
+
+#endif
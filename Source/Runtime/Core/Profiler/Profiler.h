@@ -0,0 +1,152 @@
+#pragma once
+#include "Core.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+// Frame profiler, built with the NekoEngine_PROFILE define (xmake option "profiler"). Without it the macros
+// at the bottom expand to nothing and none of this is compiled, so instrumentation can stay in the code.
+//
+//   NekoEngine_PROFILE_FRAMEMARKER()   Once per frame on the main thread, collects what every thread recorded
+//   NekoEngine_PROFILE_FUNCTION()      Times the enclosing function
+//   NekoEngine_PROFILE_SCOPE(name)     Times the enclosing scope, name is a literal or a String
+//   NekoEngine_PROFILE_THREAD(name)    Names the calling thread in the panel and in traces
+
+#ifdef NekoEngine_PROFILE
+
+namespace NekoEngine
+{
+    struct ProfileEvent
+    {
+        const char* name = nullptr; // Literal or interned, so it outlives the frame
+        int64_t begin    = 0;       // Nanoseconds on the steady clock
+        int64_t end      = 0;
+        uint32_t depth   = 0;       // Scopes open around it on its thread
+        uint32_t thread  = 0;       // Index into Profiler::GetThreadNames, GPU events use GPUThread
+    };
+
+    struct ProfileFrame
+    {
+        uint64_t index = 0;
+        int64_t begin  = 0;
+        int64_t end    = 0;
+        ArrayList<ProfileEvent> events;    // CPU scopes that ended during the frame, children before parents
+        ArrayList<ProfileEvent> gpuEvents; // Timestamp scopes of the frame the backend last read back
+
+        double GetMs() const { return double(end - begin) * 1e-6; }
+    };
+
+    // Scopes go to a ring per thread that only that thread writes, so recording takes no lock. The main thread
+    // drains every ring once per frame. A ring that wraps between two frames loses its oldest events. Rings
+    // live as long as the process, which suits the engine's long lived threads.
+    class Profiler
+    {
+    public:
+        static constexpr uint32_t RingSize     = 1 << 14; // Events per thread between two frame markers
+        static constexpr uint32_t FrameHistory = 300;
+        static constexpr uint32_t GPUThread    = ~0u;
+
+        static int64_t Now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        static void SetThreadName(const String& name);
+        static const char* InternName(const String& name);
+
+        static void BeginEvent();
+        static void EndEvent(const char* name, int64_t begin);
+
+        // Events are in nanoseconds on the steady clock, the backend maps its timestamps onto it
+        static void SubmitGPUFrame(const ProfileEvent* events, uint32_t count);
+
+        static void EndFrame();
+
+        // Paused, scopes cost a flag check and nothing is collected
+        static void SetPaused(bool paused) { s_Paused.store(paused, std::memory_order_relaxed); }
+        static bool IsPaused() { return s_Paused.load(std::memory_order_relaxed); }
+
+        // Keeps the next frameCount frames aside for SaveChromeTrace, the history only holds the last few
+        static void BeginCapture(uint32_t frameCount);
+        static bool IsCapturing();
+        static uint32_t GetCapturedFrameCount();
+
+        // Chrome trace event JSON, opens in chrome://tracing and Perfetto. Writes the capture if there is
+        // one, the history otherwise.
+        static bool SaveChromeTrace(const String& path);
+
+        // Oldest first, only touched by the main thread
+        static const Deque<ProfileFrame>& GetHistory();
+        static ArrayList<String> GetThreadNames();
+
+    private:
+        struct ThreadRing
+        {
+            String name;
+            uint32_t index = 0;
+            ArrayList<ProfileEvent> events;
+            std::atomic<uint64_t> head{0}; // Written by the owning thread only
+            uint64_t tail  = 0;            // Read by the main thread only
+            uint32_t depth = 0;
+        };
+
+        struct State;
+        static State& GetState();
+        static ThreadRing* GetThreadRing();
+        static void Drain(ThreadRing& ring, ArrayList<ProfileEvent>& events);
+
+        static std::atomic<bool> s_Paused;
+    };
+
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(const char* name) : m_Name(name) { Begin(); }
+        explicit ProfileScope(const String& name) : m_Name(nullptr)
+        {
+            if(!Profiler::IsPaused())
+                m_Name = Profiler::InternName(name);
+            Begin();
+        }
+
+        ~ProfileScope()
+        {
+            if(m_Begin)
+                Profiler::EndEvent(m_Name, m_Begin);
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        void Begin()
+        {
+            if(Profiler::IsPaused() || !m_Name)
+                return;
+
+            Profiler::BeginEvent();
+            m_Begin = Profiler::Now();
+        }
+
+        const char* m_Name;
+        int64_t m_Begin = 0;
+    };
+
+} // NekoEngine
+
+#define NekoEngine_PROFILE_CONCAT_INNER(a, b) a##b
+#define NekoEngine_PROFILE_CONCAT(a, b) NekoEngine_PROFILE_CONCAT_INNER(a, b)
+
+#define NekoEngine_PROFILE_FRAMEMARKER() NekoEngine::Profiler::EndFrame()
+#define NekoEngine_PROFILE_FUNCTION() NekoEngine::ProfileScope NekoEngine_PROFILE_CONCAT(profileScope, __LINE__)(__FUNCTION__)
+#define NekoEngine_PROFILE_SCOPE(name) NekoEngine::ProfileScope NekoEngine_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define NekoEngine_PROFILE_THREAD(name) NekoEngine::Profiler::SetThreadName(name)
+
+#else
+
+#define NekoEngine_PROFILE_FRAMEMARKER()
+#define NekoEngine_PROFILE_FUNCTION()
+#define NekoEngine_PROFILE_SCOPE(name)
+#define NekoEngine_PROFILE_THREAD(name)
+
+#endif
@@ -1,3 +1,3 @@
 target("Core")
     set_kind("static")
-    add_files("/*.cpp", "Math/*.cpp","Timer/*.cpp", "Input/*.cpp", "Memory/*.cpp", "Memory/Allocators/*.cpp", "Utility/*.cpp")
+    add_files("/*.cpp", "Math/*.cpp","Timer/*.cpp", "Input/*.cpp", "Memory/*.cpp", "Memory/Allocators/*.cpp", "Utility/*.cpp", "Profiler/*.cpp")
@@ -252,7 +252,7 @@ namespace NekoEngine
         return pbrMaterial;
     }
 
-    SharedPtr<Mesh> LoadMesh(const ofbx::Mesh* fbxMesh, int32_t triangleStart, int32_t triangleEnd)
+    SharedPtr<Mesh> LoadMesh(const ofbx::Mesh* fbxMesh, int32_t triangleStart, int32_t triangleEnd, bool upload)
     {
         const int32_t firstVertexOffset = triangleStart * 3;
         const int32_t lastVertexOffset  = triangleEnd * 3;
@@ -314,22 +314,28 @@ namespace NekoEngine
         }
 
         SharedPtr<Material> pbrMaterial;
-        if(material)
+        if(material && upload)
         {
             pbrMaterial = LoadMaterial(material, false);
         }
 
-        auto mesh = MakeShared<Mesh>(indicesArray, tempvertices);
+        // Before the mesh is created, it uploads the vertices and packed formats encode the tangent frame
+        Mesh::GenerateTangentsAndBitangents(tempvertices.data(), uint32_t(vertexCount), indicesArray.data(), uint32_t(indicesArray.size()));
+
+        // Imported meshes are drawn packed, no engine shader reads vertex colour so it is not kept
+        const uint32_t vertexFormat = (uint32_t)Mesh::VertexFormat::PACKED | (uint32_t)Mesh::VertexFormat::QUANTISED_POSITION;
+
+        // Without upload only the CPU data is wanted, see Model::SetResidency
+        auto mesh = upload ? MakeShared<Mesh>(indicesArray, tempvertices, 0.95f, vertexFormat)
+                           : Mesh::CreateCPUOnly(indicesArray, tempvertices, 0.95f, vertexFormat);
         mesh->SetName(fbxMesh->name);
-        if(material)
+        if(pbrMaterial)
             mesh->SetMaterial(pbrMaterial);
 
-        mesh->Mesh::GenerateTangentsAndBitangents(tempvertices.data(), uint32_t(vertexCount), indicesArray.data(), uint32_t(indicesArray.size()));
-
         return mesh;
     }
 
-    void Model::LoadFBX(const String& _path)
+    void Model::LoadFBX(const String& _path, ArrayList<SharedPtr<Mesh>>& result, bool upload)
     {
         String errorInfo;
         String path = _path;
@@ -388,7 +394,7 @@ namespace NekoEngine
 
             if (fbxMesh->getMaterialCount() < 2 || !geometry->getMaterials())
             {
-                meshes.push_back(LoadMesh(fbxMesh, 0, trianglesCount - 1));
+                result.push_back(LoadMesh(fbxMesh, 0, trianglesCount - 1, upload));
             }
             else
             {
@@ -401,14 +407,14 @@ namespace NekoEngine
                 {
                     if (rangeStartMaterial != materials[triangleIndex])
                     {
-                        meshes.push_back(LoadMesh(fbxMesh, rangeStart, triangleIndex - 1));
+                        result.push_back(LoadMesh(fbxMesh, rangeStart, triangleIndex - 1, upload));
 
                         // Start a new range
                         rangeStart = triangleIndex;
                         rangeStartMaterial = materials[triangleIndex];
                     }
                 }
-                meshes.push_back(LoadMesh(fbxMesh, rangeStart, trianglesCount - 1));
+                result.push_back(LoadMesh(fbxMesh, rangeStart, trianglesCount - 1, upload));
             }
         }
     }
@@ -1,6 +1,8 @@
 #include <filesystem>
 #include "Window/GLFWWindow.h"
+#include "Window/NullWindow.h"
 #include "Vulkan/VulkanRenderer.h"
+#include "Null/NullRenderer.h"
 #include "GUI/ImGuiManager.h"
 #include "JobSystem/JobSystem.h"
 #include "Input/Input.h"
@@ -9,7 +11,9 @@
 #include "File/FileSystem.h"
 #include "File/VirtualFileSystem.h"
 #include "PhysicsEngine.h"
+#include "Script/LuaScriptSystem.h"
 #include "OS/OS.h"
+#include "Profiler/Profiler.h"
 #include "Engine.h"
 #include <cereal/archives/json.hpp>
 #include <cereal/types/vector.hpp>
@@ -102,6 +106,7 @@ namespace NekoEngine
     void Engine::Init()
     {
         LOG("Engine Init.");
+        NekoEngine_PROFILE_THREAD("Main");
 
         timeStep = MakeUnique<TimeStep>();
 
@@ -134,7 +139,10 @@ namespace NekoEngine
         windowDesc.isVSync       = m_ProjectSettings.VSync;
 
         //TODO: load icon
-        window = MakeUnique<GLFWWindow>(windowDesc);
+        if(GraphicsContext::GetRenderAPI() == RENDER_API::NONE)
+            window = MakeUnique<NullWindow>(windowDesc);
+        else
+            window = MakeUnique<GLFWWindow>(windowDesc);
         Window::instance = window->instance;
         if(!window->IsInit())
         {
@@ -166,7 +174,10 @@ namespace NekoEngine
         // Draw Splash Screen
 
         // Create Renderer
-        renderer = MakeUnique<VulkanRenderer>();
+        if(GraphicsContext::GetRenderAPI() == RENDER_API::NONE)
+            renderer = MakeUnique<NullRenderer>();
+        else
+            renderer = MakeUnique<VulkanRenderer>();
         renderer->Init(false);
         LOG("Renderer Init.");
 
@@ -193,6 +204,8 @@ namespace NekoEngine
 //
 //        JobSystem::Wait(context);
 
+        // Registration order is the update order of conflicting systems, scripts run before physics
+        systemManager->RegisterSystem<LuaScriptSystem>(luaManager.get());
         systemManager->RegisterSystem<PhysicsEngine>();
         levelManager->LoadCurrentList();
 
@@ -247,6 +260,8 @@ namespace NekoEngine
             return m_CurrentState != AppState::Closing;
         }
 
+        NekoEngine_PROFILE_FRAMEMARKER();
+
         double now  = timer->GetElapsedSD();
         auto ts    = GetTimeStep();
 
@@ -283,19 +298,29 @@ namespace NekoEngine
 
         ImGui::NewFrame();
 
-        OnUpdate(*ts);
-        UpdateSystems();
-        systemManager->GetSystem<PhysicsEngine>()->SyncTransforms(levelManager->GetCurrentLevel());
+        {
+            NekoEngine_PROFILE_SCOPE("Update");
+            // Systems first, so what scripts move is picked up by the level graph update in OnUpdate
+            UpdateSystems();
+            OnUpdate(*ts);
+            systemManager->GetSystem<PhysicsEngine>()->SyncTransforms(levelManager->GetCurrentLevel());
+        }
 
         if(m_CurrentState == AppState::Closing) return false;
 
         if(!m_Minimized)
         {
-            renderer->Begin();
-            OnRender();
-            imGuiManager->OnRender(levelManager->GetCurrentLevel());
+            {
+                NekoEngine_PROFILE_SCOPE("Render");
+                renderer->Begin();
+                OnRender();
+                imGuiManager->OnRender(levelManager->GetCurrentLevel());
+            }
 
-            renderer->Present();
+            {
+                NekoEngine_PROFILE_SCOPE("Present");
+                renderer->Present();
+            }
 
             Pipeline::DeleteUnusedCache();
             Framebuffer::DeleteUnusedCache();
@@ -412,7 +437,6 @@ namespace NekoEngine
         if(GetEditorState() != EditorState::Paused
            && GetEditorState() != EditorState::Preview)
         {
-            luaManager->OnUpdate(levelManager->GetCurrentLevel());
             levelManager->GetCurrentLevel()->OnUpdate(dt);
         }
         imGuiManager->OnUpdate(dt, levelManager->GetCurrentLevel());
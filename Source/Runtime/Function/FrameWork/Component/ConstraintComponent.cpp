@@ -15,16 +15,19 @@ namespace NekoEngine
     const SharedPtr<AxisConstraint>& AxisConstraintComponent::GetConstraint()
     {
         if(!m_Initialised)
-        {
-            auto entity = gEngine->GetLevelManager()->GetCurrentLevel()->GetEntityManager()->GetEntityByUUID(m_EntityID);
+            Resolve(gEngine->GetLevelManager()->GetCurrentLevel()->GetEntityManager()->GetEntityByUUID(m_EntityID));
 
-            if(entity && entity.HasComponent<RigidBody3DComponent>())
-                m_Constraint = MakeShared<AxisConstraint>(entity.GetComponent<RigidBody3DComponent>().GetRigidBody().get(), m_Axes);
-            m_Initialised = true;
-        }
         return m_Constraint;
     }
 
+    void AxisConstraintComponent::Resolve(Entity entity)
+    {
+        m_Constraint.reset();
+        if(entity && entity.HasComponent<RigidBody3DComponent>())
+            m_Constraint = MakeShared<AxisConstraint>(entity.GetComponent<RigidBody3DComponent>().GetRigidBody().get(), m_Axes);
+        m_Initialised = true;
+    }
+
     SpringConstraintComponent::SpringConstraintComponent(Entity entity, Entity otherEntity, const glm::vec3& pos1, const glm::vec3& pos2, float constant)
     {
         m_Constraint = MakeShared<SpringConstraint>(entity.GetComponent<RigidBody3DComponent>().GetRigidBody(), otherEntity.GetComponent<RigidBody3DComponent>().GetRigidBody(), pos1, pos2, 0.9f, 0.5f);
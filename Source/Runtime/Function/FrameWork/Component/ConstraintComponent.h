@@ -19,6 +19,9 @@ namespace NekoEngine
 
         const SharedPtr<AxisConstraint>& GetConstraint();
 
+        // Builds the constraint on the entity m_EntityID resolved to, a null entity leaves it empty
+        void Resolve(Entity entity);
+
         template <typename Archive>
         void save(Archive& archive) const
         {
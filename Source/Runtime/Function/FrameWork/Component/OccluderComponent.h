@@ -0,0 +1,21 @@
+#pragma once
+#include "Core.h"
+#include <cereal/cereal.hpp>
+
+namespace NekoEngine
+{
+    // Marks the meshes of an entity's ModelComponent as occluders. They are rasterised into the CPU
+    // occlusion buffer every frame, so keep this to large, simple and solid geometry like walls and terrain.
+    class OccluderComponent
+    {
+    public:
+        bool Enabled = true;
+
+        template <typename Archive>
+        void serialize(Archive& archive)
+        {
+            archive(cereal::make_nvp("Enabled", Enabled));
+        }
+    };
+
+} // NekoEngine
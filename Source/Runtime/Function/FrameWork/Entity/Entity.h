@@ -226,6 +226,7 @@ namespace NekoEngine
             auto hierarchyComponent = TryGetComponent<Hierarchy>();
             if(hierarchyComponent)
             {
+                children.reserve(hierarchyComponent->ChildCount());
                 entt::entity child = hierarchyComponent->First();
                 while(child != entt::null && m_Level->GetRegistry().valid(child))
                 {
@@ -245,7 +246,9 @@ namespace NekoEngine
             auto hierarchyComponent = TryGetComponent<Hierarchy>();
             if(hierarchyComponent)
             {
-                hierarchyComponent->m_First = entt::null;
+                hierarchyComponent->m_First      = entt::null;
+                hierarchyComponent->m_Last       = entt::null;
+                hierarchyComponent->m_ChildCount = 0;
             }
         }
 
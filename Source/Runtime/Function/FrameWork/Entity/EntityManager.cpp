@@ -3,6 +3,21 @@
 
 namespace NekoEngine
 {
+    EntityManager::EntityManager(Level* level)
+            : m_Level(level)
+    {
+        m_Registry.on_construct<IDComponent>().connect<&EntityManager::OnIDComponentConstruct>(this);
+        m_Registry.on_update<IDComponent>().connect<&EntityManager::OnIDComponentUpdate>(this);
+        m_Registry.on_destroy<IDComponent>().connect<&EntityManager::OnIDComponentDestroy>(this);
+    }
+
+    EntityManager::~EntityManager()
+    {
+        m_Registry.on_construct<IDComponent>().disconnect(this);
+        m_Registry.on_update<IDComponent>().disconnect(this);
+        m_Registry.on_destroy<IDComponent>().disconnect(this);
+    }
+
     Entity EntityManager::Create()
     {
         auto e = m_Registry.create();
@@ -26,19 +41,90 @@ namespace NekoEngine
         }
 
         m_Registry.clear();
+        m_UUIDToEntity.clear();
     }
 
     Entity EntityManager::GetEntityByUUID(uint64_t id)
     {
-        auto view = m_Registry.view<IDComponent>();
-        for(auto entity : view)
-        {
-            auto& idComponent = m_Registry.get<IDComponent>(entity);
-            if(idComponent.ID == id)
-                return {entity, m_Level};
-        }
+        auto entity = FindEntityByUUID(id);
+        if(entity != entt::null)
+            return {entity, m_Level};
 
         LOG("Entity not found by ID");
         return Entity {};
     }
+
+    void EntityManager::GetEntitiesByUUID(const uint64_t* ids, size_t count, Entity* outEntities) const
+    {
+        for(size_t i = 0; i < count; i++)
+        {
+            auto entity = FindEntityByUUID(ids[i]);
+            outEntities[i] = entity != entt::null ? Entity(entity, m_Level) : Entity(entt::null, nullptr);
+        }
+    }
+
+    ArrayList<Entity> EntityManager::GetEntitiesByUUID(const ArrayList<uint64_t>& ids) const
+    {
+        ArrayList<Entity> entities(ids.size());
+        GetEntitiesByUUID(ids.data(), ids.size(), entities.data());
+        return entities;
+    }
+
+    void EntityManager::RebuildUUIDIndex()
+    {
+        auto& storage = m_Registry.storage<IDComponent>();
+
+        m_UUIDToEntity.clear();
+        m_UUIDToEntity.reserve(storage.size());
+
+        for(auto [entity, idComponent] : storage.each())
+            m_UUIDToEntity[(uint64_t)idComponent.ID] = entity;
+    }
+
+    entt::entity EntityManager::FindEntityByUUID(uint64_t id) const
+    {
+        auto it = m_UUIDToEntity.find(id);
+        if(it == m_UUIDToEntity.end())
+            return entt::null;
+
+        // Only reads the index so lookups are safe from concurrent systems, OnIDComponentDestroy removes entries.
+        // An ID reassigned without patch leaves the old entry behind, it is skipped here rather than erased.
+        if(!m_Registry.valid(it->second))
+            return entt::null;
+
+        auto idComponent = m_Registry.try_get<IDComponent>(it->second);
+        if(!idComponent || (uint64_t)idComponent->ID != id)
+            return entt::null;
+
+        return it->second;
+    }
+
+    void EntityManager::OnIDComponentConstruct(entt::registry& registry, entt::entity entity)
+    {
+        m_UUIDToEntity[(uint64_t)registry.get<IDComponent>(entity).ID] = entity;
+    }
+
+    void EntityManager::OnIDComponentUpdate(entt::registry& registry, entt::entity entity)
+    {
+        uint64_t id = registry.get<IDComponent>(entity).ID;
+
+        // Copying an IDComponent onto another entity (e.g. while duplicating) briefly shares the ID,
+        // keep the original owner until the copy is given its own
+        auto it = m_UUIDToEntity.find(id);
+        if(it != m_UUIDToEntity.end() && it->second != entity && registry.valid(it->second))
+        {
+            auto owner = registry.try_get<IDComponent>(it->second);
+            if(owner && (uint64_t)owner->ID == id)
+                return;
+        }
+
+        m_UUIDToEntity[id] = entity;
+    }
+
+    void EntityManager::OnIDComponentDestroy(entt::registry& registry, entt::entity entity)
+    {
+        auto it = m_UUIDToEntity.find((uint64_t)registry.get<IDComponent>(entity).ID);
+        if(it != m_UUIDToEntity.end() && it->second == entity)
+            m_UUIDToEntity.erase(it);
+    }
 }
\ No newline at end of file
@@ -86,10 +86,11 @@ namespace NekoEngine
     class EntityManager
     {
     public:
-        explicit EntityManager(Level* level)
-                : m_Level(level)
-        {
-        }
+        explicit EntityManager(Level* level);
+        ~EntityManager();
+
+        EntityManager(const EntityManager&) = delete;
+        EntityManager& operator=(const EntityManager&) = delete;
 
         Entity Create();
         Entity Create(const std::string& name);
@@ -121,8 +122,25 @@ namespace NekoEngine
 
         Entity GetEntityByUUID(uint64_t id);
 
+        // Resolve a batch of UUIDs in one pass, e.g. cross references gathered while deserialising.
+        // Unknown ids resolve to a null Entity at the same index.
+        void GetEntitiesByUUID(const uint64_t* ids, size_t count, Entity* outEntities) const;
+        ArrayList<Entity> GetEntitiesByUUID(const ArrayList<uint64_t>& ids) const;
+
+        // Drops and rebuilds the UUID index from the IDComponent storage
+        void RebuildUUIDIndex();
+
     private:
+        entt::entity FindEntityByUUID(uint64_t id) const;
+
+        void OnIDComponentConstruct(entt::registry& registry, entt::entity entity);
+        void OnIDComponentUpdate(entt::registry& registry, entt::entity entity);
+        void OnIDComponentDestroy(entt::registry& registry, entt::entity entity);
+
         Level* m_Level = nullptr;
         entt::registry m_Registry;
+
+        // UUID -> entity index maintained through IDComponent signals
+        HashMap<uint64_t, entt::entity> m_UUIDToEntity;
     };
 }
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <sstream>
 
 #include "Math/Maths.h"
+#include "Profiler/Profiler.h"
 
 namespace NekoEngine
 {
@@ -129,13 +130,16 @@ namespace NekoEngine
                         args.sharedmemory = nullptr;
                     }
 
-                    for(uint32_t j = job.groupJobOffset; j < job.groupJobEnd; ++j)
                     {
-                        args.jobIndex          = j;
-                        args.groupIndex        = j - job.groupJobOffset;
-                        args.isFirstJobInGroup = (j == job.groupJobOffset);
-                        args.isLastJobInGroup  = (j == job.groupJobEnd - 1);
-                        job.task(args);
+                        NekoEngine_PROFILE_SCOPE("Job");
+                        for(uint32_t j = job.groupJobOffset; j < job.groupJobEnd; ++j)
+                        {
+                            args.jobIndex          = j;
+                            args.groupIndex        = j - job.groupJobOffset;
+                            args.isFirstJobInGroup = (j == job.groupJobOffset);
+                            args.isLastJobInGroup  = (j == job.groupJobEnd - 1);
+                            job.task(args);
+                        }
                     }
 
                     job.ctx->counter.fetch_sub(1);
@@ -170,6 +174,8 @@ namespace NekoEngine
             {
                 std::thread& worker = internal_state->threads.emplace_back([threadID]
                                                                           {
+                                                                              NekoEngine_PROFILE_THREAD("JobSystem_" + std::to_string(threadID));
+
                                                                               while (internal_state->alive.load())
                                                                               {
                                                                                   work(threadID);
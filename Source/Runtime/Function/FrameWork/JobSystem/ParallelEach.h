@@ -0,0 +1,126 @@
+#pragma once
+
+#include "JobSystem.h"
+#include "Math/Maths.h"
+#include "entt/entt.hpp"
+
+namespace NekoEngine
+{
+    namespace JobSystem
+    {
+        // Pick a grain size that gives each worker a few chunks to balance uneven work
+        inline uint32_t AutoGrainSize(uint32_t count)
+        {
+            uint32_t chunks = Maths::Max(1u, GetThreadCount() * 4u);
+            return Maths::Max(64u, (count + chunks - 1) / chunks);
+        }
+
+        // Split [0, count) into contiguous ranges of grainSize and run func(begin, end, chunkIndex) for each.
+        // Falls back to the calling thread when there is a single chunk or no worker threads.
+        template <typename Func>
+        void ParallelFor(uint32_t count, uint32_t grainSize, Func&& func)
+        {
+            if(count == 0)
+                return;
+
+            if(grainSize == 0)
+                grainSize = AutoGrainSize(count);
+
+            const uint32_t chunkCount = DispatchGroupCount(count, grainSize);
+
+            if(chunkCount == 1 || GetThreadCount() == 0)
+            {
+                for(uint32_t chunk = 0; chunk < chunkCount; chunk++)
+                    func(chunk * grainSize, Maths::Min(count, (chunk + 1) * grainSize), chunk);
+                return;
+            }
+
+            Context context;
+            Dispatch(context, chunkCount, 1, [&func, count, grainSize](JobDispatchArgs args)
+                     { func(args.jobIndex * grainSize, Maths::Min(count, (args.jobIndex + 1) * grainSize), args.jobIndex); });
+            Wait(context);
+        }
+
+        inline uint32_t ChunkCount(uint32_t count, uint32_t grainSize)
+        {
+            if(grainSize == 0)
+                grainSize = AutoGrainSize(count);
+            return count == 0 ? 0 : DispatchGroupCount(count, grainSize);
+        }
+    }
+
+    // One output buffer per chunk so workers never share a container. Merge appends them in chunk order,
+    // which keeps the result identical to a serial loop. Keep the object around to reuse the allocations.
+    template <typename T>
+    class ParallelOutput
+    {
+    public:
+        void Prepare(uint32_t chunkCount)
+        {
+            if(m_Buffers.size() < chunkCount)
+                m_Buffers.resize(chunkCount);
+
+            for(auto& buffer : m_Buffers)
+                buffer.clear();
+
+            m_ChunkCount = chunkCount;
+        }
+
+        ArrayList<T>& operator[](uint32_t chunk) { return m_Buffers[chunk]; }
+
+        size_t Size() const
+        {
+            size_t size = 0;
+            for(uint32_t i = 0; i < m_ChunkCount; i++)
+                size += m_Buffers[i].size();
+            return size;
+        }
+
+        void Merge(ArrayList<T>& output) const
+        {
+            output.reserve(output.size() + Size());
+            for(uint32_t i = 0; i < m_ChunkCount; i++)
+                output.insert(output.end(), m_Buffers[i].begin(), m_Buffers[i].end());
+        }
+
+    private:
+        ArrayList<ArrayList<T>> m_Buffers;
+        uint32_t m_ChunkCount = 0;
+    };
+
+    // Data-parallel iteration over an entt group: the packed entity array is split into contiguous chunks
+    // dispatched on the job system. func(entity) must only touch data owned by that entity, components can
+    // be fetched with group.get<T>(entity).
+    // Groups only, group[i] is the entity at position i. On a view operator[] takes an entity and returns
+    // its components, so views (single component ones included) have to go through a group.
+    template <typename Group, typename Func>
+    void ParallelEach(Group& group, uint32_t grainSize, Func&& func)
+    {
+        JobSystem::ParallelFor((uint32_t)group.size(), grainSize, [&group, &func](uint32_t begin, uint32_t end, uint32_t chunk)
+                               {
+                                   for(uint32_t i = begin; i < end; i++)
+                                       func(group[i]);
+                               });
+    }
+
+    // As above, but func(entity, ArrayList<T>& out) appends results to a per chunk buffer.
+    // The buffers are merged into output in entity order once every chunk has finished.
+    template <typename T, typename Group, typename Func>
+    void ParallelEach(Group& group, uint32_t grainSize, ParallelOutput<T>& scratch, ArrayList<T>& output, Func&& func)
+    {
+        uint32_t count = (uint32_t)group.size();
+        if(grainSize == 0)
+            grainSize = JobSystem::AutoGrainSize(count);
+
+        scratch.Prepare(JobSystem::ChunkCount(count, grainSize));
+
+        JobSystem::ParallelFor(count, grainSize, [&group, &func, &scratch](uint32_t begin, uint32_t end, uint32_t chunk)
+                               {
+                                   auto& out = scratch[chunk];
+                                   for(uint32_t i = begin; i < end; i++)
+                                       func(group[i], out);
+                               });
+
+        scratch.Merge(output);
+    }
+} // NekoEngine
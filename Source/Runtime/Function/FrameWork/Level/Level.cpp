@@ -1,5 +1,6 @@
 #include "Level.h"
 #include "Component/ModelComponent.h"
+#include "Component/OccluderComponent.h"
 #include "Entity/EntityManager.h"
 #include "Renderable/Camera.h"
 #include "Renderable/Light.h"
@@ -26,7 +27,7 @@
 #define ALL_COMPONENTSV1 Transform, NameComponent, ActiveComponent, Hierarchy, Camera, LuaScriptComponent, Model, Light, RigidBody3DComponent, Environment, DefaultCameraController
 #define ALL_COMPONENTSV8 ALL_COMPONENTSV1, AxisConstraintComponent, ModelComponent, IDComponent
 
-#define ALL_COMPONENTSLISTV8 ALL_COMPONENTSV8
+#define ALL_COMPONENTSLISTV8 ALL_COMPONENTSV8, OccluderComponent
 
 
 CEREAL_REGISTER_TYPE(NekoEngine::SphereCollisionShape);
@@ -182,7 +183,11 @@ namespace entt
     };
 }
 
-#define ALL_COMPONENTSENTTV8(output) get<entt::entity>(output).get<Transform>(output).get<NameComponent>(output).get<ActiveComponent>(output).get<Hierarchy>(output).get<Camera>(output).get<LuaScriptComponent>(output).get<Model>(output).get<Light>(output).get<RigidBody3DComponent>(output).get<Environment>(output).get<DefaultCameraController>(output).get<IDComponent>(output).get<ModelComponent>(output).get<AxisConstraintComponent>(output);
+#define ALL_COMPONENTSENTTV8(output) get<entt::entity>(output).get<Transform>(output).get<NameComponent>(output).get<ActiveComponent>(output).get<Hierarchy>(output).get<Camera>(output).get<LuaScriptComponent>(output).get<Model>(output).get<Light>(output).get<RigidBody3DComponent>(output).get<Environment>(output).get<DefaultCameraController>(output).get<IDComponent>(output).get<ModelComponent>(output).get<AxisConstraintComponent>(output)
+#define ALL_COMPONENTSENTTV9(output) ALL_COMPONENTSENTTV8(output).get<OccluderComponent>(output)
+
+// Written at the top of .lsn files, bump when the component list changes
+#define LEVEL_SERIALISATION_VERSION 9
 
 namespace NekoEngine
 {
@@ -327,15 +332,13 @@ namespace NekoEngine
         Entity newEntity = m_EntityManager->Create();
 
         CopyEntity<ALL_COMPONENTSLISTV8>(newEntity.GetHandle(), entity.GetHandle(), m_EntityManager->GetRegistry());
-        newEntity.GetComponent<IDComponent>().ID = UUID();
+        m_EntityManager->GetRegistry().patch<IDComponent>(newEntity.GetHandle(), [](IDComponent& idComponent)
+                                                           { idComponent.ID = UUID(); });
 
         auto hierarchyComponent = newEntity.TryGetComponent<Hierarchy>();
         if(hierarchyComponent)
         {
-            hierarchyComponent->m_First  = entt::null;
-            hierarchyComponent->m_Parent = entt::null;
-            hierarchyComponent->m_Next   = entt::null;
-            hierarchyComponent->m_Prev   = entt::null;
+            hierarchyComponent->Reset();
         }
 
         auto children = entity.GetChildren();
@@ -367,6 +370,25 @@ namespace NekoEngine
         return m_EntityManager->GetEntityByUUID(id);
     }
 
+    // Axis constraints only store their target's UUID, resolve them together once the whole level is loaded
+    static void ResolveAxisConstraints(EntityManager& entityManager)
+    {
+        auto view = entityManager.GetRegistry().view<AxisConstraintComponent>();
+        if(view.empty())
+            return;
+
+        ArrayList<uint64_t> ids;
+        ids.reserve(view.size());
+        for(auto entity : view)
+            ids.push_back(view.get<AxisConstraintComponent>(entity).GetEntityID());
+
+        ArrayList<Entity> targets = entityManager.GetEntitiesByUUID(ids);
+
+        size_t index = 0;
+        for(auto entity : view)
+            view.get<AxisConstraintComponent>(entity).Resolve(targets[index++]);
+    }
+
     void DeserializeEntityHierarchy(Entity entity, cereal::JSONInputArchive& archive, int version)
     {
         // Serialize the current entity
@@ -378,12 +400,17 @@ namespace NekoEngine
         int children; // = entity.GetChildren();
         archive(children);
 
+        std::vector<entt::entity> childHandles;
+        childHandles.reserve(children);
+
         for(int i = 0; i < children; i++)
         {
             auto child = entity.GetLevel()->GetEntityManager()->Create();
             DeserializeEntityHierarchy(child, archive, version);
-            child.SetParent(entity);
+            childHandles.push_back(child.GetHandle());
         }
+
+        Hierarchy::AttachChildren(entity.GetHandle(), childHandles.data(), childHandles.size(), entity.GetLevel()->GetRegistry());
     }
 
     template <typename T>
@@ -469,28 +496,13 @@ namespace NekoEngine
     void Level::Serialise(const std::string &filePath, bool binary)
     {
         LOG("Level saved");
-        std::string path = filePath;
-        path += levelName; // StringUtility::RemoveSpaces(m_LevelName);
+        const std::string basePath = filePath + levelName; // StringUtility::RemoveSpaces(m_LevelName);
+        std::string path = basePath;
 
         if(binary)
         {
             path += std::string(".bin");
-
-            std::ofstream file(path, std::ios::binary);
-
-            {
-                // output finishes flushing its contents when it goes out of scope
-                cereal::BinaryOutputArchive output{file};
-                output(*this);
-                entt::snapshot{m_EntityManager->GetRegistry()}.get<entt::entity>(output).get<Transform>(
-                        output).get<NameComponent>(output).get<ActiveComponent>(output).get<Hierarchy>(
-                        output).get<Camera>(output).get<LuaScriptComponent>(output).get<Model>(
-                        output).get<Light>(output).get<RigidBody3DComponent>(
-                        output).get<Environment>(output).get<DefaultCameraController>(
-                        output).get<IDComponent>(output).get<ModelComponent>(
-                        output).get<AxisConstraintComponent>(output);
-            }
-            file.close();
+            SerialiseChunked(path);
         }
         else
         {
@@ -500,14 +512,9 @@ namespace NekoEngine
             {
                 // output finishes flushing its contents when it goes out of scope
                 cereal::JSONOutputArchive output{storage};
+                output(cereal::make_nvp("Version", LEVEL_SERIALISATION_VERSION));
                 output(*this);
-                entt::snapshot{m_EntityManager->GetRegistry()}.get<entt::entity>(output).get<Transform>(
-                        output).get<NameComponent>(output).get<ActiveComponent>(output).get<Hierarchy>(
-                        output).get<Camera>(output).get<LuaScriptComponent>(output).get<Model>(
-                        output).get<Light>(output).get<RigidBody3DComponent>(
-                        output).get<Environment>(output).get<DefaultCameraController>(
-                        output).get<IDComponent>(output).get<ModelComponent>(
-                        output).get<AxisConstraintComponent>(output);
+                entt::snapshot{m_EntityManager->GetRegistry()}.ALL_COMPONENTSENTTV9(output);
             }
             FileSystem::WriteTextFile(path, storage.str());
         }
@@ -530,28 +537,41 @@ namespace NekoEngine
                 return;
             }
 
-            try
+            // Cooked levels use the chunked format, older .bin files fall back to the cereal snapshot
+            if(!DeserialiseChunked(path))
             {
-                std::ifstream file(path, std::ios::binary);
-                cereal::BinaryInputArchive input(file);
-                input(*this);
+                try
+                {
+                    std::ifstream file(path, std::ios::binary);
+                    cereal::BinaryInputArchive input(file);
+                    input(*this);
 
-                entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).get<entt::entity>(
-                        input).get<Transform>(input).get<NameComponent>(input).get<ActiveComponent>(
-                        input).get<Hierarchy>(input).get<Camera>(input).get<LuaScriptComponent>(input).get<Model>(
-                        input).get<Light>(input).get<RigidBody3DComponent>(input).get<Environment>(
-                        input).get<DefaultCameraController>(input).get<IDComponent>(input).get<ModelComponent>(
-                        input).get<AxisConstraintComponent>(input);;
-                    
-            }
-            catch(...)
-            {
-                LOG("Failed to load scene");
+                    entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).get<entt::entity>(
+                            input).get<Transform>(input).get<NameComponent>(input).get<ActiveComponent>(
+                            input).get<Hierarchy>(input).get<Camera>(input).get<LuaScriptComponent>(input).get<Model>(
+                            input).get<Light>(input).get<RigidBody3DComponent>(input).get<Environment>(
+                            input).get<DefaultCameraController>(input).get<IDComponent>(input).get<ModelComponent>(
+                            input).get<AxisConstraintComponent>(input);;
+
+                }
+                catch(...)
+                {
+                    // A chunked file with a stale component layout ends up here too, the JSON save still loads
+                    m_EntityManager->Clear();
+                    if(FileSystem::FileExists(basePath + ".lsn"))
+                    {
+                        LOG("Failed to load binary scene, loading .lsn instead");
+                        binary = false;
+                    }
+                    else
+                        LOG("Failed to load scene");
+                }
             }
         }
-        else
+
+        if(!binary)
         {
-            path += std::string(".lsn");
+            path = basePath + ".lsn";
 
             if(!FileSystem::FileExists(path))
             {
@@ -564,10 +584,18 @@ namespace NekoEngine
                 std::istringstream istr;
                 istr.str(data);
                 cereal::JSONInputArchive input(istr);
+
+                // Files written before the version start straight with the level settings
+                int version = 8;
+                const char* firstNode = input.getNodeName();
+                if(firstNode && std::string(firstNode) == "Version")
+                    input(cereal::make_nvp("Version", version));
                 input(*this);
 
-                entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).ALL_COMPONENTSENTTV8(input);
-                
+                if(version >= 9)
+                    entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).ALL_COMPONENTSENTTV9(input);
+                else
+                    entt::snapshot_loader { m_EntityManager->GetRegistry() }.get<entt::entity>(input).ALL_COMPONENTSENTTV8(input);
             }
             catch(...)
             {
@@ -576,6 +604,9 @@ namespace NekoEngine
         }
 
         m_LevelGraph->DisableOnConstruct(false, m_EntityManager->GetRegistry());
+        m_EntityManager->RebuildUUIDIndex();
+        ResolveAxisConstraints(*m_EntityManager);
+        Hierarchy::RebuildChildLinks(m_EntityManager->GetRegistry());
         gEngine->OnNewLevel(this);
     }
 
@@ -121,6 +121,12 @@ namespace NekoEngine
         virtual void Serialise(const std::string& filePath, bool binary = false);
         virtual void Deserialise(const std::string& filePath, bool binary = false);
 
+        // Chunked binary format (see LevelChunkFormat.h), loaded through a memory mapped file.
+        // DeserialiseChunked returns false, leaving the level empty, if the file is not in that format or a raw
+        // chunk was written with a different component layout. Deserialise then tries the cereal and .lsn files.
+        bool SerialiseChunked(const std::string& path);
+        bool DeserialiseChunked(const std::string& path);
+
         void DeleteAllGameObjects();
 
         virtual void Render3D()
@@ -0,0 +1,43 @@
+#pragma once
+#include "Core.h"
+
+namespace NekoEngine
+{
+    // Chunked binary level layout:
+    //   LevelFileHeader | LevelChunkDesc[chunkCount] | chunk payloads (16 byte aligned)
+    // Every component type gets one chunk holding the packed entity list followed by the components.
+    // Trivially copyable components are stored as a raw array and bulk inserted straight from the
+    // mapped file, everything else is a cereal binary blob.
+
+    static constexpr uint32_t LEVEL_FILE_MAGIC      = 0x564C4B4E; // "NKLV"
+    static constexpr uint32_t LEVEL_FILE_VERSION    = 1;
+    static constexpr uint64_t LEVEL_CHUNK_ALIGNMENT = 16;
+
+    enum class LevelChunkEncoding : uint32_t
+    {
+        Raw    = 0,
+        Cereal = 1
+    };
+
+    struct LevelFileHeader
+    {
+        uint32_t magic      = LEVEL_FILE_MAGIC;
+        uint32_t version    = LEVEL_FILE_VERSION;
+        uint32_t chunkCount = 0;
+        uint32_t flags      = 0;
+    };
+
+    struct LevelChunkDesc
+    {
+        uint32_t type         = 0; // entt::hashed_string of the component name, stable across builds
+        uint32_t encoding     = 0;
+        uint32_t elementSize  = 0; // sizeof the stored element for raw chunks, used to reject stale layouts
+        uint32_t count        = 0;
+        uint64_t entityOffset = 0;
+        uint64_t dataOffset   = 0;
+        uint64_t dataSize     = 0;
+    };
+
+    static_assert(sizeof(LevelFileHeader) == 16, "LevelFileHeader layout changed");
+    static_assert(sizeof(LevelChunkDesc) == 40, "LevelChunkDesc layout changed");
+}
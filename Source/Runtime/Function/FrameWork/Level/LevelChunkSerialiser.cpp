@@ -0,0 +1,410 @@
+#include "Level.h"
+#include "LevelChunkFormat.h"
+#include "Component/ModelComponent.h"
+#include "Component/OccluderComponent.h"
+#include "Component/RigidBody3DComponent.h"
+#include "Entity/EntityManager.h"
+#include "Entity/Entity.h"
+#include "Renderable/Camera.h"
+#include "Renderable/Light.h"
+#include "Renderable/Environment.h"
+#include "Script/LuaScriptComponent.h"
+#include "File/FileSystem.h"
+#include "Transform.h"
+#include "GlmSerizlization.h"
+#include <fstream>
+#include <sstream>
+#include <cereal/cereal.hpp>
+#include <cereal/types/polymorphic.hpp>
+#include <cereal/archives/binary.hpp>
+
+namespace NekoEngine
+{
+    // Calls visitor.Visit<Component>(name) for every component stored in a level.
+    // Names are hashed into the chunk type, so renaming one breaks old files.
+    template <typename Visitor>
+    static void VisitLevelComponents(Visitor& visitor)
+    {
+        visitor.template Visit<Transform>("Transform");
+        visitor.template Visit<NameComponent>("NameComponent");
+        visitor.template Visit<ActiveComponent>("ActiveComponent");
+        visitor.template Visit<Hierarchy>("Hierarchy");
+        visitor.template Visit<Camera>("Camera");
+        visitor.template Visit<LuaScriptComponent>("LuaScriptComponent");
+        visitor.template Visit<Model>("Model");
+        visitor.template Visit<Light>("Light");
+        visitor.template Visit<RigidBody3DComponent>("RigidBody3DComponent");
+        visitor.template Visit<Environment>("Environment");
+        visitor.template Visit<DefaultCameraController>("DefaultCameraController");
+        visitor.template Visit<IDComponent>("IDComponent");
+        visitor.template Visit<ModelComponent>("ModelComponent");
+        visitor.template Visit<AxisConstraintComponent>("AxisConstraintComponent");
+        visitor.template Visit<OccluderComponent>("OccluderComponent");
+    }
+
+    static constexpr const char* ENTITY_CHUNK_NAME   = "Entities";
+    static constexpr const char* SETTINGS_CHUNK_NAME = "Settings";
+
+    // Components that are trivially copyable in practice but not by the type trait
+    template <typename T>
+    struct LevelRawElement
+    {
+        using Type = T;
+        static constexpr bool Raw = std::is_trivially_copyable_v<T>;
+    };
+
+    template <>
+    struct LevelRawElement<IDComponent>
+    {
+        using Type = uint64_t;
+        static constexpr bool Raw = true;
+    };
+
+    static uint64_t AlignChunkOffset(uint64_t offset)
+    {
+        return (offset + LEVEL_CHUNK_ALIGNMENT - 1) & ~(LEVEL_CHUNK_ALIGNMENT - 1);
+    }
+
+    class LevelChunkWriter
+    {
+    public:
+        explicit LevelChunkWriter(entt::registry& registry)
+                : m_Registry(registry)
+        {
+        }
+
+        template <typename T>
+        void Visit(const char* name)
+        {
+            auto& storage = m_Registry.storage<T>();
+            if(storage.empty())
+                return;
+
+            ArrayList<entt::entity> entities;
+            entities.reserve(storage.size());
+
+            if constexpr(LevelRawElement<T>::Raw)
+            {
+                using Element = typename LevelRawElement<T>::Type;
+
+                ArrayList<Element> elements;
+                elements.reserve(storage.size());
+
+                for(auto [entity, component] : storage.each())
+                {
+                    entities.push_back(entity);
+                    if constexpr(std::is_same_v<T, IDComponent>)
+                        elements.push_back((uint64_t)component.ID);
+                    else
+                        elements.push_back(component);
+                }
+
+                AddChunk(name, LevelChunkEncoding::Raw, sizeof(Element), entities, elements.data(), elements.size() * sizeof(Element));
+            }
+            else
+            {
+                std::ostringstream stream;
+                {
+                    cereal::BinaryOutputArchive archive(stream);
+                    for(auto [entity, component] : storage.each())
+                    {
+                        entities.push_back(entity);
+                        archive(component);
+                    }
+                }
+
+                const std::string blob = stream.str();
+                AddChunk(name, LevelChunkEncoding::Cereal, 0, entities, blob.data(), blob.size());
+            }
+        }
+
+        void AddChunk(const char* name, LevelChunkEncoding encoding, uint32_t elementSize, const ArrayList<entt::entity>& entities, const void* data, size_t dataSize)
+        {
+            LevelChunkDesc desc;
+            desc.type        = entt::hashed_string::value(name);
+            desc.encoding    = (uint32_t)encoding;
+            desc.elementSize = elementSize;
+            desc.count       = (uint32_t)entities.size();
+
+            desc.entityOffset = Append(entities.data(), entities.size() * sizeof(entt::entity));
+            desc.dataOffset   = Append(data, dataSize);
+            desc.dataSize     = dataSize;
+
+            m_Chunks.push_back(desc);
+        }
+
+        bool Write(const std::string& path)
+        {
+            LevelFileHeader header;
+            header.chunkCount = (uint32_t)m_Chunks.size();
+
+            // Payload offsets are relative until the size of the chunk table is known
+            const uint64_t payloadStart = AlignChunkOffset(sizeof(LevelFileHeader) + m_Chunks.size() * sizeof(LevelChunkDesc));
+            for(auto& chunk : m_Chunks)
+            {
+                chunk.entityOffset += payloadStart;
+                chunk.dataOffset += payloadStart;
+            }
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if(!file)
+                return false;
+
+            const char padding[LEVEL_CHUNK_ALIGNMENT] = {};
+            const uint64_t tableEnd = sizeof(LevelFileHeader) + m_Chunks.size() * sizeof(LevelChunkDesc);
+
+            file.write((const char*)&header, sizeof(LevelFileHeader));
+            file.write((const char*)m_Chunks.data(), m_Chunks.size() * sizeof(LevelChunkDesc));
+            file.write(padding, payloadStart - tableEnd);
+            file.write((const char*)m_Payload.data(), m_Payload.size());
+
+            return file.good();
+        }
+
+    private:
+        uint64_t Append(const void* data, size_t size)
+        {
+            const uint64_t offset = AlignChunkOffset(m_Payload.size());
+            m_Payload.resize(offset + size);
+            if(size > 0)
+                memcpy(m_Payload.data() + offset, data, size);
+            return offset;
+        }
+
+        entt::registry& m_Registry;
+        ArrayList<LevelChunkDesc> m_Chunks;
+        ArrayList<uint8_t> m_Payload;
+    };
+
+    // Lets cereal read straight out of the mapped file without copying it into a string stream
+    class MemoryStreamBuffer : public std::streambuf
+    {
+    public:
+        MemoryStreamBuffer(const uint8_t* data, size_t size)
+        {
+            char* begin = reinterpret_cast<char*>(const_cast<uint8_t*>(data));
+            setg(begin, begin, begin + size);
+        }
+    };
+
+    class LevelChunkReader
+    {
+    public:
+        LevelChunkReader(entt::registry& registry, const MappedFile& file, const LevelChunkDesc* chunks, uint32_t chunkCount)
+                : m_Registry(registry)
+                , m_File(file)
+                , m_Chunks(chunks)
+                , m_ChunkCount(chunkCount)
+        {
+        }
+
+        const LevelChunkDesc* Find(const char* name) const
+        {
+            const uint32_t type = entt::hashed_string::value(name);
+            for(uint32_t i = 0; i < m_ChunkCount; i++)
+            {
+                if(m_Chunks[i].type == type)
+                    return &m_Chunks[i];
+            }
+            return nullptr;
+        }
+
+        bool InBounds(const LevelChunkDesc& chunk) const
+        {
+            const uint64_t entityEnd = chunk.entityOffset + (uint64_t)chunk.count * sizeof(entt::entity);
+            const uint64_t dataEnd   = chunk.dataOffset + chunk.dataSize;
+            return entityEnd <= (uint64_t)m_File.size && dataEnd <= (uint64_t)m_File.size;
+        }
+
+        const entt::entity* Entities(const LevelChunkDesc& chunk) const
+        {
+            return reinterpret_cast<const entt::entity*>(m_File.data + chunk.entityOffset);
+        }
+
+        const uint8_t* Data(const LevelChunkDesc& chunk) const
+        {
+            return m_File.data + chunk.dataOffset;
+        }
+
+        template <typename T>
+        void Visit(const char* name)
+        {
+            const LevelChunkDesc* chunk = Find(name);
+            if(!chunk || chunk->count == 0)
+                return;
+
+            if(!InBounds(*chunk))
+            {
+                LOG_FORMAT("Level chunk %s is truncated", name);
+                m_Failed = true;
+                return;
+            }
+
+            const entt::entity* entities = Entities(*chunk);
+
+            if constexpr(LevelRawElement<T>::Raw)
+            {
+                using Element = typename LevelRawElement<T>::Type;
+
+                if(chunk->encoding != (uint32_t)LevelChunkEncoding::Raw || chunk->elementSize != sizeof(Element) || chunk->dataSize < (uint64_t)chunk->count * sizeof(Element))
+                {
+                    // Written by a build with a different component layout, the caller falls back to another format
+                    LOG_FORMAT("Level chunk %s has a stale layout", name);
+                    m_Failed = true;
+                    return;
+                }
+
+                const Element* elements = reinterpret_cast<const Element*>(Data(*chunk));
+
+                if constexpr(std::is_same_v<T, IDComponent>)
+                {
+                    ArrayList<IDComponent> components(chunk->count);
+                    for(uint32_t i = 0; i < chunk->count; i++)
+                        components[i].ID = UUID(elements[i]);
+
+                    m_Registry.insert<IDComponent>(entities, entities + chunk->count, components.begin());
+                }
+                else
+                {
+                    m_Registry.insert<T>(entities, entities + chunk->count, elements);
+                }
+            }
+            else
+            {
+                if(chunk->encoding != (uint32_t)LevelChunkEncoding::Cereal)
+                {
+                    LOG_FORMAT("Level chunk %s has an unexpected encoding", name);
+                    m_Failed = true;
+                    return;
+                }
+
+                MemoryStreamBuffer buffer(Data(*chunk), (size_t)chunk->dataSize);
+                std::istream stream(&buffer);
+                cereal::BinaryInputArchive archive(stream);
+
+                auto& storage = m_Registry.storage<T>();
+                storage.reserve(chunk->count);
+
+                for(uint32_t i = 0; i < chunk->count; i++)
+                {
+                    T instance {};
+                    archive(instance);
+                    m_Registry.emplace<T>(entities[i], std::move(instance));
+                }
+            }
+        }
+
+        bool Failed() const { return m_Failed; }
+
+    private:
+        entt::registry& m_Registry;
+        const MappedFile& m_File;
+        const LevelChunkDesc* m_Chunks;
+        uint32_t m_ChunkCount;
+        bool m_Failed = false;
+    };
+
+    bool Level::SerialiseChunked(const std::string& path)
+    {
+        auto& registry = m_EntityManager->GetRegistry();
+        LevelChunkWriter writer(registry);
+
+        {
+            ArrayList<entt::entity> entities;
+            entities.reserve(registry.storage<entt::entity>().in_use());
+            for(auto [entity] : registry.storage<entt::entity>().each())
+                entities.push_back(entity);
+
+            writer.AddChunk(ENTITY_CHUNK_NAME, LevelChunkEncoding::Raw, sizeof(entt::entity), entities, nullptr, 0);
+        }
+
+        {
+            std::ostringstream stream;
+            {
+                cereal::BinaryOutputArchive archive(stream);
+                archive(*this);
+            }
+
+            const std::string blob = stream.str();
+            writer.AddChunk(SETTINGS_CHUNK_NAME, LevelChunkEncoding::Cereal, 0, {}, blob.data(), blob.size());
+        }
+
+        VisitLevelComponents(writer);
+
+        if(!writer.Write(path))
+        {
+            LOG_FORMAT("Failed to write level - %s", path.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+    bool Level::DeserialiseChunked(const std::string& path)
+    {
+        MappedFile file;
+        if(!FileSystem::MapFile(path, file))
+            return false;
+
+        const LevelFileHeader* header = reinterpret_cast<const LevelFileHeader*>(file.data);
+        if(file.size < (int64_t)sizeof(LevelFileHeader) || header->magic != LEVEL_FILE_MAGIC)
+        {
+            FileSystem::UnmapFile(file);
+            return false;
+        }
+
+        if(header->version != LEVEL_FILE_VERSION || file.size < (int64_t)(sizeof(LevelFileHeader) + header->chunkCount * sizeof(LevelChunkDesc)))
+        {
+            LOG_FORMAT("Unsupported level file version %u - %s", header->version, path.c_str());
+            FileSystem::UnmapFile(file);
+            return false;
+        }
+
+        auto& registry = m_EntityManager->GetRegistry();
+        const LevelChunkDesc* chunks = reinterpret_cast<const LevelChunkDesc*>(file.data + sizeof(LevelFileHeader));
+        LevelChunkReader reader(registry, file, chunks, header->chunkCount);
+
+        bool loaded = false;
+        try
+        {
+            const LevelChunkDesc* entityChunk   = reader.Find(ENTITY_CHUNK_NAME);
+            const LevelChunkDesc* settingsChunk = reader.Find(SETTINGS_CHUNK_NAME);
+
+            if(entityChunk && settingsChunk && reader.InBounds(*entityChunk) && reader.InBounds(*settingsChunk))
+            {
+                // Recreate entities with their saved identifiers so raw Hierarchy links stay valid
+                const entt::entity* entities = reader.Entities(*entityChunk);
+                registry.storage<entt::entity>().reserve(entityChunk->count);
+                for(uint32_t i = 0; i < entityChunk->count; i++)
+                    registry.create(entities[i]);
+
+                MemoryStreamBuffer buffer(reader.Data(*settingsChunk), (size_t)settingsChunk->dataSize);
+                std::istream stream(&buffer);
+                cereal::BinaryInputArchive archive(stream);
+                archive(*this);
+
+                VisitLevelComponents(reader);
+                loaded = !reader.Failed();
+            }
+        }
+        catch(...)
+        {
+            loaded = false;
+        }
+
+        FileSystem::UnmapFile(file);
+
+        if(!loaded)
+        {
+            LOG_FORMAT("Failed to load chunked level - %s", path.c_str());
+            m_EntityManager->Clear();
+            return false;
+        }
+
+        // Raw transforms keep whatever flags they were saved with, match the cereal load path
+        for(auto [entity, transform] : registry.storage<Transform>().each())
+            transform.isDirty = true;
+
+        return true;
+    }
+} // NekoEngine
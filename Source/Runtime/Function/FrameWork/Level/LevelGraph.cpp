@@ -90,6 +90,82 @@ namespace NekoEngine
         }
     }
 
+    void Hierarchy::AttachChildren(entt::entity parent, const entt::entity* children, size_t count, entt::registry& registry)
+    {
+        if(parent == entt::null)
+        {
+            for(size_t i = 0; i < count; i++)
+            {
+                auto hierarchy = registry.try_get<Hierarchy>(children[i]);
+                if(hierarchy)
+                    Reparent(children[i], entt::null, registry, *hierarchy);
+            }
+            return;
+        }
+
+        auto& parent_hierarchy = registry.get_or_emplace<Hierarchy>(parent);
+
+        for(size_t i = 0; i < count; i++)
+        {
+            entt::entity child = children[i];
+            if(child == entt::null || child == parent)
+                continue;
+
+            auto hierarchy = registry.try_get<Hierarchy>(child);
+            if(hierarchy)
+                Unlink(registry, child, *hierarchy);
+            else
+                hierarchy = &registry.emplace<Hierarchy>(child);
+
+            hierarchy->m_Parent = parent;
+            hierarchy->m_Next   = entt::null;
+            hierarchy->m_Prev   = entt::null;
+
+            Append(registry, child, *hierarchy, parent_hierarchy);
+        }
+    }
+
+    void Hierarchy::ReparentChildren(entt::entity oldParent, entt::entity newParent, entt::registry& registry)
+    {
+        auto old_hierarchy = registry.try_get<Hierarchy>(oldParent);
+        if(old_hierarchy == nullptr || old_hierarchy->m_First == entt::null || oldParent == newParent)
+            return;
+
+        std::vector<entt::entity> children;
+        children.reserve(old_hierarchy->m_ChildCount);
+
+        entt::entity child = old_hierarchy->m_First;
+        while(child != entt::null)
+        {
+            children.push_back(child);
+            auto child_hierarchy = registry.try_get<Hierarchy>(child);
+            child                = child_hierarchy ? child_hierarchy->m_Next : entt::null;
+        }
+
+        AttachChildren(newParent, children.data(), children.size(), registry);
+    }
+
+    void Hierarchy::RebuildChildLinks(entt::registry& registry)
+    {
+        auto view = registry.view<Hierarchy>();
+        for(auto entity : view)
+        {
+            auto& hierarchy        = view.get<Hierarchy>(entity);
+            hierarchy.m_Last       = entt::null;
+            hierarchy.m_ChildCount = 0;
+
+            entt::entity child = hierarchy.m_First;
+            while(child != entt::null)
+            {
+                hierarchy.m_Last = child;
+                hierarchy.m_ChildCount++;
+
+                auto child_hierarchy = registry.try_get<Hierarchy>(child);
+                child                = child_hierarchy ? child_hierarchy->m_Next : entt::null;
+            }
+        }
+    }
+
     bool Hierarchy::Compare(const entt::registry& registry, const entt::entity rhs) const
     {
         if(rhs == entt::null || rhs == m_Parent || rhs == m_Prev)
@@ -117,65 +193,70 @@ namespace NekoEngine
 
     void Hierarchy::Reset()
     {
-        m_Parent = entt::null;
-        m_First  = entt::null;
-        m_Next   = entt::null;
-        m_Prev   = entt::null;
+        m_Parent     = entt::null;
+        m_First      = entt::null;
+        m_Next       = entt::null;
+        m_Prev       = entt::null;
+        m_Last       = entt::null;
+        m_ChildCount = 0;
     }
 
-    void Hierarchy::OnConstruct(entt::registry& registry, entt::entity entity)
+    void Hierarchy::Append(entt::registry& registry, entt::entity entity, Hierarchy& hierarchy, Hierarchy& parent_hierarchy)
     {
-        auto& hierarchy = registry.get<Hierarchy>(entity);
-        if(hierarchy.m_Parent != entt::null)
+        if(parent_hierarchy.m_First == entt::null)
         {
-            auto& parent_hierarchy = registry.get_or_emplace<Hierarchy>(hierarchy.m_Parent);
+            parent_hierarchy.m_First = entity;
+            hierarchy.m_Prev         = entt::null;
+        }
+        else
+        {
+            // get last children
+            auto prev_ent          = parent_hierarchy.m_Last;
+            auto current_hierarchy = prev_ent != entt::null ? registry.try_get<Hierarchy>(prev_ent) : nullptr;
 
-            if(parent_hierarchy.m_First == entt::null)
+            // last link is missing or out of date, walk the list once to recover it
+            if(current_hierarchy == nullptr || current_hierarchy->m_Next != entt::null)
             {
-                parent_hierarchy.m_First = entity;
-            }
-            else
-            {
-                // get last children
-                auto prev_ent          = parent_hierarchy.m_First;
-                auto current_hierarchy = registry.try_get<Hierarchy>(prev_ent);
+                prev_ent          = parent_hierarchy.m_First;
+                current_hierarchy = registry.try_get<Hierarchy>(prev_ent);
                 while(current_hierarchy != nullptr && current_hierarchy->m_Next != entt::null)
                 {
                     prev_ent          = current_hierarchy->m_Next;
                     current_hierarchy = registry.try_get<Hierarchy>(prev_ent);
                 }
-                // add new
-                current_hierarchy->m_Next = entity;
-                hierarchy.m_Prev          = prev_ent;
             }
-            // sort
-            //			registry.sort<Hierarchy>([&registry](const entt::entity lhs, const entt::entity rhs) {
-            //				auto& right_h = registry.get<Hierarchy>(rhs);
-            //				auto result = right_h.Compare(registry, lhs);
-            //				return result;
-            //			});
+
+            // add new
+            if(current_hierarchy != nullptr)
+                current_hierarchy->m_Next = entity;
+            hierarchy.m_Prev = prev_ent;
         }
+
+        hierarchy.m_Next        = entt::null;
+        parent_hierarchy.m_Last = entity;
+        parent_hierarchy.m_ChildCount++;
     }
 
-    void Hierarchy::OnUpdate(entt::registry& registry, entt::entity entity)
+    void Hierarchy::Unlink(entt::registry& registry, entt::entity entity, Hierarchy& hierarchy)
     {
-        auto& hierarchy = registry.get<Hierarchy>(entity);
+        Hierarchy* parent_hierarchy = nullptr;
+        if(hierarchy.m_Parent != entt::null && registry.valid(hierarchy.m_Parent))
+            parent_hierarchy = registry.try_get<Hierarchy>(hierarchy.m_Parent);
+
+        bool hasPrev = hierarchy.m_Prev != entt::null && registry.valid(hierarchy.m_Prev);
+
         // if is the first child
-        if(hierarchy.m_Prev == entt::null)
+        if(!hasPrev)
         {
-            if(hierarchy.m_Parent != entt::null)
+            if(parent_hierarchy != nullptr)
             {
-                auto parent_hierarchy = registry.try_get<Hierarchy>(hierarchy.m_Parent);
-                if(parent_hierarchy != nullptr)
+                parent_hierarchy->m_First = hierarchy.m_Next;
+                if(hierarchy.m_Next != entt::null)
                 {
-                    parent_hierarchy->m_First = hierarchy.m_Next;
-                    if(hierarchy.m_Next != entt::null)
+                    auto next_hierarchy = registry.try_get<Hierarchy>(hierarchy.m_Next);
+                    if(next_hierarchy != nullptr)
                     {
-                        auto next_hierarchy = registry.try_get<Hierarchy>(hierarchy.m_Next);
-                        if(next_hierarchy != nullptr)
-                        {
-                            next_hierarchy->m_Prev = entt::null;
-                        }
+                        next_hierarchy->m_Prev = entt::null;
                     }
                 }
             }
@@ -197,60 +278,35 @@ namespace NekoEngine
             }
         }
 
-        // sort
-        //		registry.sort<Hierarchy>([&registry](const entt::entity lhs, const entt::entity rhs)
-        //		{
-        //			auto& right_h = registry.get<Hierarchy>(rhs);
-        //			return right_h.Compare(registry, lhs);
-        //		});
+        if(parent_hierarchy != nullptr)
+        {
+            if(parent_hierarchy->m_Last == entity)
+                parent_hierarchy->m_Last = hasPrev ? hierarchy.m_Prev : entt::null;
+            if(parent_hierarchy->m_ChildCount > 0)
+                parent_hierarchy->m_ChildCount--;
+        }
     }
 
-    void Hierarchy::OnDestroy(entt::registry& registry, entt::entity entity)
+    void Hierarchy::OnConstruct(entt::registry& registry, entt::entity entity)
     {
         auto& hierarchy = registry.get<Hierarchy>(entity);
-        // if is the first child
-        if(hierarchy.m_Prev == entt::null || !registry.valid(hierarchy.m_Prev))
-        {
-            if(hierarchy.m_Parent != entt::null && registry.valid(hierarchy.m_Parent))
-            {
-                auto parent_hierarchy = registry.try_get<Hierarchy>(hierarchy.m_Parent);
-                if(parent_hierarchy != nullptr)
-                {
-                    parent_hierarchy->m_First = hierarchy.m_Next;
-                    if(hierarchy.m_Next != entt::null)
-                    {
-                        auto next_hierarchy = registry.try_get<Hierarchy>(hierarchy.m_Next);
-                        if(next_hierarchy != nullptr)
-                        {
-                            next_hierarchy->m_Prev = entt::null;
-                        }
-                    }
-                }
-            }
-        }
-        else
+        if(hierarchy.m_Parent != entt::null)
         {
-            auto prev_hierarchy = registry.try_get<Hierarchy>(hierarchy.m_Prev);
-            if(prev_hierarchy != nullptr)
-            {
-                prev_hierarchy->m_Next = hierarchy.m_Next;
-            }
-            if(hierarchy.m_Next != entt::null)
-            {
-                auto next_hierarchy = registry.try_get<Hierarchy>(hierarchy.m_Next);
-                if(next_hierarchy != nullptr)
-                {
-                    next_hierarchy->m_Prev = hierarchy.m_Prev;
-                }
-            }
+            auto& parent_hierarchy = registry.get_or_emplace<Hierarchy>(hierarchy.m_Parent);
+            Append(registry, entity, hierarchy, parent_hierarchy);
         }
+    }
 
-        // sort
-        //		registry.sort<Hierarchy>([&registry](const entt::entity lhs, const entt::entity rhs)
-        //		{
-        //			auto& right_h = registry.get<Hierarchy>(rhs);
-        //			return right_h.Compare(registry, lhs);
-        //		});
+    void Hierarchy::OnUpdate(entt::registry& registry, entt::entity entity)
+    {
+        auto& hierarchy = registry.get<Hierarchy>(entity);
+        Unlink(registry, entity, hierarchy);
+    }
+
+    void Hierarchy::OnDestroy(entt::registry& registry, entt::entity entity)
+    {
+        auto& hierarchy = registry.get<Hierarchy>(entity);
+        Unlink(registry, entity, hierarchy);
     }
 
     void LevelGraph::DisableOnConstruct(bool disable, entt::registry& registry)
@@ -38,6 +38,14 @@ namespace NekoEngine
         {
             return m_First;
         }
+        inline entt::entity Last() const
+        {
+            return m_Last;
+        }
+        inline uint32_t ChildCount() const
+        {
+            return m_ChildCount;
+        }
 
         // Return true if rhs is an ancestor of rhs
         bool Compare(const entt::registry& registry, const entt::entity rhs) const;
@@ -51,16 +59,32 @@ namespace NekoEngine
         static void OnUpdate(entt::registry& registry, entt::entity entity);
         static void Reparent(entt::entity entity, entt::entity parent, entt::registry& registry, Hierarchy& hierarchy);
 
+        // Append a batch of entities to the end of parent's child list, detaching them from any previous parent
+        static void AttachChildren(entt::entity parent, const entt::entity* children, size_t count, entt::registry& registry);
+        // Move every child of oldParent to the end of newParent's child list, keeping their order
+        static void ReparentChildren(entt::entity oldParent, entt::entity newParent, entt::registry& registry);
+
+        // Recompute last child links and child counts from the serialised first/next links
+        static void RebuildChildLinks(entt::registry& registry);
+
         entt::entity m_Parent = entt::null;
         entt::entity m_First = entt::null;
         entt::entity m_Next = entt::null;
         entt::entity m_Prev = entt::null;
 
+        // Not serialised, rebuilt from the sibling links on load
+        entt::entity m_Last = entt::null;
+        uint32_t m_ChildCount = 0;
+
         template <typename Archive>
         void serialize(Archive& archive)
         {
             archive(cereal::make_nvp("First", m_First), cereal::make_nvp("Next", m_Next), cereal::make_nvp("Previous", m_Prev), cereal::make_nvp("Parent", m_Parent));
         }
+
+    private:
+        static void Unlink(entt::registry& registry, entt::entity entity, Hierarchy& hierarchy);
+        static void Append(entt::registry& registry, entt::entity entity, Hierarchy& hierarchy, Hierarchy& parentHierarchy);
     };
 
 } // NekoEngine
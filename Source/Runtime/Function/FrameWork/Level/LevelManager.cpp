@@ -3,6 +3,7 @@
 #include "PhysicsEngine.h"
 #include "StringUtility.h"
 #include "File/VirtualFileSystem.h"
+#include <filesystem>
 
 namespace NekoEngine
 {
@@ -99,7 +100,17 @@ namespace NekoEngine
         gEngine->GetSystem<PhysicsEngine>()->SetPaused(false);
 
         std::string physicalPath;
-        if(VirtualFileSystem::ResolvePhysicalPath("//Levels/" + m_CurrentLevel->GetName() + ".lsn", physicalPath))
+        std::string binaryPath;
+        bool hasText   = VirtualFileSystem::ResolvePhysicalPath("//Levels/" + m_CurrentLevel->GetName() + ".lsn", physicalPath);
+        bool hasBinary = VirtualFileSystem::ResolvePhysicalPath("//Levels/" + m_CurrentLevel->GetName() + ".bin", binaryPath);
+
+        // Prefer the memory mapped binary level unless the text level was saved after it
+        if(hasBinary && (!hasText || std::filesystem::last_write_time(binaryPath) >= std::filesystem::last_write_time(physicalPath)))
+        {
+            auto newPath = StringUtility::RemoveName(binaryPath);
+            m_CurrentLevel->Deserialise(newPath, true);
+        }
+        else if(hasText)
         {
             auto newPath = StringUtility::RemoveName(physicalPath);
             m_CurrentLevel->Deserialise(newPath, false);
@@ -1,9 +1,109 @@
 #pragma once
 
 #include "Core.h"
+#include <algorithm>
+#include "entt/entt.hpp"
 
 namespace NekoEngine
 {
+    class Level;
+    class TimeStep;
+
+    // Components a system touches during OnUpdate. The SystemManager uses these to decide which
+    // systems can run concurrently on the job system. A system that declares nothing is exclusive
+    // and never overlaps with any other system.
+    class SystemAccess
+    {
+    public:
+        template<typename... Component>
+        SystemAccess& Read()
+        {
+            (Add<Component>(m_Reads), ...);
+            return *this;
+        }
+
+        template<typename... Component>
+        SystemAccess& Write()
+        {
+            (Add<Component>(m_Writes), ...);
+            return *this;
+        }
+
+        // Keep the system on the thread calling SystemManager::OnUpdate (Lua state, ImGui, ...)
+        SystemAccess& MainThread()
+        {
+            m_Declared   = true;
+            m_MainThread = true;
+            return *this;
+        }
+
+        // Creating/destroying entities or adding/removing components needs the whole registry
+        SystemAccess& Exclusive()
+        {
+            m_Declared  = true;
+            m_Exclusive = true;
+            return *this;
+        }
+
+        // Groups the system builds during OnUpdate. Creating a group changes the registry, so it is done
+        // up front with the storage, e.g. Group<RigidBody3DComponent>(entt::get<Transform>)
+        template<typename... Owned, typename... Get>
+        SystemAccess& Group(entt::get_t<Get...> = {})
+        {
+            m_Prepare.push_back([](entt::registry& registry)
+                                { registry.group<Owned...>(entt::get<Get...>); });
+            return *this;
+        }
+
+        bool IsMainThread() const { return m_MainThread; }
+        bool IsExclusive() const { return m_Exclusive || !m_Declared; }
+
+        const ArrayList<entt::id_type>& GetReads() const { return m_Reads; }
+        const ArrayList<entt::id_type>& GetWrites() const { return m_Writes; }
+
+        bool ConflictsWith(const SystemAccess& other) const
+        {
+            if(IsExclusive() || other.IsExclusive())
+                return true;
+
+            return Intersects(m_Writes, other.m_Writes) || Intersects(m_Writes, other.m_Reads) || Intersects(m_Reads, other.m_Writes);
+        }
+
+        // Storage and groups are created up front on the calling thread so concurrent systems only ever look them up
+        void Prepare(entt::registry& registry) const
+        {
+            for(auto& prepare : m_Prepare)
+                prepare(registry);
+        }
+
+    private:
+        template<typename Component>
+        void Add(ArrayList<entt::id_type>& list)
+        {
+            m_Declared = true;
+            list.push_back(entt::type_hash<Component>::value());
+            m_Prepare.push_back([](entt::registry& registry)
+                                { registry.storage<Component>(); });
+        }
+
+        static bool Intersects(const ArrayList<entt::id_type>& lhs, const ArrayList<entt::id_type>& rhs)
+        {
+            for(auto id : lhs)
+            {
+                if(std::find(rhs.begin(), rhs.end(), id) != rhs.end())
+                    return true;
+            }
+            return false;
+        }
+
+        ArrayList<entt::id_type> m_Reads;
+        ArrayList<entt::id_type> m_Writes;
+        ArrayList<std::function<void(entt::registry&)>> m_Prepare;
+        bool m_Declared   = false;
+        bool m_MainThread = false;
+        bool m_Exclusive  = false;
+    };
+
     class ISystem
     {
     public:
@@ -21,6 +121,9 @@ namespace NekoEngine
 
         virtual void OnDebugDraw() = 0;
 
+        // Called once on registration. Leave empty to keep the system exclusive.
+        virtual void DeclareAccess(SystemAccess& access) {}
+
         inline const std::string &GetName() const
         {
             return m_DebugName;
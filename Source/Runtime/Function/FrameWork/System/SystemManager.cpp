@@ -0,0 +1,126 @@
+#include "SystemManager.h"
+#include "JobSystem/JobSystem.h"
+#include "Timer/Timer.h"
+#include "Math/Maths.h"
+
+namespace NekoEngine
+{
+    void SystemManager::AddScheduledSystem(size_t typeName, ISystem* system)
+    {
+        ScheduleNode node;
+        node.typeName = typeName;
+        node.system   = system;
+        system->DeclareAccess(node.access);
+
+        m_Schedule.push_back(std::move(node));
+        m_ScheduleDirty = true;
+    }
+
+    void SystemManager::RemoveScheduledSystem(size_t typeName)
+    {
+        m_Schedule.erase(std::remove_if(m_Schedule.begin(), m_Schedule.end(), [typeName](const ScheduleNode& node)
+                                        { return node.typeName == typeName; }),
+                         m_Schedule.end());
+        m_ScheduleDirty = true;
+    }
+
+    void SystemManager::BuildSchedule()
+    {
+        // A system goes one wave after the latest earlier system it conflicts with
+        uint32_t waveCount = 0;
+        for(size_t i = 0; i < m_Schedule.size(); i++)
+        {
+            uint32_t wave = 0;
+            for(size_t j = 0; j < i; j++)
+            {
+                if(m_Schedule[i].access.ConflictsWith(m_Schedule[j].access))
+                    wave = Maths::Max(wave, m_Schedule[j].wave + 1);
+            }
+
+            m_Schedule[i].wave = wave;
+            waveCount          = Maths::Max(waveCount, wave + 1);
+        }
+
+        m_Waves.clear();
+        m_Waves.resize(waveCount);
+        for(uint32_t i = 0; i < (uint32_t)m_Schedule.size(); i++)
+            m_Waves[m_Schedule[i].wave].push_back(i);
+
+        m_Profile.resize(m_Schedule.size());
+        for(size_t i = 0; i < m_Schedule.size(); i++)
+        {
+            m_Profile[i].name       = m_Schedule[i].system->GetName();
+            m_Profile[i].wave       = m_Schedule[i].wave;
+            m_Profile[i].mainThread = m_Schedule[i].access.IsMainThread();
+            m_Profile[i].updateMs   = 0.0f;
+        }
+
+        m_ScheduleDirty = false;
+    }
+
+    void SystemManager::UpdateSystem(ScheduleNode& node, uint32_t index, const TimeStep& dt, Level* level)
+    {
+        TimeStamp start = Timer::Now();
+        node.system->OnUpdate(dt, level);
+        m_Profile[index].updateMs = Timer::Duration(start, Timer::Now(), 1000.0f);
+    }
+
+    void SystemManager::OnUpdate(const TimeStep &dt, Level* level)
+    {
+        if(m_ScheduleDirty)
+            BuildSchedule();
+
+        bool parallel = m_ParallelUpdate && JobSystem::GetThreadCount() > 0;
+
+        if(parallel)
+        {
+            for(auto& node : m_Schedule)
+                node.access.Prepare(level->GetRegistry());
+        }
+
+        for(auto& wave : m_Waves)
+        {
+            if(!parallel || wave.size() == 1)
+            {
+                for(auto index : wave)
+                    UpdateSystem(m_Schedule[index], index, dt, level);
+                continue;
+            }
+
+            JobSystem::Context context;
+            for(auto index : wave)
+            {
+                if(m_Schedule[index].access.IsMainThread())
+                    continue;
+
+                JobSystem::Execute(context, [this, index, &dt, level](JobDispatchArgs args)
+                                   { UpdateSystem(m_Schedule[index], index, dt, level); });
+            }
+
+            for(auto index : wave)
+            {
+                if(m_Schedule[index].access.IsMainThread())
+                    UpdateSystem(m_Schedule[index], index, dt, level);
+            }
+
+            JobSystem::Wait(context);
+        }
+    }
+
+    void SystemManager::OnImGui()
+    {
+        ImGui::Checkbox("Parallel Update", &m_ParallelUpdate);
+
+        for(size_t i = 0; i < m_Schedule.size(); i++)
+        {
+            auto system = m_Schedule[i].system;
+            float time  = i < m_Profile.size() ? m_Profile[i].updateMs : 0.0f;
+
+            if(ImGui::TreeNode(system, "%s (wave %u, %.3f ms)", system->GetName().c_str(), m_Schedule[i].wave, time))
+            {
+                system->OnImGui();
+                ImGui::TreePop();
+            }
+        }
+    }
+}
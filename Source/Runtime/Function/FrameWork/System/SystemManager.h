@@ -6,6 +6,14 @@
 
 namespace NekoEngine
 {
+    struct SystemProfile
+    {
+        String name;
+        float updateMs = 0.0f;
+        uint32_t wave  = 0;
+        bool mainThread = false;
+    };
+
     class SystemManager
     {
     public:
@@ -18,7 +26,8 @@ namespace NekoEngine
 
             // Create a pointer to the system and return it so it can be used externally
             SharedPtr<T> system = MakeShared<T>(std::forward<Args>(args)...);
-            m_Systems.insert({typeName, std::move(system)});
+            m_Systems.insert({typeName, system});
+            AddScheduledSystem(typeName, system.get());
             return system;
         }
 
@@ -27,11 +36,12 @@ namespace NekoEngine
         {
             auto typeName = typeid(T).hash_code();
 
-            ASSERT(m_Systems.find(typeName) == m_Systems.end(), "Registering system more than once.");
+            ASSERT(m_Systems.find(typeName) != m_Systems.end(), "Registering system more than once.");
 
             // Create a pointer to the system and return it so it can be used externally
             SharedPtr<T> system = SharedPtr<T>(t);
-            m_Systems.insert({typeName, std::move(system)});
+            m_Systems.insert({typeName, system});
+            AddScheduledSystem(typeName, system.get());
             return system;
         }
 
@@ -42,6 +52,7 @@ namespace NekoEngine
 
             if(m_Systems.find(typeName) != m_Systems.end())
             {
+                RemoveScheduledSystem(typeName);
                 m_Systems.erase(typeName);
             }
         }
@@ -60,40 +71,53 @@ namespace NekoEngine
         }
 
         template<typename T>
-        T* HasSystem()
+        bool HasSystem()
         {
             auto typeName = typeid(T).hash_code();
 
             return m_Systems.find(typeName) != m_Systems.end();
         }
 
-        void OnUpdate(const TimeStep &dt, Level* level)
-        {
-            for(auto &system: m_Systems)
-                system.second->OnUpdate(dt, level);
-        }
+        // Runs systems wave by wave. Systems inside a wave have no conflicting component access and are
+        // dispatched to the job system; conflicting systems keep their registration order.
+        void OnUpdate(const TimeStep &dt, Level* level);
 
-        void OnImGui()
-        {
-            for(auto &system: m_Systems)
-            {
-                if(ImGui::TreeNode(system.second->GetName().c_str()))
-                {
-                    system.second->OnImGui();
-                    ImGui::TreePop();
-                }
-            }
-        }
+        void OnImGui();
 
         void OnDebugDraw()
         {
-            for(auto &system: m_Systems)
-                system.second->OnDebugDraw();
+            for(auto &node: m_Schedule)
+                node.system->OnDebugDraw();
         }
 
+        void SetParallelUpdate(bool parallel) { m_ParallelUpdate = parallel; }
+        bool GetParallelUpdate() const { return m_ParallelUpdate; }
+
+        // Timings from the last OnUpdate, in registration order
+        const ArrayList<SystemProfile>& GetProfile() const { return m_Profile; }
+
     private:
+        struct ScheduleNode
+        {
+            size_t typeName;
+            ISystem* system;
+            SystemAccess access;
+            uint32_t wave = 0;
+        };
+
+        void AddScheduledSystem(size_t typeName, ISystem* system);
+        void RemoveScheduledSystem(size_t typeName);
+        void BuildSchedule();
+        void UpdateSystem(ScheduleNode& node, uint32_t index, const TimeStep& dt, Level* level);
+
         // Map from system type string pointer to a system pointer
         std::unordered_map<size_t, SharedPtr<ISystem>> m_Systems;
 
+        // Systems in registration order, which is also the order conflicting systems run in
+        ArrayList<ScheduleNode> m_Schedule;
+        ArrayList<ArrayList<uint32_t>> m_Waves;
+        ArrayList<SystemProfile> m_Profile;
+        bool m_ScheduleDirty  = true;
+        bool m_ParallelUpdate = true;
     };
-}
\ No newline at end of file
+}
@@ -3,6 +3,7 @@
 #include "GLFW/glfw3.h"
 #include "Engine.h"
 #include "Vulkan/VulkanImGuiRenderer.h"
+#include "Null/NullImGuiRenderer.h"
 #include "ImGui/Plugins/ImGuizmo.h"
 #include "ImGui/IconsMaterialDesignIcons.h"
 #include "ImGuiUtility.h"
@@ -48,7 +49,10 @@ namespace NekoEngine
         SetImGuiStyle();
 
         //TODO: OpenGL
-        m_IMGUIRenderer = UniquePtr<ImGuiRenderer>(new VulkanImGuiRenderer(window->GetWidth(), window->GetHeight(), m_ClearScreen));
+        if(GraphicsContext::GetRenderAPI() == RENDER_API::NONE)
+            m_IMGUIRenderer = UniquePtr<ImGuiRenderer>(new NullImGuiRenderer());
+        else
+            m_IMGUIRenderer = UniquePtr<ImGuiRenderer>(new VulkanImGuiRenderer(window->GetWidth(), window->GetHeight(), m_ClearScreen));
 
         if(m_IMGUIRenderer) m_IMGUIRenderer->Init();
 
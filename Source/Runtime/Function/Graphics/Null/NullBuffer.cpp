@@ -0,0 +1,109 @@
+#include "NullBuffer.h"
+#include "NullCommandBuffer.h"
+#include "NullRenderer.h"
+
+namespace NekoEngine
+{
+    NullVertexBuffer::NullVertexBuffer(const BufferUsage &usage)
+    {
+        bufferUsage = usage;
+        isMapped    = false;
+    }
+
+    void NullVertexBuffer::Resize(uint32_t _size)
+    {
+        if(_size == 0)
+            return;
+
+        size = _size;
+        if(isMapped)
+            mapped.resize(size);
+    }
+
+    void NullVertexBuffer::SetData(uint32_t _size, const void* data)
+    {
+        if(_size == 0)
+            return;
+
+        size = std::max(size, _size);
+        NullRenderer::CountUpload(_size);
+    }
+
+    void NullVertexBuffer::SetDataSub(uint32_t _size, const void* data, uint32_t offset)
+    {
+        size = std::max(size, offset + _size);
+        NullRenderer::CountUpload(_size);
+    }
+
+    void* NullVertexBuffer::GetPointerInternal()
+    {
+        // Dynamic buffers are filled in place every frame, so the storage has to be real
+        if(!isMapped)
+        {
+            mapped.resize(size);
+            isMapped = true;
+        }
+
+        return mapped.data();
+    }
+
+    void NullVertexBuffer::ReleasePointer()
+    {
+        if(isMapped)
+        {
+            NullRenderer::CountUpload(size);
+            isMapped = false;
+        }
+    }
+
+    void NullVertexBuffer::Bind(CommandBuffer* commandBuffer, Pipeline* pipeline)
+    {
+        if(commandBuffer)
+            static_cast<NullCommandBuffer*>(commandBuffer)->GetCounters().vertexBufferBinds++;
+    }
+
+    void NullVertexBuffer::BindInstanceData(CommandBuffer* commandBuffer)
+    {
+        if(commandBuffer)
+            static_cast<NullCommandBuffer*>(commandBuffer)->GetCounters().vertexBufferBinds++;
+    }
+
+    NullIndexBuffer::NullIndexBuffer(uint16_t* data, uint32_t count, BufferUsage bufferUsage)
+    {
+        m_Usage = bufferUsage;
+        m_Count = count;
+        m_Size  = count * sizeof(uint16_t);
+        NullRenderer::CountUpload(m_Size);
+    }
+
+    NullIndexBuffer::NullIndexBuffer(uint32_t* data, uint32_t count, BufferUsage bufferUsage)
+    {
+        m_Usage = bufferUsage;
+        m_Count = count;
+        m_Size  = count * sizeof(uint32_t);
+        NullRenderer::CountUpload(m_Size);
+    }
+
+    void NullIndexBuffer::Bind(CommandBuffer* commandBuffer) const
+    {
+        if(commandBuffer)
+            static_cast<NullCommandBuffer*>(commandBuffer)->GetCounters().indexBufferBinds++;
+    }
+
+    void NullUniformBuffer::Init(uint32_t size, const void* _data)
+    {
+        data.resize(size);
+        if(_data)
+            SetData(size, _data);
+    }
+
+    void NullUniformBuffer::SetData(uint32_t size, const void* _data)
+    {
+        if(size > data.size())
+            data.resize(size);
+
+        memcpy(data.data(), _data, size);
+        NullRenderer::CountUpload(size);
+    }
+
+} // NekoEngine
@@ -0,0 +1,66 @@
+#pragma once
+#include "RHI/VertexBuffer.h"
+#include "RHI/IndexBuffer.h"
+#include "RHI/UniformBuffer.h"
+
+namespace NekoEngine
+{
+    // Buffers keep a CPU copy only where callers write through a mapped pointer, everything handed to
+    // SetData is counted as an upload and dropped.
+
+    class NullVertexBuffer : public VertexBuffer
+    {
+    private:
+        ArrayList<uint8_t> mapped;
+        uint32_t size = 0;
+
+    public:
+        NullVertexBuffer(const BufferUsage& usage);
+        ~NullVertexBuffer() override = default;
+
+        void Resize(uint32_t _size) override;
+        void SetData(uint32_t _size, const void* data) override;
+        void SetDataSub(uint32_t _size, const void* data, uint32_t offset) override;
+        void ReleasePointer() override;
+
+        void Bind(CommandBuffer* commandBuffer, Pipeline* pipeline) override;
+        void BindInstanceData(CommandBuffer* commandBuffer) override;
+        void Unbind() override {}
+
+        uint32_t GetSize() override { return size; }
+
+    protected:
+        void* GetPointerInternal() override;
+    };
+
+    class NullIndexBuffer : public IndexBuffer
+    {
+    public:
+        NullIndexBuffer(uint16_t* data, uint32_t count, BufferUsage bufferUsage);
+        NullIndexBuffer(uint32_t* data, uint32_t count, BufferUsage bufferUsage);
+        ~NullIndexBuffer() override = default;
+
+        void Bind(CommandBuffer* commandBuffer) const override;
+        void Unbind() const override {}
+        uint32_t GetCount() const override { return m_Count; }
+        uint32_t GetSize() const override { return m_Size; }
+        void SetCount(uint32_t m_index_count) override { m_Count = m_index_count; }
+    };
+
+    class NullUniformBuffer : public UniformBuffer
+    {
+    private:
+        ArrayList<uint8_t> data;
+
+    public:
+        NullUniformBuffer() = default;
+        ~NullUniformBuffer() override = default;
+
+        void Init(uint32_t size, const void* _data) override;
+        void SetData(const void* _data) override { SetData((uint32_t)data.size(), _data); }
+        void SetData(uint32_t size, const void* _data) override;
+        void SetDynamicData(uint32_t size, uint32_t typeSize, const void* _data) override { SetData(size, _data); }
+        uint8_t* GetBuffer() const override { return (uint8_t*)data.data(); }
+    };
+
+} // NekoEngine
@@ -0,0 +1,111 @@
+#include "NullCommandBuffer.h"
+#include "RHI/Pipeline.h"
+
+namespace NekoEngine
+{
+    void NullPassCounters::Add(const NullPassCounters& other)
+    {
+        pipelineBinds     += other.pipelineBinds;
+        descriptorBinds   += other.descriptorBinds;
+        vertexBufferBinds += other.vertexBufferBinds;
+        indexBufferBinds  += other.indexBufferBinds;
+        pushConstants     += other.pushConstants;
+        drawCalls         += other.drawCalls;
+        instances         += other.instances;
+        indices           += other.indices;
+        dispatches        += other.dispatches;
+        clears            += other.clears;
+        barriers          += other.barriers;
+        copies            += other.copies;
+    }
+
+    bool NullCommandBuffer::Init(bool _isPrimary)
+    {
+        isPrimary = _isPrimary;
+        return true;
+    }
+
+    void NullCommandBuffer::Unload()
+    {
+        passes.clear();
+        currentPass   = -1;
+        boundPipeline = nullptr;
+        isRecording   = false;
+    }
+
+    void NullCommandBuffer::BeginRecording()
+    {
+        passes.clear();
+        currentPass   = -1;
+        boundPipeline = nullptr;
+        isRecording   = true;
+    }
+
+    void NullCommandBuffer::BeginRecordingSecondary(RenderPass* renderPass, Framebuffer* framebuffer)
+    {
+        if(isPrimary)
+        {
+            RUNTIME_ERROR("Recording primary command buffer!");
+        }
+
+        BeginRecording();
+    }
+
+    void NullCommandBuffer::EndRecording()
+    {
+        isRecording = false;
+        currentPass = -1;
+    }
+
+    void NullCommandBuffer::ExecuteSecondary(CommandBuffer* primaryCmdBuffer)
+    {
+        if(isPrimary)
+        {
+            RUNTIME_ERROR("Executing primary command buffer!");
+        }
+
+        // Runs inside the primary's pass, which already counted beginning it
+        auto& counters = static_cast<NullCommandBuffer*>(primaryCmdBuffer)->GetCounters();
+        for(auto& pass : passes)
+            counters.Add(pass.counters);
+
+        passes.clear();
+    }
+
+    void NullCommandBuffer::BindPipeline(Pipeline* pipeline)
+    {
+        if(pipeline != boundPipeline)
+        {
+            if(boundPipeline)
+                boundPipeline->End(this);
+
+            pipeline->Bind(this);
+            boundPipeline = pipeline;
+        }
+    }
+
+    void NullCommandBuffer::BeginPass(const String& name, uint32_t layer)
+    {
+        auto& pass  = passes.emplace_back();
+        pass.name   = name;
+        pass.layer  = layer;
+        currentPass = (int32_t)passes.size() - 1;
+    }
+
+    void NullCommandBuffer::EndPass()
+    {
+        currentPass = -1;
+    }
+
+    NullPassCounters& NullCommandBuffer::GetCounters()
+    {
+        if(currentPass < 0)
+        {
+            passes.emplace_back();
+            currentPass = (int32_t)passes.size() - 1;
+        }
+
+        return passes[currentPass].counters;
+    }
+
+} // NekoEngine
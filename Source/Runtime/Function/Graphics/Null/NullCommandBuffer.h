@@ -0,0 +1,64 @@
+#pragma once
+#include "RHI/CommandBuffer.h"
+
+namespace NekoEngine
+{
+    // What a pass would have cost the driver, counted instead of recorded
+    struct NullPassCounters
+    {
+        uint32_t pipelineBinds     = 0;
+        uint32_t descriptorBinds   = 0;
+        uint32_t vertexBufferBinds = 0;
+        uint32_t indexBufferBinds  = 0;
+        uint32_t pushConstants     = 0;
+        uint32_t drawCalls         = 0;
+        uint32_t instances         = 0;
+        uint64_t indices           = 0;
+        uint32_t dispatches        = 0;
+        uint32_t clears            = 0;
+        uint32_t barriers          = 0;
+        uint32_t copies            = 0;
+
+        void Add(const NullPassCounters& other);
+    };
+
+    struct NullPassRecord
+    {
+        String name; // Debug name of the pipeline that began the pass
+        uint32_t layer = 0;
+        NullPassCounters counters;
+    };
+
+    class NullCommandBuffer : public CommandBuffer
+    {
+    private:
+        ArrayList<NullPassRecord> passes;
+        Pipeline* boundPipeline = nullptr;
+        int32_t currentPass     = -1;
+        bool isPrimary          = true;
+        bool isRecording        = false;
+
+    public:
+        NullCommandBuffer() = default;
+        ~NullCommandBuffer() override = default;
+
+        bool Init(bool _isPrimary) override;
+        void Unload() override;
+        void BeginRecording() override;
+        void BeginRecordingSecondary(RenderPass* renderPass, Framebuffer* framebuffer) override;
+        void EndRecording() override;
+        void ExecuteSecondary(CommandBuffer* primaryCmdBuffer) override;
+        void UpdateViewport(uint32_t width, uint32_t height, bool flipViewport) override {}
+        void BindPipeline(Pipeline* pipeline) override;
+        void UnBindPipeline() override {}
+
+        // Passes are opened by the pipelines, anything counted outside of one goes to an unnamed pass
+        void BeginPass(const String& name, uint32_t layer);
+        void EndPass();
+        NullPassCounters& GetCounters();
+
+        const ArrayList<NullPassRecord>& GetPasses() const { return passes; }
+        bool IsRecording() const { return isRecording; }
+    };
+
+} // NekoEngine
@@ -0,0 +1,23 @@
+#include "NullContext.h"
+#include "NullRenderer.h"
+#include "Engine.h"
+#include "ImGui/imgui.h"
+
+namespace NekoEngine
+{
+    NullContext gNullContext{};
+
+    void NullContext::OnImGui()
+    {
+        auto renderer = dynamic_cast<NullRenderer*>(gEngine->GetRenderer());
+        if(!renderer)
+            return;
+
+        const NullFrameStats& stats = renderer->GetLastFrameStats();
+        ImGui::Text("Null renderer, last frame");
+        ImGui::Text("Passes %u | Draws %u | Instances %u", (uint32_t)stats.passes.size(), stats.total.drawCalls, stats.total.instances);
+        ImGui::Text("Pipeline Binds %u | Descriptor Binds %u", stats.total.pipelineBinds, stats.total.descriptorBinds);
+        ImGui::Text("Uploaded %.1f KB in %u uploads", (double)stats.uploadedBytes / 1024.0, stats.uploads);
+    }
+
+} // NekoEngine
@@ -0,0 +1,23 @@
+#pragma once
+#include "RHI/GraphicsContext.h"
+
+namespace NekoEngine
+{
+    class NullContext : public GraphicsContext
+    {
+    public:
+        NullContext() = default;
+        ~NullContext() override = default;
+
+        void Init() override {}
+        void Present() override {}
+        void WaitIdle() const override {}
+        void OnImGui() override;
+
+        size_t GetMinUniformBufferOffsetAlignment() const override { return 256; }
+        bool FlipImGUITexture() const override { return true; }
+    };
+
+    extern NullContext gNullContext;
+
+} // NekoEngine
@@ -0,0 +1,210 @@
+#include "NullDescriptorSet.h"
+#include "NullRenderer.h"
+#include "RHI/Shader.h"
+
+namespace NekoEngine
+{
+    NullDescriptorSet::NullDescriptorSet(const DescriptorDesc &descriptorDesc)
+    {
+        m_Descriptors = descriptorDesc.shader->GetDescriptorInfo(descriptorDesc.layoutIndex);
+
+        for(auto &descriptor: m_Descriptors.descriptors)
+        {
+            if(descriptor.type == DescriptorType::UNIFORM_BUFFER || descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
+            {
+                UniformBufferData &info = m_UniformBuffersData[descriptor.name];
+                info.LocalStorage.Allocate(descriptor.size);
+                info.LocalStorage.InitialiseEmpty();
+                info.m_Members = descriptor.m_Members;
+            }
+            else if(descriptor.type == DescriptorType::STORAGE_BUFFER)
+            {
+                m_StorageBuffers[descriptor.name];
+            }
+        }
+
+        for(auto &descriptor: m_Descriptors.descriptors)
+        {
+            if(descriptor.type == DescriptorType::UNIFORM_BUFFER || descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
+                m_UniformBufferSlots.push_back(&m_UniformBuffersData[descriptor.name]);
+        }
+
+        NullRenderer::CountDescriptorSetCreated();
+    }
+
+    NullDescriptorSet::~NullDescriptorSet()
+    {
+        for(auto &bufferInfo: m_UniformBuffersData)
+            bufferInfo.second.LocalStorage.Release();
+    }
+
+    void NullDescriptorSet::Update(CommandBuffer* cmdBuffer)
+    {
+        bool updated = m_DescriptorDirty;
+        m_DescriptorDirty = false;
+
+        for(auto &bufferInfo: m_UniformBuffersData)
+        {
+            if(!bufferInfo.second.HasUpdated)
+                continue;
+
+            NullRenderer::CountUpload(bufferInfo.second.LocalStorage.GetSize());
+            bufferInfo.second.HasUpdated = false;
+            updated = true;
+        }
+
+        for(auto &bufferInfo: m_StorageBuffers)
+        {
+            if(!bufferInfo.second.HasUpdated || bufferInfo.second.LocalStorage.empty())
+                continue;
+
+            NullRenderer::CountUpload(bufferInfo.second.LocalStorage.size());
+            bufferInfo.second.HasUpdated = false;
+            updated = true;
+        }
+
+        if(updated)
+            NullRenderer::CountDescriptorSetUpdate();
+    }
+
+    void NullDescriptorSet::SetTexture(const std::string &name, Texture* texture, uint32_t mipIndex, TextureType textureType)
+    {
+        for(auto &descriptor: m_Descriptors.descriptors)
+        {
+            if((descriptor.type == DescriptorType::IMAGE_SAMPLER || descriptor.type == DescriptorType::IMAGE_STORAGE) &&
+               descriptor.name == name)
+            {
+                descriptor.texture      = texture;
+                descriptor.textureType  = textureType;
+                descriptor.textureCount = texture ? 1 : 0;
+                descriptor.mipLevel     = mipIndex;
+                m_DescriptorDirty       = true;
+            }
+        }
+    }
+
+    void NullDescriptorSet::SetTexture(const std::string &name, Texture** texture, uint32_t textureCount, TextureType textureType)
+    {
+        for(auto &descriptor: m_Descriptors.descriptors)
+        {
+            if((descriptor.type == DescriptorType::IMAGE_SAMPLER || descriptor.type == DescriptorType::IMAGE_STORAGE) &&
+               descriptor.name == name)
+            {
+                descriptor.textureCount = textureCount;
+                descriptor.textures     = texture;
+                descriptor.textureType  = textureType;
+                m_DescriptorDirty       = true;
+            }
+        }
+    }
+
+    UniformHandle NullDescriptorSet::GetUniformHandle(const std::string &bufferName, const std::string &uniformName)
+    {
+        UniformHandle handle;
+
+        auto itr = m_UniformBuffersData.find(bufferName);
+        if(itr == m_UniformBuffersData.end())
+            return handle;
+
+        uint32_t slot = 0;
+        while(slot < (uint32_t)m_UniformBufferSlots.size() && m_UniformBufferSlots[slot] != &itr->second)
+            slot++;
+
+        if(uniformName.empty())
+        {
+            handle.buffer = slot;
+            handle.size   = (uint32_t)itr->second.LocalStorage.GetSize();
+            return handle;
+        }
+
+        for(auto &member: itr->second.m_Members)
+        {
+            if(member.name == uniformName)
+            {
+                handle.buffer = slot;
+                handle.offset = member.offset;
+                handle.size   = member.size;
+                break;
+            }
+        }
+
+        return handle;
+    }
+
+    void NullDescriptorSet::SetUniform(const UniformHandle &handle, const void* data)
+    {
+        SetUniform(handle, data, handle.size);
+    }
+
+    void NullDescriptorSet::SetUniform(const UniformHandle &handle, const void* data, uint32_t size)
+    {
+        if(!handle.IsValid() || handle.buffer >= m_UniformBufferSlots.size())
+            return;
+
+        UniformBufferData* info = m_UniformBufferSlots[handle.buffer];
+        info->LocalStorage.Write((void*)data, size, handle.offset);
+        info->HasUpdated = true;
+    }
+
+    void NullDescriptorSet::SetUniform(const std::string &bufferName, const std::string &uniformName, void* data)
+    {
+        UniformHandle handle = GetUniformHandle(bufferName, uniformName);
+        if(handle.IsValid())
+        {
+            SetUniform(handle, data);
+            return;
+        }
+
+        LOG_FORMAT("Uniform not found %s.%s", bufferName.c_str(), uniformName.c_str());
+    }
+
+    void NullDescriptorSet::SetUniform(const std::string &bufferName, const std::string &uniformName, void* data, uint32_t size)
+    {
+        UniformHandle handle = GetUniformHandle(bufferName, uniformName);
+        if(handle.IsValid())
+        {
+            SetUniform(handle, data, size);
+            return;
+        }
+
+        LOG_FORMAT("Uniform not found %s.%s", bufferName.c_str(), uniformName.c_str());
+    }
+
+    void NullDescriptorSet::SetUniformBufferData(const std::string &bufferName, void* data)
+    {
+        UniformHandle handle = GetUniformHandle(bufferName);
+        if(handle.IsValid())
+        {
+            SetUniform(handle, data);
+            return;
+        }
+
+        LOG_FORMAT("Uniform not found %s", bufferName.c_str());
+    }
+
+    void NullDescriptorSet::SetUniformDynamic(const std::string &bufferName, uint32_t size)
+    {
+        auto itr = m_UniformBuffersData.find(bufferName);
+        if(itr != m_UniformBuffersData.end())
+        {
+            itr->second.LocalStorage.Allocate(size);
+            for(auto &member: itr->second.m_Members)
+                member.size = size;
+        }
+    }
+
+    void NullDescriptorSet::SetStorageBufferData(const std::string &bufferName, const void* data, uint32_t size)
+    {
+        auto itr = m_StorageBuffers.find(bufferName);
+        if(itr == m_StorageBuffers.end())
+        {
+            LOG_FORMAT("Storage buffer not found %s", bufferName.c_str());
+            return;
+        }
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        itr->second.LocalStorage.assign(bytes, bytes + size);
+        itr->second.HasUpdated = true;
+    }
+
+} // NekoEngine
@@ -0,0 +1,54 @@
+#pragma once
+#include "RHI/DescriptorSet.h"
+#include "Buffer.h"
+
+namespace NekoEngine
+{
+    // Keeps the same uniform storage and handle layout as the Vulkan set so callers behave identically.
+    // Update counts what would have been copied to the GPU and written into the set.
+    class NullDescriptorSet : public DescriptorSet
+    {
+    private:
+        struct UniformBufferData
+        {
+            std::vector<BufferMemberInfo> m_Members;
+            Buffer LocalStorage;
+            bool HasUpdated = false;
+        };
+
+        struct StorageBufferData
+        {
+            ArrayList<uint8_t> LocalStorage;
+            bool HasUpdated = false;
+        };
+
+        uint32_t m_DynamicOffset = 0;
+        DescriptorSetInfo m_Descriptors;
+        std::map<std::string, UniformBufferData> m_UniformBuffersData;
+        ArrayList<UniformBufferData*> m_UniformBufferSlots; // UniformHandle::buffer indexes this, in reflection order
+        std::map<std::string, StorageBufferData> m_StorageBuffers;
+        bool m_DescriptorDirty = true;
+
+    public:
+        NullDescriptorSet(const DescriptorDesc& descriptorDesc);
+        ~NullDescriptorSet() override;
+
+        void Update(CommandBuffer* cmdBuffer) override;
+        void SetTexture(const std::string& name, Texture* texture, uint32_t mipIndex, TextureType textureType) override;
+        void SetTexture(const std::string& name, Texture** texture, uint32_t textureCount, TextureType textureType) override;
+        void SetBuffer(const std::string& name, UniformBuffer* buffer) override {}
+        UniformBuffer* GetUnifromBuffer(const std::string& name) override { return nullptr; }
+        void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data) override;
+        void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data, uint32_t size) override;
+        void SetUniformBufferData(const std::string& bufferName, void* data) override;
+        UniformHandle GetUniformHandle(const std::string& bufferName, const std::string& uniformName = "") override;
+        void SetUniform(const UniformHandle& handle, const void* data) override;
+        void SetUniform(const UniformHandle& handle, const void* data, uint32_t size) override;
+
+        void SetDynamicOffset(uint32_t offset) override { m_DynamicOffset = offset; }
+        uint32_t GetDynamicOffset() const override { return m_DynamicOffset; }
+        void SetUniformDynamic(const std::string& bufferName, uint32_t size) override;
+        void SetStorageBufferData(const std::string& bufferName, const void* data, uint32_t size) override;
+    };
+
+} // NekoEngine
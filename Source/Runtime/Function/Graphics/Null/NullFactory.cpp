@@ -0,0 +1,110 @@
+#include "NullFactory.h"
+#include "NullShader.h"
+#include "File/VirtualFileSystem.h"
+#include "NullTexture.h"
+#include "NullDescriptorSet.h"
+#include "NullBuffer.h"
+#include "NullPipeline.h"
+#include "NullCommandBuffer.h"
+
+namespace NekoEngine
+{
+    Shader* NullFactory::CreateShader(const String filePath)
+    {
+        std::string physicalPath;
+        VirtualFileSystem::ResolvePhysicalPath(filePath, physicalPath, false);
+        return new NullShader(physicalPath);
+    }
+
+    Shader* NullFactory::CreateShaderFromEmbeddedArray(const uint32_t* vertData, uint32_t vertDataSize,
+                                                     const uint32_t* fragData, uint32_t fragDataSize)
+    {
+        return new NullShader(vertData, vertDataSize, fragData, fragDataSize);
+    }
+
+    Texture2D* NullFactory::CreateTexture2D(TextureDesc parameters, uint32_t width, uint32_t height)
+    {
+        return new NullTexture2D(parameters, width, height);
+    }
+
+    Texture2D*
+    NullFactory::CreateTexture2DFromSource(uint32_t width, uint32_t height, void* data, TextureDesc parameters,
+                                         TextureLoadOptions loadOptions)
+    {
+        return new NullTexture2D(width, height, data, parameters, loadOptions);
+    }
+
+    Texture2D*
+    NullFactory::CreateTexture2DFromFile(const std::string &name, const std::string &filepath, TextureDesc parameters,
+                                       TextureLoadOptions loadOptions)
+    {
+        return new NullTexture2D(name, filepath, parameters, loadOptions);
+    }
+
+    TextureDepth* NullFactory::CreateTextureDepth(uint32_t width, uint32_t height)
+    {
+        return new NullTextureDepth(width, height);
+    }
+
+    TextureDepthArray* NullFactory::CreateTextureDepthArray(uint32_t width, uint32_t height, uint32_t count)
+    {
+        return new NullTextureDepthArray(width, height, count);
+    }
+
+    TextureCube* NullFactory::CreateTextureCube(uint32_t size, void* data, bool isHDR)
+    {
+        return new NullTextureCube(size, data, isHDR);
+    }
+
+    TextureCube* NullFactory::CreateTextureCubeFromFile(const std::string &filepath)
+    {
+        return new NullTextureCube(filepath);
+    }
+
+    TextureCube* NullFactory::CreateTextureCubeFromFiles(const std::string* files)
+    {
+        return new NullTextureCube(files);
+    }
+
+    TextureCube* NullFactory::CreateTextureCubeFromVCross(const std::string* files, uint32_t mips, TextureDesc params,
+                                                        TextureLoadOptions loadOptions)
+    {
+        return new NullTextureCube(files, mips, params, loadOptions);
+    }
+
+    DescriptorSet* NullFactory::CreateDescriptor(const DescriptorDesc& desc)
+    {
+        return new NullDescriptorSet(desc);
+    }
+
+    IndexBuffer* NullFactory::CreateIndexBuffer(uint16_t* data, uint32_t count, BufferUsage bufferUsage)
+    {
+        return new NullIndexBuffer(data, count, bufferUsage);
+    }
+
+    IndexBuffer* NullFactory::CreateIndexBuffer(uint32_t* data, uint32_t count, BufferUsage bufferUsage)
+    {
+        return new NullIndexBuffer(data, count, bufferUsage);
+    }
+
+    Pipeline* NullFactory::CreatePipeline(const PipelineDesc &pipelineDesc)
+    {
+        return new NullPipeline(pipelineDesc);
+    }
+
+    VertexBuffer* NullFactory::CreateVertexBuffer(const BufferUsage& usage)
+    {
+        return new NullVertexBuffer(usage);
+    }
+
+    RenderPass* NullFactory::CreateRenderPass(const RenderPassDesc& renderPassDesc)
+    {
+        return new NullRenderPass(renderPassDesc);
+    }
+
+    CommandBuffer* NullFactory::CreateCommandBuffer()
+    {
+        return new NullCommandBuffer();
+    }
+
+} // NekoEngine
\ No newline at end of file
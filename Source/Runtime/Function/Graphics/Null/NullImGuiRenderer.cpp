@@ -0,0 +1,27 @@
+#include "NullImGuiRenderer.h"
+#include "NullTexture.h"
+#include "ImGui/imgui.h"
+
+namespace NekoEngine
+{
+    NullImGuiRenderer::~NullImGuiRenderer() = default;
+
+    void NullImGuiRenderer::Render(CommandBuffer* commandBuffer)
+    {
+        ImGui::Render();
+    }
+
+    void NullImGuiRenderer::RebuildFontTexture()
+    {
+        ImGuiIO &io = ImGui::GetIO();
+
+        unsigned char* pixels;
+        int width, height;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+        m_FontTexture = MakeUnique<NullTexture2D>(width, height, pixels,
+                                                  TextureDesc(TextureFilter::NEAREST, TextureFilter::NEAREST, TextureWrap::REPEAT));
+        io.Fonts->TexID = (ImTextureID) m_FontTexture->GetHandle();
+    }
+
+} // NekoEngine
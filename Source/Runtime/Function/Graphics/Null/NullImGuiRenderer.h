@@ -0,0 +1,26 @@
+#pragma once
+#include "RHI/ImGuiRenderer.h"
+
+namespace NekoEngine
+{
+    class NullTexture2D;
+
+    // Builds ImGui's draw lists every frame like the Vulkan renderer does, then drops them
+    class NullImGuiRenderer : public ImGuiRenderer
+    {
+    private:
+        UniquePtr<NullTexture2D> m_FontTexture;
+
+    public:
+        NullImGuiRenderer() = default;
+        ~NullImGuiRenderer() override;
+
+        void Init() override { RebuildFontTexture(); }
+        void NewFrame() override {}
+        void Render(CommandBuffer* commandBuffer) override;
+        void OnResize(uint32_t width, uint32_t height) override {}
+        bool Implemented() const override { return true; }
+        void RebuildFontTexture() override;
+    };
+
+} // NekoEngine
@@ -0,0 +1,73 @@
+#include "NullPipeline.h"
+#include "NullCommandBuffer.h"
+#include "NullRenderer.h"
+#include "Engine.h"
+
+namespace NekoEngine
+{
+    NullPipeline::NullPipeline(const PipelineDesc& _pipelineDesc)
+    {
+        pipelineDesc            = _pipelineDesc;
+        shader                  = pipelineDesc.shader;
+        isDepthBiasEnabled      = pipelineDesc.isDepthBiasEnabled;
+        depthBiasConstantFactor = pipelineDesc.depthBiasConstantFactor;
+        depthBiasSlopeFactor    = pipelineDesc.depthBiasSlopeFactor;
+
+        auto shaderTypes = shader ? shader->GetShaderTypes() : ArrayList<ShaderType>();
+        isCompute        = !shaderTypes.empty() && shaderTypes[0] == ShaderType::COMPUTE;
+
+        NullRenderer::CountPipelineCreated();
+    }
+
+    void NullPipeline::Bind(CommandBuffer* commandBuffer, uint32_t layer)
+    {
+        auto nullCommandBuffer = static_cast<NullCommandBuffer*>(commandBuffer);
+        nullCommandBuffer->BeginPass(pipelineDesc.DebugName, layer);
+        nullCommandBuffer->GetCounters().pipelineBinds++;
+    }
+
+    void NullPipeline::End(CommandBuffer* commandBuffer)
+    {
+        static_cast<NullCommandBuffer*>(commandBuffer)->EndPass();
+    }
+
+    void NullPipeline::BeginSecondary(CommandBuffer* primaryCommandBuffer, uint32_t layer)
+    {
+        if(isCompute)
+            return;
+
+        static_cast<NullCommandBuffer*>(primaryCommandBuffer)->BeginPass(pipelineDesc.DebugName, layer);
+    }
+
+    void NullPipeline::BindSecondary(CommandBuffer* secondaryCommandBuffer, uint32_t layer)
+    {
+        auto nullCommandBuffer = static_cast<NullCommandBuffer*>(secondaryCommandBuffer);
+        nullCommandBuffer->BeginRecordingSecondary(nullptr, nullptr);
+        nullCommandBuffer->BeginPass(pipelineDesc.DebugName, layer);
+        nullCommandBuffer->GetCounters().pipelineBinds++;
+    }
+
+    void NullPipeline::ClearRenderTargets(CommandBuffer* commandBuffer)
+    {
+        auto renderer = gEngine->GetRenderer();
+
+        if(pipelineDesc.isSwapChainTarget)
+        {
+            for(int i = 0; i < GET_SWAP_CHAIN()->GetSwapChainBufferCount(); i++)
+                renderer->ClearRenderTarget(GET_SWAP_CHAIN()->GetImage(i), commandBuffer, pipelineDesc.clearColor);
+        }
+
+        if(pipelineDesc.depthArrayTarget)
+            renderer->ClearRenderTarget(pipelineDesc.depthArrayTarget, commandBuffer, pipelineDesc.clearColor);
+
+        if(pipelineDesc.depthTarget)
+            renderer->ClearRenderTarget(pipelineDesc.depthTarget, commandBuffer, pipelineDesc.clearColor);
+
+        for(auto texture : pipelineDesc.colourTargets)
+        {
+            if(texture != nullptr)
+                renderer->ClearRenderTarget(texture, commandBuffer, pipelineDesc.clearColor);
+        }
+    }
+
+} // NekoEngine
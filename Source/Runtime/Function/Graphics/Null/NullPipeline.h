@@ -0,0 +1,37 @@
+#pragma once
+#include "RHI/Pipeline.h"
+#include "RHI/RenderPass.h"
+
+namespace NekoEngine
+{
+    // Every bind begins a counted pass named after PipelineDesc::DebugName
+    class NullPipeline : public Pipeline
+    {
+    public:
+        NullPipeline(const PipelineDesc& pipelineDesc);
+        ~NullPipeline() override = default;
+
+        void Bind(CommandBuffer* commandBuffer, uint32_t layer) override;
+        void End(CommandBuffer* commandBuffer) override;
+        void BeginSecondary(CommandBuffer* primaryCommandBuffer, uint32_t layer) override;
+        void BindSecondary(CommandBuffer* secondaryCommandBuffer, uint32_t layer) override;
+        void ClearRenderTargets(CommandBuffer* commandBuffer) override;
+
+        SharedPtr<Shader> GetShader() const override { return shader; }
+    };
+
+    class NullRenderPass : public RenderPass
+    {
+    private:
+        int attachmentCount = 0;
+
+    public:
+        NullRenderPass(const RenderPassDesc& renderPassDesc) : attachmentCount((int)renderPassDesc.attachmentCount) {}
+        ~NullRenderPass() override = default;
+
+        void BeginRenderpass(CommandBuffer* commandBuffer, Color clearColour, Framebuffer* frame, SubPassContents contents, uint32_t width, uint32_t height) const override {}
+        void EndRenderpass(CommandBuffer* commandBuffer) override {}
+        int GetAttachmentCount() const override { return attachmentCount; }
+    };
+
+} // NekoEngine
@@ -0,0 +1,158 @@
+#include "NullRenderer.h"
+#include "NullFactory.h"
+#include "NullSwapChain.h"
+#include "Engine.h"
+#include <atomic>
+
+namespace NekoEngine
+{
+    static std::atomic<uint64_t> s_UploadedBytes         = 0;
+    static std::atomic<uint32_t> s_Uploads               = 0;
+    static std::atomic<uint32_t> s_DescriptorSetUpdates  = 0;
+    static std::atomic<uint32_t> s_PipelinesCreated      = 0;
+    static std::atomic<uint32_t> s_DescriptorSetsCreated = 0;
+
+    static NullCommandBuffer* AsNull(CommandBuffer* commandBuffer)
+    {
+        return static_cast<NullCommandBuffer*>(commandBuffer);
+    }
+
+    void NullRenderer::Init(bool loadEmbeddedShaders)
+    {
+        LOG("Initializing Null Renderer");
+
+        capabilities.Vendor               = "None";
+        capabilities.Renderer             = "NullRenderer";
+        capabilities.Version              = "1.0";
+        capabilities.MaxSamples           = 1;
+        capabilities.MaxAnisotropy        = 16.0f;
+        capabilities.MaxTextureUnits      = 32;
+        capabilities.UniformBufferOffsetAlignment = (int)gNullContext.GetMinUniformBufferOffsetAlignment();
+        capabilities.SupportCompute       = true;
+        capabilities.TextureCompressionBC = true;
+        capabilities.SupportTextureCopy   = true;
+
+        shaderLibrary = MakeShared<ShaderLibrary>();
+        rhiFactory    = MakeShared<NullFactory>();
+
+        LoadEngineShaders(loadEmbeddedShaders);
+    }
+
+    void NullRenderer::Begin()
+    {
+        static_cast<NullSwapChain*>(GET_SWAP_CHAIN())->Begin();
+    }
+
+    void NullRenderer::Present()
+    {
+        auto swapChain     = static_cast<NullSwapChain*>(GET_SWAP_CHAIN());
+        auto commandBuffer = AsNull(swapChain->GetCurrentCommandBuffer());
+        swapChain->End();
+
+        lastFrameStats.passes = commandBuffer->GetPasses();
+        lastFrameStats.total  = NullPassCounters();
+        for(auto &pass: lastFrameStats.passes)
+            lastFrameStats.total.Add(pass.counters);
+
+        // Uploads made while loading count towards the first frame
+        lastFrameStats.uploadedBytes         = s_UploadedBytes.exchange(0);
+        lastFrameStats.uploads               = s_Uploads.exchange(0);
+        lastFrameStats.descriptorSetUpdates  = s_DescriptorSetUpdates.exchange(0);
+        lastFrameStats.pipelinesCreated      = s_PipelinesCreated.exchange(0);
+        lastFrameStats.descriptorSetsCreated = s_DescriptorSetsCreated.exchange(0);
+
+        totalUploadedBytes += lastFrameStats.uploadedBytes;
+        frameCount++;
+    }
+
+    void NullRenderer::ClearRenderTarget(Texture* texture, CommandBuffer* commandBuffer, Color clearColour)
+    {
+        if(commandBuffer)
+            AsNull(commandBuffer)->GetCounters().clears++;
+    }
+
+    uint32_t NullRenderer::TransitionTextures(const TextureBarrier* barriers, uint32_t count, CommandBuffer* commandBuffer)
+    {
+        // Textures keep no layout here, so every barrier that names a state counts as recorded
+        uint32_t recorded = 0;
+        for(uint32_t i = 0; i < count; i++)
+        {
+            if(barriers[i].texture && barriers[i].state != ResourceState::Undefined)
+                recorded++;
+        }
+
+        if(commandBuffer)
+            AsNull(commandBuffer)->GetCounters().barriers += recorded;
+
+        return recorded;
+    }
+
+    void NullRenderer::CopyTextureLayer(Texture* source, Texture* destination, uint32_t layer, CommandBuffer* commandBuffer)
+    {
+        if(commandBuffer)
+            AsNull(commandBuffer)->GetCounters().copies++;
+    }
+
+    void NullRenderer::OnResize(uint32_t height, uint32_t width)
+    {
+        // The engine passes (width, height) despite the parameter names
+        static_cast<NullSwapChain*>(GET_SWAP_CHAIN())->OnResize(height, width);
+    }
+
+    void NullRenderer::BindDescriptorSets(Pipeline* pipeline, CommandBuffer* commandBuffer, uint32_t dynamicOffset,
+                                          DescriptorSet** descriptorSets, uint32_t descriptorCount)
+    {
+        AsNull(commandBuffer)->GetCounters().descriptorBinds++;
+    }
+
+    void NullRenderer::Draw(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices)
+    {
+        auto &counters = AsNull(commandBuffer)->GetCounters();
+        counters.drawCalls++;
+        counters.instances++;
+    }
+
+    void NullRenderer::DrawIndexed(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start)
+    {
+        auto &counters = AsNull(commandBuffer)->GetCounters();
+        counters.drawCalls++;
+        counters.instances++;
+        counters.indices += count;
+    }
+
+    void NullRenderer::DrawIndexedInstanced(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t instanceCount,
+                                            uint32_t start, uint32_t firstInstance)
+    {
+        auto &counters = AsNull(commandBuffer)->GetCounters();
+        counters.drawCalls++;
+        counters.instances += instanceCount;
+        counters.indices   += uint64_t(count) * instanceCount;
+    }
+
+    void NullRenderer::Dispatch(CommandBuffer* commandBuffer, uint32_t workGroupSizeX, uint32_t workGroupSizeY, uint32_t workGroupSizeZ)
+    {
+        AsNull(commandBuffer)->GetCounters().dispatches++;
+    }
+
+    void NullRenderer::CountUpload(uint64_t size)
+    {
+        s_UploadedBytes += size;
+        s_Uploads++;
+    }
+
+    void NullRenderer::CountDescriptorSetUpdate()
+    {
+        s_DescriptorSetUpdates++;
+    }
+
+    void NullRenderer::CountPipelineCreated()
+    {
+        s_PipelinesCreated++;
+    }
+
+    void NullRenderer::CountDescriptorSetCreated()
+    {
+        s_DescriptorSetsCreated++;
+    }
+
+} // NekoEngine
@@ -0,0 +1,62 @@
+#pragma once
+#include "RHI/Renderer.h"
+#include "NullCommandBuffer.h"
+#include "NullContext.h"
+
+namespace NekoEngine
+{
+    // Counters of one presented frame. Passes are in the order they were begun, a pass recorded over
+    // several secondary command buffers is still one pass.
+    struct NullFrameStats
+    {
+        ArrayList<NullPassRecord> passes;
+        NullPassCounters total;
+
+        uint64_t uploadedBytes         = 0; // Buffer, uniform and texture data handed to the backend
+        uint32_t uploads               = 0;
+        uint32_t descriptorSetUpdates  = 0; // Descriptor sets that had dirty uniforms or storage to write
+        uint32_t pipelinesCreated      = 0;
+        uint32_t descriptorSetsCreated = 0;
+    };
+
+    // Renderer for RENDER_API::NONE. Nothing reaches a GPU, every command is counted on the command buffer
+    // it was recorded into and uploads are counted as they happen, so the CPU side of the renderer can be
+    // profiled on machines without one. Shaders are still reflected from their SPIR-V, the scene renderer
+    // needs their layouts.
+    class NullRenderer : public Renderer
+    {
+    private:
+        NullFrameStats lastFrameStats;
+        uint64_t totalUploadedBytes = 0;
+        uint32_t frameCount = 0;
+
+    public:
+        NullRenderer() = default;
+        ~NullRenderer() override = default;
+
+        void Init(bool loadEmbeddedShaders = false) override;
+        void Begin() override;
+        void Present() override;
+        void ClearRenderTarget(Texture* texture, CommandBuffer* commandBuffer, Color clearColour) override;
+        uint32_t TransitionTextures(const TextureBarrier* barriers, uint32_t count, CommandBuffer* commandBuffer) override;
+        void CopyTextureLayer(Texture* source, Texture* destination, uint32_t layer, CommandBuffer* commandBuffer) override;
+        void OnResize(uint32_t height, uint32_t width) override;
+        void BindDescriptorSets(Pipeline* pipeline, CommandBuffer* commandBuffer, uint32_t dynamicOffset, DescriptorSet** descriptorSets, uint32_t descriptorCount) override;
+        void Draw(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType = DataType::UNSIGNED_INT, void* indices = nullptr) override;
+        void DrawIndexed(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start = 0) override;
+        void DrawIndexedInstanced(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t instanceCount, uint32_t start = 0, uint32_t firstInstance = 0) override;
+        void Dispatch(CommandBuffer* commandBuffer, uint32_t workGroupSizeX, uint32_t workGroupSizeY, uint32_t workGroupSizeZ) override;
+
+        GraphicsContext* GetGraphicsContext() const override { return &gNullContext; }
+
+        const NullFrameStats& GetLastFrameStats() const { return lastFrameStats; }
+        uint64_t GetTotalUploadedBytes() const { return totalUploadedBytes; }
+
+        // Safe to call from any thread, resources are created and filled on jobs too
+        static void CountUpload(uint64_t size);
+        static void CountDescriptorSetUpdate();
+        static void CountPipelineCreated();
+        static void CountDescriptorSetCreated();
+    };
+
+} // NekoEngine
@@ -0,0 +1,258 @@
+#include "NullShader.h"
+#include "NullCommandBuffer.h"
+#include "StringUtility.h"
+#include "File/VirtualFileSystem.h"
+#include "File/FileSystem.h"
+#include "Hash.h"
+#include "Renderable/Material.h"
+#include "SPIRV-Cross/spirv_cross.hpp"
+
+namespace NekoEngine
+{
+    static ShaderDataType SPIRVTypeToDataType(const spirv_cross::SPIRType &type)
+    {
+        switch(type.basetype)
+        {
+            case spirv_cross::SPIRType::Boolean:
+                return ShaderDataType::BOOL;
+            case spirv_cross::SPIRType::Int:
+                if(type.vecsize == 2)
+                    return ShaderDataType::IVEC2;
+                if(type.vecsize == 3)
+                    return ShaderDataType::IVEC3;
+                if(type.vecsize == 4)
+                    return ShaderDataType::IVEC4;
+                return ShaderDataType::INT;
+            case spirv_cross::SPIRType::UInt:
+                return ShaderDataType::UINT;
+            case spirv_cross::SPIRType::Float:
+                if(type.columns == 3)
+                    return ShaderDataType::MAT3;
+                if(type.columns == 4)
+                    return ShaderDataType::MAT4;
+                if(type.vecsize == 2)
+                    return ShaderDataType::VEC2;
+                if(type.vecsize == 3)
+                    return ShaderDataType::VEC3;
+                if(type.vecsize == 4)
+                    return ShaderDataType::VEC4;
+                return ShaderDataType::FLOAT32;
+            case spirv_cross::SPIRType::Struct:
+                return ShaderDataType::STRUCT;
+            default:
+                return ShaderDataType::NONE;
+        }
+    }
+
+    NullShader::NullShader(const String &_filePath)
+    {
+        name     = StringUtility::GetFileName(_filePath);
+        filePath = StringUtility::GetFileLocation(_filePath);
+        source   = VirtualFileSystem::ReadTextFile(_filePath);
+
+        if(source.empty())
+        {
+            LOG_FORMAT("Failed to read shader source from file: %s", _filePath.c_str());
+            return;
+        }
+
+        // Same layout as the Vulkan .shader files, one "#shader <stage> <file>" line per stage
+        Map<ShaderType, String> shaderFiles;
+        ShaderType type = ShaderType::UNKNOWN;
+        for(auto &line: StringUtility::GetLines(source))
+        {
+            String stripped = StringUtility::StringReplace(line, '\t');
+            if(StringUtility::StartsWith(stripped, "#shader"))
+            {
+                if(StringUtility::StringContains(stripped, "vertex"))
+                    type = ShaderType::VERTEX;
+                else if(StringUtility::StringContains(stripped, "geometry"))
+                    type = ShaderType::GEOMETRY;
+                else if(StringUtility::StringContains(stripped, "fragment"))
+                    type = ShaderType::FRAGMENT;
+                else if(StringUtility::StringContains(stripped, "tess_cont"))
+                    type = ShaderType::TESSELLATION_CONTROL;
+                else if(StringUtility::StringContains(stripped, "tess_eval"))
+                    type = ShaderType::TESSELLATION_EVALUATION;
+                else if(StringUtility::StringContains(stripped, "compute"))
+                    type = ShaderType::COMPUTE;
+                else
+                    type = ShaderType::UNKNOWN;
+
+                if(type != ShaderType::UNKNOWN)
+                    shaderFiles[type] = "";
+            }
+            else if(type != ShaderType::UNKNOWN)
+            {
+                shaderFiles[type].append(line);
+            }
+        }
+
+        HashCombine(hash, name);
+        uint32_t loadedStages = 0;
+        for(auto &file: shaderFiles)
+        {
+            shaderTypes.push_back(file.first);
+            stageCount++;
+
+            HashCombine(hash, filePath + file.second);
+            uint32_t fileSize = uint32_t(FileSystem::GetFileSize(filePath + file.second));
+            uint32_t* spirv = reinterpret_cast<uint32_t*>(FileSystem::ReadFile(filePath + file.second));
+            if(spirv)
+            {
+                Reflect(spirv, fileSize, file.first);
+                loadedStages++;
+                delete[] spirv;
+            }
+        }
+
+        isCompiled = !shaderFiles.empty() && loadedStages == stageCount;
+        if(!isCompiled)
+            LOG_FORMAT("Failed to load shader %s", name.c_str());
+    }
+
+    NullShader::NullShader(const uint32_t* vertData, uint32_t vertDataSize, const uint32_t* fragData, uint32_t fragDataSize)
+    {
+        filePath    = "Embedded";
+        shaderTypes = {ShaderType::VERTEX, ShaderType::FRAGMENT};
+        stageCount  = 2;
+
+        Reflect(vertData, vertDataSize, ShaderType::VERTEX);
+        Reflect(fragData, fragDataSize, ShaderType::FRAGMENT);
+
+        HashCombine(hash, name, vertData, vertDataSize, fragData, fragDataSize);
+        isCompiled = true;
+    }
+
+    NullShader::~NullShader()
+    {
+        for(auto &pc: pushConstants)
+            delete[] pc.data;
+    }
+
+    void NullShader::BindPushConstants(CommandBuffer* commandBuffer, Pipeline* pipeline)
+    {
+        static_cast<NullCommandBuffer*>(commandBuffer)->GetCounters().pushConstants += (uint32_t)pushConstants.size();
+    }
+
+    void NullShader::BindPushConstant(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t index, const void* data)
+    {
+        static_cast<NullCommandBuffer*>(commandBuffer)->GetCounters().pushConstants++;
+    }
+
+    void NullShader::Reflect(const uint32_t* data, uint32_t size, ShaderType shaderType)
+    {
+        spirv_cross::Compiler comp(std::vector<uint32_t>(data, data + size / sizeof(uint32_t)));
+        spirv_cross::ShaderResources resources = comp.get_shader_resources();
+
+        auto reflectMembers = [&](const spirv_cross::Resource &u, const String &blockName, std::vector<BufferMemberInfo> &members)
+        {
+            auto &bufferType = comp.get_type(u.base_type_id);
+            for(uint32_t i = 0; i < (uint32_t)bufferType.member_types.size(); i++)
+            {
+                auto &member    = members.emplace_back();
+                member.name     = comp.get_member_name(bufferType.self, i);
+                member.fullName = blockName + "." + member.name;
+                member.size     = (uint32_t)comp.get_declared_struct_member_size(bufferType, i);
+                member.offset   = comp.type_struct_member_offset(bufferType, i);
+                member.type     = SPIRVTypeToDataType(comp.get_type(bufferType.member_types[i]));
+            }
+        };
+
+        auto arrayCount = [&](const spirv_cross::Resource &u)
+        {
+            auto &type = comp.get_type(u.type_id);
+            return type.array.size() ? uint32_t(type.array[0]) : 1u;
+        };
+
+        if(shaderType == ShaderType::VERTEX)
+        {
+            // Only the strides are needed, inputs named inInstance* step per instance from binding 1
+            for(const spirv_cross::Resource &resource: resources.stage_inputs)
+            {
+                auto &inputType = comp.get_type(resource.type_id);
+                uint32_t size   = inputType.width / 8 * inputType.vecsize * std::max(1u, inputType.columns);
+                if(resource.name.rfind("inInstance", 0) == 0)
+                    instanceInputStride += size;
+                else
+                    vertexInputStride += size;
+            }
+        }
+
+        for(auto &u: resources.uniform_buffers)
+        {
+            uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+            uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
+
+            // Must agree with the Vulkan shader, material constants are dynamic
+            const DescriptorType uniformType = set == DESCRIPTOR_SET_MATERIAL ? DescriptorType::UNIFORM_BUFFER_DYNAMIC
+                                                                              : DescriptorType::UNIFORM_BUFFER;
+            descriptorLayoutInfos.push_back({ uniformType, shaderType, binding, set, arrayCount(u) });
+
+            auto &descriptor      = descriptorSetInfos[set].descriptors.emplace_back();
+            descriptor.binding    = binding;
+            descriptor.size       = (uint32_t)comp.get_declared_struct_size(comp.get_type(u.base_type_id));
+            descriptor.name       = u.name;
+            descriptor.offset     = 0;
+            descriptor.shaderType = shaderType;
+            descriptor.type       = uniformType;
+            descriptor.buffer     = nullptr;
+            reflectMembers(u, u.name, descriptor.m_Members);
+        }
+
+        for(auto &u: resources.push_constant_buffers)
+        {
+            uint32_t size = 0;
+            for(auto &range: comp.get_active_buffer_ranges(u.id))
+                size += uint32_t(range.range);
+
+            pushConstants.push_back({ size, shaderType });
+            pushConstants.back().data = new uint8_t[size];
+            reflectMembers(u, u.name, pushConstants.back().m_Members);
+        }
+
+        for(auto &u: resources.sampled_images)
+        {
+            uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+            uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
+            descriptorLayoutInfos.push_back({ DescriptorType::IMAGE_SAMPLER, shaderType, binding, set, arrayCount(u) });
+
+            auto &descriptor        = descriptorSetInfos[set].descriptors.emplace_back();
+            descriptor.binding      = binding;
+            descriptor.textureCount = 1;
+            descriptor.name         = u.name;
+            descriptor.texture      = Material::GetDefaultTexture().get();
+        }
+
+        for(auto &u: resources.storage_images)
+        {
+            uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+            uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
+            descriptorLayoutInfos.push_back({ DescriptorType::IMAGE_STORAGE, shaderType, binding, set, arrayCount(u) });
+
+            auto &descriptor        = descriptorSetInfos[set].descriptors.emplace_back();
+            descriptor.type         = DescriptorType::IMAGE_STORAGE;
+            descriptor.binding      = binding;
+            descriptor.textureCount = 1;
+            descriptor.name         = u.name;
+            descriptor.texture      = Material::GetDefaultTexture().get();
+        }
+
+        for(auto &u: resources.storage_buffers)
+        {
+            uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+            uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
+            descriptorLayoutInfos.push_back({ DescriptorType::STORAGE_BUFFER, shaderType, binding, set, arrayCount(u) });
+
+            auto &descriptor      = descriptorSetInfos[set].descriptors.emplace_back();
+            descriptor.type       = DescriptorType::STORAGE_BUFFER;
+            descriptor.binding    = binding;
+            descriptor.size       = (uint32_t)comp.get_declared_struct_size(comp.get_type(u.base_type_id));
+            descriptor.offset     = 0;
+            descriptor.name       = u.name;
+            descriptor.shaderType = shaderType;
+            descriptor.buffer     = nullptr;
+        }
+    }
+
+} // NekoEngine
@@ -0,0 +1,37 @@
+#pragma once
+#include "RHI/Shader.h"
+
+namespace NekoEngine
+{
+    // Reflects the same SPIR-V the Vulkan shader loads, so descriptor sets and push constants have their
+    // real layouts, but creates no modules or pipeline layouts
+    class NullShader : public Shader
+    {
+    public:
+        NullShader(const String& filePath);
+        NullShader(const uint32_t* vertData, uint32_t vertDataSize, const uint32_t* fragData, uint32_t fragDataSize);
+        ~NullShader() override;
+
+        void Bind() const override {}
+        void UnBind() const override {}
+
+        ArrayList<PushConstant>& GetPushConstants() override { return pushConstants; }
+        void BindPushConstants(CommandBuffer* commandBuffer, Pipeline* pipeline) override;
+        void BindPushConstant(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t index, const void* data) override;
+
+        DescriptorSetInfo GetDescriptorInfo(uint32_t index) override
+        {
+            if(descriptorSetInfos.find(index) != descriptorSetInfos.end())
+                return descriptorSetInfos.at(index);
+
+            LOG_FORMAT("DescriptorDesc not found. Index = %d", index);
+            return DescriptorSetInfo();
+        }
+
+        bool IsCompute() const { return !shaderTypes.empty() && shaderTypes[0] == ShaderType::COMPUTE; }
+
+    private:
+        void Reflect(const uint32_t* data, uint32_t size, ShaderType type);
+    };
+
+} // NekoEngine
@@ -0,0 +1,96 @@
+#include "NullSwapChain.h"
+#include "NullCommandBuffer.h"
+#include "NullTexture.h"
+
+namespace NekoEngine
+{
+    NullSwapChain::NullSwapChain(uint32_t _width, uint32_t _height)
+    {
+        width  = _width;
+        height = _height;
+    }
+
+    NullSwapChain::~NullSwapChain()
+    {
+        for(uint32_t i = 0; i < BufferCount; i++)
+        {
+            bufferData[i].MainCommandBuffer.reset();
+            bufferData[i].SecondaryCommandBuffers.clear();
+            images[i].reset();
+        }
+    }
+
+    bool NullSwapChain::Init(bool vsync)
+    {
+        isVSync = vsync;
+
+        TextureDesc desc;
+        desc.format = RHIFormat::R8G8B8A8_Unorm;
+        desc.flags  = TextureFlags::Texture_RenderTarget;
+
+        for(uint32_t i = 0; i < BufferCount; i++)
+        {
+            bufferData[i].MainCommandBuffer = MakeShared<NullCommandBuffer>();
+            bufferData[i].MainCommandBuffer->Init(true);
+            images[i] = MakeShared<NullTexture2D>(desc, width, height);
+        }
+
+        return true;
+    }
+
+    bool NullSwapChain::Init(bool vsync, Window* window)
+    {
+        return Init(vsync);
+    }
+
+    Texture* NullSwapChain::GetCurrentImage()
+    {
+        return images[currentBufferIndex].get();
+    }
+
+    Texture* NullSwapChain::GetImage(uint32_t index)
+    {
+        return images[index].get();
+    }
+
+    CommandBuffer* NullSwapChain::GetCurrentCommandBuffer()
+    {
+        return bufferData[currentBufferIndex].MainCommandBuffer.get();
+    }
+
+    CommandBuffer* NullSwapChain::GetSecondaryCommandBuffer(uint32_t index)
+    {
+        auto& secondaries = bufferData[currentBufferIndex].SecondaryCommandBuffers;
+        while(secondaries.size() <= index)
+        {
+            auto commandBuffer = MakeShared<NullCommandBuffer>();
+            commandBuffer->Init(false);
+            secondaries.push_back(commandBuffer);
+        }
+
+        return secondaries[index].get();
+    }
+
+    void NullSwapChain::Begin()
+    {
+        currentBufferIndex = (currentBufferIndex + 1) % BufferCount;
+        bufferData[currentBufferIndex].MainCommandBuffer->BeginRecording();
+    }
+
+    void NullSwapChain::End()
+    {
+        bufferData[currentBufferIndex].MainCommandBuffer->EndRecording();
+    }
+
+    void NullSwapChain::OnResize(uint32_t _width, uint32_t _height)
+    {
+        if(width == _width && height == _height)
+            return;
+
+        width  = _width;
+        height = _height;
+        for(uint32_t i = 0; i < BufferCount; i++)
+            images[i]->Resize(width, height);
+    }
+
+} // NekoEngine
@@ -0,0 +1,49 @@
+#pragma once
+#include "RHI/SwapChain.h"
+
+namespace NekoEngine
+{
+    class NullCommandBuffer;
+    class NullTexture2D;
+
+    class NullSwapChain : public SwapChain
+    {
+    public:
+        static constexpr uint32_t BufferCount = 3;
+
+    private:
+        struct BufferData
+        {
+            SharedPtr<NullCommandBuffer> MainCommandBuffer;
+            ArrayList<SharedPtr<NullCommandBuffer>> SecondaryCommandBuffers;
+        };
+
+        uint32_t width;
+        uint32_t height;
+        bool isVSync = false;
+
+        BufferData bufferData[BufferCount];
+        SharedPtr<NullTexture2D> images[BufferCount];
+        uint32_t currentBufferIndex = 0;
+
+    public:
+        NullSwapChain(uint32_t _width, uint32_t _height);
+        ~NullSwapChain() override;
+
+        bool Init(bool vsync) override;
+        bool Init(bool vsync, Window* window) override;
+        Texture* GetCurrentImage() override;
+        Texture* GetImage(uint32_t index) override;
+        uint32_t GetCurrentBufferIndex() const override { return currentBufferIndex; }
+        uint32_t GetCurrentImageIndex() const override { return currentBufferIndex; }
+        size_t GetSwapChainBufferCount() const override { return BufferCount; }
+        CommandBuffer* GetCurrentCommandBuffer() override;
+        CommandBuffer* GetSecondaryCommandBuffer(uint32_t index) override;
+        void SetVSync(bool vsync) override { isVSync = vsync; }
+
+        void Begin();
+        void End();
+        void OnResize(uint32_t width, uint32_t height);
+    };
+
+} // NekoEngine
@@ -0,0 +1,212 @@
+#include "NullTexture.h"
+#include "NullRenderer.h"
+#include "File/ImageLoader.h"
+#include "File/KTX2.h"
+#include "Math/Maths.h"
+
+namespace NekoEngine
+{
+    // Reads a file the way the Vulkan textures do, so decode time still shows up, and counts what would
+    // have been uploaded. Returns false if the file could not be read.
+    static bool LoadAndCountFile(const String &fileName, uint32_t* width, uint32_t* height, uint32_t* bits)
+    {
+        if(KTX2::IsKTX2File(fileName))
+        {
+            KTX2::Image ktx;
+            if(!KTX2::Load(fileName, ktx))
+            {
+                LOG_FORMAT("[Texture] Could not load %s", fileName.c_str());
+                return false;
+            }
+
+            uint64_t size = 0;
+            for(const KTX2::Level &level : ktx.levels)
+                size += level.size;
+
+            *width  = ktx.width;
+            *height = ktx.height;
+            *bits   = 32;
+            NullRenderer::CountUpload(size);
+            KTX2::Free(ktx);
+            return true;
+        }
+
+        uint8_t* pixels = ImageLoader::LoadImageFromFile(fileName, width, height, bits);
+        if(pixels == nullptr)
+        {
+            LOG_FORMAT("[Texture] Could not load %s", fileName.c_str());
+            return false;
+        }
+
+        NullRenderer::CountUpload(uint64_t(*width) * *height * *bits / 8);
+        delete[] pixels;
+        return true;
+    }
+
+    NullTexture2D::NullTexture2D(TextureDesc parameters, uint32_t width, uint32_t height)
+    {
+        this->width  = width;
+        this->height = height;
+        this->params = parameters;
+        rhiFormat    = parameters.format;
+        flags        = parameters.flags;
+        m_UUID       = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    NullTexture2D::NullTexture2D(uint32_t width, uint32_t height, void* data, TextureDesc parameters, TextureLoadOptions loadOptions)
+    {
+        Load(width, height, data, parameters, loadOptions);
+    }
+
+    NullTexture2D::NullTexture2D(const String &name, const String &filename, TextureDesc parameters, TextureLoadOptions loadOptions)
+    {
+        params      = parameters;
+        rhiFormat   = parameters.format;
+        fileName    = filename;
+        flags       = parameters.flags | TextureFlags::Texture_Sampled;
+        this->loadOptions = loadOptions;
+
+        uint32_t bits = 32;
+        if(LoadAndCountFile(fileName, &width, &height, &bits))
+        {
+            params.format = BitsToFormat(bits);
+            rhiFormat     = params.format;
+        }
+
+        m_UUID = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    void NullTexture2D::SetData(const void* pixels)
+    {
+        if(pixels)
+            NullRenderer::CountUpload(GetSize());
+    }
+
+    void NullTexture2D::Resize(uint32_t width, uint32_t height)
+    {
+        this->width  = width;
+        this->height = height;
+        m_UUID       = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    void NullTexture2D::Load(uint32_t _width, uint32_t _height, void* _data, TextureDesc _parameters, TextureLoadOptions _loadOptions)
+    {
+        width       = _width;
+        height      = _height;
+        params      = _parameters;
+        loadOptions = _loadOptions;
+        rhiFormat   = params.format;
+        flags       = params.flags | TextureFlags::Texture_Sampled;
+        bitsPerChannel = GetBitsFromFormat(params.format);
+
+        if(_data)
+            NullRenderer::CountUpload(GetSize());
+
+        m_UUID = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    uint32_t NullTexture2D::GetSize() const
+    {
+        if(IsCompressedFormat(params.format))
+            return ((width + 3) / 4) * ((height + 3) / 4) * GetBlockSize(params.format);
+
+        return width * height * bitsPerChannel / 8;
+    }
+
+    NullTextureDepth::NullTextureDepth(uint32_t _width, uint32_t _height)
+    {
+        width     = _width;
+        height    = _height;
+        rhiFormat = RHIFormat::D32_Float;
+        flags    |= TextureFlags::Texture_DepthStencil;
+        m_UUID    = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    void NullTextureDepth::Resize(uint32_t _width, uint32_t _height)
+    {
+        width  = _width;
+        height = _height;
+        m_UUID = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    NullTextureDepthArray::NullTextureDepthArray(uint32_t width, uint32_t height, uint32_t count)
+    {
+        this->width  = width;
+        this->height = height;
+        this->count  = count;
+        rhiFormat    = RHIFormat::D32_Float;
+        flags       |= TextureFlags::Texture_DepthStencil;
+        m_UUID       = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    void NullTextureDepthArray::Resize(uint32_t width, uint32_t height, uint32_t count)
+    {
+        this->width  = width;
+        this->height = height;
+        this->count  = count;
+        m_UUID       = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    NullTextureCube::NullTextureCube(uint32_t size, void* data, bool hdr)
+    {
+        rhiFormat      = hdr ? RHIFormat::R32G32B32A32_Float : RHIFormat::R8G8B8A8_Unorm;
+        params.format  = rhiFormat;
+        width          = size;
+        height         = size;
+        mipsNums       = static_cast<uint32_t>(std::floor(std::log2(Maths::Max(width, height)))) + 1;
+        bitsPerChannel = hdr ? 32 : 8;
+        channelCount   = 4;
+        flags         |= TextureFlags::Texture_Sampled;
+
+        if(data)
+            NullRenderer::CountUpload(uint64_t(width) * height * GetBytesPerPixel() * layersNum);
+
+        m_UUID = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    NullTextureCube::NullTextureCube(const String &filepath)
+    {
+        files[0]  = filepath;
+        rhiFormat = params.format;
+
+        uint32_t bits = 32;
+        LoadAndCountFile(filepath, &width, &height, &bits);
+        m_UUID = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    NullTextureCube::NullTextureCube(const String* _files)
+    {
+        uint32_t bits = 32;
+        for(uint32_t i = 0; i < 6; i++)
+        {
+            files[i] = _files[i];
+            LoadAndCountFile(files[i], &width, &height, &bits);
+        }
+
+        m_UUID = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+    NullTextureCube::NullTextureCube(const String* _files, uint32_t mips, TextureDesc _params, TextureLoadOptions _loadOptions)
+    {
+        params      = _params;
+        loadOptions = _loadOptions;
+        mipsNums    = mips;
+        rhiFormat   = params.format;
+
+        // Each file is a vertical cross of one mip, the face size is taken from the first one
+        uint32_t bits = 32;
+        for(uint32_t i = 0; i < mips; i++)
+        {
+            uint32_t srcWidth = 0, srcHeight = 0;
+            files[i] = _files[i];
+            if(LoadAndCountFile(files[i], &srcWidth, &srcHeight, &bits) && i == 0)
+            {
+                width  = srcWidth / 3;
+                height = srcHeight / 4;
+            }
+        }
+
+        m_UUID = Random64::Rand(0, std::numeric_limits<uint64_t>::max());
+    }
+
+} // NekoEngine
@@ -0,0 +1,69 @@
+#pragma once
+#include "RHI/Texture.h"
+
+namespace NekoEngine
+{
+    // Textures keep their size and format only, pixel data is counted as uploaded and dropped
+
+    class NullTexture2D : public Texture2D
+    {
+    public:
+        NullTexture2D(TextureDesc parameters, uint32_t width, uint32_t height);
+        NullTexture2D(uint32_t width, uint32_t height, void* data, TextureDesc parameters = TextureDesc(), TextureLoadOptions loadOptions = TextureLoadOptions());
+        NullTexture2D(const String& name, const String& filename, TextureDesc parameters = TextureDesc(), TextureLoadOptions loadOptions = TextureLoadOptions());
+        ~NullTexture2D() override = default;
+
+        void Bind(uint32_t slot = 0) const override {}
+        void Unbind(uint32_t slot = 0) const override {}
+
+        void SetData(const void* pixels) override;
+        void Resize(uint32_t width, uint32_t height) override;
+        void Load(uint32_t _width, uint32_t _height, void* _data, TextureDesc _parameters = TextureDesc(), TextureLoadOptions _loadOptions = TextureLoadOptions()) override;
+        uint32_t GetSize() const override;
+    };
+
+    class NullTextureDepth : public TextureDepth
+    {
+    public:
+        NullTextureDepth(uint32_t width, uint32_t height);
+        ~NullTextureDepth() override = default;
+
+        void Bind(uint32_t slot = 0) const override {}
+        void Unbind(uint32_t slot = 0) const override {}
+        void Resize(uint32_t width, uint32_t height) override;
+    };
+
+    class NullTextureDepthArray : public TextureDepthArray
+    {
+    public:
+        NullTextureDepthArray(uint32_t width, uint32_t height, uint32_t count);
+        ~NullTextureDepthArray() override = default;
+
+        void Bind(uint32_t slot = 0) const override {}
+        void Unbind(uint32_t slot = 0) const override {}
+        void Resize(uint32_t width, uint32_t height, uint32_t count) override;
+        uint32_t GetCount() const override { return count; }
+
+        uint32_t GetWidth(uint32_t mip = 0) const override { return width >> mip; }
+        uint32_t GetHeight(uint32_t mip = 0) const override { return height >> mip; }
+        TextureType GetType() override { return TextureType::DEPTHARRAY; }
+    };
+
+    class NullTextureCube : public TextureCube
+    {
+    public:
+        NullTextureCube(uint32_t size, void* data, bool hdr);
+        NullTextureCube(const String& filepath);
+        NullTextureCube(const String* files);
+        NullTextureCube(const String* files, uint32_t mips, TextureDesc params, TextureLoadOptions loadOptions);
+        ~NullTextureCube() override = default;
+
+        void Bind(uint32_t slot = 0) const override {}
+        void Unbind(uint32_t slot = 0) const override {}
+
+        uint32_t GetWidth(uint32_t mip = 0) const override { return width >> mip; }
+        uint32_t GetHeight(uint32_t mip = 0) const override { return height >> mip; }
+        TextureType GetType() override { return TextureType::CUBE; }
+    };
+
+} // NekoEngine
@@ -1,4 +1,5 @@
 #include "BufferLayout.h"
+#include "Hash.h"
 
 namespace NekoEngine
 {
@@ -13,6 +14,14 @@ namespace NekoEngine
             case RHIFormat::R8_UInt:
                 _size = sizeof(uint8_t);
                 break;
+            case RHIFormat::R8G8B8A8_Unorm:
+            case RHIFormat::R16G16_Float:
+                _size = sizeof(uint32_t);
+                break;
+            case RHIFormat::R16G16B16A16_Float:
+            case RHIFormat::R16G16B16A16_Snorm:
+                _size = sizeof(uint16_t) * 4;
+                break;
             case RHIFormat::R32_Float:
                 _size = sizeof(float);
                 break;
@@ -28,7 +37,20 @@ namespace NekoEngine
             default:
                 return;
         }
-        layout.push_back({_name, _format, _size, _isNormalised});
+        layout.push_back({_name, _format, size, _isNormalised});
         size += _size;
     }
+
+    uint64_t BufferLayout::GetHash() const
+    {
+        uint64_t hash = 0;
+        HashCombine(hash, size);
+
+        for(auto& element : layout)
+        {
+            HashCombine(hash, (uint32_t)element.format, element.offset);
+        }
+
+        return hash;
+    }
 } // NekoEngine
\ No newline at end of file
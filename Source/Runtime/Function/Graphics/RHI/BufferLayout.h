@@ -23,9 +23,13 @@ namespace NekoEngine
         BufferLayout() = default;
 
         inline ArrayList<BufferElement>& GetLayout() { return layout; }
-        inline uint32_t GetStride() { return size; }
+        inline const ArrayList<BufferElement>& GetLayout() const { return layout; }
+        inline uint32_t GetStride() const { return size; }
 
-        void Push(const String& _name, RHIFormat _format, bool _isNormalised);
+        // Elements are packed in push order, element i is read by the vertex input at location i
+        void Push(const String& _name, RHIFormat _format, bool _isNormalised = false);
+
+        uint64_t GetHash() const;
     };
 
 
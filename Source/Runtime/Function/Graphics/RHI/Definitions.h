@@ -33,6 +33,16 @@ namespace NekoEngine
     static constexpr uint16_t DESCRIPTOR_MAX_SAMPLERS                 = 1024;
     static constexpr uint16_t DESCRIPTOR_MAX_TEXTURES                 = 1024;
 
+    // Uniform buffers in the material set are dynamic, sub-allocated each frame from one ring buffer
+    static constexpr uint32_t DESCRIPTOR_SET_MATERIAL  = 1;
+    static constexpr uint32_t UNIFORM_RING_FRAME_SIZE  = 4 * 1024 * 1024;
+
+    // Staging memory shared by every texture and buffer upload in flight
+    static constexpr uint32_t UPLOAD_RING_SIZE = 32 * 1024 * 1024;
+
+    // Pipeline and shader reflection caches, relative to the working directory
+    static constexpr const char* RENDER_CACHE_FOLDER = "Cache/";
+
     enum class CullMode : uint8_t
     {
         FRONT = 0,
@@ -111,6 +121,17 @@ namespace NekoEngine
         D16_Unorm_S8_UInt,
         D24_Unorm_S8_UInt,
         D32_Float_S8_UInt,
+
+        // 4x4 block compressed, only sampled. The sRGB variants come from TextureDesc::srgb like the others.
+        BC1_Unorm,
+        BC3_Unorm,
+        BC4_Unorm,
+        BC5_Unorm,
+        BC6H_UFloat,
+        BC7_Unorm,
+
+        // Vertex attributes only, read as -1 to 1
+        R16G16B16A16_Snorm,
         SCREEN
     };
 
@@ -126,7 +147,8 @@ namespace NekoEngine
         UNIFORM_BUFFER,
         UNIFORM_BUFFER_DYNAMIC,
         IMAGE_SAMPLER,
-        IMAGE_STORAGE
+        IMAGE_STORAGE,
+        STORAGE_BUFFER
     };
 
     enum class ShaderDataType : uint8_t
@@ -186,6 +208,17 @@ namespace NekoEngine
         Texture_MipViews             = BIT(6)
     };
 
+    // How a pass uses a texture, each backend maps it to its own layout
+    enum class ResourceState : uint8_t
+    {
+        Undefined = 0,
+        RenderTarget,
+        DepthWrite,
+        DepthRead,
+        ShaderRead,
+        Storage
+    };
+
     enum RendererBufferType
     {
         RENDERER_BUFFER_COLOUR  = BIT(0),
@@ -257,6 +290,17 @@ namespace NekoEngine
         UNKNOWN    = 4
     };
 
+    // Where a uniform lives, resolved once from reflection by name and reused instead of string lookups.
+    // Handles stay valid for every descriptor set created from the same shader layout.
+    struct UniformHandle
+    {
+        uint32_t buffer = UINT32_MAX; // Uniform buffer of a descriptor set, or push constant block of a shader
+        uint32_t offset = 0;
+        uint32_t size   = 0;
+
+        bool IsValid() const { return buffer != UINT32_MAX; }
+    };
+
     struct BufferMemberInfo
     {
         uint32_t size;
@@ -425,19 +469,34 @@ namespace NekoEngine
 
         void SetValue(const std::string& name, void* value)
         {
+            SetValue(GetHandle(name), value);
+        }
+
+        void SetValue(const UniformHandle& handle, const void* value)
+        {
+            if(handle.IsValid())
+                memcpy(&data[handle.offset], value, handle.size);
+        }
+
+        void SetData(void* value)
+        {
+            memcpy(data, value, size);
+        }
+
+        UniformHandle GetHandle(const std::string& memberName) const
+        {
+            UniformHandle handle;
             for(auto& member : m_Members)
             {
-                if(member.name == name)
+                if(member.name == memberName)
                 {
-                    memcpy(&data[member.offset], value, member.size);
+                    handle.buffer = 0;
+                    handle.offset = member.offset;
+                    handle.size   = member.size;
                     break;
                 }
             }
-        }
-
-        void SetData(void* value)
-        {
-            memcpy(data, value, size);
+            return handle;
         }
     };
 }
\ No newline at end of file
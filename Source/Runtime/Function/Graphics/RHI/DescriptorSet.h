@@ -41,11 +41,23 @@ namespace NekoEngine
 
         virtual void SetUniformBufferData(const std::string &bufferName, void* data) = 0;
 
+        // Resolve once, then set through the handle. Without a uniform name the handle covers the whole buffer.
+        virtual UniformHandle GetUniformHandle(const std::string &bufferName, const std::string &uniformName = "") = 0;
+
+        virtual void SetUniform(const UniformHandle &handle, const void* data) = 0;
+
+        virtual void SetUniform(const UniformHandle &handle, const void* data, uint32_t size) = 0;
+
         virtual void TransitionImages(CommandBuffer* commandBuffer = nullptr)
         {}
 
         virtual void SetUniformDynamic(const std::string &bufferName, uint32_t size)
         {}
+
+        // Storage buffers belong to the set and grow to fit what is written. The data is copied, so it can be
+        // rebuilt every frame.
+        virtual void SetStorageBufferData(const std::string &bufferName, const void* data, uint32_t size)
+        {}
     };
 
 } // NekoEngine
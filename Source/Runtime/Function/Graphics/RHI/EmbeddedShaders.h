@@ -6,6 +6,12 @@
 
 #include "Shaders/CompiledSPV/Headers/ForwardPBRvertspv.hpp"
 #include "Shaders/CompiledSPV/Headers/ForwardPBRfragspv.hpp"
+#include "Shaders/CompiledSPV/Headers/ForwardPBRPackedvertspv.hpp"
+#include "Shaders/CompiledSPV/Headers/ShadowPackedvertspv.hpp"
+#include "Shaders/CompiledSPV/Headers/ForwardPBRInstancedvertspv.hpp"
+#include "Shaders/CompiledSPV/Headers/ShadowInstancedvertspv.hpp"
+#include "Shaders/CompiledSPV/Headers/ForwardPBRPackedInstancedvertspv.hpp"
+#include "Shaders/CompiledSPV/Headers/ShadowPackedInstancedvertspv.hpp"
 
 #include "Shaders/CompiledSPV/Headers/Skyboxvertspv.hpp"
 #include "Shaders/CompiledSPV/Headers/Skyboxfragspv.hpp"
@@ -6,4 +6,5 @@
 
 namespace NekoEngine
 {
+    RENDER_API GraphicsContext::renderAPI = RENDER_API::VULKAN;
 } // NekoEngine
\ No newline at end of file
@@ -5,7 +5,8 @@ namespace NekoEngine
 
     enum class RENDER_API : uint8_t
     {
-        VULKAN
+        VULKAN,
+        NONE // Null backend, no GPU work, see Null/NullRenderer.h
     };
 
     class GraphicsContext
@@ -13,6 +14,7 @@ namespace NekoEngine
         friend class VulkanRenderer;
     private:
         SharedPtr<Renderer> renderer;
+        static RENDER_API renderAPI;
     public:
         GraphicsContext()= default;
         virtual ~GraphicsContext() = default;
@@ -29,7 +31,10 @@ namespace NekoEngine
         virtual void WaitIdle() const                             = 0;
         virtual void OnImGui()                                    = 0;
 
-        static RENDER_API GetRenderAPI() { return RENDER_API::VULKAN; };
+        static RENDER_API GetRenderAPI() { return renderAPI; };
+
+        // Must be set before the engine creates its window and renderer
+        static void SetRenderAPI(RENDER_API api) { renderAPI = api; }
 
         SharedPtr<Renderer> GetRenderer() const
         {
@@ -10,12 +10,17 @@ namespace NekoEngine
     static std::unordered_map<uint64_t, PipelineAsset> m_PipelineCache;
     static const float m_CacheLifeTime = 0.1f;
 
-    SharedPtr<Pipeline> Pipeline::Get(const PipelineDesc& pipelineDesc)
+    uint64_t PipelineDesc::GetHash() const
     {
         uint64_t hash = 0;
-        HashCombine(hash, pipelineDesc.shader.get(), pipelineDesc.cullMode, pipelineDesc.isDepthBiasEnabled, (uint32_t)pipelineDesc.drawType, (uint32_t)pipelineDesc.polygonMode, pipelineDesc.isTransparencyEnabled);
+        HashCombine(hash, shader.get(), cullMode, isDepthBiasEnabled, (uint32_t)drawType, (uint32_t)polygonMode, isTransparencyEnabled, (uint32_t)blendMode);
+
+        if(vertexLayout)
+        {
+            HashCombine(hash, vertexLayout->GetHash());
+        }
 
-        for(auto texture : pipelineDesc.colourTargets)
+        for(auto texture : colourTargets)
         {
             if(texture)
             {
@@ -23,25 +28,35 @@ namespace NekoEngine
             }
         }
 
-        if(pipelineDesc.depthTarget)
+        if(depthTarget)
         {
-            HashCombine(hash, pipelineDesc.depthTarget->GetUUID());
+            HashCombine(hash, depthTarget->GetUUID());
         }
 
-        if(pipelineDesc.depthArrayTarget)
+        if(depthArrayTarget)
         {
-            HashCombine(hash, pipelineDesc.depthArrayTarget->GetUUID());
+            HashCombine(hash, depthArrayTarget->GetUUID());
         }
 
-        HashCombine(hash, pipelineDesc.isClearTargets);
-        HashCombine(hash, pipelineDesc.isSwapChainTarget);
-        HashCombine(hash, pipelineDesc.lineWidth);
-        HashCombine(hash, pipelineDesc.depthBiasConstantFactor);
-        HashCombine(hash, pipelineDesc.depthBiasSlopeFactor);
-        HashCombine(hash, pipelineDesc.cubeMapIndex);
-        HashCombine(hash, pipelineDesc.cubeMapTarget);
-        HashCombine(hash, pipelineDesc.mipIndex);
+        HashCombine(hash, isClearTargets);
+        HashCombine(hash, isSwapChainTarget);
+        HashCombine(hash, lineWidth);
+        HashCombine(hash, depthBiasConstantFactor);
+        HashCombine(hash, depthBiasSlopeFactor);
+        HashCombine(hash, cubeMapIndex);
+        HashCombine(hash, cubeMapTarget);
+        HashCombine(hash, mipIndex);
 
+        return hash;
+    }
+
+    SharedPtr<Pipeline> Pipeline::Get(const PipelineDesc& pipelineDesc)
+    {
+        return Get(pipelineDesc, pipelineDesc.GetHash());
+    }
+
+    SharedPtr<Pipeline> Pipeline::Get(const PipelineDesc& pipelineDesc, uint64_t hash)
+    {
         if(pipelineDesc.isSwapChainTarget)
         {
             // Add one swapchain image to hash
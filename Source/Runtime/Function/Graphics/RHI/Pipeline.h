@@ -2,6 +2,7 @@
 #include "Renderer.h"
 #include "Definitions.h"
 #include "Shader.h"
+#include "BufferLayout.h"
 namespace NekoEngine
 {
     struct PipelineAsset
@@ -14,6 +15,9 @@ namespace NekoEngine
     {
         SharedPtr<Shader> shader;
 
+        // Overrides the per vertex formats and stride reflected from the shader, input location i reads element i
+        SharedPtr<BufferLayout> vertexLayout;
+
         CullMode cullMode       = CullMode::BACK;
         PolygonMode polygonMode = PolygonMode::FILL;
         DrawType drawType       = DrawType::TRIANGLE;
@@ -37,12 +41,17 @@ namespace NekoEngine
         int mipIndex                  = 0;
 
         std::string DebugName;
+
+        // Hash of every field that changes the created pipeline. Compute it once and pass it to
+        // Pipeline::Get when the same desc is resolved repeatedly.
+        uint64_t GetHash() const;
     };
 
     class Pipeline
     {
     public:
         static SharedPtr<Pipeline> Get(const PipelineDesc& pipelineDesc);
+        static SharedPtr<Pipeline> Get(const PipelineDesc& pipelineDesc, uint64_t hash);
         static void ClearCache();
         static void DeleteUnusedCache();
 
@@ -51,6 +60,11 @@ namespace NekoEngine
 
         virtual void Bind(CommandBuffer* commandBuffer, uint32_t layer = 0) = 0;
         virtual void End(CommandBuffer* commandBuffer) { }
+
+        // Parallel recording: the primary buffer begins the render pass with BeginSecondary, each secondary
+        // buffer recorded inside it starts with BindSecondary, then the primary executes them and calls End
+        virtual void BeginSecondary(CommandBuffer* primaryCommandBuffer, uint32_t layer = 0) { }
+        virtual void BindSecondary(CommandBuffer* secondaryCommandBuffer, uint32_t layer = 0) { }
         virtual void ClearRenderTargets(CommandBuffer* commandBuffer) { }
         virtual SharedPtr<Shader> GetShader() const = 0;
 
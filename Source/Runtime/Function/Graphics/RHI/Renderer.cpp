@@ -33,6 +33,15 @@ namespace NekoEngine
             shaderLibrary->AddResource("Debanding", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ScreenPassvertspv.data(), spirv_ScreenPassvertspv_size, spirv_Debandingfragspv.data(), spirv_Debandingfragspv_size)));
             shaderLibrary->AddResource("ChromaticAberation", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ScreenPassvertspv.data(), spirv_ScreenPassvertspv_size, spirv_ChromaticAberationfragspv.data(), spirv_ChromaticAberationfragspv_size)));
             shaderLibrary->AddResource("DepthPrePass", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ForwardPBRvertspv.data(), spirv_ForwardPBRvertspv_size, spirv_DepthPrePassfragspv.data(), spirv_DepthPrePassfragspv_size)));
+            shaderLibrary->AddResource("ForwardPBRPacked", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ForwardPBRPackedvertspv.data(), spirv_ForwardPBRPackedvertspv_size, spirv_ForwardPBRfragspv.data(), spirv_ForwardPBRfragspv_size)));
+            shaderLibrary->AddResource("DepthPrePassPacked", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ForwardPBRPackedvertspv.data(), spirv_ForwardPBRPackedvertspv_size, spirv_DepthPrePassfragspv.data(), spirv_DepthPrePassfragspv_size)));
+            shaderLibrary->AddResource("ShadowPacked", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ShadowPackedvertspv.data(), spirv_ShadowPackedvertspv_size, spirv_Shadowfragspv.data(), spirv_Shadowfragspv_size)));
+            shaderLibrary->AddResource("ForwardPBRInstanced", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ForwardPBRInstancedvertspv.data(), spirv_ForwardPBRInstancedvertspv_size, spirv_ForwardPBRfragspv.data(), spirv_ForwardPBRfragspv_size)));
+            shaderLibrary->AddResource("DepthPrePassInstanced", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ForwardPBRInstancedvertspv.data(), spirv_ForwardPBRInstancedvertspv_size, spirv_DepthPrePassfragspv.data(), spirv_DepthPrePassfragspv_size)));
+            shaderLibrary->AddResource("ShadowInstanced", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ShadowInstancedvertspv.data(), spirv_ShadowInstancedvertspv_size, spirv_Shadowfragspv.data(), spirv_Shadowfragspv_size)));
+            shaderLibrary->AddResource("ForwardPBRPackedInstanced", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ForwardPBRPackedInstancedvertspv.data(), spirv_ForwardPBRPackedInstancedvertspv_size, spirv_ForwardPBRfragspv.data(), spirv_ForwardPBRfragspv_size)));
+            shaderLibrary->AddResource("DepthPrePassPackedInstanced", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ForwardPBRPackedInstancedvertspv.data(), spirv_ForwardPBRPackedInstancedvertspv_size, spirv_DepthPrePassfragspv.data(), spirv_DepthPrePassfragspv_size)));
+            shaderLibrary->AddResource("ShadowPackedInstanced", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ShadowPackedInstancedvertspv.data(), spirv_ShadowPackedInstancedvertspv_size, spirv_Shadowfragspv.data(), spirv_Shadowfragspv_size)));
             shaderLibrary->AddResource("ToneMapping", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ScreenPassvertspv.data(), spirv_ScreenPassvertspv_size, spirv_ToneMappingfragspv.data(), spirv_ToneMappingfragspv_size)));
             shaderLibrary->AddResource("Bloom", SharedPtr<Shader>(rhiFactory->CreateShaderFromEmbeddedArray(spirv_ScreenPassvertspv.data(), spirv_ScreenPassvertspv_size, spirv_Bloomfragspv.data(), spirv_Bloomfragspv_size)));
 //            if(Renderer::capabilities.SupportCompute)
@@ -72,6 +81,15 @@ namespace NekoEngine
 //             shaderLibrary->AddResource("Outline", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/Outline.shader")));
             shaderLibrary->AddResource("ChromaticAberation", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/ChromaticAberation.shader")));
             shaderLibrary->AddResource("DepthPrePass", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/DepthPrePass.shader")));
+            shaderLibrary->AddResource("ForwardPBRInstanced", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/ForwardPBRInstanced.shader")));
+            shaderLibrary->AddResource("DepthPrePassInstanced", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/DepthPrePassInstanced.shader")));
+            shaderLibrary->AddResource("ShadowInstanced", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/ShadowInstanced.shader")));
+            shaderLibrary->AddResource("ForwardPBRPacked", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/ForwardPBRPacked.shader")));
+            shaderLibrary->AddResource("ForwardPBRPackedInstanced", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/ForwardPBRPackedInstanced.shader")));
+            shaderLibrary->AddResource("DepthPrePassPacked", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/DepthPrePassPacked.shader")));
+            shaderLibrary->AddResource("DepthPrePassPackedInstanced", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/DepthPrePassPackedInstanced.shader")));
+            shaderLibrary->AddResource("ShadowPacked", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/ShadowPacked.shader")));
+            shaderLibrary->AddResource("ShadowPackedInstanced", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/ShadowPackedInstanced.shader")));
             shaderLibrary->AddResource("ToneMapping", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/ToneMapping.shader")));
             shaderLibrary->AddResource("Bloom", SharedPtr<Shader>(rhiFactory->CreateShader("//CoreShaders/Bloom.shader")));
             if(Renderer::capabilities.SupportCompute)
@@ -91,7 +109,7 @@ namespace NekoEngine
     {
         mesh->GetVertexBuffer()->Bind(commandBuffer, pipeline);
         mesh->GetIndexBuffer()->Bind(commandBuffer);
-        DrawIndexed(commandBuffer, DrawType::TRIANGLE, mesh->GetIndexBuffer()->GetCount());
+        DrawIndexed(commandBuffer, DrawType::TRIANGLE, mesh->GetLod(0).indexCount, mesh->GetLod(0).indexOffset);
         mesh->GetVertexBuffer()->Unbind();
         mesh->GetIndexBuffer()->Unbind();
     }
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core.h"
+#include "Profiler/Profiler.h"
 #include "Asset/AssetManager.h"
 #include "Renderable/Mesh.h"
 #include "SwapChain.h"
@@ -19,6 +20,9 @@ namespace NekoEngine
         int UniformBufferOffsetAlignment = 0;
         bool WideLines                   = false;
         bool SupportCompute              = false;
+        bool TextureCompressionBC        = false;
+        bool SupportTextureCopy          = false; // CopyTextureLayer is implemented
+        bool SupportTimestamps           = false; // GPU scopes are timed for the profiler
     };
 
     struct RenderConfig
@@ -27,6 +31,13 @@ namespace NekoEngine
         uint32_t EnvironmentMapSize = 1024;
     };
 
+    // Moves texture to state before the commands recorded after it
+    struct TextureBarrier
+    {
+        Texture* texture    = nullptr;
+        ResourceState state = ResourceState::Undefined;
+    };
+
     class RHIFactory;
 
     class Renderer
@@ -47,8 +58,18 @@ namespace NekoEngine
         virtual void Draw(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType = DataType::UNSIGNED_INT, void* indices = nullptr) = 0;
         virtual void DrawMesh(CommandBuffer* commandBuffer, Pipeline* pipeline, Mesh* mesh);
         virtual void DrawIndexed(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start = 0) = 0;
+        virtual void DrawIndexedInstanced(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t instanceCount, uint32_t start = 0, uint32_t firstInstance = 0) = 0;
         virtual void Dispatch(CommandBuffer* commandBuffer, uint32_t workGroupSizeX, uint32_t workGroupSizeY, uint32_t workGroupSizeZ) = 0;
         virtual void ClearRenderTarget(Texture* texture, CommandBuffer* commandBuffer, Color clearColour = Color(0.1f, 0.1f, 0.1f, 1.0f)){};
+        // Records the barriers that change a texture's state, batched where the backend can. Barriers to the
+        // state a texture is already in are skipped, returns how many were recorded.
+        virtual uint32_t TransitionTextures(const TextureBarrier* barriers, uint32_t count, CommandBuffer* commandBuffer) { return 0; }
+        // Copies one layer of a depth array into the same layer of another of the same size, both keep their state
+        virtual void CopyTextureLayer(Texture* source, Texture* destination, uint32_t layer, CommandBuffer* commandBuffer) {}
+        // Timestamps around the commands recorded in between, handed to the profiler once the GPU is done
+        // with the frame. name must outlive the frame. Only called in builds with the profiler.
+        virtual void BeginGPUScope(const char* name, CommandBuffer* commandBuffer) {}
+        virtual void EndGPUScope(CommandBuffer* commandBuffer) {}
         virtual void Present() = 0;
         virtual void OnResize(uint32_t height, uint32_t width) = 0;
         virtual void BindDescriptorSets(Pipeline* pipeline, CommandBuffer* commandBuffer, uint32_t dynamicOffset, DescriptorSet** descriptorSets, uint32_t descriptorCount) = 0;
@@ -65,4 +86,32 @@ namespace NekoEngine
             return renderConfig;
         }
     };
+
+#ifdef NekoEngine_PROFILE
+    class GPUProfileScope
+    {
+    public:
+        GPUProfileScope(Renderer* renderer, const char* name, CommandBuffer* commandBuffer)
+            : m_Renderer(renderer), m_CommandBuffer(commandBuffer)
+        {
+            m_Renderer->BeginGPUScope(name, m_CommandBuffer);
+        }
+
+        GPUProfileScope(Renderer* renderer, const String& name, CommandBuffer* commandBuffer)
+            : GPUProfileScope(renderer, Profiler::InternName(name), commandBuffer) {}
+
+        ~GPUProfileScope() { m_Renderer->EndGPUScope(m_CommandBuffer); }
+
+        GPUProfileScope(const GPUProfileScope&) = delete;
+        GPUProfileScope& operator=(const GPUProfileScope&) = delete;
+
+    private:
+        Renderer* m_Renderer;
+        CommandBuffer* m_CommandBuffer;
+    };
+
+#define NekoEngine_PROFILE_GPU(renderer, name, commandBuffer) NekoEngine::GPUProfileScope NekoEngine_PROFILE_CONCAT(gpuProfileScope, __LINE__)(renderer, name, commandBuffer)
+#else
+#define NekoEngine_PROFILE_GPU(renderer, name, commandBuffer)
+#endif
 }
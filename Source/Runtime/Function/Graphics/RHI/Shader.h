@@ -19,6 +19,7 @@ namespace NekoEngine
         bool isCompiled = false;
         uint64_t hash = 0;
         uint32_t vertexInputStride = 0;
+        uint32_t instanceInputStride = 0;
     public:
         static const Shader* currentlyBound;
     public:
@@ -34,9 +35,14 @@ namespace NekoEngine
         virtual ArrayList<PushConstant>& GetPushConstants() = 0;
         virtual PushConstant* GetPushConstant(uint32_t index) { return nullptr; }
         virtual void BindPushConstants(CommandBuffer* commandBuffer, Pipeline* pipeline) = 0;
+        // Pushes one block from caller owned data instead of the shared block storage, safe to call from several threads
+        virtual void BindPushConstant(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t index, const void* data) = 0;
         virtual DescriptorSetInfo GetDescriptorInfo(uint32_t index) { return DescriptorSetInfo(); }
         virtual uint64_t GetHash() const { return hash; }
 
+        // Size of the per instance vertex inputs (binding 1), zero when the shader is not instanced
+        uint32_t GetInstanceInputStride() const { return instanceInputStride; }
+
         //TODO Create Shader
     };
 }
@@ -26,6 +26,8 @@ namespace NekoEngine
         virtual uint32_t GetCurrentImageIndex() const    = 0;
         virtual size_t GetSwapChainBufferCount() const   = 0;
         virtual CommandBuffer* GetCurrentCommandBuffer() = 0;
+        // Secondary command buffer for the current frame, index is any slot the caller records into
+        virtual CommandBuffer* GetSecondaryCommandBuffer(uint32_t index) = 0;
         virtual void SetVSync(bool vsync)                = 0;
     };
 }
\ No newline at end of file
@@ -53,6 +53,14 @@ namespace NekoEngine
                 return 64;
             case RHIFormat::R32G32B32A32_Float:
                 return 128;
+            case RHIFormat::BC1_Unorm:
+            case RHIFormat::BC4_Unorm:
+                return 4;
+            case RHIFormat::BC3_Unorm:
+            case RHIFormat::BC5_Unorm:
+            case RHIFormat::BC6H_UFloat:
+            case RHIFormat::BC7_Unorm:
+                return 8;
             default:
                 return 32;
         }
@@ -98,6 +98,17 @@ namespace NekoEngine
             return format == RHIFormat::D24_Unorm_S8_UInt || format == RHIFormat::D16_Unorm_S8_UInt ||
                    format == RHIFormat::D32_Float_S8_UInt;
         }
+
+        static bool IsCompressedFormat(RHIFormat format)
+        {
+            return format >= RHIFormat::BC1_Unorm && format <= RHIFormat::BC7_Unorm;
+        }
+
+        // Bytes per 4x4 block of a compressed format
+        static uint32_t GetBlockSize(RHIFormat format)
+        {
+            return format == RHIFormat::BC1_Unorm || format == RHIFormat::BC4_Unorm ? 8 : 16;
+        }
     };
 
     class Texture2D : virtual public Texture
@@ -17,6 +17,7 @@ namespace NekoEngine
         virtual void SetDataSub(uint32_t size, const void* data, uint32_t offset) = 0;
         virtual void ReleasePointer()                                             = 0;
         virtual void Bind(CommandBuffer* commandBuffer, Pipeline* pipeline)       = 0;
+        virtual void BindInstanceData(CommandBuffer* commandBuffer)               = 0; // Per instance stream, binding 1
         virtual void Unbind()                                                     = 0;
         virtual uint32_t GetSize() { return 0; }
 
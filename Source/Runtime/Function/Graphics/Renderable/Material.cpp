@@ -126,7 +126,7 @@ namespace NekoEngine
         if(!descriptorSet)
             return;
 
-        descriptorSet->SetUniformBufferData("UniformMaterialData", *&materialProperties);
+        descriptorSet->SetUniform(materialDataUniform, materialProperties);
         descriptorSet->Update();
     }
 
@@ -233,6 +233,7 @@ namespace NekoEngine
         descriptorDesc.shader = shader.get();
 
         descriptorSet = GET_RHI_FACTORY()->CreateDescriptor(descriptorDesc);
+        materialDataUniform = descriptorSet->GetUniformHandle("UniformMaterialData");
 
         UpdateDescriptorSet();
     }
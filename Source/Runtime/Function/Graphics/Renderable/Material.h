@@ -10,6 +10,7 @@
 namespace NekoEngine
 {
     class DescriptorSet;
+    class Pipeline;
 
     const float PBR_WORKFLOW_SEPARATE_TEXTURES = 0.0f;
     const float PBR_WORKFLOW_METALLIC_ROUGHNESS = 1.0f;
@@ -61,12 +62,17 @@ namespace NekoEngine
         String name;
         SharedPtr<Shader> shader;
         DescriptorSet* descriptorSet;
+        UniformHandle materialDataUniform;
         MaterialProperties* materialProperties;
         PBRMaterialTextures pbrMaterialTextures;
         uint32_t materialBufferSize;
         uint32_t flags;
         bool isTextureUpdated = false;
 
+        // Pipeline a renderer resolved for this material, valid while pipelineKey matches its pass state
+        SharedPtr<Pipeline> pipeline;
+        uint64_t pipelineKey = 0;
+
         static SharedPtr<Texture2D> defaultTexture;
     public:
         Material(SharedPtr<Shader> &shader, const MaterialProperties &properties = MaterialProperties(),
@@ -137,8 +143,20 @@ namespace NekoEngine
                 flags |= (uint32_t) flag;
             else
                 flags &= ~(uint32_t) flag;
+
+            pipeline = nullptr;
         };
 
+        // Returns the cached pipeline when it was built for the same pass state key, otherwise nullptr
+        Pipeline* GetPipeline(uint64_t key) const
+        { return pipelineKey == key ? pipeline.get() : nullptr; }
+
+        void SetPipeline(const SharedPtr<Pipeline> &_pipeline, uint64_t key)
+        {
+            pipeline = _pipeline;
+            pipelineKey = key;
+        }
+
 
         bool IsTexturesUpdated()
         { return isTextureUpdated; }
@@ -1,8 +1,75 @@
 #include "Mesh.h"
 #include "meshoptimizer.h"
+#include "Math/Maths.h"
 #include "Engine.h"
+#include <glm/gtc/packing.hpp>
 namespace NekoEngine
 {
+    namespace
+    {
+        // Octahedral encoding, both components in -1 to 1. Zero vectors come back as +Z.
+        glm::vec2 OctEncode(const glm::vec3& v)
+        {
+            const float length = glm::abs(v.x) + glm::abs(v.y) + glm::abs(v.z);
+            if(length <= 0.0f || !std::isfinite(length))
+                return glm::vec2(0.0f);
+
+            const glm::vec3 n = v / length;
+            if(n.z >= 0.0f)
+                return glm::vec2(n.x, n.y);
+
+            return glm::vec2((1.0f - glm::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f),
+                             (1.0f - glm::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f));
+        }
+
+        // Written in the element order of Mesh::GetVertexLayout
+        ArrayList<uint8_t> PackVertices(const ArrayList<Vertex>& vertices, uint32_t vertexFormat, const glm::vec3& center, float scale)
+        {
+            const bool quantised = vertexFormat & (uint32_t)Mesh::VertexFormat::QUANTISED_POSITION;
+            const bool colour    = vertexFormat & (uint32_t)Mesh::VertexFormat::COLOUR;
+            const uint32_t stride = Mesh::GetVertexLayout(vertexFormat)->GetStride();
+
+            ArrayList<uint8_t> result(vertices.size() * stride);
+            uint8_t* dest = result.data();
+
+            for(auto& vertex : vertices)
+            {
+                const float bitangentSign = glm::dot(glm::cross(vertex.normal, vertex.tangent), vertex.biTangent) < 0.0f ? -1.0f : 1.0f;
+
+                if(quantised)
+                {
+                    const glm::vec4 position = glm::vec4((vertex.position - center) / scale, bitangentSign);
+                    const uint64_t packed    = glm::packSnorm4x16(position);
+                    memcpy(dest, &packed, sizeof(packed));
+                    dest += sizeof(packed);
+                }
+                else
+                {
+                    const glm::vec4 position = glm::vec4(vertex.position, bitangentSign);
+                    memcpy(dest, &position, sizeof(position));
+                    dest += sizeof(position);
+                }
+
+                const uint64_t normalTangent = glm::packSnorm4x16(glm::vec4(OctEncode(vertex.normal), OctEncode(vertex.tangent)));
+                memcpy(dest, &normalTangent, sizeof(normalTangent));
+                dest += sizeof(normalTangent);
+
+                const uint32_t texCoords = glm::packHalf2x16(vertex.texCoords);
+                memcpy(dest, &texCoords, sizeof(texCoords));
+                dest += sizeof(texCoords);
+
+                if(colour)
+                {
+                    const uint32_t packedColour = glm::packUnorm4x8(vertex.color);
+                    memcpy(dest, &packedColour, sizeof(packedColour));
+                    dest += sizeof(packedColour);
+                }
+            }
+
+            return result;
+        }
+    }
+
     Mesh::Mesh()
             : indices()
             , vertices()
@@ -16,10 +83,18 @@ namespace NekoEngine
             : name(mesh.name)
             , indices(mesh.indices)
             , vertices(mesh.vertices)
+            , positions(mesh.positions)
+            , lods(mesh.lods)
+            , meshlets(mesh.meshlets)
             , vertexBuffer(mesh.vertexBuffer)
             , indexBuffer(mesh.indexBuffer)
             , material(mesh.material)
             , boundingBox(mesh.boundingBox)
+            , vertexFormat(mesh.vertexFormat)
+            , vertexTransform(mesh.vertexTransform)
+            , residency(mesh.residency)
+            , vertexCount(mesh.vertexCount)
+            , gpuBytes(mesh.gpuBytes)
     {
     }
 
@@ -31,42 +106,261 @@ namespace NekoEngine
 //    {
 //    }
 
-    Mesh::Mesh(const std::vector<uint32_t>& _indices, const std::vector<Vertex>& _vertices, float optimiseThreshold)
+    Mesh::Mesh(const std::vector<uint32_t>& _indices, const std::vector<Vertex>& _vertices, float optimiseThreshold, uint32_t _vertexFormat,
+               MeshResidency _residency)
     {
-        indices  = _indices;
-        vertices = _vertices;
+        Build(_indices, _vertices, optimiseThreshold, _vertexFormat);
+        Upload();
+        SetResidency(_residency);
+    }
 
+    SharedPtr<Mesh> Mesh::CreateCPUOnly(const std::vector<uint32_t>& _indices, const std::vector<Vertex>& _vertices, float optimiseThreshold,
+                                        uint32_t _vertexFormat)
+    {
+        auto mesh = MakeShared<Mesh>();
+        mesh->Build(_indices, _vertices, optimiseThreshold, _vertexFormat);
+        return mesh;
+    }
+
+    void Mesh::Build(const std::vector<uint32_t>& _indices, const std::vector<Vertex>& _vertices, float optimiseThreshold, uint32_t _vertexFormat)
+    {
+        vertices     = _vertices;
+        vertexFormat = _vertexFormat != 0 ? (_vertexFormat | (uint32_t)VertexFormat::PACKED) : 0;
 
-        size_t indexCount         = indices.size();
-        size_t target_index_count = size_t(indices.size() * optimiseThreshold);
+        const float* vertexPositions = (const float*)(&vertices[0]);
+        const float scale            = meshopt_simplifyScale(vertexPositions, vertices.size(), sizeof(Vertex));
 
-        float target_error = 1e-3f;
-        float* resultError = nullptr;
+        // Level 0 is the source, only lightly simplified
+        ArrayList<ArrayList<uint32_t>> levels(1);
+        ArrayList<float> errors(1, 0.0f);
 
-        //TODO: Check
-        auto newIndexCount = meshopt_simplify(indices.data(), indices.data(), indices.size(), (const float*)(&vertices[0]), vertices.size(), sizeof(Vertex), target_index_count, target_error, 0, resultError);
+        ArrayList<uint32_t>& source = levels[0];
+        source.resize(_indices.size());
+        source.resize(meshopt_simplify(source.data(), _indices.data(), _indices.size(), vertexPositions, vertices.size(), sizeof(Vertex),
+                                       size_t(_indices.size() * optimiseThreshold), 1e-3f, 0, &errors[0]));
+
+        // Every further level aims for half the triangles of the one before. They are all simplified from level 0
+        // so the recorded error is against the source. Once the topology stops the regular simplifier from getting
+        // close to the target, the sloppy one takes over, and the chain ends when neither makes real progress.
+        if(source.size() >= MESH_LOD_MIN_INDICES)
+        {
+            while(levels.size() < MESH_MAX_LODS)
+            {
+                const size_t previousCount = levels.back().size();
+                const size_t targetCount   = previousCount / 2;
 
-        auto newVertexCount = meshopt_optimizeVertexFetch( // return vertices (not vertex attribute values)
-                (vertices.data()),
-                (unsigned int*)(indices.data()),
-                newIndexCount, // total new indices (not faces)
-                (vertices.data()),
-                (size_t)vertices.size(), // total vertices (not vertex attribute values)
-                sizeof(Vertex)   // vertex stride
-        );
+                ArrayList<uint32_t> level(levels[0].size());
+                float error = 0.0f;
+
+                size_t count = meshopt_simplify(level.data(), levels[0].data(), levels[0].size(), vertexPositions, vertices.size(), sizeof(Vertex),
+                                                targetCount, 0.05f, 0, &error);
+
+                if(count > targetCount + targetCount / 2)
+                    count = meshopt_simplifySloppy(level.data(), levels[0].data(), levels[0].size(), vertexPositions, vertices.size(), sizeof(Vertex),
+                                                   targetCount, 0.05f, &error);
+
+                if(count == 0 || count > previousCount - previousCount / 8)
+                    break;
+
+                level.resize(count);
+                levels.push_back(std::move(level));
+                errors.push_back(Maths::Max(error, errors.back()));
+            }
+        }
+
+        // Large meshes get level 0 rewritten in meshlet order, so every meshlet is a contiguous range the
+        // renderer can draw or skip on its own. Level 0 starts the index buffer, the ranges are absolute.
+        meshlets.clear();
+        if(levels[0].size() / 3 >= MESHLET_MIN_TRIANGLES)
+        {
+            const ArrayList<uint32_t>& level = levels[0];
+            const size_t maxMeshlets = meshopt_buildMeshletsBound(level.size(), MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES);
+
+            ArrayList<meshopt_Meshlet> built(maxMeshlets);
+            ArrayList<uint32_t> meshletVertices(maxMeshlets * MESHLET_MAX_VERTICES);
+            ArrayList<uint8_t> meshletTriangles(maxMeshlets * MESHLET_MAX_TRIANGLES * 3);
+
+            // A cone weight above zero keeps meshlets flatter so more of them can be backface culled
+            const size_t meshletCount = meshopt_buildMeshlets(built.data(), meshletVertices.data(), meshletTriangles.data(), level.data(), level.size(),
+                                                              vertexPositions, vertices.size(), sizeof(Vertex), MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES, 0.25f);
+
+            ArrayList<uint32_t> reordered;
+            reordered.reserve(level.size());
+            meshlets.reserve(meshletCount);
+
+            for(size_t i = 0; i < meshletCount; i++)
+            {
+                const meshopt_Meshlet& source = built[i];
+                const meshopt_Bounds bounds   = meshopt_computeMeshletBounds(&meshletVertices[source.vertex_offset], &meshletTriangles[source.triangle_offset],
+                                                                             source.triangle_count, vertexPositions, vertices.size(), sizeof(Vertex));
+
+                Meshlet& meshlet    = meshlets.emplace_back();
+                meshlet.center      = glm::vec3(bounds.center[0], bounds.center[1], bounds.center[2]);
+                meshlet.radius      = bounds.radius;
+                meshlet.coneApex    = glm::vec3(bounds.cone_apex[0], bounds.cone_apex[1], bounds.cone_apex[2]);
+                meshlet.coneAxis    = glm::vec3(bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2]);
+                meshlet.coneCutoff  = bounds.cone_cutoff;
+                meshlet.indexOffset = (uint32_t)reordered.size();
+                meshlet.indexCount  = source.triangle_count * 3;
+
+                for(uint32_t j = 0; j < source.triangle_count * 3; j++)
+                    reordered.push_back(meshletVertices[source.vertex_offset + meshletTriangles[source.triangle_offset + j]]);
+            }
+
+            levels[0] = std::move(reordered);
+        }
+
+        indices.clear();
+        lods.clear();
+        for(size_t i = 0; i < levels.size(); i++)
+        {
+            MeshLod& lod   = lods.emplace_back();
+            lod.indexOffset = (uint32_t)indices.size();
+            lod.indexCount  = (uint32_t)levels[i].size();
+            lod.error       = errors[i] * scale;
+            indices.insert(indices.end(), levels[i].begin(), levels[i].end());
+        }
 
+        // Remapping all levels at once orders the vertices by first use in level 0
+        const size_t newVertexCount = meshopt_optimizeVertexFetch(vertices.data(), indices.data(), indices.size(),
+                                                                  vertices.data(), vertices.size(), sizeof(Vertex));
+        vertices.resize(newVertexCount);
+        vertexCount = (uint32_t)newVertexCount;
 
         boundingBox = MakeShared<BoundingBox>();
 
+        positions.clear();
+        positions.reserve(vertices.size());
         for(auto& vertex : vertices)
         {
             boundingBox->Merge(vertex.position);
+            positions.push_back(vertex.position);
         }
 
-        indexBuffer = SharedPtr<IndexBuffer>(GET_RHI_FACTORY()->CreateIndexBuffer(indices.data(), (uint32_t)newIndexCount));
+        residency = MeshResidency::Full;
+    }
+
+    void Mesh::Upload()
+    {
+        indexBuffer = SharedPtr<IndexBuffer>(GET_RHI_FACTORY()->CreateIndexBuffer(indices.data(), (uint32_t)indices.size()));
+        gpuBytes    = sizeof(uint32_t) * (uint64_t)indices.size();
 
         vertexBuffer = SharedPtr<VertexBuffer>(GET_RHI_FACTORY()->CreateVertexBuffer(BufferUsage::STATIC));
-        vertexBuffer->SetData((uint32_t)(sizeof(Vertex) * newVertexCount), vertices.data());
+
+        if(IsPacked())
+        {
+            // Quantised positions use one scale on every axis so the dequantise transform keeps angles,
+            // the snorm range then spans the largest half extent around the centre
+            glm::vec3 center = glm::vec3(0.0f);
+            float scale      = 1.0f;
+
+            if(vertexFormat & (uint32_t)VertexFormat::QUANTISED_POSITION)
+            {
+                const glm::vec3 extents = boundingBox->GetExtents() * 0.5f;
+                center          = boundingBox->Center();
+                scale           = Maths::Max(Maths::Max(extents.x, extents.y), Maths::Max(extents.z, 1e-6f));
+                vertexTransform = glm::translate(glm::mat4(1.0f), center) * glm::scale(glm::mat4(1.0f), glm::vec3(scale));
+            }
+
+            const ArrayList<uint8_t> packed = PackVertices(vertices, vertexFormat, center, scale);
+            vertexBuffer->SetData((uint32_t)packed.size(), packed.data());
+            gpuBytes += packed.size();
+        }
+        else
+        {
+            vertexBuffer->SetData((uint32_t)(sizeof(Vertex) * vertices.size()), vertices.data());
+            gpuBytes += sizeof(Vertex) * (uint64_t)vertices.size();
+        }
+    }
+
+    bool Mesh::SetResidency(MeshResidency _residency)
+    {
+        if(_residency > residency)
+            return false;
+
+        // Swapped with empty lists so the memory actually goes, clear keeps the capacity
+        if(_residency < MeshResidency::Full)
+            ArrayList<Vertex>().swap(vertices);
+
+        if(_residency == MeshResidency::GPUOnly)
+        {
+            ArrayList<glm::vec3>().swap(positions);
+            ArrayList<uint32_t>().swap(indices);
+        }
+        else if(_residency == MeshResidency::Positions && !lods.empty() && indices.size() > lods[0].indexCount)
+        {
+            // Level 0 starts the index buffer
+            ArrayList<uint32_t>(indices.begin(), indices.begin() + lods[0].indexCount).swap(indices);
+        }
+
+        residency = _residency;
+        return true;
+    }
+
+    bool Mesh::RestoreCPUData(Mesh& source, MeshResidency _residency)
+    {
+        if(source.residency != MeshResidency::Full || source.vertexCount != vertexCount || source.lods.size() != lods.size())
+            return false;
+
+        for(size_t i = 0; i < lods.size(); i++)
+        {
+            if(source.lods[i].indexOffset != lods[i].indexOffset || source.lods[i].indexCount != lods[i].indexCount)
+                return false;
+        }
+
+        vertices  = std::move(source.vertices);
+        positions = std::move(source.positions);
+        indices   = std::move(source.indices);
+        residency = MeshResidency::Full;
+        source.residency = MeshResidency::GPUOnly;
+
+        return SetResidency(_residency);
+    }
+
+    uint64_t Mesh::GetCPUBytes() const
+    {
+        return sizeof(Vertex) * (uint64_t)vertices.capacity() + sizeof(glm::vec3) * (uint64_t)positions.capacity()
+               + sizeof(uint32_t) * (uint64_t)indices.capacity() + sizeof(MeshLod) * (uint64_t)lods.capacity()
+               + sizeof(Meshlet) * (uint64_t)meshlets.capacity();
+    }
+
+    const SharedPtr<BufferLayout>& Mesh::GetVertexLayout(uint32_t vertexFormat)
+    {
+        // Built once for every combination, meshes may be loaded from worker threads
+        static const Array<SharedPtr<BufferLayout>, VERTEX_FORMAT_COUNT> layouts = []()
+        {
+            Array<SharedPtr<BufferLayout>, VERTEX_FORMAT_COUNT> result;
+
+            for(uint32_t format = 1; format < VERTEX_FORMAT_COUNT; format++)
+            {
+                auto layout = MakeShared<BufferLayout>();
+
+                if(format & (uint32_t)VertexFormat::QUANTISED_POSITION)
+                    layout->Push("inPosition", RHIFormat::R16G16B16A16_Snorm, true);
+                else
+                    layout->Push("inPosition", RHIFormat::R32G32B32A32_Float);
+
+                layout->Push("inNormalTangent", RHIFormat::R16G16B16A16_Snorm, true);
+                layout->Push("inTexCoord", RHIFormat::R16G16_Float);
+
+                if(format & (uint32_t)VertexFormat::COLOUR)
+                    layout->Push("inColor", RHIFormat::R8G8B8A8_Unorm, true);
+
+                result[format] = layout;
+            }
+
+            return result;
+        }();
+
+        return layouts[vertexFormat & (VERTEX_FORMAT_COUNT - 1)];
+    }
+
+    uint32_t Mesh::SelectLod(float maxError) const
+    {
+        uint32_t lod = 0;
+        while(lod + 1 < (uint32_t)lods.size() && lods[lod + 1].error <= maxError)
+            lod++;
+        return lod;
     }
 
     void Mesh::GenerateNormals(Vertex* _vertices, uint32_t vertexCount, uint32_t* _indices, uint32_t indexCount)
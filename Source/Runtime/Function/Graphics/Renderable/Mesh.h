@@ -1,6 +1,7 @@
 #pragma once
 #include "RHI/IndexBuffer.h"
 #include "RHI/VertexBuffer.h"
+#include "RHI/BufferLayout.h"
 #include "Material.h"
 #include "Math/BoundingBox.h"
 
@@ -32,22 +33,88 @@ namespace NekoEngine
         }
     };
 
+    static constexpr uint32_t MESH_MAX_LODS = 5;
+    static constexpr uint32_t MESH_LOD_MIN_INDICES = 3 * 256; // Smaller meshes only get level 0
+
+    // One level of detail, a range of the mesh's shared index buffer
+    struct MeshLod
+    {
+        uint32_t indexOffset = 0;
+        uint32_t indexCount  = 0;
+        float error          = 0.0f; // Largest deviation from the source mesh, in object space units
+    };
+
+    static constexpr uint32_t MESHLET_MAX_VERTICES  = 64;
+    static constexpr uint32_t MESHLET_MAX_TRIANGLES = 124;
+    static constexpr uint32_t MESHLET_MIN_TRIANGLES = 8192; // Smaller meshes are always drawn whole
+
+    // A small cluster of level 0 triangles, a range of the index buffer with object space bounds for culling.
+    // The cone holds the normals of its triangles, seen from inside it every triangle faces away.
+    struct Meshlet
+    {
+        glm::vec3 center     = glm::vec3(0.0f);
+        float radius         = 0.0f;
+        glm::vec3 coneApex   = glm::vec3(0.0f);
+        float coneCutoff     = 1.0f; // 1 when the normals spread too far to ever be backface culled
+        glm::vec3 coneAxis   = glm::vec3(0.0f, 0.0f, 1.0f);
+        uint32_t indexOffset = 0;
+        uint32_t indexCount  = 0;
+    };
+
+    // What a mesh keeps on the CPU once its buffers are uploaded, each level keeps everything the one before does
+    enum class MeshResidency : uint8_t
+    {
+        GPUOnly   = 0, // Nothing, the default
+        Positions = 1, // Positions and level 0 indices, for the occlusion rasteriser and other geometry queries
+        Full      = 2  // Every vertex and every level of detail, as built
+    };
+
     //TODO add bounding box
     class Mesh
     {
+    public:
+        // Layout of the uploaded vertex buffer, the CPU copy is full Vertex data when it is kept.
+        // Packed vertices store an octahedral normal and tangent with the bitangent sign in position.w,
+        // and half float UVs. They take 20 bytes with quantised positions, 32 with float positions and colour.
+        enum class VertexFormat : uint32_t
+        {
+            FULL               = 0,      // Vertex as it is, 72 bytes
+            PACKED             = BIT(0),
+            QUANTISED_POSITION = BIT(1), // 16 bit positions across the bounds, implies PACKED
+            COLOUR             = BIT(2)  // RGBA8 colour, implies PACKED. None of the engine shaders read it
+        };
+        static constexpr uint32_t VERTEX_FORMAT_COUNT = 8;
+
     protected:
         String name;
         bool isActive = true;
         ArrayList<uint32_t> indices;
         ArrayList<Vertex> vertices;
+        ArrayList<glm::vec3> positions;
+        ArrayList<MeshLod> lods;
+        ArrayList<Meshlet> meshlets;
         SharedPtr<VertexBuffer> vertexBuffer;
         SharedPtr<IndexBuffer> indexBuffer;
         SharedPtr<Material> material;
         SharedPtr<BoundingBox> boundingBox;
+        uint32_t vertexFormat = 0;
+        glm::mat4 vertexTransform = glm::mat4(1.0f);
+        MeshResidency residency = MeshResidency::Full;
+        uint32_t vertexCount = 0;
+        uint64_t gpuBytes = 0;
+
+        void Build(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, float optimiseThreshold, uint32_t vertexFormat);
+        void Upload();
     public:
         Mesh();
         Mesh(const Mesh& mesh);
-        Mesh(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, float optimiseThreshold = 0.95f);
+        Mesh(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, float optimiseThreshold = 0.95f, uint32_t vertexFormat = 0,
+             MeshResidency residency = MeshResidency::GPUOnly);
+
+        // Built exactly like the constructor does but never uploaded, everything is kept. Only useful to hand its
+        // data to RestoreCPUData of a mesh made from the same source.
+        static SharedPtr<Mesh> CreateCPUOnly(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, float optimiseThreshold = 0.95f,
+                                             uint32_t vertexFormat = 0);
 
         virtual ~Mesh() = default;
 
@@ -59,6 +126,47 @@ namespace NekoEngine
         const SharedPtr<Material>& GetMaterial() const { return material; }
         const SharedPtr<BoundingBox>& GetBoundingBox() const { return boundingBox; }
 
+        // CPU copies of what was uploaded, as far as the residency keeps them. Indices hold every level of detail
+        // back to back with Full, see GetLod, and only level 0 with Positions. Vertices are only kept with Full.
+        const ArrayList<uint32_t>& GetIndices() const { return indices; }
+        const ArrayList<Vertex>& GetVertices() const { return vertices; }
+        const ArrayList<glm::vec3>& GetPositions() const { return positions; }
+
+        MeshResidency GetResidency() const { return residency; }
+
+        // Drops CPU data down to what residency keeps. False, leaving the mesh as it is, when it asks for data
+        // already dropped. That has to come back through RestoreCPUData, see Model::SetResidency.
+        bool SetResidency(MeshResidency residency);
+
+        // Takes the CPU data of a CreateCPUOnly mesh built from the same source, then keeps what residency asks for.
+        // False when source does not match what this mesh uploaded.
+        bool RestoreCPUData(Mesh& source, MeshResidency residency);
+
+        // Resident CPU copies, and what the vertex and index buffers take
+        uint64_t GetCPUBytes() const;
+        uint64_t GetGPUBytes() const { return gpuBytes; }
+
+        // Level 0 is full detail, every further level has roughly half the triangles of the one before
+        uint32_t GetLodCount() const { return (uint32_t)lods.size(); }
+        const MeshLod& GetLod(uint32_t lod) const { return lods[lod]; }
+
+        // Coarsest level whose error stays within maxError, in object space units
+        uint32_t SelectLod(float maxError) const;
+
+        // Level 0 split into meshlets, empty for meshes below MESHLET_MIN_TRIANGLES.
+        // The meshlets cover level 0 back to back in index buffer order.
+        const ArrayList<Meshlet>& GetMeshlets() const { return meshlets; }
+
+        uint32_t GetVertexFormat() const { return vertexFormat; }
+        bool IsPacked() const { return vertexFormat != 0; }
+
+        // Maps the uploaded positions back to object space, identity unless positions are quantised.
+        // Renderers multiply it into the transform they draw the mesh with.
+        const glm::mat4& GetVertexTransform() const { return vertexTransform; }
+
+        // Layout a pipeline needs to read the format, null for FULL which matches the shader inputs as they are
+        static const SharedPtr<BufferLayout>& GetVertexLayout(uint32_t vertexFormat);
+
         bool IsActive() { return isActive; }
         const std::string& GetName() const { return name; }
 
@@ -6,24 +6,24 @@
 
 namespace NekoEngine
 {
-    Mesh* MeshFactory::CreatePrimative(PrimitiveType type)
+    Mesh* MeshFactory::CreatePrimative(PrimitiveType type, MeshResidency residency)
     {
         switch(type)
         {
             case PrimitiveType::Cube:
-                return CreateCube();
+                return CreateCube(residency);
             case PrimitiveType::Plane:
-                return CreatePlane(1.0f, 1.0f, glm::vec3(0.0f, 1.0f, 0.0f));
+                return CreatePlane(1.0f, 1.0f, glm::vec3(0.0f, 1.0f, 0.0f), residency);
             case PrimitiveType::Quad:
-                return CreateQuad();
+                return CreateQuad(residency);
             case PrimitiveType::Sphere:
-                return CreateSphere();
+                return CreateSphere(64, 64, residency);
             case PrimitiveType::Pyramid:
-                return CreatePyramid();
+                return CreatePyramid(residency);
             case PrimitiveType::Capsule:
-                return CreateCapsule();
+                return CreateCapsule(0.5f, 2.0f, 64, 8, residency);
             case PrimitiveType::Cylinder:
-                return CreateCylinder();
+                return CreateCylinder(0.5f, 0.5f, 1.0f, 64, 8, residency);
             case PrimitiveType::Terrain:
                 // return CreateTerrain(); //TODO: Create Terrain
             default:
@@ -33,7 +33,7 @@ namespace NekoEngine
         }
     }
 
-    Mesh* MeshFactory::CreatePlane(float width, float height, const glm::vec3 &normal)
+    Mesh* MeshFactory::CreatePlane(float width, float height, const glm::vec3 &normal, MeshResidency residency)
     {
         glm::vec3 vec = normal * 90.0f;
         glm::quat rotation =
@@ -62,10 +62,10 @@ namespace NekoEngine
                 0, 1, 2,
                 2, 3, 0
         };
-        return new Mesh(indices, data);
+        return new Mesh(indices, data, 0.95f, 0, residency);
     }
 
-    Mesh* MeshFactory::CreateCube()
+    Mesh* MeshFactory::CreateCube(MeshResidency residency)
     {
         //    v6----- v5
         //   /|      /|
@@ -195,10 +195,10 @@ namespace NekoEngine
                 20, 22, 23
         };
 
-        return new Mesh(indices, data);
+        return new Mesh(indices, data, 0.95f, 0, residency);
     }
 
-    Mesh* MeshFactory::CreateQuad()
+    Mesh* MeshFactory::CreateQuad(MeshResidency residency)
     {
         std::vector<Vertex> data(4);
 
@@ -227,10 +227,10 @@ namespace NekoEngine
                 0,
         };
 
-        return new Mesh(indices, data);
+        return new Mesh(indices, data, 0.95f, 0, residency);
     }
 
-    Mesh* MeshFactory::CreateSphere(uint32_t xSegments, uint32_t ySegments)
+    Mesh* MeshFactory::CreateSphere(uint32_t xSegments, uint32_t ySegments, MeshResidency residency)
     {
         auto data = std::vector<Vertex>();
 
@@ -297,10 +297,10 @@ namespace NekoEngine
             }
         }
 
-        return new Mesh(indices, data);
+        return new Mesh(indices, data, 0.95f, 0, residency);
     }
 
-    Mesh* MeshFactory::CreateCapsule(float radius, float midHeight, int radialSegments, int rings)
+    Mesh* MeshFactory::CreateCapsule(float radius, float midHeight, int radialSegments, int rings, MeshResidency residency)
     {
         int i, j, prevrow, thisrow, point;
         float x, y, z, u, v, w;
@@ -450,10 +450,10 @@ namespace NekoEngine
             thisrow = point;
         }
 
-        return new Mesh(indices, data);
+        return new Mesh(indices, data, 0.95f, 0, residency);
     }
 
-    Mesh* MeshFactory::CreatePyramid()
+    Mesh* MeshFactory::CreatePyramid(MeshResidency residency)
     {
         std::vector<Vertex> data(18);
 
@@ -556,10 +556,10 @@ namespace NekoEngine
                 15, 12, 14
         };
 
-        return new Mesh(indices, data);
+        return new Mesh(indices, data, 0.95f, 0, residency);
     }
 
-    Mesh* MeshFactory::CreateCylinder(float bottomRadius, float topRadius, float height, int radialSegments, int rings)
+    Mesh* MeshFactory::CreateCylinder(float bottomRadius, float topRadius, float height, int radialSegments, int rings, MeshResidency residency)
     {
         int i, j, prevrow, thisrow, point = 0;
         float x, y, z, u, v, radius;
@@ -695,6 +695,6 @@ namespace NekoEngine
             };
         };
 
-        return new Mesh(indices, data);
+        return new Mesh(indices, data, 0.95f, 0, residency);
     }
 }
\ No newline at end of file
@@ -5,16 +5,16 @@ namespace NekoEngine
 {
     namespace MeshFactory
     {
-        Mesh* CreatePrimative(PrimitiveType type);
-        Mesh* CreateQuad();
+        Mesh* CreatePrimative(PrimitiveType type, MeshResidency residency = MeshResidency::GPUOnly);
+        Mesh* CreateQuad(MeshResidency residency = MeshResidency::GPUOnly);
         Mesh* CreateQuad(float x, float y, float width, float height);
         Mesh* CreateQuad(const FVector2& position, const FVector2& size);
-        Mesh* CreateCube();
-        Mesh* CreatePyramid();
-        Mesh* CreateSphere(uint32_t xSegments = 64, uint32_t ySegments = 64);
-        Mesh* CreateCapsule(float radius = 0.5f, float midHeight = 2.0f, int radialSegments = 64, int rings = 8);
-        Mesh* CreatePlane(float width, float height, const FVector3& normal);
-        Mesh* CreateCylinder(float bottomRadius = 0.5f, float topRadius = 0.5f, float height = 1.0f, int radialSegments = 64, int rings = 8);
+        Mesh* CreateCube(MeshResidency residency = MeshResidency::GPUOnly);
+        Mesh* CreatePyramid(MeshResidency residency = MeshResidency::GPUOnly);
+        Mesh* CreateSphere(uint32_t xSegments = 64, uint32_t ySegments = 64, MeshResidency residency = MeshResidency::GPUOnly);
+        Mesh* CreateCapsule(float radius = 0.5f, float midHeight = 2.0f, int radialSegments = 64, int rings = 8, MeshResidency residency = MeshResidency::GPUOnly);
+        Mesh* CreatePlane(float width, float height, const FVector3& normal, MeshResidency residency = MeshResidency::GPUOnly);
+        Mesh* CreateCylinder(float bottomRadius = 0.5f, float topRadius = 0.5f, float height = 1.0f, int radialSegments = 64, int rings = 8, MeshResidency residency = MeshResidency::GPUOnly);
         Mesh* CreateTerrain();
     }
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "File/VirtualFileSystem.h"
 #include "Model.h"
 #include "StringUtility.h"
+#include "Math/Maths.h"
 
 namespace NekoEngine
 {
@@ -23,6 +24,12 @@ namespace NekoEngine
     }
 
     void Model::LoadModel(const String &path)
+    {
+        LoadMeshes(path, meshes, true);
+        LOG_FORMAT("Model::LoadModel: Load model: %s", path.c_str());
+    }
+
+    void Model::LoadMeshes(const String &path, ArrayList<SharedPtr<Mesh>> &result, bool upload)
     {
         //TODO load model
         String resolvedPath;
@@ -35,7 +42,7 @@ namespace NekoEngine
 
         if(fileExtension == "fbx" || fileExtension == "FBX")
         {
-            LoadFBX(resolvedPath);
+            LoadFBX(resolvedPath, result, upload);
         }
         else if(fileExtension == "obj" || fileExtension == "OBJ")
         {
@@ -49,8 +56,68 @@ namespace NekoEngine
         {
             LOG_FORMAT("Model::LoadModel: Unsupport file extension: %s", fileExtension.c_str());
         }
+    }
+
+    MeshResidency Model::GetResidency() const
+    {
+        MeshResidency residency = MeshResidency::Full;
+        for(auto &mesh: meshes)
+            residency = Maths::Min(residency, mesh->GetResidency());
+        return residency;
+    }
+
+    bool Model::SetResidency(MeshResidency residency)
+    {
+        bool missing = false;
+        for(auto &mesh: meshes)
+        {
+            if(!mesh->SetResidency(residency))
+                missing = true;
+        }
 
+        if(!missing)
+            return true;
 
-        LOG_FORMAT("Model::LoadModel: Load model: %s", path.c_str());
+        if(sourceUnavailable)
+            return false;
+
+        // There are no cooked meshes to read back, so the source is built again without uploading it and only
+        // its CPU data is kept. Primitives are cheap to make, their buffers go with the temporary meshes.
+        ArrayList<SharedPtr<Mesh>> source;
+        if(primitiveType == PrimitiveType::File)
+            LoadMeshes(filePath, source, false);
+        else if(primitiveType != PrimitiveType::None && meshes.size() == 1)
+            source.emplace_back(MeshFactory::CreatePrimative(primitiveType, MeshResidency::Full));
+
+        bool restored = source.size() == meshes.size();
+        for(size_t i = 0; restored && i < meshes.size(); i++)
+        {
+            if(meshes[i]->GetResidency() < residency && (!source[i] || !meshes[i]->RestoreCPUData(*source[i], residency)))
+                restored = false;
+        }
+
+        if(!restored)
+        {
+            LOG_FORMAT("Model::SetResidency: Can't rebuild the CPU data of %s", filePath.c_str());
+            sourceUnavailable = true;
+        }
+
+        return restored;
+    }
+
+    uint64_t Model::GetCPUBytes() const
+    {
+        uint64_t bytes = 0;
+        for(auto &mesh: meshes)
+            bytes += mesh->GetCPUBytes();
+        return bytes;
+    }
+
+    uint64_t Model::GetGPUBytes() const
+    {
+        uint64_t bytes = 0;
+        for(auto &mesh: meshes)
+            bytes += mesh->GetGPUBytes();
+        return bytes;
     }
 }
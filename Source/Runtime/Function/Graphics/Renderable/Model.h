@@ -17,6 +17,7 @@ namespace NekoEngine
         PrimitiveType primitiveType = PrimitiveType::None;
         ArrayList<SharedPtr<Mesh>> meshes;
         String filePath;
+        bool sourceUnavailable = false; // Reloading CPU data failed once, it is not tried again
     public:
         Model() = default;
         Model(const String& _filePath);
@@ -33,6 +34,16 @@ namespace NekoEngine
         const std::string& GetFilePath() const { return filePath; }
         PrimitiveType GetPrimitiveType() { return primitiveType; }
         void SetPrimitiveType(PrimitiveType type) { primitiveType = type; }
+
+        // Lowest residency of the meshes, meshes keep nothing on the CPU once uploaded unless asked to
+        MeshResidency GetResidency() const;
+
+        // Every mesh keeps what residency asks for. CPU data dropped already is rebuilt from the file the model
+        // was loaded from, or the primitive regenerated, so this can be slow. False when that fails.
+        bool SetResidency(MeshResidency residency);
+
+        uint64_t GetCPUBytes() const;
+        uint64_t GetGPUBytes() const;
         SET_ASSET_TYPE(AssetType::Model);
 
         template <typename Archive>
@@ -74,8 +85,11 @@ namespace NekoEngine
         }
 
     private:
+        // Meshes of the file at path go to result, without upload they only hold CPU data
+        void LoadMeshes(const String& path, ArrayList<SharedPtr<Mesh>>& result, bool upload);
+
         void LoadOBJ(const String& path);
         void LoadGLTF(const String & path);
-        void LoadFBX(const String& path);
+        void LoadFBX(const String& path, ArrayList<SharedPtr<Mesh>>& result, bool upload);
     };
 }
\ No newline at end of file
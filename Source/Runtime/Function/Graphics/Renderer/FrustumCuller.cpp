@@ -0,0 +1,186 @@
+#include "FrustumCuller.h"
+#include "Renderable/Mesh.h"
+#include "JobSystem/ParallelEach.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define NEKO_CULL_SSE 1
+#endif
+
+namespace NekoEngine
+{
+    void FrustumCuller::Begin()
+    {
+        m_Count = 0;
+    }
+
+    uint32_t FrustumCuller::Add(entt::entity entity, Mesh* mesh, const glm::mat4* worldTransform)
+    {
+        uint32_t index = m_Count++;
+        if(index >= m_Items.size())
+            m_Items.emplace_back();
+
+        Item& item = m_Items[index];
+        if(item.entity != entity || item.mesh != mesh)
+        {
+            item.entity = entity;
+            item.mesh   = mesh;
+            item.stale  = true;
+        }
+
+        item.worldTransform = worldTransform;
+        return index;
+    }
+
+    glm::vec3 FrustumCuller::GetCenter(uint32_t index) const
+    {
+        return glm::vec3(m_MinX[index] + m_MaxX[index], m_MinY[index] + m_MaxY[index], m_MinZ[index] + m_MaxZ[index]) * 0.5f;
+    }
+
+    void FrustumCuller::GetBounds(uint32_t index, glm::vec3& min, glm::vec3& max) const
+    {
+        min = glm::vec3(m_MinX[index], m_MinY[index], m_MinZ[index]);
+        max = glm::vec3(m_MaxX[index], m_MaxY[index], m_MaxZ[index]);
+    }
+
+    void FrustumCuller::Cull(const Frustum* views, uint32_t viewCount)
+    {
+        m_NumBoundsUpdated = 0;
+        viewCount          = Maths::Min(viewCount, CULL_MAX_VIEWS);
+
+        const uint32_t padded = (m_Count + 3) & ~3u;
+        const uint32_t words  = (m_Count + 63) / 64;
+
+        // Never shrink, slots past the current count keep their bounds for when they come back
+        if(m_MinX.size() < padded)
+        {
+            m_MinX.resize(padded);
+            m_MinY.resize(padded);
+            m_MinZ.resize(padded);
+            m_MaxX.resize(padded);
+            m_MaxY.resize(padded);
+            m_MaxZ.resize(padded);
+        }
+
+        for(uint32_t view = 0; view < viewCount; view++)
+        {
+            m_Visibility[view].resize(words);
+
+            for(int i = 0; i < 6; i++)
+            {
+                const Plane& plane  = views[view].GetPlane(i);
+                m_Planes[view][i][0] = plane.Normal().x;
+                m_Planes[view][i][1] = plane.Normal().y;
+                m_Planes[view][i][2] = plane.Normal().z;
+                m_Planes[view][i][3] = plane.Distance();
+            }
+        }
+
+        if(m_Count == 0)
+            return;
+
+        // Chunks cover whole 64 bit words so no two workers write the same bitset word
+        const uint32_t grainSize = (JobSystem::AutoGrainSize(m_Count) + 63) & ~63u;
+        m_ChunkUpdates.assign(JobSystem::ChunkCount(m_Count, grainSize), 0);
+
+        JobSystem::ParallelFor(m_Count, grainSize, [this, viewCount](uint32_t begin, uint32_t end, uint32_t chunk)
+                               {
+                                   m_ChunkUpdates[chunk] = UpdateBounds(begin, end);
+                                   TestRange(begin, end, viewCount);
+                               });
+
+        for(uint32_t updated : m_ChunkUpdates)
+            m_NumBoundsUpdated += updated;
+    }
+
+    uint32_t FrustumCuller::UpdateBounds(uint32_t begin, uint32_t end)
+    {
+        uint32_t updated = 0;
+
+        for(uint32_t i = begin; i < end; i++)
+        {
+            Item& item = m_Items[i];
+
+            if(!item.stale && memcmp(&item.cachedTransform, item.worldTransform, sizeof(glm::mat4)) == 0)
+            {
+                item.unchangedFrames = Maths::Min(item.unchangedFrames + 1, StaticFrameCount);
+                continue;
+            }
+
+            item.cachedTransform = *item.worldTransform;
+            item.unchangedFrames = 0;
+            item.stale           = false;
+
+            BoundingBox box = item.mesh->GetBoundingBox()->Transformed(item.cachedTransform);
+            glm::vec3 min   = box.GetMin();
+            glm::vec3 max   = box.GetMax();
+
+            m_MinX[i] = min.x;
+            m_MinY[i] = min.y;
+            m_MinZ[i] = min.z;
+            m_MaxX[i] = max.x;
+            m_MaxY[i] = max.y;
+            m_MaxZ[i] = max.z;
+            updated++;
+        }
+
+        return updated;
+    }
+
+    void FrustumCuller::TestRange(uint32_t begin, uint32_t end, uint32_t viewCount)
+    {
+        for(uint32_t view = 0; view < viewCount; view++)
+        {
+            uint64_t* bits = m_Visibility[view].data();
+            for(uint32_t word = begin / 64; word < (end + 63) / 64; word++)
+                bits[word] = 0;
+        }
+
+        for(uint32_t i = begin; i < end; i += 4)
+        {
+            // Lanes past the last item are padding
+            const uint32_t validMask = end - i >= 4 ? 0xf : (1u << (end - i)) - 1;
+
+#if NEKO_CULL_SSE
+            const __m128 minX = _mm_loadu_ps(&m_MinX[i]);
+            const __m128 minY = _mm_loadu_ps(&m_MinY[i]);
+            const __m128 minZ = _mm_loadu_ps(&m_MinZ[i]);
+            const __m128 maxX = _mm_loadu_ps(&m_MaxX[i]);
+            const __m128 maxY = _mm_loadu_ps(&m_MaxY[i]);
+            const __m128 maxZ = _mm_loadu_ps(&m_MaxZ[i]);
+            const __m128 zero = _mm_setzero_ps();
+#endif
+
+            for(uint32_t view = 0; view < viewCount; view++)
+            {
+                uint32_t mask = validMask;
+
+                for(int p = 0; p < 6 && mask; p++)
+                {
+                    // A box is outside when its corner furthest along the plane normal is behind it
+                    const float* plane = m_Planes[view][p];
+#if NEKO_CULL_SSE
+                    __m128 x    = plane[0] >= 0.0f ? maxX : minX;
+                    __m128 y    = plane[1] >= 0.0f ? maxY : minY;
+                    __m128 z    = plane[2] >= 0.0f ? maxZ : minZ;
+                    __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane[0])), _mm_mul_ps(y, _mm_set1_ps(plane[1]))),
+                                             _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(plane[2])), _mm_set1_ps(plane[3])));
+                    mask &= (uint32_t)_mm_movemask_ps(_mm_cmpge_ps(dist, zero));
+#else
+                    const float* x = plane[0] >= 0.0f ? &m_MaxX[i] : &m_MinX[i];
+                    const float* y = plane[1] >= 0.0f ? &m_MaxY[i] : &m_MinY[i];
+                    const float* z = plane[2] >= 0.0f ? &m_MaxZ[i] : &m_MinZ[i];
+                    for(uint32_t lane = 0; lane < 4; lane++)
+                    {
+                        if(x[lane] * plane[0] + y[lane] * plane[1] + z[lane] * plane[2] + plane[3] < 0.0f)
+                            mask &= ~(1u << lane);
+                    }
+#endif
+                }
+
+                m_Visibility[view][i >> 6] |= (uint64_t)mask << (i & 63);
+            }
+        }
+    }
+
+} // NekoEngine
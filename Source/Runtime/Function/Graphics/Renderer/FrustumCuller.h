@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Core.h"
+#include "Math/Frustum.h"
+#include "RHI/Definitions.h"
+#include "entt/entt.hpp"
+
+namespace NekoEngine
+{
+    class Mesh;
+
+    // Camera plus every shadow cascade
+    static constexpr uint32_t CULL_MAX_VIEWS = 1 + SHADOWMAP_MAX;
+
+    // Frustum culls every (entity, mesh) pair against several views in one pass.
+    // World space AABBs are kept in packed SoA arrays and only re-transformed when the world matrix or
+    // the mesh in a slot changed since last frame. Boxes are tested four at a time against the planes
+    // of all views, chunked over the job system, and the result is one visibility bitset per view.
+    class FrustumCuller
+    {
+    public:
+        // Frames a slot's transform and mesh have to stay the same before it counts as static
+        static constexpr uint32_t StaticFrameCount = 30;
+
+        // Items are added in the same order every frame so unchanged slots keep their cached bounds
+        void Begin();
+        uint32_t Add(entt::entity entity, Mesh* mesh, const glm::mat4* worldTransform);
+
+        void Cull(const Frustum* views, uint32_t viewCount);
+
+        bool IsVisible(uint32_t view, uint32_t index) const
+        {
+            return (m_Visibility[view][index >> 6] >> (index & 63)) & 1;
+        }
+
+        // Later passes (occlusion) may only clear bits, and only from chunks covering whole 64 bit words
+        void Hide(uint32_t view, uint32_t index)
+        {
+            m_Visibility[view][index >> 6] &= ~(1ull << (index & 63));
+        }
+
+        const ArrayList<uint64_t>& GetVisibility(uint32_t view) const { return m_Visibility[view]; }
+        glm::vec3 GetCenter(uint32_t index) const;
+        void GetBounds(uint32_t index, glm::vec3& min, glm::vec3& max) const;
+
+        Mesh* GetMesh(uint32_t index) const { return m_Items[index].mesh; }
+        const glm::mat4& GetTransform(uint32_t index) const { return *m_Items[index].worldTransform; }
+        bool IsStatic(uint32_t index) const { return m_Items[index].unchangedFrames >= StaticFrameCount; }
+
+        uint32_t GetCount() const { return m_Count; }
+        uint32_t GetNumBoundsUpdated() const { return m_NumBoundsUpdated; }
+
+    private:
+        struct Item
+        {
+            entt::entity entity             = entt::null;
+            Mesh* mesh                      = nullptr;
+            const glm::mat4* worldTransform = nullptr;
+            glm::mat4 cachedTransform       = glm::mat4(1.0f);
+            uint32_t unchangedFrames        = 0;
+            bool stale                      = true;
+        };
+
+        uint32_t UpdateBounds(uint32_t begin, uint32_t end);
+        void TestRange(uint32_t begin, uint32_t end, uint32_t viewCount);
+
+        ArrayList<Item> m_Items;
+
+        // SoA world AABBs, padded to a multiple of four
+        ArrayList<float> m_MinX, m_MinY, m_MinZ;
+        ArrayList<float> m_MaxX, m_MaxY, m_MaxZ;
+
+        // Per view plane data, x/y/z/w of the six planes
+        float m_Planes[CULL_MAX_VIEWS][6][4];
+
+        ArrayList<uint64_t> m_Visibility[CULL_MAX_VIEWS];
+        ArrayList<uint32_t> m_ChunkUpdates;
+
+        uint32_t m_Count            = 0;
+        uint32_t m_NumBoundsUpdated = 0;
+    };
+
+} // NekoEngine
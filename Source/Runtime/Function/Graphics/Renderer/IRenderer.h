@@ -15,6 +15,8 @@ namespace NekoEngine
         Pipeline* pipeline = nullptr;
         glm::mat4 transform;
         glm::mat4 textureMatrix;
+        uint64_t sortKey = 0; // See RenderSortKey
+        uint32_t lod = 0;     // Level of detail of mesh, see Mesh::GetLod
         bool animated = false;
     };
 
@@ -0,0 +1,322 @@
+#include "LightClusterer.h"
+#include "JobSystem/ParallelEach.h"
+#include <cfloat>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define NEKO_CLUSTER_SSE 1
+#endif
+
+namespace NekoEngine
+{
+    void LightClusterer::Begin(const glm::mat4& view, const glm::mat4& projection, float nearPlane, float farPlane)
+    {
+        nearPlane = Maths::Max(nearPlane, 0.0001f);
+        farPlane  = Maths::Max(farPlane, nearPlane * 1.001f);
+
+        if(projection != m_Projection || nearPlane != m_Near || farPlane != m_Far)
+        {
+            m_Projection   = projection;
+            m_Near         = nearPlane;
+            m_Far          = farPlane;
+            m_FroxelsDirty = true;
+        }
+
+        m_View = view;
+        m_DirectionalLights.clear();
+        m_LocalLights.clear();
+    }
+
+    void LightClusterer::AddLight(const Light& light)
+    {
+        if(light.Type == float(LightType::DirectionalLight))
+            m_DirectionalLights.push_back(light);
+        else
+            m_LocalLights.push_back(light);
+    }
+
+    void LightClusterer::BuildFroxels()
+    {
+        m_FroxelsDirty = false;
+
+        const float logRatio = std::log(m_Far / m_Near);
+        m_DepthSliceParams.x = float(CLUSTER_GRID_Z) / logRatio;
+        m_DepthSliceParams.y = -float(CLUSTER_GRID_Z) * std::log(m_Near) / logRatio;
+
+        for(uint32_t slice = 0; slice <= CLUSTER_GRID_Z; slice++)
+            m_SliceDepth[slice] = m_Near * std::pow(m_Far / m_Near, float(slice) / float(CLUSTER_GRID_Z));
+
+        m_MinX.resize(CLUSTER_COUNT);
+        m_MinY.resize(CLUSTER_COUNT);
+        m_MinZ.resize(CLUSTER_COUNT);
+        m_MaxX.resize(CLUSTER_COUNT);
+        m_MaxY.resize(CLUSTER_COUNT);
+        m_MaxZ.resize(CLUSTER_COUNT);
+        m_CenterX.resize(CLUSTER_COUNT);
+        m_CenterY.resize(CLUSTER_COUNT);
+        m_CenterZ.resize(CLUSTER_COUNT);
+        m_Radius.resize(CLUSTER_COUNT);
+
+        // Every tile corner is a line through view space, froxel corners are where it crosses the slice depths.
+        // Unprojecting a point on each clip plane works for perspective and orthographic cameras alike.
+        const uint32_t cornersX = CLUSTER_GRID_X + 1;
+        glm::vec3 nearPoints[(CLUSTER_GRID_X + 1) * (CLUSTER_GRID_Y + 1)];
+        glm::vec3 farPoints[(CLUSTER_GRID_X + 1) * (CLUSTER_GRID_Y + 1)];
+
+        const glm::mat4 invProjection = glm::inverse(m_Projection);
+        for(uint32_t y = 0; y <= CLUSTER_GRID_Y; y++)
+        {
+            for(uint32_t x = 0; x <= CLUSTER_GRID_X; x++)
+            {
+                const glm::vec2 ndc = glm::vec2(float(x) / CLUSTER_GRID_X, float(y) / CLUSTER_GRID_Y) * 2.0f - 1.0f;
+                const glm::vec4 nearPoint = invProjection * glm::vec4(ndc, -1.0f, 1.0f);
+                const glm::vec4 farPoint  = invProjection * glm::vec4(ndc, 1.0f, 1.0f);
+
+                nearPoints[y * cornersX + x] = glm::vec3(nearPoint) / nearPoint.w;
+                farPoints[y * cornersX + x]  = glm::vec3(farPoint) / farPoint.w;
+            }
+        }
+
+        for(uint32_t slice = 0; slice < CLUSTER_GRID_Z; slice++)
+        {
+            for(uint32_t y = 0; y < CLUSTER_GRID_Y; y++)
+            {
+                for(uint32_t x = 0; x < CLUSTER_GRID_X; x++)
+                {
+                    glm::vec3 min = glm::vec3(FLT_MAX);
+                    glm::vec3 max = glm::vec3(-FLT_MAX);
+
+                    for(uint32_t corner = 0; corner < 8; corner++)
+                    {
+                        const uint32_t point = (y + ((corner >> 1) & 1)) * cornersX + x + (corner & 1);
+                        const float depth    = m_SliceDepth[slice + (corner >> 2)];
+
+                        const glm::vec3& a = nearPoints[point];
+                        const glm::vec3& b = farPoints[point];
+                        const glm::vec3 p  = a + (b - a) * ((-depth - a.z) / (b.z - a.z));
+
+                        min = glm::min(min, p);
+                        max = glm::max(max, p);
+                    }
+
+                    const uint32_t cluster = slice * CLUSTER_SLICE_SIZE + y * CLUSTER_GRID_X + x;
+                    const glm::vec3 center = (min + max) * 0.5f;
+
+                    m_MinX[cluster]    = min.x;
+                    m_MinY[cluster]    = min.y;
+                    m_MinZ[cluster]    = min.z;
+                    m_MaxX[cluster]    = max.x;
+                    m_MaxY[cluster]    = max.y;
+                    m_MaxZ[cluster]    = max.z;
+                    m_CenterX[cluster] = center.x;
+                    m_CenterY[cluster] = center.y;
+                    m_CenterZ[cluster] = center.z;
+                    m_Radius[cluster]  = glm::length(max - center);
+                }
+            }
+        }
+    }
+
+    void LightClusterer::Build()
+    {
+        if(m_FroxelsDirty)
+            BuildFroxels();
+
+        m_Lights.clear();
+        m_Bounds.clear();
+        m_Lights.insert(m_Lights.end(), m_DirectionalLights.begin(), m_DirectionalLights.end());
+        m_DirectionalLightCount = (uint32_t)m_Lights.size();
+        m_Grid.resize(CLUSTER_COUNT);
+
+        for(auto& sliceLights : m_SliceLights)
+            sliceLights.clear();
+
+        auto getSlice = [this](float depth)
+        {
+            const float slice = std::log(Maths::Max(depth, m_Near)) * m_DepthSliceParams.x + m_DepthSliceParams.y;
+            return (uint32_t)Maths::Min(Maths::Max(slice, 0.0f), float(CLUSTER_GRID_Z - 1));
+        };
+
+        for(auto& light : m_LocalLights)
+        {
+            LightBounds bounds;
+            bounds.position  = glm::vec3(m_View * glm::vec4(glm::vec3(light.Position), 1.0f));
+            bounds.range     = light.Radius;
+            bounds.center    = bounds.position;
+            bounds.radius    = bounds.range;
+            bounds.direction = glm::vec3(0.0f);
+            bounds.cosAngle  = -1.0f;
+            bounds.sinAngle  = 0.0f;
+            bounds.cone      = false;
+
+            if(bounds.range <= 0.0f)
+                continue;
+
+            if(light.Type == float(LightType::SpotLight))
+            {
+                // The shader lights fragments where dot(toLight, Direction) > 1 - Angle, so the cone points
+                // away from Direction. Cones of 90 degrees or wider are culled as spheres.
+                const float cosAngle = 1.0f - light.Angle;
+                if(cosAngle >= 1.0f)
+                    continue;
+
+                if(cosAngle > 0.0f)
+                {
+                    bounds.direction = -glm::normalize(glm::mat3(m_View) * glm::vec3(light.Direction));
+                    bounds.cosAngle  = cosAngle;
+                    bounds.sinAngle  = std::sqrt(1.0f - cosAngle * cosAngle);
+                    bounds.cone      = true;
+
+                    // Smallest sphere around the cone
+                    if(cosAngle < 0.70710678f)
+                    {
+                        bounds.center = bounds.position + bounds.direction * (cosAngle * bounds.range);
+                        bounds.radius = bounds.sinAngle * bounds.range;
+                    }
+                    else
+                    {
+                        bounds.center = bounds.position + bounds.direction * (bounds.range / (2.0f * cosAngle));
+                        bounds.radius = bounds.range / (2.0f * cosAngle);
+                    }
+                }
+            }
+
+            const float minDepth = -bounds.center.z - bounds.radius;
+            const float maxDepth = -bounds.center.z + bounds.radius;
+            if(maxDepth <= m_Near || minDepth >= m_Far)
+                continue;
+
+            const uint32_t index = (uint32_t)m_Lights.size();
+            m_Lights.push_back(light);
+            m_Bounds.push_back(bounds);
+
+            for(uint32_t slice = getSlice(minDepth); slice <= getSlice(maxDepth); slice++)
+                m_SliceLights[slice].push_back(index);
+        }
+
+        JobSystem::ParallelFor(CLUSTER_GRID_Z, 1, [this](uint32_t begin, uint32_t end, uint32_t chunk)
+                               {
+                                   for(uint32_t slice = begin; slice < end; slice++)
+                                       BinSlice(slice);
+                               });
+
+        // Slices were binned with offsets into their own lists, rebase them onto the merged list
+        m_Indices.clear();
+        for(uint32_t slice = 0; slice < CLUSTER_GRID_Z; slice++)
+        {
+            const uint32_t base = (uint32_t)m_Indices.size();
+            for(uint32_t cluster = slice * CLUSTER_SLICE_SIZE; cluster < (slice + 1) * CLUSTER_SLICE_SIZE; cluster++)
+                m_Grid[cluster].offset += base;
+
+            m_Indices.insert(m_Indices.end(), m_SliceIndices[slice].begin(), m_SliceIndices[slice].end());
+        }
+    }
+
+    void LightClusterer::BinSlice(uint32_t slice)
+    {
+        const ArrayList<uint32_t>& lights = m_SliceLights[slice];
+        ArrayList<uint32_t>& indices      = m_SliceIndices[slice];
+        ArrayList<uint8_t>& masks         = m_SliceMasks[slice];
+        ClusterRange* grid                = &m_Grid[slice * CLUSTER_SLICE_SIZE];
+
+        indices.clear();
+        masks.resize(lights.size());
+
+        for(uint32_t group = 0; group < CLUSTER_SLICE_SIZE; group += 4)
+        {
+            const uint32_t first = slice * CLUSTER_SLICE_SIZE + group;
+
+#if NEKO_CLUSTER_SSE
+            const __m128 minX    = _mm_loadu_ps(&m_MinX[first]);
+            const __m128 minY    = _mm_loadu_ps(&m_MinY[first]);
+            const __m128 minZ    = _mm_loadu_ps(&m_MinZ[first]);
+            const __m128 maxX    = _mm_loadu_ps(&m_MaxX[first]);
+            const __m128 maxY    = _mm_loadu_ps(&m_MaxY[first]);
+            const __m128 maxZ    = _mm_loadu_ps(&m_MaxZ[first]);
+            const __m128 centerX = _mm_loadu_ps(&m_CenterX[first]);
+            const __m128 centerY = _mm_loadu_ps(&m_CenterY[first]);
+            const __m128 centerZ = _mm_loadu_ps(&m_CenterZ[first]);
+            const __m128 radius  = _mm_loadu_ps(&m_Radius[first]);
+            const __m128 zero    = _mm_setzero_ps();
+#endif
+
+            for(uint32_t i = 0; i < (uint32_t)lights.size(); i++)
+            {
+                const LightBounds& bounds = m_Bounds[lights[i] - m_DirectionalLightCount];
+
+#if NEKO_CLUSTER_SSE
+                // Sphere against the froxel AABBs, distance from the center to the closest point of each box
+                const __m128 lightX = _mm_set1_ps(bounds.center.x);
+                const __m128 lightY = _mm_set1_ps(bounds.center.y);
+                const __m128 lightZ = _mm_set1_ps(bounds.center.z);
+                const __m128 dx     = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minX, lightX), _mm_sub_ps(lightX, maxX)), zero);
+                const __m128 dy     = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minY, lightY), _mm_sub_ps(lightY, maxY)), zero);
+                const __m128 dz     = _mm_max_ps(_mm_max_ps(_mm_sub_ps(minZ, lightZ), _mm_sub_ps(lightZ, maxZ)), zero);
+                const __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+                uint32_t mask = (uint32_t)_mm_movemask_ps(_mm_cmple_ps(distSq, _mm_set1_ps(bounds.radius * bounds.radius)));
+
+                if(mask && bounds.cone)
+                {
+                    // Cone against the froxel bounding spheres
+                    const __m128 vx     = _mm_sub_ps(centerX, _mm_set1_ps(bounds.position.x));
+                    const __m128 vy     = _mm_sub_ps(centerY, _mm_set1_ps(bounds.position.y));
+                    const __m128 vz     = _mm_sub_ps(centerZ, _mm_set1_ps(bounds.position.z));
+                    const __m128 lenSq  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+                    const __m128 axial  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, _mm_set1_ps(bounds.direction.x)),
+                                                                _mm_mul_ps(vy, _mm_set1_ps(bounds.direction.y))),
+                                                     _mm_mul_ps(vz, _mm_set1_ps(bounds.direction.z)));
+                    const __m128 radial = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(lenSq, _mm_mul_ps(axial, axial)), zero));
+                    const __m128 dist   = _mm_sub_ps(_mm_mul_ps(radial, _mm_set1_ps(bounds.cosAngle)),
+                                                     _mm_mul_ps(axial, _mm_set1_ps(bounds.sinAngle)));
+
+                    const __m128 outside = _mm_or_ps(_mm_or_ps(_mm_cmpgt_ps(dist, radius),
+                                                               _mm_cmpgt_ps(axial, _mm_add_ps(radius, _mm_set1_ps(bounds.range)))),
+                                                     _mm_cmplt_ps(axial, _mm_sub_ps(zero, radius)));
+                    mask &= ~(uint32_t)_mm_movemask_ps(outside);
+                }
+#else
+                uint32_t mask = 0;
+                for(uint32_t lane = 0; lane < 4; lane++)
+                {
+                    const uint32_t cluster = first + lane;
+                    const float dx = Maths::Max(Maths::Max(m_MinX[cluster] - bounds.center.x, bounds.center.x - m_MaxX[cluster]), 0.0f);
+                    const float dy = Maths::Max(Maths::Max(m_MinY[cluster] - bounds.center.y, bounds.center.y - m_MaxY[cluster]), 0.0f);
+                    const float dz = Maths::Max(Maths::Max(m_MinZ[cluster] - bounds.center.z, bounds.center.z - m_MaxZ[cluster]), 0.0f);
+                    if(dx * dx + dy * dy + dz * dz > bounds.radius * bounds.radius)
+                        continue;
+
+                    if(bounds.cone)
+                    {
+                        const glm::vec3 v   = glm::vec3(m_CenterX[cluster], m_CenterY[cluster], m_CenterZ[cluster]) - bounds.position;
+                        const float axial   = glm::dot(v, bounds.direction);
+                        const float radial  = std::sqrt(Maths::Max(glm::dot(v, v) - axial * axial, 0.0f));
+                        const float dist    = radial * bounds.cosAngle - axial * bounds.sinAngle;
+                        const float radius  = m_Radius[cluster];
+                        if(dist > radius || axial > radius + bounds.range || axial < -radius)
+                            continue;
+                    }
+
+                    mask |= 1u << lane;
+                }
+#endif
+                masks[i] = (uint8_t)mask;
+            }
+
+            for(uint32_t lane = 0; lane < 4; lane++)
+            {
+                ClusterRange& range = grid[group + lane];
+                range.offset = (uint32_t)indices.size();
+
+                for(uint32_t i = 0; i < (uint32_t)lights.size(); i++)
+                {
+                    if((masks[i] >> lane) & 1)
+                        indices.push_back(lights[i]);
+                }
+
+                range.count = (uint32_t)indices.size() - range.offset;
+            }
+        }
+    }
+
+} // NekoEngine
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Core.h"
+#include "Renderable/Light.h"
+
+namespace NekoEngine
+{
+    // Froxel grid: tiles evenly split NDC, depth slices are exponential between the near and far plane
+    static constexpr uint32_t CLUSTER_GRID_X = 16;
+    static constexpr uint32_t CLUSTER_GRID_Y = 9;
+    static constexpr uint32_t CLUSTER_GRID_Z = 24;
+    static constexpr uint32_t CLUSTER_SLICE_SIZE = CLUSTER_GRID_X * CLUSTER_GRID_Y;
+    static constexpr uint32_t CLUSTER_COUNT = CLUSTER_SLICE_SIZE * CLUSTER_GRID_Z;
+
+    // Assigns point and spot lights to a view space froxel grid, so the forward shader only loops over the
+    // lights that can reach the cluster a pixel falls in. Froxel bounds are only rebuilt when the projection
+    // changes. Lights are binned one depth slice per job, each light tested against four froxels at a time.
+    //
+    // The output is laid out the way the shader reads it:
+    //  lights  - directional lights first, they light every pixel, then the clustered lights
+    //  grid    - per cluster offset and count into indices, x fastest, then y, then z
+    //  indices - indices into lights, one contiguous list per cluster
+    class LightClusterer
+    {
+    public:
+        struct ClusterRange
+        {
+            uint32_t offset = 0;
+            uint32_t count  = 0;
+        };
+
+        void Begin(const glm::mat4& view, const glm::mat4& projection, float nearPlane, float farPlane);
+
+        // Position, direction and intensity are taken as given, lights must already be in world space
+        void AddLight(const Light& light);
+        void Build();
+
+        const ArrayList<Light>& GetLights() const { return m_Lights; }
+        const ArrayList<ClusterRange>& GetGrid() const { return m_Grid; }
+        const ArrayList<uint32_t>& GetIndices() const { return m_Indices; }
+        uint32_t GetDirectionalLightCount() const { return m_DirectionalLightCount; }
+
+        // slice = log(viewDepth) * x + y
+        glm::vec2 GetDepthSliceParams() const { return m_DepthSliceParams; }
+
+    private:
+        // View space bounds of a point light, or of a spot light's cone
+        struct LightBounds
+        {
+            glm::vec3 center;
+            float radius;
+            glm::vec3 position;
+            float range;
+            glm::vec3 direction; // Cone axis, away from the light
+            float cosAngle;
+            float sinAngle;
+            bool cone;
+        };
+
+        void BuildFroxels();
+        void BinSlice(uint32_t slice);
+
+        glm::mat4 m_View             = glm::mat4(1.0f);
+        glm::mat4 m_Projection       = glm::mat4(0.0f);
+        float m_Near                 = 0.0f;
+        float m_Far                  = 0.0f;
+        glm::vec2 m_DepthSliceParams = glm::vec2(0.0f);
+        bool m_FroxelsDirty          = true;
+
+        // SoA view space froxel AABBs and bounding spheres, a slice is a multiple of four
+        ArrayList<float> m_MinX, m_MinY, m_MinZ;
+        ArrayList<float> m_MaxX, m_MaxY, m_MaxZ;
+        ArrayList<float> m_CenterX, m_CenterY, m_CenterZ, m_Radius;
+        float m_SliceDepth[CLUSTER_GRID_Z + 1];
+
+        ArrayList<Light> m_DirectionalLights;
+        ArrayList<Light> m_LocalLights;
+        ArrayList<LightBounds> m_Bounds;
+
+        // Per slice, reused every frame
+        ArrayList<uint32_t> m_SliceLights[CLUSTER_GRID_Z];
+        ArrayList<uint32_t> m_SliceIndices[CLUSTER_GRID_Z];
+        ArrayList<uint8_t> m_SliceMasks[CLUSTER_GRID_Z];
+
+        ArrayList<Light> m_Lights;
+        ArrayList<ClusterRange> m_Grid;
+        ArrayList<uint32_t> m_Indices;
+        uint32_t m_DirectionalLightCount = 0;
+    };
+
+} // NekoEngine
@@ -0,0 +1,143 @@
+#include "MeshletCuller.h"
+#include "OcclusionCuller.h"
+#include "Renderable/Mesh.h"
+#include "JobSystem/ParallelEach.h"
+
+namespace NekoEngine
+{
+    void MeshletCuller::Begin(uint32_t batchCount, const Frustum& frustum, const glm::vec3& cameraPosition, const glm::vec3& viewDirection,
+                              bool orthographic, const OcclusionCuller* occlusion)
+    {
+        m_Frustum        = frustum;
+        m_CameraPosition = cameraPosition;
+        m_ViewDirection  = viewDirection;
+        m_Orthographic   = orthographic;
+        m_Occlusion      = occlusion;
+
+        m_Items.clear();
+        m_MeshletItems.clear();
+        m_Ranges.clear();
+        m_BatchItems.assign(batchCount, ~0u);
+        m_NumMeshlets = 0;
+        m_NumCulled   = 0;
+    }
+
+    void MeshletCuller::Add(uint32_t batch, const Mesh* mesh, const glm::mat4& transform, bool twoSided)
+    {
+        const auto& meshlets = mesh->GetMeshlets();
+        if(meshlets.empty())
+            return;
+
+        Item& item = m_Items.emplace_back();
+        item.mesh  = mesh;
+
+        // Quantised meshes are drawn with their dequantise transform folded in, the bounds are in object space
+        item.transform = mesh->IsPacked() ? transform * glm::inverse(mesh->GetVertexTransform()) : transform;
+
+        const float scaleX = glm::length(glm::vec3(item.transform[0]));
+        const float scaleY = glm::length(glm::vec3(item.transform[1]));
+        const float scaleZ = glm::length(glm::vec3(item.transform[2]));
+        const float minScale = Maths::Min(scaleX, Maths::Min(scaleY, scaleZ));
+        item.scale = Maths::Max(scaleX, Maths::Max(scaleY, scaleZ));
+
+        // Cones only survive rotation and uniform scale, mirrored transforms also flip which side is the back
+        item.coneCulling = !twoSided && minScale > item.scale * 0.99f && glm::determinant(glm::mat3(item.transform)) > 0.0f;
+
+        item.firstMeshlet = (uint32_t)m_MeshletItems.size();
+        m_MeshletItems.insert(m_MeshletItems.end(), meshlets.size(), (uint32_t)m_Items.size() - 1);
+        m_BatchItems[batch] = (uint32_t)m_Items.size() - 1;
+    }
+
+    void MeshletCuller::Cull()
+    {
+        m_NumMeshlets = (uint32_t)m_MeshletItems.size();
+        if(m_NumMeshlets == 0)
+            return;
+
+        m_Visible.resize(m_NumMeshlets);
+
+        JobSystem::ParallelFor(m_NumMeshlets, JobSystem::AutoGrainSize(m_NumMeshlets), [this](uint32_t begin, uint32_t end, uint32_t chunk)
+                               { TestMeshlets(begin, end); });
+
+        // Merge visible neighbours, this is a byte scan so it stays on the calling thread
+        for(auto& item : m_Items)
+        {
+            const auto& meshlets = item.mesh->GetMeshlets();
+            item.firstRange      = (uint32_t)m_Ranges.size();
+
+            for(uint32_t i = 0; i < (uint32_t)meshlets.size(); i++)
+            {
+                if(!m_Visible[item.firstMeshlet + i])
+                {
+                    m_NumCulled++;
+                    continue;
+                }
+
+                const Meshlet& meshlet = meshlets[i];
+                if(m_Ranges.size() > item.firstRange &&
+                   m_Ranges.back().indexOffset + m_Ranges.back().indexCount == meshlet.indexOffset)
+                {
+                    m_Ranges.back().indexCount += meshlet.indexCount;
+                }
+                else
+                {
+                    m_Ranges.push_back({ meshlet.indexOffset, meshlet.indexCount });
+                }
+            }
+
+            item.rangeCount = (uint32_t)m_Ranges.size() - item.firstRange;
+        }
+    }
+
+    void MeshletCuller::TestMeshlets(uint32_t begin, uint32_t end)
+    {
+        for(uint32_t index = begin; index < end; index++)
+        {
+            const Item& item       = m_Items[m_MeshletItems[index]];
+            const Meshlet& meshlet = item.mesh->GetMeshlets()[index - item.firstMeshlet];
+
+            const glm::vec3 center = glm::vec3(item.transform * glm::vec4(meshlet.center, 1.0f));
+            const float radius     = meshlet.radius * item.scale;
+
+            bool visible = true;
+            for(int plane = 0; plane < 6 && visible; plane++)
+                visible = m_Frustum.GetPlane(plane).Distance(center) >= -radius;
+
+            if(visible && item.coneCulling && meshlet.coneCutoff < 1.0f)
+            {
+                const glm::vec3 axis = glm::normalize(glm::mat3(item.transform) * meshlet.coneAxis);
+                glm::vec3 direction  = m_ViewDirection;
+
+                if(!m_Orthographic)
+                {
+                    const glm::vec3 apex = glm::vec3(item.transform * glm::vec4(meshlet.coneApex, 1.0f));
+                    direction            = apex - m_CameraPosition;
+                    const float length   = glm::length(direction);
+                    direction            = length > 0.0f ? direction / length : axis * -1.0f;
+                }
+
+                visible = glm::dot(direction, axis) < meshlet.coneCutoff;
+            }
+
+            if(visible && m_Occlusion)
+                visible = !m_Occlusion->IsOccluded(center - glm::vec3(radius), center + glm::vec3(radius));
+
+            m_Visible[index] = visible ? 1 : 0;
+        }
+    }
+
+    const MeshletCuller::DrawRange* MeshletCuller::GetRanges(uint32_t batch, uint32_t& count) const
+    {
+        count = 0;
+        if(batch >= m_BatchItems.size() || m_BatchItems[batch] == ~0u)
+            return nullptr;
+
+        const Item& item = m_Items[m_BatchItems[batch]];
+        count            = item.rangeCount;
+
+        // Data of an empty vector may be null, any non null pointer works with a count of zero
+        static const DrawRange NoRanges = {};
+        return item.rangeCount > 0 ? &m_Ranges[item.firstRange] : &NoRanges;
+    }
+
+} // NekoEngine
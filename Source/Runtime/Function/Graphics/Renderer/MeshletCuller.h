@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Core.h"
+#include "Math/Frustum.h"
+
+namespace NekoEngine
+{
+    class Mesh;
+    class OcclusionCuller;
+
+    // Culls the meshlets of large meshes the camera sees, entirely on the CPU.
+    // Every added draw is split into its meshlets, which are tested against the frustum, their normal cone
+    // (backface) and optionally the occlusion buffer, a fixed range of meshlets per job. The visible
+    // meshlets of a draw are then merged into as few index ranges as possible, neighbouring meshlets are
+    // neighbours in the index buffer so a mostly visible mesh still takes only a handful of draws.
+    class MeshletCuller
+    {
+    public:
+        struct DrawRange
+        {
+            uint32_t indexOffset = 0;
+            uint32_t indexCount  = 0;
+        };
+
+        // Orthographic views cull the cones against viewDirection instead of the camera position.
+        // occlusion may be null, otherwise it must have been rendered for the same view this frame.
+        void Begin(uint32_t batchCount, const Frustum& frustum, const glm::vec3& cameraPosition, const glm::vec3& viewDirection,
+                   bool orthographic, const OcclusionCuller* occlusion);
+
+        // transform is the one the mesh is drawn with. Two sided materials skip the backface test.
+        void Add(uint32_t batch, const Mesh* mesh, const glm::mat4& transform, bool twoSided);
+        void Cull();
+
+        // Index ranges of an added batch, null when the batch was not added and is drawn whole.
+        // A batch whose meshlets were all culled returns a valid pointer with a count of zero.
+        const DrawRange* GetRanges(uint32_t batch, uint32_t& count) const;
+
+        uint32_t GetNumMeshlets() const { return m_NumMeshlets; }
+        uint32_t GetNumCulled() const { return m_NumCulled; }
+
+    private:
+        struct Item
+        {
+            const Mesh* mesh;
+            glm::mat4 transform; // Object space of the meshlet bounds to world
+            float scale;         // Largest axis scale, for the radii
+            bool coneCulling;
+            uint32_t firstMeshlet;
+            uint32_t firstRange = 0;
+            uint32_t rangeCount = 0;
+        };
+
+        void TestMeshlets(uint32_t begin, uint32_t end);
+
+        Frustum m_Frustum;
+        glm::vec3 m_CameraPosition = glm::vec3(0.0f);
+        glm::vec3 m_ViewDirection  = glm::vec3(0.0f, 0.0f, -1.0f);
+        bool m_Orthographic        = false;
+        const OcclusionCuller* m_Occlusion = nullptr;
+
+        ArrayList<Item> m_Items;
+        ArrayList<uint32_t> m_BatchItems;  // Item of every batch, ~0u when the batch was not added
+        ArrayList<uint32_t> m_MeshletItems; // Item of every meshlet, so jobs split meshlets instead of meshes
+        ArrayList<uint8_t> m_Visible;
+        ArrayList<DrawRange> m_Ranges;
+
+        uint32_t m_NumMeshlets = 0;
+        uint32_t m_NumCulled   = 0;
+    };
+
+} // NekoEngine
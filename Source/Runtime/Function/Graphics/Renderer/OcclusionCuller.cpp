@@ -0,0 +1,360 @@
+#include "OcclusionCuller.h"
+#include "FrustumCuller.h"
+#include "Renderable/Mesh.h"
+#include "JobSystem/ParallelEach.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define NEKO_OCCLUSION_SSE 1
+#endif
+
+namespace NekoEngine
+{
+    // Pixels whose centre can fall inside [min, max], false when none of them are on screen
+    static bool PixelRange(float min, float max, int32_t size, int32_t& first, int32_t& last)
+    {
+        first = (int32_t)std::floor(Maths::Min(Maths::Max(min, 0.0f), (float)size));
+        last  = (int32_t)std::floor(Maths::Max(Maths::Min(max, (float)(size - 1)), -1.0f));
+        return first <= last;
+    }
+
+    static glm::vec3 ClipToScreen(const glm::vec4& clip)
+    {
+        const float invW = 1.0f / clip.w;
+        return glm::vec3((clip.x * invW * 0.5f + 0.5f) * OCCLUSION_WIDTH,
+                         (0.5f - clip.y * invW * 0.5f) * OCCLUSION_HEIGHT,
+                         invW);
+    }
+
+    static const uint32_t* GetOccluderIndices(const Mesh* mesh)
+    {
+        return mesh->GetIndices().data() + mesh->GetLod(0).indexOffset;
+    }
+
+    void OcclusionCuller::Begin(const glm::mat4& projView)
+    {
+        m_ProjView     = projView;
+        m_NumTriangles = 0;
+        m_Occluders.clear();
+    }
+
+    void OcclusionCuller::AddOccluder(const Mesh* mesh, const glm::mat4& worldTransform, uint32_t cullIndex)
+    {
+        m_Occluders.push_back({ mesh, worldTransform, cullIndex });
+    }
+
+    void OcclusionCuller::Render()
+    {
+        m_TriangleOffsets.resize(m_Occluders.size() + 1);
+        m_TriangleOffsets[0] = 0;
+
+        for(size_t i = 0; i < m_Occluders.size(); i++)
+            m_TriangleOffsets[i + 1] = m_TriangleOffsets[i] + m_Occluders[i].mesh->GetLod(0).indexCount / 3;
+
+        m_NumTriangles = m_TriangleOffsets.back();
+
+        const uint32_t grainSize = JobSystem::AutoGrainSize(m_NumTriangles);
+        m_ChunkCount             = JobSystem::ChunkCount(m_NumTriangles, grainSize);
+
+        if(m_Chunks.size() < m_ChunkCount)
+            m_Chunks.resize(m_ChunkCount);
+
+        JobSystem::ParallelFor(m_NumTriangles, grainSize, [this](uint32_t begin, uint32_t end, uint32_t chunk)
+                               { SetupTriangles(begin, end, m_Chunks[chunk]); });
+
+        // Bins own disjoint pixels, so every bin is rasterised by one job without any locking
+        JobSystem::ParallelFor(OCCLUSION_BIN_COUNT, 1, [this](uint32_t begin, uint32_t end, uint32_t chunk)
+                               {
+                                   for(uint32_t bin = begin; bin < end; bin++)
+                                       RasteriseBin(bin);
+                               });
+    }
+
+    void OcclusionCuller::SetupTriangles(uint32_t begin, uint32_t end, BinnedChunk& chunk)
+    {
+        chunk.triangles.clear();
+        for(auto& bin : chunk.bins)
+            bin.clear();
+
+        // Occluders always use level 0, a coarser level could grow past the real silhouette
+        // Last occluder starting at or before begin, empty meshes share their offset with the next one
+        uint32_t occluder = (uint32_t)(std::upper_bound(m_TriangleOffsets.begin(), m_TriangleOffsets.end(), begin) - m_TriangleOffsets.begin()) - 1;
+
+        glm::mat4 transform       = m_ProjView * m_Occluders[occluder].transform;
+        const uint32_t* indices   = GetOccluderIndices(m_Occluders[occluder].mesh);
+        const glm::vec3* vertices = m_Occluders[occluder].mesh->GetPositions().data();
+
+        for(uint32_t i = begin; i < end; i++)
+        {
+            if(i >= m_TriangleOffsets[occluder + 1])
+            {
+                while(i >= m_TriangleOffsets[occluder + 1])
+                    occluder++;
+
+                transform = m_ProjView * m_Occluders[occluder].transform;
+                indices   = GetOccluderIndices(m_Occluders[occluder].mesh);
+                vertices  = m_Occluders[occluder].mesh->GetPositions().data();
+            }
+
+            const uint32_t first = (i - m_TriangleOffsets[occluder]) * 3;
+            const glm::vec4 in[3] = { transform * glm::vec4(vertices[indices[first]], 1.0f),
+                                      transform * glm::vec4(vertices[indices[first + 1]], 1.0f),
+                                      transform * glm::vec4(vertices[indices[first + 2]], 1.0f) };
+
+            // Signed distance to the near plane, z >= -w
+            float distance[3];
+            for(int v = 0; v < 3; v++)
+                distance[v] = in[v].z + in[v].w;
+
+            if(distance[0] >= 0.0f && distance[1] >= 0.0f && distance[2] >= 0.0f)
+            {
+                AddTriangle(in[0], in[1], in[2], chunk);
+                continue;
+            }
+
+            // Clip against the near plane, what is left is a triangle or a quad
+            glm::vec4 out[4];
+            uint32_t outCount = 0;
+            for(int v = 0; v < 3; v++)
+            {
+                const int next = (v + 1) % 3;
+                if(distance[v] >= 0.0f)
+                    out[outCount++] = in[v];
+
+                if((distance[v] >= 0.0f) != (distance[next] >= 0.0f))
+                    out[outCount++] = in[v] + (in[next] - in[v]) * (distance[v] / (distance[v] - distance[next]));
+            }
+
+            for(uint32_t v = 1; v + 1 < outCount; v++)
+                AddTriangle(out[0], out[v], out[v + 1], chunk);
+        }
+    }
+
+    void OcclusionCuller::AddTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c, BinnedChunk& chunk)
+    {
+        glm::vec3 p[3] = { ClipToScreen(a), ClipToScreen(b), ClipToScreen(c) };
+
+        Triangle triangle;
+        if(!PixelRange(Maths::Min(p[0].x, Maths::Min(p[1].x, p[2].x)), Maths::Max(p[0].x, Maths::Max(p[1].x, p[2].x)), OCCLUSION_WIDTH, triangle.minX, triangle.maxX) ||
+           !PixelRange(Maths::Min(p[0].y, Maths::Min(p[1].y, p[2].y)), Maths::Max(p[0].y, Maths::Max(p[1].y, p[2].y)), OCCLUSION_HEIGHT, triangle.minY, triangle.maxY))
+            return;
+
+        // Set up in double, near clipped vertices can land far outside the buffer
+        double area = ((double)p[1].x - p[0].x) * ((double)p[2].y - p[0].y) - ((double)p[1].y - p[0].y) * ((double)p[2].x - p[0].x);
+        if(std::abs(area) < 1e-6)
+            return;
+
+        // Both windings are rasterised, single sided walls occlude from either side
+        if(area < 0.0)
+        {
+            std::swap(p[1], p[2]);
+            area = -area;
+        }
+
+        double edgeA[3], edgeB[3], edgeC[3];
+        for(int e = 0; e < 3; e++)
+        {
+            const glm::vec3& from = p[e];
+            const glm::vec3& to   = p[(e + 1) % 3];
+            edgeA[e]              = (double)from.y - to.y;
+            edgeB[e]              = (double)to.x - from.x;
+            edgeC[e]              = (double)from.x * to.y - (double)to.x * from.y;
+
+            triangle.edgeA[e] = (float)edgeA[e];
+            triangle.edgeB[e] = (float)edgeB[e];
+            triangle.edgeC[e] = (float)edgeC[e];
+        }
+
+        // The edge opposite a vertex gives its barycentric weight, 1/w is linear in screen space
+        triangle.depthA = (float)((edgeA[1] * p[0].z + edgeA[2] * p[1].z + edgeA[0] * p[2].z) / area);
+        triangle.depthB = (float)((edgeB[1] * p[0].z + edgeB[2] * p[1].z + edgeB[0] * p[2].z) / area);
+        triangle.depthC = (float)((edgeC[1] * p[0].z + edgeC[2] * p[1].z + edgeC[0] * p[2].z) / area);
+
+        const uint32_t index = (uint32_t)chunk.triangles.size();
+        chunk.triangles.push_back(triangle);
+
+        for(int32_t y = triangle.minY / (int32_t)OCCLUSION_BIN_HEIGHT; y <= triangle.maxY / (int32_t)OCCLUSION_BIN_HEIGHT; y++)
+        {
+            for(int32_t x = triangle.minX / (int32_t)OCCLUSION_BIN_WIDTH; x <= triangle.maxX / (int32_t)OCCLUSION_BIN_WIDTH; x++)
+                chunk.bins[y * OCCLUSION_BINS_X + x].push_back(index);
+        }
+    }
+
+    void OcclusionCuller::RasteriseBin(uint32_t bin)
+    {
+        const int32_t binMinX = (bin % OCCLUSION_BINS_X) * OCCLUSION_BIN_WIDTH;
+        const int32_t binMinY = (bin / OCCLUSION_BINS_X) * OCCLUSION_BIN_HEIGHT;
+        const int32_t binMaxX = binMinX + OCCLUSION_BIN_WIDTH - 1;
+        const int32_t binMaxY = binMinY + OCCLUSION_BIN_HEIGHT - 1;
+
+        for(int32_t y = binMinY; y <= binMaxY; y++)
+            std::fill_n(&m_Depth[y * OCCLUSION_WIDTH + binMinX], OCCLUSION_BIN_WIDTH, 0.0f);
+
+        // Chunk order keeps the result deterministic, not that it matters for a max() blend
+        for(uint32_t chunk = 0; chunk < m_ChunkCount; chunk++)
+        {
+            const BinnedChunk& binned = m_Chunks[chunk];
+
+            for(uint32_t index : binned.bins[bin])
+            {
+                const Triangle& tri = binned.triangles[index];
+
+                // Bins are a multiple of four wide, so a group of four never leaves the bin
+                const int32_t minX = Maths::Max(tri.minX, binMinX) & ~3;
+                const int32_t maxX = Maths::Min(tri.maxX, binMaxX);
+                const int32_t minY = Maths::Max(tri.minY, binMinY);
+                const int32_t maxY = Maths::Min(tri.maxY, binMaxY);
+
+                for(int32_t y = minY; y <= maxY; y++)
+                {
+                    const float py = (float)y + 0.5f;
+                    float* row     = &m_Depth[y * OCCLUSION_WIDTH];
+
+                    const float rowEdge0 = tri.edgeB[0] * py + tri.edgeC[0];
+                    const float rowEdge1 = tri.edgeB[1] * py + tri.edgeC[1];
+                    const float rowEdge2 = tri.edgeB[2] * py + tri.edgeC[2];
+                    const float rowDepth = tri.depthB * py + tri.depthC;
+
+#if NEKO_OCCLUSION_SSE
+                    const __m128 centre = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+                    const __m128 zero   = _mm_setzero_ps();
+
+                    for(int32_t x = minX; x <= maxX; x += 4)
+                    {
+                        const __m128 px = _mm_add_ps(_mm_set1_ps((float)x), centre);
+
+                        const __m128 e0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.edgeA[0]), px), _mm_set1_ps(rowEdge0));
+                        const __m128 e1 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.edgeA[1]), px), _mm_set1_ps(rowEdge1));
+                        const __m128 e2 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.edgeA[2]), px), _mm_set1_ps(rowEdge2));
+                        const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero));
+
+                        // Masked lanes become 0, which never beats what is already stored
+                        const __m128 depth = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.depthA), px), _mm_set1_ps(rowDepth));
+                        _mm_storeu_ps(row + x, _mm_max_ps(_mm_loadu_ps(row + x), _mm_and_ps(inside, depth)));
+                    }
+#else
+                    for(int32_t x = minX; x <= maxX; x++)
+                    {
+                        const float px = (float)x + 0.5f;
+                        if(tri.edgeA[0] * px + rowEdge0 >= 0.0f && tri.edgeA[1] * px + rowEdge1 >= 0.0f && tri.edgeA[2] * px + rowEdge2 >= 0.0f)
+                            row[x] = Maths::Max(row[x], tri.depthA * px + rowDepth);
+                    }
+#endif
+                }
+            }
+        }
+
+        for(int32_t tileY = binMinY / OCCLUSION_TILE_SIZE; tileY <= binMaxY / (int32_t)OCCLUSION_TILE_SIZE; tileY++)
+        {
+            for(int32_t tileX = binMinX / OCCLUSION_TILE_SIZE; tileX <= binMaxX / (int32_t)OCCLUSION_TILE_SIZE; tileX++)
+            {
+                float farthest = FLT_MAX;
+                for(uint32_t y = 0; y < OCCLUSION_TILE_SIZE; y++)
+                {
+                    const float* row = &m_Depth[(tileY * OCCLUSION_TILE_SIZE + y) * OCCLUSION_WIDTH + tileX * OCCLUSION_TILE_SIZE];
+                    for(uint32_t x = 0; x < OCCLUSION_TILE_SIZE; x++)
+                        farthest = Maths::Min(farthest, row[x]);
+                }
+                m_TileMin[tileY * OCCLUSION_TILES_X + tileX] = farthest;
+            }
+        }
+    }
+
+    bool OcclusionCuller::IsOccluded(const glm::vec3& min, const glm::vec3& max) const
+    {
+        float minX = FLT_MAX, minY = FLT_MAX;
+        float maxX = -FLT_MAX, maxY = -FLT_MAX;
+        float nearest = 0.0f;
+
+        for(int i = 0; i < 8; i++)
+        {
+            const glm::vec4 clip = m_ProjView * glm::vec4(i & 1 ? max.x : min.x, i & 2 ? max.y : min.y, i & 4 ? max.z : min.z, 1.0f);
+            if(clip.w <= 0.0f || clip.z < -clip.w)
+                return false;
+
+            const glm::vec3 screen = ClipToScreen(clip);
+            minX    = Maths::Min(minX, screen.x);
+            minY    = Maths::Min(minY, screen.y);
+            maxX    = Maths::Max(maxX, screen.x);
+            maxY    = Maths::Max(maxY, screen.y);
+            nearest = Maths::Max(nearest, screen.z);
+        }
+
+        int32_t x0, x1, y0, y1;
+        if(!PixelRange(minX, maxX, OCCLUSION_WIDTH, x0, x1) || !PixelRange(minY, maxY, OCCLUSION_HEIGHT, y0, y1))
+            return false;
+
+        for(int32_t tileY = y0 / (int32_t)OCCLUSION_TILE_SIZE; tileY <= y1 / (int32_t)OCCLUSION_TILE_SIZE; tileY++)
+        {
+            for(int32_t tileX = x0 / (int32_t)OCCLUSION_TILE_SIZE; tileX <= x1 / (int32_t)OCCLUSION_TILE_SIZE; tileX++)
+            {
+                if(m_TileMin[tileY * OCCLUSION_TILES_X + tileX] > nearest)
+                    continue;
+
+                // The tile is only partly covered by nearer occluders, check the pixels the box overlaps
+                const int32_t pixelMinX = Maths::Max(x0, tileX * (int32_t)OCCLUSION_TILE_SIZE);
+                const int32_t pixelMaxX = Maths::Min(x1, tileX * (int32_t)OCCLUSION_TILE_SIZE + (int32_t)OCCLUSION_TILE_SIZE - 1);
+                const int32_t pixelMinY = Maths::Max(y0, tileY * (int32_t)OCCLUSION_TILE_SIZE);
+                const int32_t pixelMaxY = Maths::Min(y1, tileY * (int32_t)OCCLUSION_TILE_SIZE + (int32_t)OCCLUSION_TILE_SIZE - 1);
+
+                for(int32_t y = pixelMinY; y <= pixelMaxY; y++)
+                {
+                    for(int32_t x = pixelMinX; x <= pixelMaxX; x++)
+                    {
+                        if(m_Depth[y * OCCLUSION_WIDTH + x] <= nearest)
+                            return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    uint32_t OcclusionCuller::Cull(FrustumCuller& culler, uint32_t view)
+    {
+        const uint32_t count = culler.GetCount();
+        if(count == 0 || m_NumTriangles == 0)
+            return 0;
+
+        m_IsOccluder.assign(count, 0);
+        for(auto& occluder : m_Occluders)
+        {
+            if(occluder.cullIndex < count)
+                m_IsOccluder[occluder.cullIndex] = 1;
+        }
+
+        // Chunks cover whole 64 bit words so no two workers write the same bitset word
+        const uint32_t grainSize = (JobSystem::AutoGrainSize(count) + 63) & ~63u;
+        m_ChunkCulled.assign(JobSystem::ChunkCount(count, grainSize), 0);
+
+        JobSystem::ParallelFor(count, grainSize, [this, &culler, view](uint32_t begin, uint32_t end, uint32_t chunk)
+                               {
+                                   uint32_t culled = 0;
+                                   for(uint32_t i = begin; i < end; i++)
+                                   {
+                                       if(m_IsOccluder[i] || !culler.IsVisible(view, i))
+                                           continue;
+
+                                       glm::vec3 min, max;
+                                       culler.GetBounds(i, min, max);
+                                       if(IsOccluded(min, max))
+                                       {
+                                           culler.Hide(view, i);
+                                           culled++;
+                                       }
+                                   }
+                                   m_ChunkCulled[chunk] = culled;
+                               });
+
+        uint32_t culled = 0;
+        for(uint32_t chunkCulled : m_ChunkCulled)
+            culled += chunkCulled;
+
+        return culled;
+    }
+
+} // NekoEngine
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Core.h"
+
+namespace NekoEngine
+{
+    class Mesh;
+    class FrustumCuller;
+
+    static constexpr uint32_t OCCLUSION_WIDTH     = 256;
+    static constexpr uint32_t OCCLUSION_HEIGHT    = 128;
+    static constexpr uint32_t OCCLUSION_TILE_SIZE = 8;
+    static constexpr uint32_t OCCLUSION_TILES_X   = OCCLUSION_WIDTH / OCCLUSION_TILE_SIZE;
+    static constexpr uint32_t OCCLUSION_TILES_Y   = OCCLUSION_HEIGHT / OCCLUSION_TILE_SIZE;
+    static constexpr uint32_t OCCLUSION_BINS_X    = 4;
+    static constexpr uint32_t OCCLUSION_BINS_Y    = 4;
+    static constexpr uint32_t OCCLUSION_BIN_COUNT = OCCLUSION_BINS_X * OCCLUSION_BINS_Y;
+    static constexpr uint32_t OCCLUSION_BIN_WIDTH  = OCCLUSION_WIDTH / OCCLUSION_BINS_X;
+    static constexpr uint32_t OCCLUSION_BIN_HEIGHT = OCCLUSION_HEIGHT / OCCLUSION_BINS_Y;
+
+    // Software occlusion culling for the camera view, entirely on the CPU.
+    // Occluder meshes are rasterised into a small depth buffer holding 1/w, so larger is nearer and a
+    // cleared pixel (0) is infinitely far away. Triangles are transformed, near clipped and binned into
+    // screen bins on the job system, then every bin is rasterised by one job, four pixels at a time.
+    // Each 8x8 tile keeps its farthest depth so most boxes are accepted or rejected without touching pixels.
+    //
+    // A box is occluded when every pixel its screen rect covers holds something nearer than the box's
+    // nearest corner. Boxes crossing the near plane are always visible.
+    class OcclusionCuller
+    {
+    public:
+        // projView must be the GL style (-w <= z <= w) projection times view of the camera
+        void Begin(const glm::mat4& projView);
+
+        // cullIndex is the occluder's slot in the FrustumCuller, occluders are never tested against themselves.
+        // The mesh has to keep at least MeshResidency::Positions.
+        void AddOccluder(const Mesh* mesh, const glm::mat4& worldTransform, uint32_t cullIndex);
+        void Render();
+
+        bool IsOccluded(const glm::vec3& min, const glm::vec3& max) const;
+
+        // Clears the bits of occluded items in one view of the culler, returns how many were culled
+        uint32_t Cull(FrustumCuller& culler, uint32_t view);
+
+        // Row major, row 0 is the top of the screen
+        const float* GetDepth() const { return m_Depth.data(); }
+
+        uint32_t GetNumOccluders() const { return (uint32_t)m_Occluders.size(); }
+        uint32_t GetNumTriangles() const { return m_NumTriangles; }
+
+    private:
+        struct Occluder
+        {
+            const Mesh* mesh;
+            glm::mat4 transform;
+            uint32_t cullIndex;
+        };
+
+        // Edge functions and the 1/w plane, all as a * x + b * y + c in pixel coordinates
+        struct Triangle
+        {
+            float edgeA[3], edgeB[3], edgeC[3];
+            float depthA, depthB, depthC;
+            int32_t minX, minY, maxX, maxY;
+        };
+
+        // Setup output of one job, kept apart so workers never share a container
+        struct BinnedChunk
+        {
+            ArrayList<Triangle> triangles;
+            ArrayList<uint32_t> bins[OCCLUSION_BIN_COUNT];
+        };
+
+        void SetupTriangles(uint32_t begin, uint32_t end, BinnedChunk& chunk);
+        void AddTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c, BinnedChunk& chunk);
+        void RasteriseBin(uint32_t bin);
+
+        glm::mat4 m_ProjView = glm::mat4(1.0f);
+
+        ArrayList<Occluder> m_Occluders;
+        ArrayList<uint32_t> m_TriangleOffsets; // First triangle of every occluder, plus the total
+        ArrayList<BinnedChunk> m_Chunks;
+        ArrayList<uint8_t> m_IsOccluder;
+        ArrayList<uint32_t> m_ChunkCulled;
+        uint32_t m_ChunkCount   = 0;
+        uint32_t m_NumTriangles = 0;
+
+        ArrayList<float> m_Depth   = ArrayList<float>(OCCLUSION_WIDTH * OCCLUSION_HEIGHT, 0.0f);
+        ArrayList<float> m_TileMin = ArrayList<float>(OCCLUSION_TILES_X * OCCLUSION_TILES_Y, 0.0f);
+    };
+
+} // NekoEngine
@@ -0,0 +1,422 @@
+#include "RenderGraph.h"
+#include "RHI/RHIFactory.h"
+#include "GUI/ImGuiUtility.h"
+#include "Math/Maths.h"
+#include "Engine.h"
+#include "Hash.h"
+
+namespace NekoEngine
+{
+    static const char* ResourceStateToString(ResourceState state)
+    {
+        switch(state)
+        {
+            case ResourceState::RenderTarget:
+                return "Render Target";
+            case ResourceState::DepthWrite:
+                return "Depth Write";
+            case ResourceState::DepthRead:
+                return "Depth Read";
+            case ResourceState::ShaderRead:
+                return "Shader Read";
+            case ResourceState::Storage:
+                return "Storage";
+            default:
+                return "Undefined";
+        }
+    }
+
+    RenderGraphResource RenderGraphBuilder::Read(RenderGraphResource resource, ResourceState state)
+    {
+        if(resource != InvalidRenderGraphResource)
+            m_Graph.m_Passes[m_Pass].accesses.push_back({ resource, state, false });
+        return resource;
+    }
+
+    RenderGraphResource RenderGraphBuilder::Write(RenderGraphResource resource, ResourceState state)
+    {
+        if(resource != InvalidRenderGraphResource)
+            m_Graph.m_Passes[m_Pass].accesses.push_back({ resource, state, true });
+        return resource;
+    }
+
+    void RenderGraphBuilder::SetEnabled(bool enabled)
+    {
+        m_Graph.m_Passes[m_Pass].enabled = enabled;
+    }
+
+    void RenderGraphBuilder::SetSideEffect()
+    {
+        m_Graph.m_Passes[m_Pass].sideEffect = true;
+    }
+
+    RenderGraph::~RenderGraph()
+    {
+        ReleaseTransients();
+    }
+
+    void RenderGraph::Reset()
+    {
+        m_Passes.clear();
+        m_Resources.clear();
+        m_Compiled = false;
+    }
+
+    RenderGraphResource RenderGraph::ImportTexture(const String& name, Texture* texture)
+    {
+        ResourceNode& resource = m_Resources.emplace_back();
+        resource.name      = name;
+        resource.imported  = true;
+        resource.texture   = texture;
+        resource.texture2D = dynamic_cast<Texture2D*>(texture);
+        return (RenderGraphResource)m_Resources.size() - 1;
+    }
+
+    RenderGraphResource RenderGraph::ImportAliasableTexture(const String& name, Texture2D* texture, const TextureDesc& desc)
+    {
+        ResourceNode& resource = m_Resources.emplace_back();
+        resource.name      = name;
+        resource.desc      = desc;
+        resource.width     = texture->GetWidth();
+        resource.height    = texture->GetHeight();
+        resource.key       = GetTextureKey(desc, resource.width, resource.height);
+        resource.imported  = true;
+        resource.aliasable = true;
+        resource.texture   = texture;
+        resource.texture2D = texture;
+        return (RenderGraphResource)m_Resources.size() - 1;
+    }
+
+    RenderGraphResource RenderGraph::CreateTexture(const String& name, const TextureDesc& desc, uint32_t width, uint32_t height)
+    {
+        ResourceNode& resource = m_Resources.emplace_back();
+        resource.name   = name;
+        resource.desc   = desc;
+        resource.width  = Maths::Max(width, 1u);
+        resource.height = Maths::Max(height, 1u);
+        resource.key    = GetTextureKey(desc, resource.width, resource.height);
+        return (RenderGraphResource)m_Resources.size() - 1;
+    }
+
+    void RenderGraph::AddPass(const String& name, const RenderGraphSetupFunc& setup, const RenderGraphExecuteFunc& execute)
+    {
+        PassNode& pass = m_Passes.emplace_back();
+        pass.name    = name;
+        pass.execute = execute;
+
+        RenderGraphBuilder builder(*this, (uint32_t)m_Passes.size() - 1);
+        setup(builder);
+    }
+
+    void RenderGraph::Compile()
+    {
+        NekoEngine_PROFILE_FUNCTION();
+        m_FrameIndex++;
+        m_Stats = {};
+        m_Stats.passes = (uint32_t)m_Passes.size();
+
+        CullPasses();
+        ComputeLifetimes();
+        TrimPool();
+        AssignTextures();
+        PlanBarriers();
+
+        m_Compiled = true;
+    }
+
+    void RenderGraph::CullPasses()
+    {
+        // Walking back from the last pass, a pass runs if it has a side effect or touches a texture a later
+        // running pass touches. Writes are not assumed to replace the whole texture, so every earlier writer
+        // of a texture a running pass uses runs too.
+        ArrayList<bool> needed(m_Resources.size(), false);
+
+        for(int32_t p = (int32_t)m_Passes.size() - 1; p >= 0; p--)
+        {
+            PassNode& pass = m_Passes[p];
+            bool run = pass.enabled && pass.sideEffect;
+
+            if(pass.enabled && !run)
+            {
+                for(auto& access : pass.accesses)
+                {
+                    if(access.write && needed[access.resource])
+                    {
+                        run = true;
+                        break;
+                    }
+                }
+            }
+
+            pass.culled = !run;
+            if(!run)
+            {
+                m_Stats.culledPasses++;
+                continue;
+            }
+
+            for(auto& access : pass.accesses)
+                needed[access.resource] = true;
+        }
+    }
+
+    void RenderGraph::ComputeLifetimes()
+    {
+        for(int32_t p = 0; p < (int32_t)m_Passes.size(); p++)
+        {
+            if(m_Passes[p].culled)
+                continue;
+
+            for(auto& access : m_Passes[p].accesses)
+            {
+                ResourceNode& resource = m_Resources[access.resource];
+                if(resource.firstPass < 0)
+                    resource.firstPass = p;
+                resource.lastPass = p;
+            }
+        }
+    }
+
+    void RenderGraph::TrimPool()
+    {
+        for(size_t i = 0; i < m_Pool.size();)
+        {
+            if(m_Pool[i].lastFrame + PoolFrameLifetime < m_FrameIndex)
+            {
+                delete m_Pool[i].texture;
+                m_Pool.erase(m_Pool.begin() + i);
+            }
+            else
+                i++;
+        }
+    }
+
+    void RenderGraph::AssignTextures()
+    {
+        // Aliasable imports first, they cost nothing extra, then what the pool already holds
+        m_Slots.clear();
+        for(auto& resource : m_Resources)
+        {
+            if(resource.aliasable)
+            {
+                AliasSlot& slot = m_Slots.emplace_back();
+                slot.texture        = resource.texture2D;
+                slot.key            = resource.key;
+                slot.availableAfter = resource.lastPass;
+            }
+        }
+
+        for(size_t i = 0; i < m_Pool.size(); i++)
+        {
+            AliasSlot& slot = m_Slots.emplace_back();
+            slot.texture = m_Pool[i].texture;
+            slot.pooled  = (int32_t)i;
+            slot.key     = m_Pool[i].key;
+        }
+
+        // Transients are placed in the order they are first used, each in the first free slot that matches
+        for(int32_t p = 0; p < (int32_t)m_Passes.size(); p++)
+        {
+            if(m_Passes[p].culled)
+                continue;
+
+            for(auto& access : m_Passes[p].accesses)
+            {
+                ResourceNode& resource = m_Resources[access.resource];
+                if(resource.imported || resource.firstPass != p || resource.texture)
+                    continue;
+
+                AliasSlot* found = nullptr;
+                for(auto& slot : m_Slots)
+                {
+                    if(slot.key == resource.key && slot.availableAfter < p)
+                    {
+                        found = &slot;
+                        break;
+                    }
+                }
+
+                if(!found)
+                {
+                    PooledTexture& pooled = m_Pool.emplace_back();
+                    pooled.texture = GET_RHI_FACTORY()->CreateTexture2D(resource.desc, resource.width, resource.height);
+                    pooled.key     = resource.key;
+                    pooled.size    = GetTextureSize(resource.desc, resource.width, resource.height);
+
+                    found          = &m_Slots.emplace_back();
+                    found->texture = pooled.texture;
+                    found->pooled  = (int32_t)m_Pool.size() - 1;
+                    found->key     = resource.key;
+                }
+
+                found->availableAfter = resource.lastPass;
+                found->used           = true;
+                if(found->pooled >= 0)
+                    m_Pool[found->pooled].lastFrame = m_FrameIndex;
+
+                resource.texture   = found->texture;
+                resource.texture2D = found->texture;
+
+                m_Stats.transientTextures++;
+                m_Stats.transientBytes += GetTextureSize(resource.desc, resource.width, resource.height);
+            }
+        }
+
+        for(auto& slot : m_Slots)
+        {
+            if(slot.used)
+                m_Stats.physicalTextures++;
+        }
+
+        for(auto& pooled : m_Pool)
+            m_Stats.pooledBytes += pooled.size;
+    }
+
+    void RenderGraph::PlanBarriers()
+    {
+        // States are only predicted within the frame. The first use of a texture always gets a barrier,
+        // the backend drops it when the texture is already in that state.
+        m_PlannedStates.clear();
+
+        for(auto& pass : m_Passes)
+        {
+            pass.barriers.clear();
+            if(pass.culled)
+                continue;
+
+            for(auto& access : pass.accesses)
+            {
+                Texture* texture = m_Resources[access.resource].texture;
+                if(!texture || access.state == ResourceState::Undefined)
+                    continue;
+
+                auto planned = m_PlannedStates.find(texture);
+                if(planned != m_PlannedStates.end() && planned->second == access.state)
+                    continue;
+
+                m_PlannedStates[texture] = access.state;
+                pass.barriers.push_back({ texture, access.state });
+            }
+
+            m_Stats.barriersPlanned += (uint32_t)pass.barriers.size();
+        }
+    }
+
+    void RenderGraph::Execute(CommandBuffer* commandBuffer)
+    {
+        if(!m_Compiled)
+            Compile();
+
+        auto renderer = gEngine->GetRenderer();
+        for(auto& pass : m_Passes)
+        {
+            if(pass.culled)
+                continue;
+
+            // Barriers count towards the pass that needed them
+            NekoEngine_PROFILE_SCOPE(pass.name);
+            NekoEngine_PROFILE_GPU(renderer, pass.name, commandBuffer);
+
+            if(!pass.barriers.empty())
+                m_Stats.barriersRecorded += renderer->TransitionTextures(pass.barriers.data(), (uint32_t)pass.barriers.size(), commandBuffer);
+
+            pass.execute(*this, commandBuffer);
+        }
+    }
+
+    Texture* RenderGraph::GetTexture(RenderGraphResource resource) const
+    {
+        return resource < m_Resources.size() ? m_Resources[resource].texture : nullptr;
+    }
+
+    Texture2D* RenderGraph::GetTexture2D(RenderGraphResource resource) const
+    {
+        return resource < m_Resources.size() ? m_Resources[resource].texture2D : nullptr;
+    }
+
+    bool RenderGraph::IsPassCulled(const String& name) const
+    {
+        for(auto& pass : m_Passes)
+        {
+            if(pass.name == name)
+                return pass.culled;
+        }
+
+        return true;
+    }
+
+    void RenderGraph::ReleaseTransients()
+    {
+        for(auto& pooled : m_Pool)
+            delete pooled.texture;
+
+        m_Pool.clear();
+        m_Slots.clear();
+
+        // Resources of the current frame may point into the pool
+        for(auto& resource : m_Resources)
+        {
+            if(!resource.imported)
+            {
+                resource.texture   = nullptr;
+                resource.texture2D = nullptr;
+            }
+        }
+        m_Compiled = false;
+    }
+
+    uint64_t RenderGraph::GetTextureKey(const TextureDesc& desc, uint32_t width, uint32_t height)
+    {
+        uint64_t key = 0;
+        HashCombine(key, (uint32_t)desc.format, desc.flags, (uint32_t)desc.wrap, (uint32_t)desc.minFilter, (uint32_t)desc.magFilter,
+                    desc.srgb, desc.generateMipMaps, desc.anisotropicFiltering, (uint32_t)desc.msaaLevel, width, height);
+        return key;
+    }
+
+    uint64_t RenderGraph::GetTextureSize(const TextureDesc& desc, uint32_t width, uint32_t height)
+    {
+        uint64_t size = uint64_t(width) * height * Texture::GetBitsFromFormat(desc.format) / 8;
+
+        // A full mip chain adds a third
+        if(desc.flags & TextureFlags::Texture_CreateMips)
+            size += size / 3;
+
+        return size;
+    }
+
+    void RenderGraph::OnImGui()
+    {
+        ImGui::Text("Passes %u, culled %u", m_Stats.passes, m_Stats.culledPasses);
+        ImGui::Text("Transient textures %u on %u textures", m_Stats.transientTextures, m_Stats.physicalTextures);
+        ImGui::Text("Transient memory %.1f MB, pooled %.1f MB", (double)m_Stats.transientBytes / (1024.0 * 1024.0),
+                    (double)m_Stats.pooledBytes / (1024.0 * 1024.0));
+        ImGui::Text("Barriers planned %u, recorded %u", m_Stats.barriersPlanned, m_Stats.barriersRecorded);
+
+        if(ImGui::TreeNode("Passes"))
+        {
+            for(auto& pass : m_Passes)
+            {
+                if(pass.culled)
+                {
+                    ImGui::TextDisabled("%s (culled)", pass.name.c_str());
+                    continue;
+                }
+
+                if(ImGui::TreeNode(pass.name.c_str()))
+                {
+                    for(auto& access : pass.accesses)
+                    {
+                        const ResourceNode& resource = m_Resources[access.resource];
+                        ImGui::Text("%s %s (%s)", access.write ? "Write" : "Read", resource.name.c_str(), ResourceStateToString(access.state));
+                    }
+
+                    ImGui::Text("%u barriers", (uint32_t)pass.barriers.size());
+                    ImGui::TreePop();
+                }
+            }
+
+            ImGui::TreePop();
+        }
+    }
+
+} // NekoEngine
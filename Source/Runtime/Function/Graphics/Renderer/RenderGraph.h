@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Core.h"
+#include "RHI/Texture.h"
+#include "RHI/Renderer.h"
+
+namespace NekoEngine
+{
+    class CommandBuffer;
+    class RenderGraph;
+
+    typedef uint32_t RenderGraphResource;
+    static constexpr RenderGraphResource InvalidRenderGraphResource = ~0u;
+
+    struct RenderGraphStats
+    {
+        uint32_t passes            = 0; // Passes added this frame, culled ones included
+        uint32_t culledPasses      = 0;
+        uint32_t transientTextures = 0; // Transient textures used by the passes that run
+        uint32_t physicalTextures  = 0; // Textures backing them, pooled or aliased onto imports
+        uint32_t barriersPlanned   = 0; // State changes predicted from the declared accesses
+        uint32_t barriersRecorded  = 0; // Barriers the backend actually recorded
+        uint64_t transientBytes    = 0; // What the transients would take with a texture each
+        uint64_t pooledBytes       = 0; // What the pool holds
+    };
+
+    // Handed to a pass's setup callback to declare what the pass touches. Every access names the state the
+    // texture has to be in when the pass starts, ResourceState::Undefined for a pass that handles it itself.
+    // Accesses to InvalidRenderGraphResource are ignored, so optional inputs can be passed as they are.
+    class RenderGraphBuilder
+    {
+    public:
+        RenderGraphResource Read(RenderGraphResource resource, ResourceState state = ResourceState::ShaderRead);
+        RenderGraphResource Write(RenderGraphResource resource, ResourceState state = ResourceState::RenderTarget);
+
+        // A disabled pass is culled along with every pass that only feeds it
+        void SetEnabled(bool enabled);
+
+        // Never culled, for passes whose output leaves the graph, like the one drawing to the swapchain
+        void SetSideEffect();
+
+    private:
+        friend class RenderGraph;
+        RenderGraphBuilder(RenderGraph& graph, uint32_t pass) : m_Graph(graph), m_Pass(pass) {}
+
+        RenderGraph& m_Graph;
+        uint32_t m_Pass;
+    };
+
+    typedef std::function<void(RenderGraphBuilder& builder)> RenderGraphSetupFunc;
+    typedef std::function<void(RenderGraph& graph, CommandBuffer* commandBuffer)> RenderGraphExecuteFunc;
+
+    // Frame graph the scene renderer rebuilds every frame. Passes run in the order they were added, after:
+    //  - culling, walking back from the side effect passes, so disabled passes and passes nobody reads go
+    //  - assigning transient textures to pooled textures, two transients with the same description share one
+    //    when their lifetimes do not overlap, and an aliasable import is reused once its last reader ran
+    //  - planning the barriers each pass needs from the declared accesses, recorded as one batch per pass
+    // Pooled textures live as long as they keep being used and are dropped after PoolFrameLifetime frames
+    // without, so switching an effect off gives its memory back. Pooled textures keep their identity from
+    // frame to frame while the graph does not change, which keeps the pipelines built on them cached.
+    class RenderGraph
+    {
+    public:
+        static constexpr uint32_t PoolFrameLifetime = 60;
+
+        RenderGraph() = default;
+        ~RenderGraph();
+
+        RenderGraph(const RenderGraph&) = delete;
+        RenderGraph& operator=(const RenderGraph&) = delete;
+
+        // Forgets the last frame's passes and resources, the pool is kept
+        void Reset();
+
+        // A texture owned elsewhere, left alone by aliasing
+        RenderGraphResource ImportTexture(const String& name, Texture* texture);
+
+        // A texture owned elsewhere whose contents are not needed after its last use this frame, so transients
+        // with the same description may take it over from there. desc must be what it was created with.
+        RenderGraphResource ImportAliasableTexture(const String& name, Texture2D* texture, const TextureDesc& desc);
+
+        // Created or taken from the pool at compile time, only valid while the frame's passes run
+        RenderGraphResource CreateTexture(const String& name, const TextureDesc& desc, uint32_t width, uint32_t height);
+
+        void AddPass(const String& name, const RenderGraphSetupFunc& setup, const RenderGraphExecuteFunc& execute);
+
+        void Compile();
+        void Execute(CommandBuffer* commandBuffer);
+
+        Texture* GetTexture(RenderGraphResource resource) const;
+        Texture2D* GetTexture2D(RenderGraphResource resource) const;
+        bool IsPassCulled(const String& name) const;
+
+        // Drops every pooled texture, for resizes. They are created again at the new size by the next compile.
+        void ReleaseTransients();
+
+        const RenderGraphStats& GetStats() const { return m_Stats; }
+        void OnImGui();
+
+    private:
+        friend class RenderGraphBuilder;
+
+        struct ResourceAccess
+        {
+            RenderGraphResource resource = InvalidRenderGraphResource;
+            ResourceState state          = ResourceState::Undefined;
+            bool write                   = false;
+        };
+
+        struct PassNode
+        {
+            String name;
+            ArrayList<ResourceAccess> accesses;
+            ArrayList<TextureBarrier> barriers;
+            RenderGraphExecuteFunc execute;
+            bool enabled    = true;
+            bool sideEffect = false;
+            bool culled     = false;
+        };
+
+        struct ResourceNode
+        {
+            String name;
+            TextureDesc desc;
+            uint32_t width       = 0;
+            uint32_t height      = 0;
+            uint64_t key         = 0;
+            bool imported        = false;
+            bool aliasable       = false;
+            Texture* texture     = nullptr; // Imports are set when added, transients by AssignTextures
+            Texture2D* texture2D = nullptr;
+            int32_t firstPass    = -1;
+            int32_t lastPass     = -1;
+        };
+
+        struct PooledTexture
+        {
+            Texture2D* texture = nullptr;
+            uint64_t key       = 0;
+            uint64_t size      = 0;
+            uint64_t lastFrame = 0;
+        };
+
+        // A texture transients can be placed in this frame, free once pass availableAfter has run
+        struct AliasSlot
+        {
+            Texture2D* texture     = nullptr;
+            int32_t pooled         = -1; // Index into m_Pool, -1 for an aliasable import
+            uint64_t key           = 0;
+            int32_t availableAfter = -1;
+            bool used              = false;
+        };
+
+        static uint64_t GetTextureKey(const TextureDesc& desc, uint32_t width, uint32_t height);
+        static uint64_t GetTextureSize(const TextureDesc& desc, uint32_t width, uint32_t height);
+
+        void CullPasses();
+        void ComputeLifetimes();
+        void AssignTextures();
+        void PlanBarriers();
+        void TrimPool();
+
+        ArrayList<PassNode> m_Passes;
+        ArrayList<ResourceNode> m_Resources;
+        ArrayList<PooledTexture> m_Pool;
+        ArrayList<AliasSlot> m_Slots;
+        HashMap<Texture*, ResourceState> m_PlannedStates;
+        uint64_t m_FrameIndex = 0;
+        bool m_Compiled       = false;
+
+        RenderGraphStats m_Stats;
+    };
+
+} // NekoEngine
@@ -0,0 +1,150 @@
+#include "RenderQueue.h"
+#include "Math/Maths.h"
+
+namespace NekoEngine
+{
+    namespace
+    {
+        uint64_t FoldPointer(const void* ptr, uint32_t bits)
+        {
+            // Murmur3 finaliser so neighbouring allocations land in different ids
+            uint64_t value = reinterpret_cast<uint64_t>(ptr);
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdULL;
+            value ^= value >> 33;
+            return value & ((1ULL << bits) - 1);
+        }
+    }
+
+    namespace RenderSortKey
+    {
+        uint32_t QuantiseDepth(float depth, uint32_t bits)
+        {
+            const uint32_t maxValue = (1u << bits) - 1;
+            depth                   = Maths::Clamp(depth, 0.0f, 1.0f);
+            return static_cast<uint32_t>(depth * static_cast<float>(maxValue));
+        }
+
+        uint64_t Make(RenderBucket bucket, const Pipeline* pipeline, const Material* material, const Mesh* mesh, float depth, uint32_t lod)
+        {
+            uint64_t key          = static_cast<uint64_t>(bucket) << 60;
+            const uint64_t meshId = (FoldPointer(mesh, 12) + lod) & 0xfff;
+
+            if(bucket == RenderBucket::Opaque)
+            {
+                key |= FoldPointer(pipeline, 12) << 48;
+                key |= FoldPointer(material, 16) << 32;
+                key |= meshId << 20;
+                key |= QuantiseDepth(depth, 20);
+            }
+            else
+            {
+                const uint64_t maxDepth = (1u << 24) - 1;
+                key |= (maxDepth - QuantiseDepth(depth, 24)) << 36;
+                key |= FoldPointer(pipeline, 12) << 24;
+                key |= FoldPointer(material, 12) << 12;
+                key |= meshId;
+            }
+
+            return key;
+        }
+    }
+
+    void BuildRenderBatches(const CommandQueue& queue, BatchQueue& batches, ArrayList<glm::mat4>* instanceTransforms)
+    {
+        batches.clear();
+
+        for(uint32_t i = 0; i < (uint32_t)queue.size(); i++)
+        {
+            const RenderCommand& command = queue[i];
+
+            if(instanceTransforms && !batches.empty())
+            {
+                RenderBatch& last           = batches.back();
+                const RenderCommand& shared = queue[last.firstCommand];
+
+                if(shared.mesh == command.mesh && shared.lod == command.lod && shared.material == command.material &&
+                   shared.pipeline == command.pipeline)
+                {
+                    instanceTransforms->push_back(command.transform);
+                    last.instanceCount++;
+                    continue;
+                }
+            }
+
+            RenderBatch& batch  = batches.emplace_back();
+            batch.firstCommand  = i;
+            batch.instanceCount = 1;
+
+            if(instanceTransforms)
+            {
+                batch.firstInstance = (uint32_t)instanceTransforms->size();
+                instanceTransforms->push_back(command.transform);
+            }
+        }
+    }
+
+    void RenderQueueSorter::Sort(CommandQueue& queue)
+    {
+        const uint32_t count = static_cast<uint32_t>(queue.size());
+        if(count < 2)
+            return;
+
+        m_Keys.resize(count);
+        m_KeysScratch.resize(count);
+        m_Indices.resize(count);
+        m_IndicesScratch.resize(count);
+
+        // One histogram per byte, all built in a single read of the keys
+        uint32_t histograms[8][256] = {};
+        for(uint32_t i = 0; i < count; i++)
+        {
+            uint64_t key = queue[i].sortKey;
+            m_Keys[i]    = key;
+            m_Indices[i] = i;
+
+            for(uint32_t byte = 0; byte < 8; byte++)
+                histograms[byte][(key >> (byte * 8)) & 0xff]++;
+        }
+
+        uint64_t* keys       = m_Keys.data();
+        uint64_t* keysOut    = m_KeysScratch.data();
+        uint32_t* indices    = m_Indices.data();
+        uint32_t* indicesOut = m_IndicesScratch.data();
+
+        for(uint32_t byte = 0; byte < 8; byte++)
+        {
+            uint32_t* histogram  = histograms[byte];
+            const uint32_t shift = byte * 8;
+
+            if(histogram[(keys[0] >> shift) & 0xff] == count)
+                continue;
+
+            uint32_t offset = 0;
+            for(uint32_t digit = 0; digit < 256; digit++)
+            {
+                uint32_t digitCount = histogram[digit];
+                histogram[digit]    = offset;
+                offset += digitCount;
+            }
+
+            for(uint32_t i = 0; i < count; i++)
+            {
+                uint32_t destination    = histogram[(keys[i] >> shift) & 0xff]++;
+                keysOut[destination]    = keys[i];
+                indicesOut[destination] = indices[i];
+            }
+
+            std::swap(keys, keysOut);
+            std::swap(indices, indicesOut);
+        }
+
+        m_Sorted.clear();
+        m_Sorted.reserve(count);
+        for(uint32_t i = 0; i < count; i++)
+            m_Sorted.push_back(queue[indices[i]]);
+
+        queue.swap(m_Sorted);
+    }
+
+} // NekoEngine
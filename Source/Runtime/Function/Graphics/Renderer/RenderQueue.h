@@ -0,0 +1,73 @@
+#pragma once
+
+#include "IRenderer.h"
+
+namespace NekoEngine
+{
+    class DescriptorSet;
+
+    enum class RenderBucket : uint8_t
+    {
+        Opaque      = 0,
+        Transparent = 1,
+        Overlay     = 2 // Not depth tested, drawn last
+    };
+
+    // Draw order packed into one integer so sorting is a plain 64 bit compare:
+    //   opaque      | bucket:4 | pipeline:12 | material:16 | mesh:12 | depth:20 front to back
+    //   transparent | bucket:4 | depth:24 back to front | pipeline:12 | material:12 | mesh:12
+    // State ids are folded pointers. A collision only splits a batch, binding still compares pointers.
+    namespace RenderSortKey
+    {
+        // Levels of detail of one mesh get distinct mesh ids so they batch separately
+        uint64_t Make(RenderBucket bucket, const Pipeline* pipeline, const Material* material, const Mesh* mesh, float depth, uint32_t lod = 0);
+
+        // Depth is the view distance normalised to [0, 1]
+        uint32_t QuantiseDepth(float depth, uint32_t bits);
+    }
+
+    // LSD radix sort of a command queue by RenderCommand::sortKey. Stable, and byte passes where
+    // every key has the same digit are skipped. Scratch memory is kept between frames.
+    class RenderQueueSorter
+    {
+    public:
+        void Sort(CommandQueue& queue);
+
+    private:
+        ArrayList<uint64_t> m_Keys;
+        ArrayList<uint64_t> m_KeysScratch;
+        ArrayList<uint32_t> m_Indices;
+        ArrayList<uint32_t> m_IndicesScratch;
+        CommandQueue m_Sorted;
+    };
+
+    // A run of sorted commands sharing mesh, level of detail, material and pipeline, drawn with one instanced call
+    struct RenderBatch
+    {
+        uint32_t firstCommand  = 0;
+        uint32_t instanceCount = 0;
+        uint32_t firstInstance = 0; // Offset into the frame's instance buffer
+    };
+
+    typedef std::vector<RenderBatch> BatchQueue;
+
+    // Merges neighbouring commands of a sorted queue into batches and appends their transforms to
+    // instanceTransforms. Without an instance buffer every command becomes its own batch.
+    void BuildRenderBatches(const CommandQueue& queue, BatchQueue& batches, ArrayList<glm::mat4>* instanceTransforms);
+
+    // What is currently bound inside a pass, used to skip redundant binds of sorted commands
+    struct RenderBindState
+    {
+        Pipeline* pipeline         = nullptr;
+        DescriptorSet* materialSet = nullptr;
+        Mesh* mesh                 = nullptr;
+
+        void Reset()
+        {
+            pipeline    = nullptr;
+            materialSet = nullptr;
+            mesh        = nullptr;
+        }
+    };
+
+} // NekoEngine
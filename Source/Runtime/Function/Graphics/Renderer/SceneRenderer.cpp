@@ -6,9 +6,13 @@
 #include "Renderable/Environment.h"
 #include "Entity/Entity.h"
 #include "Component/ModelComponent.h"
+#include "Component/OccluderComponent.h"
 #include "GUI/ImGuiUtility.h"
 #include "RHI/Renderer.h"
 #include "Engine.h"
+#include "JobSystem/ParallelEach.h"
+#include "Hash.h"
+#include "Profiler/Profiler.h"
 
 namespace NekoEngine
 {
@@ -43,8 +47,9 @@ namespace NekoEngine
         mainRenderTargetDesc.minFilter = TextureFilter::LINEAR;
         mainRenderTargetDesc.magFilter = TextureFilter::LINEAR;
         mainRenderTargetDesc.generateMipMaps = false;
-        m_MainTexture = GET_RHI_FACTORY()->CreateTexture2D(mainRenderTargetDesc, width, height);
-        m_PostProcessTexture1 = GET_RHI_FACTORY()->CreateTexture2D(mainRenderTargetDesc, width, height);
+        m_MainTextureDesc = mainRenderTargetDesc;
+        m_SceneTexture = GET_RHI_FACTORY()->CreateTexture2D(mainRenderTargetDesc, width, height);
+        m_MainTexture = m_SceneTexture;
 
         // Setup shadow pass data
         m_ShadowData.m_ShadowTex = nullptr;
@@ -53,9 +58,18 @@ namespace NekoEngine
         m_ShadowData.m_ShadowMapsInvalidated = true;
         m_ShadowData.m_CascadeSplitLambda = 0.92f;
         m_ShadowData.m_Shader = GET_SHADER_LIB()->GetResource("Shadow");
+        m_ShadowData.m_InstancedShader = GET_SHADER_LIB()->GetResource("ShadowInstanced");
+        m_ShadowData.m_PackedShader = GET_SHADER_LIB()->GetResource("ShadowPacked");
+        m_ShadowData.m_PackedInstancedShader = GET_SHADER_LIB()->GetResource("ShadowPackedInstanced");
         m_ShadowData.m_ShadowTex = GET_RHI_FACTORY()->CreateTextureDepthArray(m_ShadowData.m_ShadowMapSize,
                                                                               m_ShadowData.m_ShadowMapSize,
                                                                               m_ShadowData.m_ShadowMapNum);
+
+        // Without copies the static casters are drawn into the shadow map with the dynamic ones
+        if(gEngine->GetRenderer()->capabilities.SupportTextureCopy)
+            m_ShadowData.m_StaticShadowTex = GET_RHI_FACTORY()->CreateTextureDepthArray(m_ShadowData.m_ShadowMapSize,
+                                                                                        m_ShadowData.m_ShadowMapSize,
+                                                                                        m_ShadowData.m_ShadowMapNum);
         m_ShadowData.m_LightSize = 1.5f;
         m_ShadowData.m_MaxShadowDistance = 500.0f;
         m_ShadowData.m_ShadowFade = 40.0f;
@@ -67,16 +81,25 @@ namespace NekoEngine
         descriptorDesc.shader = m_ShadowData.m_Shader.get();
         m_ShadowData.m_DescriptorSet.resize(1);
         m_ShadowData.m_DescriptorSet[0] = SharedPtr<DescriptorSet>(GET_RHI_FACTORY()->CreateDescriptor(descriptorDesc));
+        m_ShadowData.m_LightMatricesUniform = m_ShadowData.m_DescriptorSet[0]->GetUniformHandle("ShadowData", "LightMatrices");
         m_ShadowData.m_CurrentDescriptorSets.resize(2);
 
         m_ShadowData.m_CascadeCommandQueue[0].reserve(1000);
         m_ShadowData.m_CascadeCommandQueue[1].reserve(1000);
         m_ShadowData.m_CascadeCommandQueue[2].reserve(1000);
         m_ShadowData.m_CascadeCommandQueue[3].reserve(1000);
+        m_ShadowData.m_CascadeStaticQueue[0].reserve(1000);
+        m_ShadowData.m_CascadeStaticQueue[1].reserve(1000);
+        m_ShadowData.m_CascadeStaticQueue[2].reserve(1000);
+        m_ShadowData.m_CascadeStaticQueue[3].reserve(1000);
+        m_ShadowData.m_StaticCasters.reserve(1000);
 
         // Setup forward pass data
         m_ForwardData.m_DepthTest = true;
         m_ForwardData.m_Shader = GET_SHADER_LIB()->GetResource("ForwardPBR");
+        m_ForwardData.m_InstancedShader = GET_SHADER_LIB()->GetResource("ForwardPBRInstanced");
+        m_ForwardData.m_PackedShader = GET_SHADER_LIB()->GetResource("ForwardPBRPacked");
+        m_ForwardData.m_PackedInstancedShader = GET_SHADER_LIB()->GetResource("ForwardPBRPackedInstanced");
         m_ForwardData.m_DepthTexture = GET_RHI_FACTORY()->CreateTextureDepth(width, height);
         m_ForwardData.m_CommandQueue.reserve(1000);
 
@@ -93,6 +116,14 @@ namespace NekoEngine
                 static_cast<uint32_t>(MAX_OBJECTS * m_ForwardData.m_DynamicAlignment),
                 m_ForwardData.m_DynamicAlignment));
 
+        m_ForwardData.m_InstanceTransforms.reserve(MAX_OBJECTS);
+        m_ForwardData.m_InstanceBuffers.resize(GET_SWAP_CHAIN()->GetSwapChainBufferCount());
+        for(auto &instanceBuffer: m_ForwardData.m_InstanceBuffers)
+        {
+            instanceBuffer = GET_RHI_FACTORY()->CreateVertexBuffer(BufferUsage::DYNAMIC);
+            instanceBuffer->Resize(MAX_OBJECTS * sizeof(glm::mat4));
+        }
+
         const int SSAO_NOISE_DIM = 4;
         std::vector<glm::vec4> noiseData(SSAO_NOISE_DIM * SSAO_NOISE_DIM);
 
@@ -119,8 +150,8 @@ namespace NekoEngine
         noiseTextureDesc.magFilter = TextureFilter::LINEAR;
         m_NormalTexture = GET_RHI_FACTORY()->CreateTexture2D(noiseTextureDesc, width, height);
 
-        m_SSAOTexture = GET_RHI_FACTORY()->CreateTexture2D(noiseTextureDesc, width / 2, height / 2);
-        m_SSAOTexture1 = GET_RHI_FACTORY()->CreateTexture2D(noiseTextureDesc, width / 2, height / 2);
+        // The SSAO, bloom and post process targets are render graph transients
+        m_SSAOTextureDesc = noiseTextureDesc;
 
         m_ForwardData.m_BiasMatrix = glm::mat4(
                 0.5, 0.0, 0.0, 0.0,
@@ -151,6 +182,32 @@ namespace NekoEngine
         m_ForwardData.m_DescriptorSet[2] = SharedPtr<DescriptorSet>(
                 GET_RHI_FACTORY()->CreateDescriptor(descriptorDesc));
 
+        // Set 2 is recreated when the environment changes, always from the same layout so these stay valid
+        auto &uniforms = m_ForwardData.m_Uniforms;
+        auto* sceneSet = m_ForwardData.m_DescriptorSet[2].get();
+        uniforms.projView              = m_ForwardData.m_DescriptorSet[0]->GetUniformHandle("UBO", "projView");
+        uniforms.cameraPosition        = sceneSet->GetUniformHandle("UBOLight", "cameraPosition");
+        uniforms.viewMatrix            = sceneSet->GetUniformHandle("UBOLight", "ViewMatrix");
+        uniforms.lightView             = sceneSet->GetUniformHandle("UBOLight", "LightView");
+        uniforms.shadowTransform       = sceneSet->GetUniformHandle("UBOLight", "ShadowTransform");
+        uniforms.splitDepths           = sceneSet->GetUniformHandle("UBOLight", "SplitDepths");
+        uniforms.biasMatrix            = sceneSet->GetUniformHandle("UBOLight", "BiasMatrix");
+        uniforms.lightSize             = sceneSet->GetUniformHandle("UBOLight", "LightSize");
+        uniforms.shadowFade            = sceneSet->GetUniformHandle("UBOLight", "ShadowFade");
+        uniforms.cascadeFade           = sceneSet->GetUniformHandle("UBOLight", "CascadeFade");
+        uniforms.maxShadowDist         = sceneSet->GetUniformHandle("UBOLight", "MaxShadowDist");
+        uniforms.initialBias           = sceneSet->GetUniformHandle("UBOLight", "InitialBias");
+        uniforms.width                 = sceneSet->GetUniformHandle("UBOLight", "Width");
+        uniforms.height                = sceneSet->GetUniformHandle("UBOLight", "Height");
+        uniforms.shadowEnabled         = sceneSet->GetUniformHandle("UBOLight", "shadowEnabled");
+        uniforms.directionalLightCount = sceneSet->GetUniformHandle("UBOLight", "DirectionalLightCount");
+        uniforms.clusterProjView       = sceneSet->GetUniformHandle("UBOLight", "ClusterProjView");
+        uniforms.clusterCount          = sceneSet->GetUniformHandle("UBOLight", "ClusterCount");
+        uniforms.clusterDepthParams    = sceneSet->GetUniformHandle("UBOLight", "ClusterDepthParams");
+        uniforms.shadowCount           = sceneSet->GetUniformHandle("UBOLight", "ShadowCount");
+        uniforms.mode                  = sceneSet->GetUniformHandle("UBOLight", "Mode");
+        uniforms.envMipCount           = sceneSet->GetUniformHandle("UBOLight", "EnvMipCount");
+
         // m_ForwardData.m_DescriptorSet[0]->SetUniformDynamic("TransformData", static_cast<uint32_t>(MAX_OBJECTS * m_ForwardData.m_DynamicAlignment));
 
         m_ForwardData.m_DefaultMaterial = new Material(m_ForwardData.m_Shader);
@@ -207,12 +264,6 @@ namespace NekoEngine
                         SharedPtr<DescriptorSet>(GET_RHI_FACTORY()->CreateDescriptor(descriptorDesc)));
         }
 
-        mainRenderTargetDesc.flags =
-                TextureFlags::Texture_RenderTarget | TextureFlags::Texture_CreateMips | TextureFlags::Texture_MipViews;
-        m_BloomTexture = GET_RHI_FACTORY()->CreateTexture2D(mainRenderTargetDesc, width, height);
-        m_BloomTexture1 = GET_RHI_FACTORY()->CreateTexture2D(mainRenderTargetDesc, width, height);
-        m_BloomTexture2 = GET_RHI_FACTORY()->CreateTexture2D(mainRenderTargetDesc, width, height);
-
         m_FXAAShader = GET_SHADER_LIB()->GetResource(m_SupportCompute ? "FXAAComp" : "FXAA");
         descriptorDesc.layoutIndex = 0;
         descriptorDesc.shader = m_FXAAShader.get();
@@ -230,6 +281,11 @@ namespace NekoEngine
                 GET_RHI_FACTORY()->CreateDescriptor(descriptorDesc));
 
         m_DepthPrePassShader = GET_SHADER_LIB()->GetResource("DepthPrePass");
+        m_DepthPrePassInstancedShader = GET_SHADER_LIB()->GetResource("DepthPrePassInstanced");
+        m_DepthPrePassPackedShader = GET_SHADER_LIB()->GetResource("DepthPrePassPacked");
+        m_DepthPrePassPackedInstancedShader = GET_SHADER_LIB()->GetResource("DepthPrePassPackedInstanced");
+        if(!m_DepthPrePassShader->GetPushConstants().empty())
+            m_ForwardData.m_Uniforms.depthPrePassTransform = m_DepthPrePassShader->GetPushConstants()[0].GetHandle("transform");
         descriptorDesc.layoutIndex = 0;
         descriptorDesc.shader = m_DepthPrePassShader.get();
         m_DepthPrePassDescriptorSet = SharedPtr<DescriptorSet>(GET_RHI_FACTORY()->CreateDescriptor(descriptorDesc));
@@ -561,18 +617,16 @@ namespace NekoEngine
     SceneRenderer::~SceneRenderer()
     {
         delete m_ForwardData.m_DepthTexture;
-        delete m_MainTexture;
-        delete m_PostProcessTexture1;
-        delete m_SSAOTexture;
-        delete m_SSAOTexture1;
+        delete m_SceneTexture;
         delete m_NoiseTexture;
-        delete m_BloomTexture;
-        delete m_BloomTexture1;
-        delete m_BloomTexture2;
         delete m_NormalTexture;
 
         delete m_ShadowData.m_ShadowTex;
+        delete m_ShadowData.m_StaticShadowTex;
         delete m_ForwardData.m_DefaultMaterial;
+
+        for(auto instanceBuffer: m_ForwardData.m_InstanceBuffers)
+            delete instanceBuffer;
         delete m_DefaultTextureCube;
         delete m_ScreenQuad;
 
@@ -642,15 +696,11 @@ namespace NekoEngine
         height -= (height % 2 != 0) ? 1 : 0;
 
         m_ForwardData.m_DepthTexture->Resize(width, height);
-        m_MainTexture->Resize(width, height);
-        m_PostProcessTexture1->Resize(width, height);
-        m_SSAOTexture->Resize(width / 2, height / 2);
-        m_SSAOTexture1->Resize(width / 2, height / 2);
-        m_BloomTexture->Resize(width, height);
-        m_BloomTexture1->Resize(width, height);
-        m_BloomTexture2->Resize(width, height);
-
+        m_SceneTexture->Resize(width, height);
         m_NormalTexture->Resize(width, height);
+
+        // Transients are created again at the new size by the next compile
+        m_RenderGraph.ReleaseTransients();
     }
 
     void SceneRenderer::EnableDebugRenderer(bool enable)
@@ -665,6 +715,7 @@ namespace NekoEngine
 
     void SceneRenderer::BeginScene(Level* level)
     {
+        NekoEngine_PROFILE_FUNCTION();
 
         auto &registry = level->GetRegistry();
         m_CurrentScene = level;
@@ -672,7 +723,12 @@ namespace NekoEngine
         m_Stats.NumDrawCalls = 0;
         m_Stats.NumRenderedObjects = 0;
         m_Stats.NumShadowObjects = 0;
+        m_Stats.NumShadowCascadesDrawn = 0;
+        m_Stats.NumShadowCascadesStatic = 0;
         m_Stats.UpdatesPerSecond = 0;
+        m_Stats.NumPipelineBinds = 0;
+        m_Stats.NumDescriptorBinds = 0;
+        m_Stats.NumVertexBufferBinds = 0;
 
         m_Renderer2DData.m_BatchDrawCallIndex = 0;
         m_TextRendererData.m_BatchDrawCallIndex = 0;
@@ -713,7 +769,7 @@ namespace NekoEngine
 
         if(renderSettings.Renderer3DEnabled)
         {
-            m_ForwardData.m_DescriptorSet[0]->SetUniform("UBO", "projView", &projView);
+            m_ForwardData.m_DescriptorSet[0]->SetUniform(m_ForwardData.m_Uniforms.projView, &projView);
             m_ForwardData.m_DescriptorSet[0]->Update();
         }
 
@@ -771,22 +827,20 @@ namespace NekoEngine
         }
 
         Light* directionaLight = nullptr;
-        static Light lights[256];
-        uint32_t numLights = 0;
 
         if(renderSettings.Renderer3DEnabled)
         {
             m_ForwardData.m_Frustum = m_Camera->GetFrustum(view);
+            m_LightClusterer.Begin(view, proj, m_Camera->GetNear(), m_Camera->GetFar());
             {
                 auto group = registry.group<Light>(entt::get<Transform>);
 
-                for(auto &lightEntity: group)
+                // Every light only writes its own component, the clusterer takes the visible ones in group order after
+                m_VisibleLights.clear();
+                ParallelEach(group, 64, m_LightScratch, m_VisibleLights, [&group, level, this](entt::entity lightEntity, ArrayList<entt::entity>& visible)
                 {
                     if(!Entity(lightEntity, level).Active())
-                        continue;
-
-                    if(numLights >= 64)
-                        break;
+                        return;
 
                     const auto &[light, trans] = group.get<Light, Transform>(lightEntity);
                     light.Position = glm::vec4(trans.GetWorldPosition(), 1.0f);
@@ -795,49 +849,76 @@ namespace NekoEngine
                     forward = glm::normalize(forward);
                     light.Direction = glm::vec4(forward, 1.0f);
 
-                    if(light.Type == (float) LightType::DirectionalLight)
-                        directionaLight = &light;
-
                     if(light.Type != float(LightType::DirectionalLight))
                     {
                         auto inside = m_ForwardData.m_Frustum.IsInside(
-                                BoundingSphere(glm::vec3(light.Position), light.Radius * 100));
+                                BoundingSphere(glm::vec3(light.Position), light.Radius));
 
                         if(inside == Intersection::OUTSIDE)
-                            continue;
+                            return;
                     }
 
-                    lights[numLights] = light;
-                    lights[numLights].Intensity *= m_Exposure;
-                    numLights++;
+                    visible.push_back(lightEntity);
+                });
+
+                for(auto lightEntity: m_VisibleLights)
+                {
+                    auto &light = group.get<Light>(lightEntity);
+                    if(light.Type == (float) LightType::DirectionalLight)
+                        directionaLight = &light;
+
+                    Light exposed = light;
+                    exposed.Intensity *= m_Exposure;
+                    m_LightClusterer.AddLight(exposed);
                 }
             }
 
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "lights", lights, sizeof(Light) * numLights);
+            m_LightClusterer.Build();
+            m_Stats.NumLights = (uint32_t)m_LightClusterer.GetLights().size();
+            m_Stats.NumClusterLightIndices = (uint32_t)m_LightClusterer.GetIndices().size();
+
+            const auto &clusterLights = m_LightClusterer.GetLights();
+            const auto &clusterGrid = m_LightClusterer.GetGrid();
+            const auto &clusterIndices = m_LightClusterer.GetIndices();
+            m_ForwardData.m_DescriptorSet[2]->SetStorageBufferData("LightBuffer", clusterLights.data(),
+                                                                   uint32_t(sizeof(Light) * clusterLights.size()));
+            m_ForwardData.m_DescriptorSet[2]->SetStorageBufferData("ClusterGrid", clusterGrid.data(),
+                                                                   uint32_t(sizeof(LightClusterer::ClusterRange) * clusterGrid.size()));
+            m_ForwardData.m_DescriptorSet[2]->SetStorageBufferData("ClusterLightIndices", clusterIndices.data(),
+                                                                   uint32_t(sizeof(uint32_t) * clusterIndices.size()));
 
             glm::vec4 cameraPos = glm::vec4(m_CameraTransform->GetWorldPosition(), 1.0f);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "cameraPosition", &cameraPos);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.cameraPosition, &cameraPos);
         }
 
-        if(renderSettings.ShadowsEnabled)
+        // Static casters are drawn into their own array and copied under the dynamic ones when the backend can
+        // copy, otherwise a cascade is only left alone when it holds static casters that did not change
+        const bool shadowCasting = renderSettings.ShadowsEnabled && directionaLight;
+        const bool shadowCaching = m_Settings.ShadowCaching;
+        const bool shadowCopies = shadowCaching && m_ShadowData.m_StaticShadowTex;
+
+        for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
         {
-            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
-            {
-                m_ShadowData.m_CascadeCommandQueue[i].clear();
-            }
+            m_ShadowData.m_CascadeCommandQueue[i].clear();
+            m_ShadowData.m_CascadeBatches[i].clear();
+            m_ShadowData.m_CascadeStaticQueue[i].clear();
+            m_ShadowData.m_CascadeStaticBatches[i].clear();
+            m_ShadowData.m_CascadeCache[i].update = false;
+        }
+        m_ShadowData.m_StaticCasters.clear();
 
-            if(directionaLight)
-            {
-                UpdateCascades(level, directionaLight);
+        if(shadowCasting)
+        {
+            UpdateCascades(level, directionaLight);
 
-                for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
-                {
-                    m_ShadowData.m_CascadeFrustums[i].Define(m_ShadowData.m_ShadowProjView[i]);
-                }
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+            {
+                m_ShadowData.m_CascadeFrustums[i].Define(m_ShadowData.m_ShadowProjView[i]);
             }
         }
 
         m_ForwardData.m_CommandQueue.clear();
+        m_ForwardData.m_Batches.clear();
 
         auto &shadowData = GetShadowData();
         glm::mat4* shadowTransforms = shadowData.m_ShadowProjView;
@@ -854,19 +935,19 @@ namespace NekoEngine
         int shadowEnabled = renderSettings.ShadowsEnabled ? 1 : 0;
         if(renderSettings.Renderer3DEnabled)
         {
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "ViewMatrix", &view);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "LightView", &LightView);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "ShadowTransform", shadowTransforms);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "SplitDepths", uSplitDepth);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "BiasMatrix", &m_ForwardData.m_BiasMatrix);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "LightSize", &LightSize);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "ShadowFade", &ShadowFade);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "CascadeFade", &transitionFade);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "MaxShadowDist", &MaxShadowDist);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "InitialBias", &bias);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "Width", &width);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "Height", &height);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "shadowEnabled", &shadowEnabled);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.viewMatrix, &view);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.lightView, &LightView);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.shadowTransform, shadowTransforms);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.splitDepths, uSplitDepth);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.biasMatrix, &m_ForwardData.m_BiasMatrix);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.lightSize, &LightSize);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.shadowFade, &ShadowFade);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.cascadeFade, &transitionFade);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.maxShadowDist, &MaxShadowDist);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.initialBias, &bias);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.width, &width);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.height, &height);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.shadowEnabled, &shadowEnabled);
 
             m_ForwardData.m_DescriptorSet[2]->SetTexture("uShadowMap",
                                                          reinterpret_cast<Texture*>(shadowData.m_ShadowTex), 0,
@@ -874,14 +955,17 @@ namespace NekoEngine
 
             int numShadows = shadowData.m_ShadowMapNum;
             auto EnvMipCount = m_ForwardData.m_EnvironmentMap ? m_ForwardData.m_EnvironmentMap->GetMipMapLevels() : 0;
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "LightCount", &numLights);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "ShadowCount", &numShadows);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "Mode", &m_ForwardData.m_RenderMode);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UBOLight", "EnvMipCount", &EnvMipCount);
+            uint32_t directionalLightCount = m_LightClusterer.GetDirectionalLightCount();
+            glm::uvec4 clusterCount = glm::uvec4(CLUSTER_GRID_X, CLUSTER_GRID_Y, CLUSTER_GRID_Z, 0);
+            glm::vec4 clusterDepthParams = glm::vec4(m_LightClusterer.GetDepthSliceParams(), 0.0f, 0.0f);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.directionalLightCount, &directionalLightCount);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.clusterProjView, &projView);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.clusterCount, &clusterCount);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.clusterDepthParams, &clusterDepthParams);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.shadowCount, &numShadows);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.mode, &m_ForwardData.m_RenderMode);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.envMipCount, &EnvMipCount);
             m_ForwardData.m_DescriptorSet[2]->SetTexture("uBRDFLUT", m_ForwardData.m_BRDFLUT.get());
-            m_ForwardData.m_DescriptorSet[2]->SetTexture("uSSAOMap",
-                                                         gEngine->GetLevelManager()->GetCurrentLevel()->GetSettings().renderSettings.SSAOEnabled
-                                                         ? m_SSAOTexture : Material::GetDefaultTexture().get());
             m_ForwardData.m_DescriptorSet[2]->SetTexture("uEnvMap", m_ForwardData.m_EnvironmentMap, 0,
                                                          TextureType::CUBE);
             m_ForwardData.m_DescriptorSet[2]->SetTexture("uIrrMap", m_ForwardData.m_IrradianceMap, 0,
@@ -889,13 +973,24 @@ namespace NekoEngine
 
             auto group = registry.group<ModelComponent>(entt::get<Transform>);
 
-            PipelineDesc pipelineDesc = {};
-            pipelineDesc.shader = m_ForwardData.m_Shader;
-            pipelineDesc.polygonMode = PolygonMode::FILL;
-            pipelineDesc.blendMode = BlendMode::SrcAlphaOneMinusSrcAlpha;
-            pipelineDesc.isClearTargets = false;
-            pipelineDesc.isSwapChainTarget = false;
+            m_ForwardData.m_Instancing = m_Settings.Instancing && InstancingSupported();
+
+            // Pipeline state per vertex format, resolved when the first mesh of a format shows up
+            const bool packedVertices = PackedVerticesSupported();
+            PipelineDesc pipelineDescs[Mesh::VERTEX_FORMAT_COUNT];
+            uint64_t forwardPassKeys[Mesh::VERTEX_FORMAT_COUNT] = {};
+            Pipeline* shadowPipelines[Mesh::VERTEX_FORMAT_COUNT] = {};
+
+            const glm::vec3 cameraPosition = m_CameraTransform->GetWorldPosition();
+            const float invFar = 1.0f / Maths::Max(m_Camera->GetFar(), 0.0001f);
 
+            const bool occlusionCulling = m_Settings.OcclusionCulling;
+            if(occlusionCulling)
+                m_OcclusionCuller.Begin(projView);
+
+            // Kept serial: culler slots are handed out in order and used by the occluders, and restoring an occluder's
+            // positions reads its source file. The per mesh work is in FrustumCuller::Cull, which runs on the job system.
+            m_Culler.Begin();
             for(auto entity: group)
             {
                 if(!Entity(entity, level).Active())
@@ -906,75 +1001,232 @@ namespace NekoEngine
                 if(!model.model)
                     continue;
 
-                const auto &meshes = model.model->GetMeshes();
+                const auto &worldTransform = trans.GetWorldMatrix();
+
+                const auto* occluder = registry.try_get<OccluderComponent>(entity);
+                const bool isOccluder = occlusionCulling && occluder && occluder->Enabled;
 
-                for(auto mesh: meshes)
+                // Meshes drop their CPU data after upload, occluders get their positions back the first time
+                // they are drawn. A model whose source can't be read again is not used as an occluder.
+                if(isOccluder && model.model->GetResidency() < MeshResidency::Positions)
+                    model.model->SetResidency(MeshResidency::Positions);
+
+                for(auto &mesh: model.model->GetMeshes())
                 {
                     if(!mesh->IsActive())
                         continue;
 
-                    auto &worldTransform = trans.GetWorldMatrix();
-                    auto bbCopy = mesh->GetBoundingBox()->Transformed(worldTransform);
+                    uint32_t index = m_Culler.Add(entity, mesh.get(), &worldTransform);
+                    if(isOccluder && mesh->GetResidency() >= MeshResidency::Positions)
+                        m_OcclusionCuller.AddOccluder(mesh.get(), worldTransform, index);
+                }
+            }
 
-                    if(directionaLight)
-                    {
-                        for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
-                        {
-                            auto inside = m_ShadowData.m_CascadeFrustums[i].IsInside(bbCopy);
+            // View 0 is the camera, the cascades drawn this frame follow
+            Frustum views[CULL_MAX_VIEWS];
+            uint32_t viewCascades[CULL_MAX_VIEWS] = {};
+            uint32_t viewCount = 1;
+            views[0] = m_ForwardData.m_Frustum;
 
-                            if(!inside)
-                                continue;
+            if(shadowCasting)
+            {
+                for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+                {
+                    if(!m_ShadowData.m_CascadeCache[i].update)
+                        continue;
 
-                            RenderCommand command;
-                            command.mesh = mesh.get();
-                            command.transform = worldTransform;
-                            command.material = mesh->GetMaterial() ? mesh->GetMaterial().get()
-                                                                   : m_ForwardData.m_DefaultMaterial;
+                    viewCascades[viewCount] = i;
+                    views[viewCount++] = m_ShadowData.m_CascadeFrustums[i];
+                }
+            }
 
-                            // Bind here in case not bound in the loop below as meshes will be inside
-                            // cascade frustum and not the cameras
-                            command.material->Bind();
+            uint64_t staticHashes[SHADOWMAP_MAX] = {};
 
-                            m_ShadowData.m_CascadeCommandQueue[i].push_back(command);
-                        }
-                    }
+            {
+                NekoEngine_PROFILE_SCOPE("Frustum Cull");
+                m_Culler.Cull(views, viewCount);
+            }
+            m_Stats.NumCullBoundsUpdated = m_Culler.GetNumBoundsUpdated();
+
+            // Camera only, occluders are not rendered from the cascades' point of view
+            m_Stats.NumOccluders       = 0;
+            m_Stats.NumOcclusionCulled = 0;
+            if(occlusionCulling && m_OcclusionCuller.GetNumOccluders() > 0)
+            {
+                NekoEngine_PROFILE_SCOPE("Occlusion Cull");
+                m_OcclusionCuller.Render();
+                m_Stats.NumOccluders       = m_OcclusionCuller.GetNumOccluders();
+                m_Stats.NumOcclusionCulled = m_OcclusionCuller.Cull(m_Culler, 0);
+            }
+
+            // Pixels one unit of error covers at unit view distance, orthographic views ignore the distance
+            const float pixelsPerUnit = m_Camera->GetProjectionMatrix()[1][1] * 0.5f * (float)m_MainTexture->GetHeight();
+            const float lodErrorPerDistance = m_Settings.LodErrorPixels / Maths::Max(pixelsPerUnit, 0.0001f);
+            const bool orthographic = m_Camera->IsOrthographic();
+
+            for(uint32_t index = 0; index < m_Culler.GetCount(); index++)
+            {
+                Mesh* mesh = m_Culler.GetMesh(index);
+                const auto &worldTransform = m_Culler.GetTransform(index);
 
+                const uint32_t vertexFormat = mesh->GetVertexFormat();
+                if(vertexFormat != 0 && !packedVertices)
+                    continue;
+
+                // Quantised positions are dequantised by the transform they are drawn with
+                const glm::mat4 drawTransform = mesh->IsPacked() ? worldTransform * mesh->GetVertexTransform() : worldTransform;
+
+                // Picked once from the camera, so a mesh keeps the same level in every cascade
+                uint32_t lod = 0;
+                uint32_t shadowLod = 0;
+                if(mesh->GetLodCount() > 1)
+                {
+                    glm::vec3 boundsMin, boundsMax;
+                    m_Culler.GetBounds(index, boundsMin, boundsMax);
+
+                    const float radius = glm::length(boundsMax - boundsMin) * 0.5f;
+                    const float distance = orthographic ? 1.0f : Maths::Max(glm::length((boundsMin + boundsMax) * 0.5f - cameraPosition) - radius,
+                                                                          m_Camera->GetNear());
+
+                    // Mesh errors are in object space, the largest axis scale takes them to world space
+                    const float worldScale = Maths::Max(glm::length(glm::vec3(worldTransform[0])),
+                                                        Maths::Max(glm::length(glm::vec3(worldTransform[1])), glm::length(glm::vec3(worldTransform[2]))));
+
+                    lod = mesh->SelectLod(lodErrorPerDistance * distance / Maths::Max(worldScale, 0.0001f));
+                    shadowLod = Maths::Min(lod + (uint32_t)Maths::Max(m_Settings.ShadowLodBias, 0), mesh->GetLodCount() - 1);
+                }
+
+                // Meshes the camera sees have their material bound below
+                const bool visible = m_Culler.IsVisible(0, index);
+                bool bound = visible;
+
+                // Static casters are only queued once it is known which cascades draw them again
+                const bool isStatic = shadowCaching && m_Culler.IsStatic(index);
+                StaticShadowCaster* staticCaster = nullptr;
+                uint64_t casterHash = 0;
+
+                for(uint32_t view = 1; view < viewCount; view++)
+                {
+                    if(!m_Culler.IsVisible(view, index))
+                        continue;
+
+                    const uint32_t cascade = viewCascades[view];
+
+                    if(!shadowPipelines[vertexFormat])
+                        shadowPipelines[vertexFormat] = Pipeline::Get(GetShadowPipelineDesc(vertexFormat)).get();
+
+                    if(staticCaster)
                     {
-                        auto inside = m_ForwardData.m_Frustum.IsInside(bbCopy);
+                        staticCaster->cascades |= 1u << cascade;
+                        HashCombine(staticHashes[cascade], index, casterHash);
+                        continue;
+                    }
+
+                    RenderCommand command;
+                    command.mesh = mesh;
+                    command.lod = shadowLod;
+                    command.transform = drawTransform;
+                    command.material = mesh->GetMaterial() ? mesh->GetMaterial().get()
+                                                           : m_ForwardData.m_DefaultMaterial;
 
-                        if(!inside)
-                            continue;
+                    // Groups the cascade by vertex format, every format is its own pass of the cascade
+                    command.pipeline = shadowPipelines[vertexFormat];
+                    command.sortKey = RenderSortKey::Make(RenderBucket::Opaque, command.pipeline, command.material,
+                                                          command.mesh, 0.0f, command.lod);
 
-                        RenderCommand command;
-                        command.mesh = mesh.get();
-                        command.transform = worldTransform;
-                        command.material = mesh->GetMaterial() ? mesh->GetMaterial().get()
-                                                               : m_ForwardData.m_DefaultMaterial;
+                    if(isStatic)
+                    {
+                        HashCombine(casterHash, mesh, shadowLod);
+                        for(uint32_t j = 0; j < 16; j++)
+                            HashCombine(casterHash, drawTransform[j / 4][j % 4]);
+
+                        staticCaster = &m_ShadowData.m_StaticCasters.emplace_back();
+                        staticCaster->command = command;
+                        staticCaster->cascades = 1u << cascade;
+                        staticCaster->bound = bound;
+                        HashCombine(staticHashes[cascade], index, casterHash);
+                        continue;
+                    }
 
-                        // Update material buffers
+                    // Bind here in case not bound in the loop below as meshes will be inside
+                    // cascade frustum and not the cameras
+                    if(!bound)
+                    {
                         command.material->Bind();
+                        bound = true;
+                    }
 
-                        pipelineDesc.colourTargets[0] = m_MainTexture;
-                        pipelineDesc.cullMode = command.material->GetFlag(Material::RenderFlags::TWOSIDED)
-                                                ? CullMode::NONE : CullMode::BACK;
-                        pipelineDesc.isTransparencyEnabled = command.material->GetFlag(
-                                Material::RenderFlags::ALPHABLEND);
+                    m_ShadowData.m_CascadeCommandQueue[cascade].push_back(command);
+                }
 
-                        if(m_ForwardData.m_DepthTest && command.material->GetFlag(Material::RenderFlags::DEPTHTEST))
-                        {
-                            pipelineDesc.depthTarget = m_ForwardData.m_DepthTexture;
-                        }
+                if(!visible)
+                    continue;
 
-//                        pipelineDesc.DebugName = fmt::format("Forward PBR {0} {1}",
-//                                                             pipelineDesc.isTransparencyEnabled ? "Transparent" : "",
-//                                                             pipelineDesc.depthTarget ? "DepthTested" : "");
+                float depth = glm::length(m_Culler.GetCenter(index) - cameraPosition) * invFar;
 
-                        command.pipeline = Pipeline::Get(pipelineDesc).get();
+                RenderCommand command;
+                command.mesh = mesh;
+                command.lod = lod;
+                command.transform = drawTransform;
+                command.material = mesh->GetMaterial() ? mesh->GetMaterial().get()
+                                                       : m_ForwardData.m_DefaultMaterial;
 
-                        m_ForwardData.m_CommandQueue.push_back(command);
-                    }
+                // Update material buffers
+                command.material->Bind();
+
+                if(!forwardPassKeys[vertexFormat])
+                    pipelineDescs[vertexFormat] = GetForwardPipelineDesc(forwardPassKeys[vertexFormat], vertexFormat);
+
+                command.pipeline = GetForwardPipeline(command.material, pipelineDescs[vertexFormat], forwardPassKeys[vertexFormat]);
+
+                RenderBucket bucket = RenderBucket::Opaque;
+                if(!command.material->GetFlag(Material::RenderFlags::DEPTHTEST))
+                    bucket = RenderBucket::Overlay;
+                else if(command.material->GetFlag(Material::RenderFlags::ALPHABLEND))
+                    bucket = RenderBucket::Transparent;
+
+                command.sortKey = RenderSortKey::Make(bucket, command.pipeline, command.material,
+                                                      command.mesh, depth, command.lod);
+
+                m_ForwardData.m_CommandQueue.push_back(command);
+            }
+
+            // Opaque front to back grouped by state, blended back to front
+            m_ForwardData.m_Sorter.Sort(m_ForwardData.m_CommandQueue);
+
+            if(shadowCasting)
+                QueueStaticShadowCasters(staticHashes, shadowCopies);
+
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+            {
+                m_ShadowData.m_CascadeSorter.Sort(m_ShadowData.m_CascadeCommandQueue[i]);
+                m_ShadowData.m_CascadeSorter.Sort(m_ShadowData.m_CascadeStaticQueue[i]);
+            }
+
+            BuildBatches();
+
+            // Single instance draws of large meshes at full detail are culled again per meshlet for the camera
+            const bool meshletCulling = m_Settings.MeshletCulling;
+            const glm::vec3 viewDirection = -glm::normalize(glm::vec3(m_CameraTransform->GetWorldMatrix()[2]));
+            m_MeshletCuller.Begin(meshletCulling ? (uint32_t) m_ForwardData.m_Batches.size() : 0, m_ForwardData.m_Frustum,
+                                  cameraPosition, viewDirection, orthographic, m_Stats.NumOccluders > 0 ? &m_OcclusionCuller : nullptr);
+
+            if(meshletCulling)
+            {
+                for(uint32_t i = 0; i < (uint32_t) m_ForwardData.m_Batches.size(); i++)
+                {
+                    const auto &batch = m_ForwardData.m_Batches[i];
+                    const auto &command = m_ForwardData.m_CommandQueue[batch.firstCommand];
+
+                    if(batch.instanceCount == 1 && command.lod == 0 && !command.mesh->GetMeshlets().empty())
+                        m_MeshletCuller.Add(i, command.mesh, command.transform, command.material->GetFlag(Material::RenderFlags::TWOSIDED));
                 }
+
+                m_MeshletCuller.Cull();
             }
+
+            m_Stats.NumMeshlets = m_MeshletCuller.GetNumMeshlets();
+            m_Stats.NumMeshletsCulled = m_MeshletCuller.GetNumCulled();
         }
 
         m_Renderer2DData.m_CommandQueue2D.clear();
@@ -1051,71 +1303,258 @@ namespace NekoEngine
 
     void SceneRenderer::OnRender()
     {
+        NekoEngine_PROFILE_FUNCTION();
+        m_SecondaryCommandBufferCount = 0;
 
-        auto &LevelRenderSettings = gEngine->GetLevelManager()->GetCurrentLevel()->GetSettings().renderSettings;
-        gEngine->GetRenderer()->ClearRenderTarget(m_MainTexture, GET_SWAP_CHAIN()->GetCurrentCommandBuffer());
+        BuildRenderGraph();
+        m_RenderGraph.Compile();
+        m_RenderGraph.Execute(GET_SWAP_CHAIN()->GetCurrentCommandBuffer());
+
+        m_MainTexture = m_SceneTexture;
+    }
 
+    void SceneRenderer::BuildRenderGraph()
+    {
+        auto &LevelRenderSettings = gEngine->GetLevelManager()->GetCurrentLevel()->GetSettings().renderSettings;
         LevelRenderSettings.SSAOEnabled = false;
-        if(LevelRenderSettings.SSAOEnabled)
-            gEngine->GetRenderer()->ClearRenderTarget(m_NormalTexture, GET_SWAP_CHAIN()->GetCurrentCommandBuffer());
+
+        const bool postProcess = !m_DisablePostProcess;
+        const uint32_t width   = m_SceneTexture->GetWidth();
+        const uint32_t height  = m_SceneTexture->GetHeight();
 
         // Set to default texture if bloom disabled
         m_BloomTextureLastRenderered = Material::GetDefaultTexture().get();
 
-        if(m_ForwardData.m_DepthTest)
-        {
-            gEngine->GetRenderer()->ClearRenderTarget(dynamic_cast<Texture*>(m_ForwardData.m_DepthTexture), GET_SWAP_CHAIN()->GetCurrentCommandBuffer());
-        }
-
-        GenerateBRDFLUTPass();
-        DepthPrePass();
+        // Set again by the passes that run, nothing may keep pointing at last frame's transients
+        m_MainTexture         = m_SceneTexture;
+        m_PostProcessTexture1 = nullptr;
+        m_SSAOTexture         = nullptr;
+        m_SSAOTexture1        = nullptr;
+        m_BloomTexture        = nullptr;
+        m_BloomTexture1       = nullptr;
+        m_BloomTexture2       = nullptr;
+
+        m_RenderGraph.Reset();
+
+        // The scene colour is only read by the first post process pass, later ones may write over it
+        RenderGraphResource scene  = m_RenderGraph.ImportAliasableTexture("Scene", m_SceneTexture, m_MainTextureDesc);
+        RenderGraphResource depth  = m_RenderGraph.ImportTexture("Depth", dynamic_cast<Texture*>(m_ForwardData.m_DepthTexture));
+        RenderGraphResource normal = m_RenderGraph.ImportTexture("Normal", m_NormalTexture);
+        RenderGraphResource shadow = m_RenderGraph.ImportTexture("Shadow Map", dynamic_cast<Texture*>(m_ShadowData.m_ShadowTex));
+        RenderGraphResource brdf   = m_RenderGraph.ImportTexture("BRDF LUT", m_ForwardData.m_BRDFLUT.get());
+        RenderGraphResource target = m_ForwardData.m_RenderTexture ? m_RenderGraph.ImportTexture("Render Texture", m_ForwardData.m_RenderTexture)
+                                                                   : InvalidRenderGraphResource;
+
+        const bool clearNormal = LevelRenderSettings.SSAOEnabled;
+        const bool clearDepth  = m_ForwardData.m_DepthTest;
+
+        m_RenderGraph.AddPass("Clear",
+            [&](RenderGraphBuilder &builder)
+            {
+                // Cleared with transfers that leave the layout as they found it, so no state is asked for
+                builder.Write(scene, ResourceState::Undefined);
+                if(clearNormal)
+                    builder.Write(normal, ResourceState::Undefined);
+                if(clearDepth)
+                    builder.Write(depth, ResourceState::Undefined);
+            },
+            [this, clearNormal, clearDepth](RenderGraph &graph, CommandBuffer* commandBuffer)
+            {
+                gEngine->GetRenderer()->ClearRenderTarget(m_SceneTexture, commandBuffer);
+                if(clearNormal)
+                    gEngine->GetRenderer()->ClearRenderTarget(m_NormalTexture, commandBuffer);
+                if(clearDepth)
+                    gEngine->GetRenderer()->ClearRenderTarget(dynamic_cast<Texture*>(m_ForwardData.m_DepthTexture), commandBuffer);
+            });
+
+        m_RenderGraph.AddPass("BRDF LUT",
+            [&](RenderGraphBuilder &builder)
+            {
+                builder.SetEnabled(m_GenerateBRDFLUT);
+                builder.Write(brdf);
+            },
+            [this](RenderGraph &graph, CommandBuffer* commandBuffer) { GenerateBRDFLUTPass(); });
 
-        if(LevelRenderSettings.SSAOEnabled && !m_DisablePostProcess)
+        m_RenderGraph.AddPass("Depth Prepass",
+            [&](RenderGraphBuilder &builder)
+            {
+                builder.Write(depth, ResourceState::DepthWrite);
+                builder.Write(normal);
+            },
+            [this](RenderGraph &graph, CommandBuffer* commandBuffer) { DepthPrePass(); });
+
+        RenderGraphResource ssao     = InvalidRenderGraphResource;
+        RenderGraphResource ssaoBlur = InvalidRenderGraphResource;
+        if(LevelRenderSettings.SSAOEnabled && postProcess && m_Camera && m_SSAOShader && m_SSAOShader->IsCompiled())
         {
-            SSAOPass();
+            ssao = m_RenderGraph.CreateTexture("SSAO", m_SSAOTextureDesc, width / 2, height / 2);
+            m_RenderGraph.AddPass("SSAO",
+                [&](RenderGraphBuilder &builder)
+                {
+                    builder.Read(depth);
+                    builder.Read(normal);
+                    builder.Write(ssao);
+                },
+                [this, ssao](RenderGraph &graph, CommandBuffer* commandBuffer)
+                {
+                    m_SSAOTexture = graph.GetTexture2D(ssao);
+                    SSAOPass();
+                });
 
             if(LevelRenderSettings.SSAOBlur)
-                SSAOBlurPass();
+            {
+                ssaoBlur = m_RenderGraph.CreateTexture("SSAO Blur", m_SSAOTextureDesc, width / 2, height / 2);
+                m_RenderGraph.AddPass("SSAO Blur",
+                    [&](RenderGraphBuilder &builder)
+                    {
+                        builder.Read(depth);
+                        builder.Read(normal);
+
+                        // Sampled by the first blur, written back by the second
+                        builder.Write(ssao, ResourceState::ShaderRead);
+                        builder.Write(ssaoBlur);
+                    },
+                    [this, ssao, ssaoBlur](RenderGraph &graph, CommandBuffer* commandBuffer)
+                    {
+                        m_SSAOTexture  = graph.GetTexture2D(ssao);
+                        m_SSAOTexture1 = graph.GetTexture2D(ssaoBlur);
+                        SSAOBlurPass();
+                    });
+            }
         }
 
-        if(m_Settings.ShadowPass && LevelRenderSettings.ShadowsEnabled)
-            ShadowPass();
-        if(m_Settings.GeomPass && LevelRenderSettings.Renderer3DEnabled)
-            ForwardPass();
-        if(m_Settings.SkyboxPass && LevelRenderSettings.SkyboxRenderEnabled)
-            SkyboxPass();
-        if(m_Settings.GeomPass && LevelRenderSettings.Renderer2DEnabled)
-            Render2DPass();
+        m_RenderGraph.AddPass("Shadow",
+            [&](RenderGraphBuilder &builder)
+            {
+                builder.SetEnabled(m_Settings.ShadowPass && LevelRenderSettings.ShadowsEnabled);
+                builder.Write(shadow, ResourceState::DepthWrite);
+            },
+            [this](RenderGraph &graph, CommandBuffer* commandBuffer) { ShadowPass(); });
 
-        TextPass();
+        m_RenderGraph.AddPass("Forward",
+            [&](RenderGraphBuilder &builder)
+            {
+                builder.SetEnabled(m_Settings.GeomPass && LevelRenderSettings.Renderer3DEnabled);
+                builder.Read(shadow);
+                builder.Read(brdf);
+                builder.Read(ssao);
+                builder.Write(depth, ResourceState::DepthWrite);
+                builder.Write(scene);
+            },
+            [this, ssao](RenderGraph &graph, CommandBuffer* commandBuffer)
+            {
+                Texture* ssaoMap = graph.GetTexture(ssao);
+                m_ForwardData.m_DescriptorSet[2]->SetTexture("uSSAOMap", ssaoMap ? ssaoMap : Material::GetDefaultTexture().get());
+                ForwardPass();
+            });
 
-        m_LastRenderTarget = m_MainTexture;
+        m_RenderGraph.AddPass("Skybox",
+            [&](RenderGraphBuilder &builder)
+            {
+                builder.SetEnabled(m_Settings.SkyboxPass && LevelRenderSettings.SkyboxRenderEnabled);
+                builder.Write(depth, ResourceState::DepthWrite);
+                builder.Write(scene);
+            },
+            [this](RenderGraph &graph, CommandBuffer* commandBuffer) { SkyboxPass(); });
+
+        m_RenderGraph.AddPass("2D",
+            [&](RenderGraphBuilder &builder)
+            {
+                builder.SetEnabled(m_Settings.GeomPass && LevelRenderSettings.Renderer2DEnabled);
+                builder.Write(depth, ResourceState::DepthWrite);
+                builder.Write(scene);
+            },
+            [this](RenderGraph &graph, CommandBuffer* commandBuffer) { Render2DPass(); });
+
+        m_RenderGraph.AddPass("Text",
+            [&](RenderGraphBuilder &builder) { builder.Write(scene); },
+            [this](RenderGraph &graph, CommandBuffer* commandBuffer)
+            {
+                TextPass();
+                m_LastRenderTarget = m_MainTexture;
+            });
 
         // if (LevelRenderSettings.EyeAdaptation)
         //    EyeAdaptationPass();
 
-        if(LevelRenderSettings.BloomEnabled && !m_DisablePostProcess)
-            BloomPass();
-
-        if(LevelRenderSettings.DepthOfFieldEnabled && !m_DisablePostProcess)
-            DepthOfFieldPass();
-
-        if(LevelRenderSettings.DebandingEnabled && !m_DisablePostProcess)
-            DebandingPass();
-
-        ToneMappingPass();
-
-        if(LevelRenderSettings.SharpenEnabled && !m_DisablePostProcess)
-            SharpenPass();
-
-        if(LevelRenderSettings.FXAAEnabled && !m_DisablePostProcess)
-            FXAAPass();
+        RenderGraphResource bloom  = InvalidRenderGraphResource;
+        RenderGraphResource bloom1 = InvalidRenderGraphResource;
+        RenderGraphResource bloom2 = InvalidRenderGraphResource;
+        if(LevelRenderSettings.BloomEnabled && postProcess && width > 0 && height > 0)
+        {
+            TextureDesc bloomDesc = m_MainTextureDesc;
+            bloomDesc.flags = TextureFlags::Texture_RenderTarget | TextureFlags::Texture_CreateMips | TextureFlags::Texture_MipViews;
+            bloom  = m_RenderGraph.CreateTexture("Bloom", bloomDesc, width, height);
+            bloom1 = m_RenderGraph.CreateTexture("Bloom 1", bloomDesc, width, height);
+            bloom2 = m_RenderGraph.CreateTexture("Bloom 2", bloomDesc, width, height);
+
+            const ResourceState bloomState = m_SupportCompute ? ResourceState::Storage : ResourceState::RenderTarget;
+            m_RenderGraph.AddPass("Bloom",
+                [&](RenderGraphBuilder &builder)
+                {
+                    builder.Read(scene);
+                    builder.Write(bloom, bloomState);
+                    builder.Write(bloom1, bloomState);
+                    builder.Write(bloom2, bloomState);
+                },
+                [this, bloom, bloom1, bloom2](RenderGraph &graph, CommandBuffer* commandBuffer)
+                {
+                    m_BloomTexture  = graph.GetTexture2D(bloom);
+                    m_BloomTexture1 = graph.GetTexture2D(bloom1);
+                    m_BloomTexture2 = graph.GetTexture2D(bloom2);
+                    BloomPass();
+                });
+        }
 
-        if(LevelRenderSettings.ChromaticAberationEnabled && !m_DisablePostProcess)
-            ChromaticAberationPass();
+        // Every post process pass reads the colour so far and writes a new one, which the graph places in the
+        // scene texture or a pooled one. The pass methods return early without writing when their shader is
+        // not ready, so those checks are made here and such a pass is not added at all.
+        RenderGraphResource colour   = scene;
+        RenderGraphResource previous = InvalidRenderGraphResource;
+        auto addPostProcessPass = [&](const char* name, bool enabled, void (SceneRenderer::*pass)(), ResourceState outputState, bool readsBloom)
+        {
+            if(!enabled)
+                return;
 
-        if(LevelRenderSettings.FilmicGrainEnabled && !m_DisablePostProcess)
-            FilmicGrainPass();
+            RenderGraphResource input  = colour;
+            RenderGraphResource output = m_RenderGraph.CreateTexture(name, m_MainTextureDesc, width, height);
+            m_RenderGraph.AddPass(name,
+                [&](RenderGraphBuilder &builder)
+                {
+                    builder.Read(input);
+                    if(readsBloom)
+                    {
+                        builder.Read(bloom1);
+                        builder.Read(bloom2);
+                    }
+                    builder.Write(output, outputState);
+                },
+                [this, input, output, pass](RenderGraph &graph, CommandBuffer* commandBuffer)
+                {
+                    m_MainTexture         = graph.GetTexture2D(input);
+                    m_PostProcessTexture1 = graph.GetTexture2D(output);
+                    (this->*pass)();
+                });
+
+            previous = input;
+            colour   = output;
+        };
+
+        const ResourceState computeState = m_SupportCompute ? ResourceState::Storage : ResourceState::RenderTarget;
+        addPostProcessPass("Depth Of Field", LevelRenderSettings.DepthOfFieldEnabled && postProcess && m_Camera && m_DepthOfFieldShader &&
+                           m_DepthOfFieldShader->IsCompiled(), &SceneRenderer::DepthOfFieldPass, ResourceState::RenderTarget, false);
+        addPostProcessPass("Debanding", LevelRenderSettings.DebandingEnabled && postProcess && m_DebandingShader->IsCompiled(),
+                           &SceneRenderer::DebandingPass, ResourceState::RenderTarget, false);
+        addPostProcessPass("Tone Mapping", true, &SceneRenderer::ToneMappingPass, ResourceState::RenderTarget, true);
+
+        // SharpenPass is not implemented and writes nothing yet
+
+        addPostProcessPass("FXAA", LevelRenderSettings.FXAAEnabled && postProcess && m_FXAAShader->IsCompiled(),
+                           &SceneRenderer::FXAAPass, computeState, false);
+        addPostProcessPass("Chromatic Aberation", LevelRenderSettings.ChromaticAberationEnabled && postProcess && m_Camera &&
+                           m_ChromaticAberationShader->IsCompiled(), &SceneRenderer::ChromaticAberationPass, ResourceState::RenderTarget, false);
+        addPostProcessPass("Filmic Grain", LevelRenderSettings.FilmicGrainEnabled && postProcess && m_FilmicGrainShader->IsCompiled(),
+                           &SceneRenderer::FilmicGrainPass, ResourceState::RenderTarget, false);
 
         // if(LevelRenderSettings.OutlineEnabled
         // OutlinePass();
@@ -1123,7 +1562,43 @@ namespace NekoEngine
 //        if(m_Settings.DebugPass && LevelRenderSettings.DebugRenderEnabled)
 //            DebugPass();
 
-        FinalPass();
+        m_RenderGraph.AddPass("Final",
+            [&](RenderGraphBuilder &builder)
+            {
+                builder.SetSideEffect();
+                builder.Read(colour);
+                builder.Write(target);
+
+#ifndef NekoEngine_DIST
+                // The debug views show textures from earlier in the frame, which have to live until here
+                switch(LevelRenderSettings.DebugMode)
+                {
+                    case 1:
+                        builder.Read(ssao);
+                        break;
+                    case 2:
+                        builder.Read(ssaoBlur);
+                        break;
+                    case 3:
+                        builder.Read(normal);
+                        break;
+                    case 4:
+                        builder.Read(bloom);
+                        break;
+                    case 6:
+                        builder.Read(previous);
+                        break;
+                    default:
+                        break;
+                }
+#endif
+            },
+            [this, colour, previous](RenderGraph &graph, CommandBuffer* commandBuffer)
+            {
+                m_MainTexture         = graph.GetTexture2D(colour);
+                m_PostProcessTexture1 = graph.GetTexture2D(previous);
+                FinalPass();
+            });
     }
 
     void SceneRenderer::OnUpdate(const TimeStep &timeStep, Level* level)
@@ -1235,10 +1710,26 @@ namespace NekoEngine
                                  ImGuiUtility::PropertyFlag::ReadOnly);
         ImGuiUtility::Property("Max textures Per draw call", (int &) m_Renderer2DData.m_Limits.MaxTextures, 1, 16);
         ImGuiUtility::Property("Exposure", m_Exposure);
+        ImGuiUtility::Property("GPU Instancing", m_Settings.Instancing);
+        ImGuiUtility::Property("Parallel Recording", m_Settings.ParallelRecording);
+        ImGuiUtility::Property("Warm Up Pipelines", m_Settings.WarmUpPipelines);
+        ImGuiUtility::Property("Occlusion Culling", m_Settings.OcclusionCulling);
+        ImGuiUtility::Property("Meshlet Culling", m_Settings.MeshletCulling);
+        ImGuiUtility::Property("LOD Error Pixels", m_Settings.LodErrorPixels, 0.0f, 16.0f, 0.1f);
+        ImGuiUtility::Property("Shadow LOD Bias", m_Settings.ShadowLodBias, 0, (int)MESH_MAX_LODS - 1);
+        ImGuiUtility::Property("Shadow Caching", m_Settings.ShadowCaching);
+        ImGuiUtility::Property("Shadow Far Cascade Interval", m_Settings.ShadowFarCascadeInterval, 1, 8);
+        ImGuiUtility::Property("Shadow Snap Texels", m_Settings.ShadowSnapTexels, 1, 64);
 
         ImGui::Columns(1);
         ImGui::Separator();
         ImGui::PopStyleVar();
+
+        if(ImGui::TreeNode("Render Graph"))
+        {
+            m_RenderGraph.OnImGui();
+            ImGui::TreePop();
+        }
     }
 
     void SceneRenderer::OnNewLevel(Level* level)
@@ -1256,6 +1747,152 @@ namespace NekoEngine
         descriptorDesc.layoutIndex = 0;
         descriptorDesc.shader = m_SkyboxShader.get();
         m_SkyboxDescriptorSet = SharedPtr<DescriptorSet>(GET_RHI_FACTORY()->CreateDescriptor(descriptorDesc));
+
+        if(m_Settings.WarmUpPipelines && level)
+            WarmUpPipelines(level);
+
+        InvalidateShadowCache();
+    }
+
+    void SceneRenderer::InvalidateShadowCache()
+    {
+        for(auto &cache: m_ShadowData.m_CascadeCache)
+            cache = ShadowCascadeCache();
+    }
+
+    PipelineDesc SceneRenderer::GetForwardPipelineDesc(uint64_t &passKey, uint32_t vertexFormat) const
+    {
+        PipelineDesc pipelineDesc = {};
+        if(vertexFormat != 0)
+            pipelineDesc.shader = m_ForwardData.m_Instancing ? m_ForwardData.m_PackedInstancedShader : m_ForwardData.m_PackedShader;
+        else
+            pipelineDesc.shader = m_ForwardData.m_Instancing ? m_ForwardData.m_InstancedShader : m_ForwardData.m_Shader;
+        pipelineDesc.vertexLayout = Mesh::GetVertexLayout(vertexFormat);
+        pipelineDesc.polygonMode = PolygonMode::FILL;
+        pipelineDesc.blendMode = BlendMode::SrcAlphaOneMinusSrcAlpha;
+        pipelineDesc.isClearTargets = false;
+        pipelineDesc.isSwapChainTarget = false;
+        pipelineDesc.colourTargets[0] = m_MainTexture;
+
+        // Materials keep the pipeline they resolved until their flags or this pass state change
+        passKey = pipelineDesc.GetHash();
+        HashCombine(passKey, m_ForwardData.m_DepthTest, m_ForwardData.m_DepthTexture->GetUUID());
+        return pipelineDesc;
+    }
+
+    Pipeline* SceneRenderer::GetForwardPipeline(Material* material, PipelineDesc &pipelineDesc, uint64_t passKey) const
+    {
+        Pipeline* cached = material->GetPipeline(passKey);
+        if(cached)
+            return cached;
+
+        pipelineDesc.cullMode = material->GetFlag(Material::RenderFlags::TWOSIDED) ? CullMode::NONE : CullMode::BACK;
+        pipelineDesc.isTransparencyEnabled = material->GetFlag(Material::RenderFlags::ALPHABLEND);
+        pipelineDesc.depthTarget = m_ForwardData.m_DepthTest && material->GetFlag(Material::RenderFlags::DEPTHTEST)
+                                   ? m_ForwardData.m_DepthTexture : nullptr;
+
+        auto pipeline = Pipeline::Get(pipelineDesc);
+        material->SetPipeline(pipeline, passKey);
+        return pipeline.get();
+    }
+
+    PipelineDesc SceneRenderer::GetShadowPipelineDesc(uint32_t vertexFormat, bool clear, bool staticCache) const
+    {
+        PipelineDesc pipelineDesc;
+        if(vertexFormat != 0)
+            pipelineDesc.shader = m_ForwardData.m_Instancing ? m_ShadowData.m_PackedInstancedShader : m_ShadowData.m_PackedShader;
+        else
+            pipelineDesc.shader = m_ForwardData.m_Instancing ? m_ShadowData.m_InstancedShader : m_ShadowData.m_Shader;
+        pipelineDesc.vertexLayout = Mesh::GetVertexLayout(vertexFormat);
+        pipelineDesc.cullMode = CullMode::FRONT;
+        pipelineDesc.isTransparencyEnabled = true; // For alpha cutout
+        pipelineDesc.depthArrayTarget = staticCache ? dynamic_cast<Texture*>(m_ShadowData.m_StaticShadowTex)
+                                                    : dynamic_cast<Texture*>(m_ShadowData.m_ShadowTex);
+        pipelineDesc.isClearTargets = clear;
+        pipelineDesc.isDepthBiasEnabled = false;
+        pipelineDesc.depthBiasConstantFactor = 0.0f;
+        pipelineDesc.depthBiasSlopeFactor = 0.0f;
+        pipelineDesc.DebugName = staticCache ? "Static Shadow" : "Shadow";
+        return pipelineDesc;
+    }
+
+    PipelineDesc SceneRenderer::GetDepthPrePassPipelineDesc(uint32_t vertexFormat) const
+    {
+        PipelineDesc pipelineDesc{};
+        if(vertexFormat != 0)
+            pipelineDesc.shader = m_ForwardData.m_Instancing ? m_DepthPrePassPackedInstancedShader : m_DepthPrePassPackedShader;
+        else
+            pipelineDesc.shader = m_ForwardData.m_Instancing ? m_DepthPrePassInstancedShader : m_DepthPrePassShader;
+        pipelineDesc.vertexLayout = Mesh::GetVertexLayout(vertexFormat);
+        pipelineDesc.polygonMode = PolygonMode::FILL;
+        pipelineDesc.blendMode = BlendMode::SrcAlphaOneMinusSrcAlpha;
+        pipelineDesc.isClearTargets = false;
+        pipelineDesc.isSwapChainTarget = false;
+        pipelineDesc.cullMode = CullMode::BACK;
+        pipelineDesc.isTransparencyEnabled = false;
+        pipelineDesc.depthTarget = m_ForwardData.m_DepthTexture;
+        pipelineDesc.colourTargets[0] = m_NormalTexture;
+        pipelineDesc.DebugName = "Depth Prepass";
+        return pipelineDesc;
+    }
+
+    void SceneRenderer::WarmUpPipelines(Level* level)
+    {
+        // Whatever the driver compiles here also lands in the pipeline cache saved at shutdown
+        m_ForwardData.m_Instancing = m_Settings.Instancing && InstancingSupported();
+        m_WarmPipelines.clear();
+
+        if(m_ShadowData.m_Shader->IsCompiled())
+        {
+            m_WarmPipelines.push_back(Pipeline::Get(GetShadowPipelineDesc()));
+            if(m_ShadowData.m_StaticShadowTex)
+                m_WarmPipelines.push_back(Pipeline::Get(GetShadowPipelineDesc(0, true, true)));
+        }
+        if(m_DepthPrePassShader->IsCompiled())
+            m_WarmPipelines.push_back(Pipeline::Get(GetDepthPrePassPipelineDesc()));
+
+        const bool packedVertices = PackedVerticesSupported();
+        PipelineDesc pipelineDescs[Mesh::VERTEX_FORMAT_COUNT];
+        uint64_t forwardPassKeys[Mesh::VERTEX_FORMAT_COUNT] = {};
+        uint32_t materialCount = 0;
+
+        auto view = level->GetRegistry().view<ModelComponent>();
+        for(auto entity: view)
+        {
+            const auto &model = view.get<ModelComponent>(entity);
+            if(!model.model)
+                continue;
+
+            for(auto &mesh: model.model->GetMeshes())
+            {
+                const uint32_t vertexFormat = mesh->GetVertexFormat();
+                if(vertexFormat != 0 && !packedVertices)
+                    continue;
+
+                // Shadow and depth pipelines of packed formats are warmed with the first mesh using them
+                if(!forwardPassKeys[vertexFormat])
+                {
+                    pipelineDescs[vertexFormat] = GetForwardPipelineDesc(forwardPassKeys[vertexFormat], vertexFormat);
+
+                    if(vertexFormat != 0)
+                    {
+                        m_WarmPipelines.push_back(Pipeline::Get(GetShadowPipelineDesc(vertexFormat)));
+                        if(m_ShadowData.m_StaticShadowTex)
+                            m_WarmPipelines.push_back(Pipeline::Get(GetShadowPipelineDesc(vertexFormat, true, true)));
+                        m_WarmPipelines.push_back(Pipeline::Get(GetDepthPrePassPipelineDesc(vertexFormat)));
+                    }
+                }
+
+                Material* material = mesh->GetMaterial() ? mesh->GetMaterial().get() : m_ForwardData.m_DefaultMaterial;
+                if(!material->GetPipeline(forwardPassKeys[vertexFormat]))
+                {
+                    GetForwardPipeline(material, pipelineDescs[vertexFormat], forwardPassKeys[vertexFormat]);
+                    materialCount++;
+                }
+            }
+        }
+
+        LOG_FORMAT("Warmed up pipelines for %u materials", materialCount);
     }
 
     float RoundUpToNearestMultipleOf5(float value)
@@ -1301,6 +1938,13 @@ namespace NekoEngine
         const glm::mat4 invCam = glm::inverse(
                 m_Camera->GetProjectionMatrix() * glm::inverse(m_CameraTransform->GetWorldMatrix()));
 
+        const uint64_t frame = m_ShadowData.m_FrameIndex++;
+        const float shadowMapSize = (float)m_ShadowData.m_ShadowMapSize;
+        const float snapTexels = (float)Maths::Max(m_Settings.ShadowSnapTexels, 1);
+
+        glm::vec3 lightDir = glm::normalize(-light->Direction);
+        const glm::mat4 lightRotation = glm::lookAt(glm::vec3(0.0f), lightDir, glm::vec3(0.0f, 0.0f, 1.0f));
+
         for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
         {
             float splitDist = cascadeSplits[i];
@@ -1353,42 +1997,39 @@ namespace NekoEngine
             // const float value = 16.0f;
             // radius = std::ceil(radius *value) / value;
 
-            static const float roundTo[8] = {5.0f, 5.0f, 20.0f, 200.0f, 400.0f, 400.0f, 400.0f, 400.0f};
-            radius = RoundUpToNearestMultipleOf5(radius);
+            // Grown so the frustum stays inside when the centre is snapped up to half a step away from it
+            radius = RoundUpToNearestMultipleOf5(radius / Maths::Max(1.0f - 2.0f * snapTexels / shadowMapSize, 0.5f));
 
             cascadeRadius[i] = radius;
 
             glm::vec3 maxExtents = glm::vec3(radius);
             glm::vec3 minExtents = -maxExtents;
 
-            glm::vec3 lightDir = glm::normalize(-light->Direction);
             glm::mat4 lightOrthoMatrix = glm::ortho(minExtents.x, maxExtents.x, minExtents.y, maxExtents.y,
                                                     m_ShadowData.CascadeNearPlaneOffset,
                                                     maxExtents.z - minExtents.z + m_ShadowData.CascadeFarPlaneOffset);
-            glm::mat4 LightViewMatrix = glm::lookAt(frustumCenter - lightDir * -minExtents.z, frustumCenter,
-                                                    glm::vec3(0.0f, 0.0f, 1.0f));
-
-            auto shadowProj = lightOrthoMatrix * LightViewMatrix;
 
-            const bool StabilizeCascades = true;
-            if(StabilizeCascades)
-            {
-                // Create the rounding matrix, by projecting the world-space origin and determining
-                // the fractional offset in texel space
-                glm::vec4 shadowOrigin = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
-                shadowOrigin = shadowProj * shadowOrigin;
-                shadowOrigin *= (m_ShadowData.m_ShadowMapSize * 0.5f);
+            // The centre is snapped in light space to whole steps of snapTexels texels, which keeps the cascade
+            // stable like rounding to a single texel does, and also leaves the matrix exactly the same from
+            // frame to frame while the camera moves within a step, so the cached static casters stay valid
+            const float snapStep = 2.0f * radius * snapTexels / shadowMapSize;
+            glm::vec3 lightSpaceCenter = glm::vec3(lightRotation * glm::vec4(frustumCenter, 1.0f));
+            lightSpaceCenter = glm::floor(lightSpaceCenter / snapStep + 0.5f) * snapStep;
 
-                glm::vec4 roundedOrigin = glm::round(shadowOrigin);
-                glm::vec4 roundOffset = roundedOrigin - shadowOrigin;
-                roundOffset = roundOffset * (2.0f / m_ShadowData.m_ShadowMapSize);
-                roundOffset.z = 0.0f;
-                roundOffset.w = 0.0f;
+            glm::mat4 LightViewMatrix = glm::translate(glm::mat4(1.0f), -(lightSpaceCenter + glm::vec3(0.0f, 0.0f, radius))) * lightRotation;
 
-                lightOrthoMatrix[3] += roundOffset;
-            }
             // Store split distance and matrix in cascade
             m_ShadowData.m_SplitDepth[i] = glm::vec4((m_Camera->GetNear() + splitDist * clipRange) * -1.0f);
+
+            // Far cascades cover a lot with few texels, so they are drawn less often, on staggered frames.
+            // A cascade keeps the matrix it was last drawn with until it is drawn again.
+            const uint32_t interval = i < 2 ? 1u : (uint32_t)Maths::Max(m_Settings.ShadowFarCascadeInterval, 1) << (i - 2);
+
+            auto &cache = m_ShadowData.m_CascadeCache[i];
+            cache.update = interval <= 1 || (frame + i) % interval == 0 || !cache.drawn;
+            if(!cache.update)
+                continue;
+
             m_ShadowData.m_ShadowProjView[i] = lightOrthoMatrix * LightViewMatrix;
 
             if(i == 0)
@@ -1426,59 +2067,216 @@ namespace NekoEngine
         bool empty = true;
         for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
         {
-            if(!m_ShadowData.m_CascadeCommandQueue[i].empty())
+            if(m_ShadowData.m_CascadeCache[i].update)
                 empty = false;
         }
 
         if(empty)
             return;
 
-        m_ShadowData.m_DescriptorSet[0]->SetUniform("ShadowData", "LightMatrices", m_ShadowData.m_ShadowProjView);
+        m_ShadowData.m_DescriptorSet[0]->SetUniform(m_ShadowData.m_LightMatricesUniform, m_ShadowData.m_ShadowProjView);
         m_ShadowData.m_DescriptorSet[0]->Update();
 
-        PipelineDesc pipelineDesc;
-        pipelineDesc.shader = m_ShadowData.m_Shader;
-        pipelineDesc.cullMode = CullMode::FRONT;
-        pipelineDesc.isTransparencyEnabled = true; // For alpha cutout
-        pipelineDesc.depthArrayTarget = reinterpret_cast<Texture*>(m_ShadowData.m_ShadowTex);
-        pipelineDesc.isClearTargets = true;
-        pipelineDesc.isDepthBiasEnabled = false;
-        pipelineDesc.depthBiasConstantFactor = 0.0f;
-        pipelineDesc.depthBiasSlopeFactor = 0.0f;
-        pipelineDesc.DebugName = "Shadow";
+        CommandBuffer* commandBuffer = GET_SWAP_CHAIN()->GetCurrentCommandBuffer();
+        const bool caching = m_Settings.ShadowCaching;
+        const bool copies = caching && m_ShadowData.m_StaticShadowTex;
 
-        auto pipeline = Pipeline::Get(pipelineDesc);
-        auto commandBuffer = GET_SWAP_CHAIN()->GetCurrentCommandBuffer();
+        // Static casters of the cascades that changed go to the static array first, every cascade drawn this
+        // frame then starts from a copy of its static layer and only the dynamic casters are drawn over it
+        if(copies)
+        {
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
+            {
+                const auto &cache = m_ShadowData.m_CascadeCache[i];
+                if(cache.update && cache.drawStatic)
+                    AddShadowPasses(m_ShadowData.m_CascadeStaticQueue[i], m_ShadowData.m_CascadeStaticBatches[i], i, true, true);
+            }
+
+            RecordPasses(commandBuffer);
+
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
+            {
+                if(m_ShadowData.m_CascadeCache[i].update)
+                    gEngine->GetRenderer()->CopyTextureLayer(m_ShadowData.m_StaticShadowTex, m_ShadowData.m_ShadowTex, i, commandBuffer);
+            }
+        }
+
+        for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
+        {
+            const auto &cache = m_ShadowData.m_CascadeCache[i];
+            if(cache.update && (!copies || cache.dynamic))
+                AddShadowPasses(m_ShadowData.m_CascadeCommandQueue[i], m_ShadowData.m_CascadeBatches[i], i, !copies, false);
+        }
+
+        RecordPasses(commandBuffer);
 
         for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
         {
-            m_ShadowData.m_Layer = i;
-            pipeline->Bind(commandBuffer, m_ShadowData.m_Layer);
+            auto &cache = m_ShadowData.m_CascadeCache[i];
+            if(!cache.update)
+                continue;
 
-            uint32_t layer = static_cast<uint32_t>(m_ShadowData.m_Layer);
-            auto &pushConstants = m_ShadowData.m_Shader->GetPushConstants();
-            memcpy(pushConstants[0].data + sizeof(glm::mat4), &layer, sizeof(uint32_t));
-            m_ShadowData.m_CurrentDescriptorSets[0] = m_ShadowData.m_DescriptorSet[0].get();
+            cache.drawn = true;
+            cache.liveIsStatic = caching && !cache.dynamic;
+            m_Stats.NumShadowCascadesDrawn++;
 
-            for(auto &command: m_ShadowData.m_CascadeCommandQueue[m_ShadowData.m_Layer])
+            if(cache.drawStatic)
             {
-                m_Stats.NumShadowObjects++;
+                cache.projView = m_ShadowData.m_ShadowProjView[i];
+                cache.staticHash = cache.frameHash;
+                cache.staticValid = true;
+                m_Stats.NumShadowCascadesStatic++;
+            }
+            else if(!caching)
+                cache.staticValid = false;
+        }
+    }
+
+    void SceneRenderer::AddShadowPasses(const CommandQueue &commands, const BatchQueue &batches, uint32_t cascade,
+                                        bool clear, bool staticCache)
+    {
+        m_ShadowData.m_Layer = cascade;
+
+        if(batches.empty())
+        {
+            if(clear)
+                AddRecordPass(Pipeline::Get(GetShadowPipelineDesc(0, true, staticCache)).get(), cascade, 0, 0,
+                              [](CommandBuffer*, uint32_t, uint32_t, SceneRendererStats &) {});
+            return;
+        }
+
+        // Each cascade is its own render pass, all of them are recorded in one go. The cascade queues are
+        // sorted by the clearing pipeline of each vertex format, only the first run of a cascade clears it.
+        uint32_t runBegin = 0;
+        while(runBegin < batches.size())
+        {
+            const auto &first = commands[batches[runBegin].firstCommand];
+
+            uint32_t runEnd = runBegin + 1;
+            while(runEnd < batches.size() && commands[batches[runEnd].firstCommand].pipeline == first.pipeline)
+                runEnd++;
+
+            Pipeline* pipeline = runBegin == 0 && clear ? first.pipeline
+                                                        : Pipeline::Get(GetShadowPipelineDesc(first.mesh->GetVertexFormat(), false, staticCache)).get();
+
+            AddRecordPass(pipeline, cascade, runBegin, runEnd,
+                          [this, pipeline, &commands, &batches, cascade](CommandBuffer* commandBuffer, uint32_t begin, uint32_t end, SceneRendererStats &stats)
+                          { RecordShadowBatches(commandBuffer, pipeline, commands, batches, cascade, begin, end, stats); });
+
+            runBegin = runEnd;
+        }
+    }
+
+    void SceneRenderer::QueueStaticShadowCasters(const uint64_t* staticHashes, bool copies)
+    {
+        uint32_t redrawn = 0; // Bit per cascade drawing its static casters this frame
+
+        for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+        {
+            auto &cache = m_ShadowData.m_CascadeCache[i];
+            cache.drawStatic = false;
+            cache.dynamic = !m_ShadowData.m_CascadeCommandQueue[i].empty();
+            cache.frameHash = staticHashes[i];
+
+            if(!cache.update || !m_Settings.ShadowCaching)
+                continue;
 
-                Mesh* mesh = command.mesh;
+            const bool unchanged = cache.staticValid && cache.staticHash == cache.frameHash
+                                   && cache.projView == m_ShadowData.m_ShadowProjView[i];
 
-                auto trans = command.transform;
-                memcpy(pushConstants[0].data, &trans, sizeof(glm::mat4));
+            // Without copies the whole layer is drawn again unless it would come out exactly as it is
+            cache.drawStatic = copies ? !unchanged : !(unchanged && cache.liveIsStatic && !cache.dynamic);
 
-                Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-                m_ShadowData.m_CurrentDescriptorSets[1] = material->GetDescriptorSet();
+            if(!cache.drawStatic && !cache.dynamic && cache.liveIsStatic)
+                cache.update = false;
 
-                m_ShadowData.m_Shader->BindPushConstants(commandBuffer, pipeline.get());
-                gEngine->GetRenderer()->BindDescriptorSets(pipeline.get(), commandBuffer, 0,
-                                                           m_ShadowData.m_CurrentDescriptorSets.data(), 2);
-                gEngine->GetRenderer()->DrawMesh(commandBuffer, pipeline.get(), mesh);
+            if(cache.drawStatic)
+                redrawn |= 1u << i;
+        }
+
+        if(!redrawn)
+            return;
+
+        Pipeline* staticPipelines[Mesh::VERTEX_FORMAT_COUNT] = {};
+        for(auto &caster: m_ShadowData.m_StaticCasters)
+        {
+            const uint32_t cascades = caster.cascades & redrawn;
+            if(!cascades)
+                continue;
+
+            RenderCommand command = caster.command;
+            if(copies)
+            {
+                const uint32_t vertexFormat = command.mesh->GetVertexFormat();
+                if(!staticPipelines[vertexFormat])
+                    staticPipelines[vertexFormat] = Pipeline::Get(GetShadowPipelineDesc(vertexFormat, true, true)).get();
+
+                command.pipeline = staticPipelines[vertexFormat];
+                command.sortKey = RenderSortKey::Make(RenderBucket::Opaque, command.pipeline, command.material,
+                                                      command.mesh, 0.0f, command.lod);
             }
 
-            pipeline->End(commandBuffer);
+            if(!caster.bound)
+            {
+                command.material->Bind();
+                caster.bound = true;
+            }
+
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+            {
+                if(!(cascades & (1u << i)))
+                    continue;
+
+                if(copies)
+                    m_ShadowData.m_CascadeStaticQueue[i].push_back(command);
+                else
+                    m_ShadowData.m_CascadeCommandQueue[i].push_back(command);
+            }
+        }
+    }
+
+    void SceneRenderer::RecordShadowBatches(CommandBuffer* commandBuffer, Pipeline* pipeline, const CommandQueue &commands,
+                                            const BatchQueue &batches, uint32_t cascade, uint32_t begin, uint32_t end,
+                                            SceneRendererStats &stats)
+    {
+        const bool instanced = m_ForwardData.m_Instancing;
+        auto shader = pipeline->GetShader();
+
+        // The instanced shader reads the transform per instance, so the cascade index comes first
+        const auto &pushConstant = shader->GetPushConstants()[0];
+        ArrayList<uint8_t> pushData(pushConstant.data, pushConstant.data + pushConstant.size);
+        memcpy(pushData.data() + (instanced ? 0 : sizeof(glm::mat4)), &cascade, sizeof(uint32_t));
+
+        DescriptorSet* sets[2];
+        sets[0] = m_ShadowData.m_DescriptorSet[0].get();
+
+        RenderBindState bindState;
+        bindState.pipeline = pipeline;
+
+        if(instanced)
+            m_ForwardData.m_InstanceBuffers[GET_SWAP_CHAIN()->GetCurrentBufferIndex()]->BindInstanceData(commandBuffer);
+
+        for(uint32_t i = begin; i < end; i++)
+        {
+            auto &batch = batches[i];
+            auto &command = commands[batch.firstCommand];
+            stats.NumShadowObjects += batch.instanceCount;
+
+            if(!instanced)
+                memcpy(pushData.data(), &command.transform, sizeof(glm::mat4));
+
+            Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
+            shader->BindPushConstant(commandBuffer, pipeline, 0, pushData.data());
+
+            if(material->GetDescriptorSet() != bindState.materialSet)
+            {
+                bindState.materialSet = material->GetDescriptorSet();
+                sets[1] = bindState.materialSet;
+                gEngine->GetRenderer()->BindDescriptorSets(pipeline, commandBuffer, 0, sets, 2);
+                stats.NumDescriptorBinds++;
+            }
+
+            DrawMesh(commandBuffer, pipeline, command.mesh, command.lod, bindState, stats, batch.instanceCount, batch.firstInstance);
         }
     }
 
@@ -1486,46 +2284,84 @@ namespace NekoEngine
     {
         
         CommandBuffer* commandBuffer = GET_SWAP_CHAIN()->GetCurrentCommandBuffer();
-        PipelineDesc pipelineDesc{};
-        pipelineDesc.shader = m_DepthPrePassShader;
-        pipelineDesc.polygonMode = PolygonMode::FILL;
-        pipelineDesc.blendMode = BlendMode::SrcAlphaOneMinusSrcAlpha;
-        pipelineDesc.isClearTargets = false;
-        pipelineDesc.isSwapChainTarget = false;
-        pipelineDesc.cullMode = CullMode::BACK;
-        pipelineDesc.isTransparencyEnabled = false;
-        pipelineDesc.depthTarget = m_ForwardData.m_DepthTexture;
-        pipelineDesc.colourTargets[0] = m_NormalTexture;
-        pipelineDesc.DebugName = "Depth Prepass";
 
-        auto pipeline = Pipeline::Get(pipelineDesc).get();
-        commandBuffer->BindPipeline(pipeline);
+        // One pass per run of batches sharing a vertex format
+        const auto &batches = m_ForwardData.m_Batches;
+        uint32_t runBegin = 0;
+
+        do
+        {
+            uint32_t vertexFormat = 0;
+            uint32_t runEnd = runBegin;
+
+            if(runBegin < batches.size())
+            {
+                vertexFormat = m_ForwardData.m_CommandQueue[batches[runBegin].firstCommand].mesh->GetVertexFormat();
+                while(runEnd < batches.size() && m_ForwardData.m_CommandQueue[batches[runEnd].firstCommand].mesh->GetVertexFormat() == vertexFormat)
+                    runEnd++;
+            }
+
+            auto pipeline = Pipeline::Get(GetDepthPrePassPipelineDesc(vertexFormat)).get();
+            AddRecordPass(pipeline, 0, runBegin, runEnd,
+                          [this, pipeline](CommandBuffer* commandBuffer, uint32_t begin, uint32_t end, SceneRendererStats &stats)
+                          { RecordDepthPrePassBatches(commandBuffer, pipeline, begin, end, stats); });
+
+            runBegin = runEnd;
+        } while(runBegin < batches.size());
+
+        RecordPasses(commandBuffer);
+    }
+
+    void SceneRenderer::RecordDepthPrePassBatches(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t begin,
+                                                  uint32_t end, SceneRendererStats &stats)
+    {
+        const bool instanced = m_ForwardData.m_Instancing;
+        auto shader = pipeline->GetShader();
 
-        for(auto &command: m_ForwardData.m_CommandQueue)
+        ArrayList<uint8_t> pushData;
+        const UniformHandle &transform = m_ForwardData.m_Uniforms.depthPrePassTransform;
+        if(!instanced)
         {
+            const auto &pushConstant = shader->GetPushConstants()[0];
+            pushData.assign(pushConstant.data, pushConstant.data + pushConstant.size);
+        }
+
+        RenderBindState bindState;
+        bindState.pipeline = pipeline;
+
+        DescriptorSet* sets[2];
+        sets[0] = m_ForwardData.m_DescriptorSet[0].get();
+
+        if(instanced)
+            m_ForwardData.m_InstanceBuffers[GET_SWAP_CHAIN()->GetCurrentBufferIndex()]->BindInstanceData(commandBuffer);
+
+        for(uint32_t i = begin; i < end; i++)
+        {
+            auto &batch = m_ForwardData.m_Batches[i];
+            auto &command = m_ForwardData.m_CommandQueue[batch.firstCommand];
+
             if(!command.material->GetFlag(Material::RenderFlags::DEPTHTEST) ||
                command.material->GetFlag(Material::RenderFlags::ALPHABLEND))
                 continue;
 
-            Mesh* mesh = command.mesh;
-            auto &worldTransform = command.transform;
-
-            DescriptorSet* sets[2];
-            sets[0] = m_ForwardData.m_DescriptorSet[0].get();
-
             Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-            sets[1] = material->GetDescriptorSet();
 
-            auto &pushConstants = m_DepthPrePassShader->GetPushConstants()[0];
-            pushConstants.SetValue("transform", (void*) &worldTransform);
+            if(!instanced)
+            {
+                memcpy(pushData.data() + transform.offset, &command.transform, sizeof(glm::mat4));
+                shader->BindPushConstant(commandBuffer, pipeline, 0, pushData.data());
+            }
 
-            m_DepthPrePassShader->BindPushConstants(commandBuffer, pipeline);
-            gEngine->GetRenderer()->BindDescriptorSets(pipeline, commandBuffer, 0, sets, 2);
-            gEngine->GetRenderer()->DrawMesh(commandBuffer, pipeline, mesh);
-        }
+            if(material->GetDescriptorSet() != bindState.materialSet)
+            {
+                bindState.materialSet = material->GetDescriptorSet();
+                sets[1] = bindState.materialSet;
+                gEngine->GetRenderer()->BindDescriptorSets(pipeline, commandBuffer, 0, sets, 2);
+                stats.NumDescriptorBinds++;
+            }
 
-        if(commandBuffer)
-            commandBuffer->UnBindPipeline();
+            DrawForwardBatch(commandBuffer, pipeline, i, bindState, stats);
+        }
     }
 
     void SceneRenderer::SSAOPass()
@@ -1658,31 +2494,276 @@ namespace NekoEngine
 
         CommandBuffer* commandBuffer = GET_SWAP_CHAIN()->GetCurrentCommandBuffer();
 
-        for(auto &command: m_ForwardData.m_CommandQueue)
+        m_ForwardData.m_CurrentDescriptorSets[0] = m_ForwardData.m_DescriptorSet[0].get();
+        m_ForwardData.m_CurrentDescriptorSets[2] = m_ForwardData.m_DescriptorSet[2].get();
+
+        // The queue is sorted by pipeline, and a new pipeline starts a new render pass, so every run of
+        // batches sharing a pipeline is recorded as its own pass
+        const auto &batches = m_ForwardData.m_Batches;
+        uint32_t runBegin = 0;
+
+        while(runBegin < batches.size())
         {
-            m_Stats.NumRenderedObjects++;
+            Pipeline* pipeline = m_ForwardData.m_CommandQueue[batches[runBegin].firstCommand].pipeline;
+
+            uint32_t runEnd = runBegin + 1;
+            while(runEnd < batches.size() && m_ForwardData.m_CommandQueue[batches[runEnd].firstCommand].pipeline == pipeline)
+                runEnd++;
+
+            AddRecordPass(pipeline, 0, runBegin, runEnd,
+                          [this, pipeline](CommandBuffer* commandBuffer, uint32_t begin, uint32_t end, SceneRendererStats &stats)
+                          { RecordForwardBatches(commandBuffer, pipeline, begin, end, stats); });
+
+            runBegin = runEnd;
+        }
+
+        RecordPasses(commandBuffer);
+    }
+
+    void SceneRenderer::RecordForwardBatches(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t begin,
+                                             uint32_t end, SceneRendererStats &stats)
+    {
+        const bool instanced = m_ForwardData.m_Instancing;
+        if(instanced)
+            m_ForwardData.m_InstanceBuffers[GET_SWAP_CHAIN()->GetCurrentBufferIndex()]->BindInstanceData(commandBuffer);
+
+        // The pipeline's shader depends on the vertex format, its push constant layout is the one bound
+        auto shader = pipeline->GetShader();
+
+        ArrayList<uint8_t> pushData;
+        UniformHandle transform;
+        if(!instanced)
+        {
+            const auto &pushConstant = shader->GetPushConstants()[0];
+            pushData.assign(pushConstant.data, pushConstant.data + pushConstant.size);
+            transform = pushConstant.GetHandle("transform");
+        }
+
+        DescriptorSet* sets[3];
+        sets[0] = m_ForwardData.m_CurrentDescriptorSets[0];
+        sets[2] = m_ForwardData.m_CurrentDescriptorSets[2];
+
+        // The queue is sorted by material so most of these binds are skipped
+        RenderBindState bindState;
+        bindState.pipeline = pipeline;
+
+        for(uint32_t i = begin; i < end; i++)
+        {
+            auto &batch = m_ForwardData.m_Batches[i];
+            auto &command = m_ForwardData.m_CommandQueue[batch.firstCommand];
+            stats.NumRenderedObjects += batch.instanceCount;
 
-            Mesh* mesh = command.mesh;
-            auto &worldTransform = command.transform;
             Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-            auto pipeline = command.pipeline;
-            commandBuffer->BindPipeline(pipeline);
 
-            m_ForwardData.m_CurrentDescriptorSets[0] = m_ForwardData.m_DescriptorSet[0].get();
-            m_ForwardData.m_CurrentDescriptorSets[1] = material->GetDescriptorSet();
-            m_ForwardData.m_CurrentDescriptorSets[2] = m_ForwardData.m_DescriptorSet[2].get();
+            if(!instanced)
+            {
+                memcpy(pushData.data() + transform.offset, &command.transform, sizeof(glm::mat4));
+                shader->BindPushConstant(commandBuffer, pipeline, 0, pushData.data());
+            }
+
+            if(material->GetDescriptorSet() != bindState.materialSet)
+            {
+                bindState.materialSet = material->GetDescriptorSet();
+                sets[1] = bindState.materialSet;
+                gEngine->GetRenderer()->BindDescriptorSets(pipeline, commandBuffer, 0, sets, 3);
+                stats.NumDescriptorBinds++;
+            }
+
+            DrawForwardBatch(commandBuffer, pipeline, i, bindState, stats);
+        }
+    }
+
+    void SceneRenderer::DrawMesh(CommandBuffer* commandBuffer, Pipeline* pipeline, Mesh* mesh, uint32_t lod, RenderBindState& bindState,
+                                 SceneRendererStats& stats, uint32_t instanceCount, uint32_t firstInstance)
+    {
+        if(mesh != bindState.mesh)
+        {
+            mesh->GetVertexBuffer()->Bind(commandBuffer, pipeline);
+            mesh->GetIndexBuffer()->Bind(commandBuffer);
+            bindState.mesh = mesh;
+            stats.NumVertexBufferBinds++;
+        }
+
+        // Every level of detail lives in the same index buffer, so switching levels needs no rebind
+        const MeshLod &range = mesh->GetLod(lod);
+        gEngine->GetRenderer()->DrawIndexedInstanced(commandBuffer, DrawType::TRIANGLE, range.indexCount,
+                                                     instanceCount, range.indexOffset, firstInstance);
+        stats.NumDrawCalls++;
+    }
+
+    void SceneRenderer::DrawForwardBatch(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t batchIndex, RenderBindState& bindState,
+                                         SceneRendererStats& stats)
+    {
+        const auto &batch = m_ForwardData.m_Batches[batchIndex];
+        const auto &command = m_ForwardData.m_CommandQueue[batch.firstCommand];
+
+        uint32_t rangeCount = 0;
+        const MeshletCuller::DrawRange* ranges = m_MeshletCuller.GetRanges(batchIndex, rangeCount);
+        if(!ranges)
+        {
+            DrawMesh(commandBuffer, pipeline, command.mesh, command.lod, bindState, stats, batch.instanceCount, batch.firstInstance);
+            return;
+        }
+
+        if(rangeCount == 0)
+            return;
+
+        if(command.mesh != bindState.mesh)
+        {
+            command.mesh->GetVertexBuffer()->Bind(commandBuffer, pipeline);
+            command.mesh->GetIndexBuffer()->Bind(commandBuffer);
+            bindState.mesh = command.mesh;
+            stats.NumVertexBufferBinds++;
+        }
+
+        // Meshlet batches are never instanced, firstInstance still points at their transform
+        for(uint32_t i = 0; i < rangeCount; i++)
+        {
+            gEngine->GetRenderer()->DrawIndexedInstanced(commandBuffer, DrawType::TRIANGLE, ranges[i].indexCount, 1,
+                                                         ranges[i].indexOffset, batch.firstInstance);
+            stats.NumDrawCalls++;
+        }
+    }
 
-            auto &pushConstants = m_ForwardData.m_Shader->GetPushConstants()[0];
-            pushConstants.SetValue("transform", (void*) &worldTransform);
+    void SceneRenderer::AddRecordPass(Pipeline* pipeline, uint32_t layer, uint32_t begin, uint32_t end, RecordBatchesFunc record)
+    {
+        RecordPassDesc &pass = m_RecordPasses.emplace_back();
+        pass.pipeline = pipeline;
+        pass.layer = layer;
+        pass.begin = begin;
+        pass.end = end;
+        pass.record = std::move(record);
+    }
+
+    void SceneRenderer::RecordPasses(CommandBuffer* commandBuffer)
+    {
+        uint32_t totalBatches = 0;
+        for(auto &pass: m_RecordPasses)
+            totalBatches += pass.end - pass.begin;
+
+        // Secondary buffers cost more than they save for a handful of draws
+        static constexpr uint32_t MinBatchesPerTask = 32;
+
+        if(!m_Settings.ParallelRecording || JobSystem::GetThreadCount() == 0 || totalBatches < MinBatchesPerTask * 2)
+        {
+            for(auto &pass: m_RecordPasses)
+            {
+                pass.pipeline->Bind(commandBuffer, pass.layer);
+                m_Stats.NumPipelineBinds++;
+                pass.record(commandBuffer, pass.begin, pass.end, m_Stats);
+                pass.pipeline->End(commandBuffer);
+            }
 
-            m_ForwardData.m_Shader->BindPushConstants(commandBuffer, pipeline);
-            gEngine->GetRenderer()->BindDescriptorSets(pipeline, commandBuffer, 0,
-                                                       m_ForwardData.m_CurrentDescriptorSets.data(), 3);
-            gEngine->GetRenderer()->DrawMesh(commandBuffer, pipeline, mesh);
+            m_RecordPasses.clear();
+            return;
+        }
+
+        const uint32_t grainSize = Maths::Max(MinBatchesPerTask, JobSystem::AutoGrainSize(totalBatches));
+
+        m_RecordTasks.clear();
+        for(uint32_t passIndex = 0; passIndex < (uint32_t) m_RecordPasses.size(); passIndex++)
+        {
+            auto &pass = m_RecordPasses[passIndex];
+            for(uint32_t begin = pass.begin; begin < pass.end; begin += grainSize)
+            {
+                SecondaryRecordTask &task = m_RecordTasks.emplace_back();
+                task.pass = passIndex;
+                task.begin = begin;
+                task.end = Maths::Min(pass.end, begin + grainSize);
+                task.commandBuffer = GET_SWAP_CHAIN()->GetSecondaryCommandBuffer(m_SecondaryCommandBufferCount++);
+            }
         }
 
-        if(commandBuffer)
-            commandBuffer->UnBindPipeline();
+        JobSystem::ParallelFor((uint32_t) m_RecordTasks.size(), 1, [this](uint32_t begin, uint32_t end, uint32_t chunk)
+        {
+            NekoEngine_PROFILE_SCOPE("Record Secondary");
+            for(uint32_t i = begin; i < end; i++)
+            {
+                SecondaryRecordTask &task = m_RecordTasks[i];
+                const RecordPassDesc &pass = m_RecordPasses[task.pass];
+
+                pass.pipeline->BindSecondary(task.commandBuffer, pass.layer);
+                task.stats.NumPipelineBinds++;
+                pass.record(task.commandBuffer, task.begin, task.end, task.stats);
+                task.commandBuffer->EndRecording();
+            }
+        });
+
+        // Empty passes still begin and end so their targets are cleared as before
+        uint32_t taskIndex = 0;
+        for(uint32_t passIndex = 0; passIndex < (uint32_t) m_RecordPasses.size(); passIndex++)
+        {
+            auto &pass = m_RecordPasses[passIndex];
+            pass.pipeline->BeginSecondary(commandBuffer, pass.layer);
+
+            for(; taskIndex < m_RecordTasks.size() && m_RecordTasks[taskIndex].pass == passIndex; taskIndex++)
+            {
+                SecondaryRecordTask &task = m_RecordTasks[taskIndex];
+                task.commandBuffer->ExecuteSecondary(commandBuffer);
+
+                m_Stats.NumPipelineBinds += task.stats.NumPipelineBinds;
+                m_Stats.NumDescriptorBinds += task.stats.NumDescriptorBinds;
+                m_Stats.NumVertexBufferBinds += task.stats.NumVertexBufferBinds;
+                m_Stats.NumDrawCalls += task.stats.NumDrawCalls;
+                m_Stats.NumRenderedObjects += task.stats.NumRenderedObjects;
+                m_Stats.NumShadowObjects += task.stats.NumShadowObjects;
+            }
+
+            pass.pipeline->End(commandBuffer);
+        }
+
+        m_RecordPasses.clear();
+    }
+
+    bool SceneRenderer::InstancingSupported() const
+    {
+        auto compiled = [](const SharedPtr<Shader> &shader)
+        { return shader && shader->IsCompiled() && shader->GetInstanceInputStride() > 0; };
+
+        // Packed meshes need the packed instanced variants as well, unless they are not drawn at all
+        const bool packed = !PackedVerticesSupported() ||
+                            (compiled(m_ForwardData.m_PackedInstancedShader) && compiled(m_DepthPrePassPackedInstancedShader) &&
+                             compiled(m_ShadowData.m_PackedInstancedShader));
+
+        return compiled(m_ForwardData.m_InstancedShader) && compiled(m_DepthPrePassInstancedShader) &&
+               compiled(m_ShadowData.m_InstancedShader) && packed;
+    }
+
+    bool SceneRenderer::PackedVerticesSupported() const
+    {
+        auto compiled = [](const SharedPtr<Shader> &shader)
+        { return shader && shader->IsCompiled(); };
+
+        return compiled(m_ForwardData.m_PackedShader) && compiled(m_DepthPrePassPackedShader) &&
+               compiled(m_ShadowData.m_PackedShader);
+    }
+
+    void SceneRenderer::BuildBatches()
+    {
+        NekoEngine_PROFILE_FUNCTION();
+        auto &transforms = m_ForwardData.m_InstanceTransforms;
+        transforms.clear();
+
+        ArrayList<glm::mat4>* instanceTransforms = m_ForwardData.m_Instancing ? &transforms : nullptr;
+
+        BuildRenderBatches(m_ForwardData.m_CommandQueue, m_ForwardData.m_Batches, instanceTransforms);
+        for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+        {
+            BuildRenderBatches(m_ShadowData.m_CascadeCommandQueue[i], m_ShadowData.m_CascadeBatches[i], instanceTransforms);
+            BuildRenderBatches(m_ShadowData.m_CascadeStaticQueue[i], m_ShadowData.m_CascadeStaticBatches[i], instanceTransforms);
+        }
+
+        if(transforms.empty())
+            return;
+
+        // One upload per frame, batches index into it through firstInstance
+        VertexBuffer* instanceBuffer = m_ForwardData.m_InstanceBuffers[GET_SWAP_CHAIN()->GetCurrentBufferIndex()];
+        uint32_t size = static_cast<uint32_t>(transforms.size() * sizeof(glm::mat4));
+
+        if(instanceBuffer->GetSize() < size)
+            instanceBuffer->Resize(size + size / 2);
+
+        instanceBuffer->SetData(size, transforms.data());
     }
 
     void SceneRenderer::SkyboxPass()
@@ -1873,6 +2954,10 @@ namespace NekoEngine
             default:
                 break;
         }
+
+        // Intermediate textures of effects that did not run this frame are not there
+        if(!finalPassTexture)
+            finalPassTexture = m_MainTexture;
 #endif
         m_FinalPassDescriptorSet->SetTexture("u_Texture", finalPassTexture);
         m_FinalPassDescriptorSet->Update();
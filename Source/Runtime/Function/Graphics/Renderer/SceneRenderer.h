@@ -1,6 +1,13 @@
 #pragma once
 
 #include "IRenderer.h"
+#include "RenderQueue.h"
+#include "FrustumCuller.h"
+#include "OcclusionCuller.h"
+#include "MeshletCuller.h"
+#include "LightClusterer.h"
+#include "JobSystem/ParallelEach.h"
+#include "RenderGraph.h"
 #include "RHI/CommandBuffer.h"
 #include "RHI/DescriptorSet.h"
 #include "RHI/Framebuffer.h"
@@ -57,6 +64,16 @@ namespace NekoEngine
         bool PostProcessPass = false;
         bool ShadowPass = true;
         bool SkyboxPass = true;
+        bool Instancing = true;
+        bool ParallelRecording = true;
+        bool WarmUpPipelines = true; // Build the pipelines a level uses while it loads instead of on first draw
+        bool OcclusionCulling = true; // Test camera visible meshes against the OccluderComponent meshes on the CPU
+        bool MeshletCulling = true; // Cull the meshlets of large meshes drawn at full detail, and draw only what is left
+        float LodErrorPixels = 1.0f; // Screen space error a level of detail may have in the main view
+        int ShadowLodBias = 1; // Levels of detail shadow casters drop on top of the main view's choice
+        bool ShadowCaching = true; // Keep the static casters' depth of a cascade while it does not move, only dynamic casters are drawn over it
+        int ShadowFarCascadeInterval = 2; // Cascades past the first two are drawn every this many frames, doubling for each one further out
+        int ShadowSnapTexels = 16; // Cascades move in steps of this many texels, so a still or slowly moving camera keeps them in place
     };
 
     struct SceneRendererStats
@@ -66,6 +83,40 @@ namespace NekoEngine
         uint32_t NumRenderedObjects = 0;
         uint32_t NumShadowObjects = 0;
         uint32_t NumDrawCalls = 0;
+        uint32_t NumPipelineBinds = 0;
+        uint32_t NumDescriptorBinds = 0;
+        uint32_t NumVertexBufferBinds = 0;
+        uint32_t NumCullBoundsUpdated = 0;
+        uint32_t NumLights = 0;
+        uint32_t NumClusterLightIndices = 0;
+        uint32_t NumOccluders = 0;
+        uint32_t NumOcclusionCulled = 0;
+        uint32_t NumMeshlets = 0;
+        uint32_t NumMeshletsCulled = 0;
+        uint32_t NumShadowCascadesDrawn = 0;
+        uint32_t NumShadowCascadesStatic = 0; // Cascades whose static casters were drawn again
+    };
+
+    typedef std::function<void(CommandBuffer* commandBuffer, uint32_t begin, uint32_t end, SceneRendererStats& stats)> RecordBatchesFunc;
+
+    // Batches [begin, end) of one render pass, recorded by record either inline or split over secondary command buffers
+    struct RecordPassDesc
+    {
+        Pipeline* pipeline = nullptr;
+        uint32_t layer     = 0;
+        uint32_t begin     = 0;
+        uint32_t end       = 0;
+        RecordBatchesFunc record;
+    };
+
+    // A range of one pass recorded into its own secondary command buffer on a job system worker
+    struct SecondaryRecordTask
+    {
+        uint32_t pass                = 0;
+        uint32_t begin               = 0;
+        uint32_t end                 = 0;
+        CommandBuffer* commandBuffer = nullptr;
+        SceneRendererStats stats     = {};
     };
 
     struct RenderCommand2D
@@ -93,6 +144,30 @@ namespace NekoEngine
         }
     };
 
+    // What a cascade's layer holds, so layers whose contents would come out the same are not drawn again
+    struct ShadowCascadeCache
+    {
+        glm::mat4 projView  = glm::mat4(0.0f); // Matrix the static casters were drawn with
+        uint64_t staticHash = 0;               // Static casters drawn, with their levels of detail and transforms
+        bool staticValid    = false;           // The static casters for projView and staticHash are drawn
+        bool liveIsStatic   = false;           // The shadow map layer holds the static casters and nothing else
+        bool drawn          = false;           // Drawn at all since the cache was last invalidated
+
+        // Decided every frame
+        bool update        = false; // Drawn this frame, far cascades are skipped on some frames
+        bool drawStatic    = false; // The static casters are drawn again rather than reused
+        bool dynamic       = false; // Dynamic casters are drawn over the static ones
+        uint64_t frameHash = 0;     // Static casters visible this frame
+    };
+
+    // A static caster some cascades see, queued once they know whether their static casters are drawn again
+    struct StaticShadowCaster
+    {
+        RenderCommand command;
+        uint32_t cascades = 0;     // Bit per cascade
+        bool bound        = false; // Its material was already bound this frame
+    };
+
     struct ShadowData
     {
         uint32_t m_Layer = 0;
@@ -103,9 +178,17 @@ namespace NekoEngine
         float m_CascadeFade;
         float m_InitialBias;
         float CascadeFarPlaneOffset = 50.0f, CascadeNearPlaneOffset = -50.0f;
-        CommandQueue m_CascadeCommandQueue[SHADOWMAP_MAX];
+        CommandQueue m_CascadeCommandQueue[SHADOWMAP_MAX]; // Dynamic casters, or every caster while caching is off
+        BatchQueue m_CascadeBatches[SHADOWMAP_MAX];
+        CommandQueue m_CascadeStaticQueue[SHADOWMAP_MAX]; // Static casters, only filled when they are drawn again
+        BatchQueue m_CascadeStaticBatches[SHADOWMAP_MAX];
+        RenderQueueSorter m_CascadeSorter;
+        ShadowCascadeCache m_CascadeCache[SHADOWMAP_MAX];
+        ArrayList<StaticShadowCaster> m_StaticCasters;
+        uint64_t m_FrameIndex = 0;
 
         TextureDepthArray* m_ShadowTex;
+        TextureDepthArray* m_StaticShadowTex = nullptr; // Static casters per cascade, copied under the dynamic ones
         uint32_t m_ShadowMapNum;
         uint32_t m_ShadowMapSize;
         bool m_ShadowMapsInvalidated;
@@ -113,12 +196,47 @@ namespace NekoEngine
         glm::vec4 m_SplitDepth[SHADOWMAP_MAX];
         glm::mat4 m_LightMatrix;
         std::vector<SharedPtr<DescriptorSet>> m_DescriptorSet;
+        UniformHandle m_LightMatricesUniform;
 
         std::vector<DescriptorSet*> m_CurrentDescriptorSets;
         SharedPtr<Shader> m_Shader = nullptr;
+        SharedPtr<Shader> m_InstancedShader = nullptr;
+        SharedPtr<Shader> m_PackedShader = nullptr;
+        SharedPtr<Shader> m_PackedInstancedShader = nullptr;
         Frustum m_CascadeFrustums[SHADOWMAP_MAX];
     };
 
+    // Uniforms written every frame, resolved by name once at init
+    struct ForwardUniforms
+    {
+        UniformHandle projView;
+
+        UniformHandle cameraPosition;
+        UniformHandle viewMatrix;
+        UniformHandle lightView;
+        UniformHandle shadowTransform;
+        UniformHandle splitDepths;
+        UniformHandle biasMatrix;
+        UniformHandle lightSize;
+        UniformHandle shadowFade;
+        UniformHandle cascadeFade;
+        UniformHandle maxShadowDist;
+        UniformHandle initialBias;
+        UniformHandle width;
+        UniformHandle height;
+        UniformHandle shadowEnabled;
+        UniformHandle directionalLightCount;
+        UniformHandle clusterProjView;
+        UniformHandle clusterCount;
+        UniformHandle clusterDepthParams;
+        UniformHandle shadowCount;
+        UniformHandle mode;
+        UniformHandle envMipCount;
+
+        // Push constant members, the forward transform is looked up on each pipeline's own shader
+        UniformHandle depthPrePassTransform;
+    };
+
     struct ForwardData
     {
         Texture2D* m_DefaultTexture;
@@ -132,11 +250,22 @@ namespace NekoEngine
         Texture* m_IrradianceMap = nullptr;
 
         CommandQueue m_CommandQueue;
+        BatchQueue m_Batches;
+        RenderQueueSorter m_Sorter;
+
+        // Per instance transforms of every batch this frame, forward and shadow, one buffer per frame in flight
+        ArrayList<glm::mat4> m_InstanceTransforms;
+        std::vector<VertexBuffer*> m_InstanceBuffers;
+        bool m_Instancing = false;
 
         std::vector<SharedPtr<DescriptorSet>> m_DescriptorSet;
         std::vector<DescriptorSet*> m_CurrentDescriptorSets;
+        ForwardUniforms m_Uniforms;
 
         SharedPtr<Shader> m_Shader = nullptr;
+        SharedPtr<Shader> m_InstancedShader = nullptr;
+        SharedPtr<Shader> m_PackedShader = nullptr;
+        SharedPtr<Shader> m_PackedInstancedShader = nullptr;
         Texture* m_RenderTexture = nullptr;
         TextureDepth* m_DepthTexture = nullptr;
 
@@ -214,8 +343,12 @@ namespace NekoEngine
     public:
         bool m_DebugRenderEnabled = false;
     private:
+        // m_MainTexture and the other pass textures below point at what the render graph assigned while the
+        // graph executes, m_MainTexture is m_SceneTexture outside of it
         Texture2D* m_MainTexture = nullptr;
+        Texture2D* m_SceneTexture = nullptr;
         Texture2D* m_LastRenderTarget = nullptr;
+        TextureDesc m_MainTextureDesc;
 
         Texture2D* m_PostProcessTexture1 = nullptr;
         Texture2D* m_PostProcessTexture2 = nullptr;
@@ -228,6 +361,17 @@ namespace NekoEngine
 
         ShadowData m_ShadowData;
         ForwardData m_ForwardData;
+        FrustumCuller m_Culler;
+        OcclusionCuller m_OcclusionCuller;
+        MeshletCuller m_MeshletCuller;
+        LightClusterer m_LightClusterer;
+        ParallelOutput<entt::entity> m_LightScratch;
+        ArrayList<entt::entity> m_VisibleLights; // Active lights inside the camera frustum, in group order
+        ArrayList<SharedPtr<Pipeline>> m_WarmPipelines; // Pass pipelines built ahead of time, kept alive for the level
+
+        ArrayList<RecordPassDesc> m_RecordPasses;
+        ArrayList<SecondaryRecordTask> m_RecordTasks;
+        uint32_t m_SecondaryCommandBufferCount = 0;
         Renderer2DData m_Renderer2DData;
         Renderer2DData m_TextRendererData;
         DebugDrawData m_DebugDrawData;
@@ -284,9 +428,13 @@ namespace NekoEngine
         SharedPtr<DescriptorSet> m_DepthPrePassDescriptorSet;
         SharedPtr<Pipeline> m_DepthPrePassPipeline = nullptr;
         SharedPtr<Shader> m_DepthPrePassShader;
+        SharedPtr<Shader> m_DepthPrePassInstancedShader;
+        SharedPtr<Shader> m_DepthPrePassPackedShader;
+        SharedPtr<Shader> m_DepthPrePassPackedInstancedShader;
 
         Texture2D* m_SSAOTexture  = nullptr;
         Texture2D* m_SSAOTexture1 = nullptr;
+        TextureDesc m_SSAOTextureDesc;
 
         Texture2D* m_NoiseTexture  = nullptr;
         Texture2D* m_NormalTexture = nullptr;
@@ -309,6 +457,8 @@ namespace NekoEngine
         SharedPtr<DescriptorSet> m_DepthOfFieldPassDescriptorSet;
         SharedPtr<Shader> m_DepthOfFieldShader;
 
+        RenderGraph m_RenderGraph;
+
         SceneRendererSettings m_Settings;
         SceneRendererStats m_Stats;
 
@@ -369,16 +519,60 @@ namespace NekoEngine
 
         float SubmitTexture(Texture* texture);
         void UpdateCascades(Level* level, Light* light);
+        void InvalidateShadowCache();
 
         ForwardData& GetForwardData() { return m_ForwardData; }
         ShadowData& GetShadowData() { return m_ShadowData; }
         SceneRendererSettings& GetSettings() { return m_Settings; }
         SceneRendererStats& GetSceneRendererStats() { return m_Stats; }
+        const RenderGraph& GetRenderGraph() const { return m_RenderGraph; }
 
         void CreateCubeMap(const std::string& filePath, const glm::vec4& params, SharedPtr<TextureCube>& outEnv, SharedPtr<TextureCube>& outIrr);
 
         void SetDisablePostProcess(bool disabled) { m_DisablePostProcess = disabled; }
     private:
+        // Binds the mesh buffers unless the previous draw in the pass used the same mesh, then draws one level of detail
+        void DrawMesh(CommandBuffer* commandBuffer, Pipeline* pipeline, Mesh* mesh, uint32_t lod, RenderBindState& bindState,
+                      SceneRendererStats& stats, uint32_t instanceCount = 1, uint32_t firstInstance = 0);
+
+        // Draws a forward batch, only the meshlet ranges that survived culling when it has any
+        void DrawForwardBatch(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t batchIndex, RenderBindState& bindState,
+                              SceneRendererStats& stats);
+
+        // Queues a pass for RecordPasses, which records every queued pass into commandBuffer in order.
+        // With worker threads the ranges are recorded into secondary command buffers in parallel first.
+        void AddRecordPass(Pipeline* pipeline, uint32_t layer, uint32_t begin, uint32_t end, RecordBatchesFunc record);
+        void RecordPasses(CommandBuffer* commandBuffer);
+
+        // Only read shared state, so they can run on several threads at once
+        void RecordShadowBatches(CommandBuffer* commandBuffer, Pipeline* pipeline, const CommandQueue& commands,
+                                 const BatchQueue& batches, uint32_t cascade, uint32_t begin, uint32_t end, SceneRendererStats& stats);
+
+        // Queues the passes drawing a cascade queue into its layer, the first run clears it when clear is set
+        void AddShadowPasses(const CommandQueue& commands, const BatchQueue& batches, uint32_t cascade, bool clear, bool staticCache);
+
+        // Decides which cascades draw their static casters again and queues them there, staticHashes per cascade
+        void QueueStaticShadowCasters(const uint64_t* staticHashes, bool copies);
+        void RecordDepthPrePassBatches(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t begin, uint32_t end,
+                                       SceneRendererStats& stats);
+        void RecordForwardBatches(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t begin, uint32_t end,
+                                  SceneRendererStats& stats);
+
+        // Declares this frame's passes and the textures they touch, OnRender compiles and executes it
+        void BuildRenderGraph();
+
+        bool InstancingSupported() const;
+        bool PackedVerticesSupported() const;
+        void BuildBatches();
+
+        // Shared by the passes and WarmUpPipelines so both resolve exactly the same pipelines.
+        // vertexFormat is a Mesh::VertexFormat, packed formats get the packed shader variants and their layout.
+        PipelineDesc GetForwardPipelineDesc(uint64_t& passKey, uint32_t vertexFormat = 0) const;
+        Pipeline* GetForwardPipeline(Material* material, PipelineDesc& pipelineDesc, uint64_t passKey) const;
+        PipelineDesc GetShadowPipelineDesc(uint32_t vertexFormat = 0, bool clear = true, bool staticCache = false) const;
+        PipelineDesc GetDepthPrePassPipelineDesc(uint32_t vertexFormat = 0) const;
+        void WarmUpPipelines(Level* level);
+
         void TextFlush(Renderer2DData& textRenderData, std::vector<TextVertexData*>& textVertexBufferBase, TextVertexData*& textVertexBufferPtr);
     };
 
@@ -34,7 +34,7 @@ namespace NekoEngine
         void Flush(VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
         void Invalidate(VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
         void SetUsage(VkBufferUsageFlags flags) { usageFlags = flags; }
-        void SetMemoryProperyFlags(VkBufferUsageFlags flags) { usageFlags = flags; }
+        void SetMemoryProperyFlags(VkMemoryPropertyFlags flags) { property = flags; }
 
         const VkBuffer& GetHandle() const { return buffer; }
         const VkBuffer& GetBuffer() const { return buffer; }
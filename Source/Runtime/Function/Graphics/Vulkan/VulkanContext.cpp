@@ -74,6 +74,9 @@ namespace NekoEngine
     VulkanContext::~VulkanContext()
     {
 //        VulkanRenderer::Flush
+        VulkanRenderer::ReleaseUniformRing();
+        VulkanRenderer::ReleaseUploadManager();
+        VulkanRenderer::ReleaseTimestampQueries();
         vkDestroyDescriptorPool(GET_DEVICE(), VulkanRenderer::GetDescriptorPool(), nullptr);
         if(m_DebugCallback)
         {
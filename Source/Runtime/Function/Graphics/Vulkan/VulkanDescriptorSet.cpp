@@ -6,6 +6,8 @@
 #include "VulkanUtility.h"
 #include "VulkanDevice.h"
 #include "VulkanContext.h"
+#include "VulkanUniformRing.h"
+#include <algorithm>
 
 namespace NekoEngine
 {
@@ -27,9 +29,10 @@ namespace NekoEngine
 
         for(auto &descriptor: m_Descriptors.descriptors)
         {
-            if(descriptor.type == DescriptorType::UNIFORM_BUFFER)
+            if(descriptor.type == DescriptorType::UNIFORM_BUFFER || descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
             {
-                for(uint32_t frame = 0; frame < m_FramesInFlight; frame++)
+                const bool dynamic = descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC;
+                for(uint32_t frame = 0; frame < m_FramesInFlight && !dynamic; frame++)
                 {
                     // Uniform Buffer per frame in flight
                     auto buffer = SharedPtr<UniformBuffer>(new VulkanUniformBuffer());
@@ -47,10 +50,38 @@ namespace NekoEngine
                 info.HasUpdated[1] = false;
                 info.HasUpdated[2] = false;
                 info.m_Members = descriptor.m_Members;
+                info.Dynamic = dynamic;
+                info.Binding = descriptor.binding;
                 m_UniformBuffersData[descriptor.name] = info;
             }
+            else if(descriptor.type == DescriptorType::STORAGE_BUFFER)
+            {
+                // Never bound empty, a runtime array only buffer reflects a size of 0
+                StorageBufferInfo &info = m_StorageBuffers[descriptor.name];
+                for(uint32_t frame = 0; frame < m_FramesInFlight; frame++)
+                {
+                    info.Buffers.push_back(MakeUnique<VulkanBuffer>(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                                                    std::max(descriptor.size, 256u), nullptr));
+                    info.HasUpdated[frame] = false;
+                }
+            }
+        }
+
+        // Map nodes never move, so slots can point straight at them. Reflection order is the same for
+        // every set made from this layout, which is what lets handles be shared between them.
+        for(auto &descriptor: m_Descriptors.descriptors)
+        {
+            if(descriptor.type == DescriptorType::UNIFORM_BUFFER || descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
+                m_UniformBufferSlots.push_back(&m_UniformBuffersData[descriptor.name]);
+
+            if(descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
+                m_DynamicBuffers.push_back(&m_UniformBuffersData[descriptor.name]);
         }
 
+        std::sort(m_DynamicBuffers.begin(), m_DynamicBuffers.end(), [](const UniformBufferInfo* a, const UniformBufferInfo* b)
+                  { return a->Binding < b->Binding; });
+        m_Dynamic = !m_DynamicBuffers.empty();
+
         for(uint32_t frame = 0; frame < m_FramesInFlight; frame++)
         {
             m_DescriptorDirty[frame] = true;
@@ -123,12 +154,56 @@ namespace NekoEngine
 
     void VulkanDescriptorSet::Update(CommandBuffer* cmdBuffer)
     {
-        m_Dynamic = false;
         int descriptorWritesCount = 0;
         uint32_t currentFrame = gVulkanContext.GetSwapChain()->GetCurrentBufferIndex();
+        VulkanUniformRing* ring = VulkanRenderer::GetUniformRing();
+
+        if(m_Dynamic && m_RingGeneration != ring->GetGeneration())
+        {
+            // The ring buffer was recreated, point every frame's set at the new one
+            m_RingGeneration = ring->GetGeneration();
+            for(uint32_t frame = 0; frame < m_FramesInFlight; frame++)
+                m_DescriptorDirty[frame] = true;
+        }
 
         for(auto &bufferInfo: m_UniformBuffersData)
         {
+            if(bufferInfo.second.Dynamic)
+            {
+                // Last frame's slice gets overwritten, so copy once per frame even when unchanged.
+                // Further updates in the same frame are free unless the data changed.
+                UniformBufferInfo &info = bufferInfo.second;
+                if(info.RingFrame != ring->GetFrameNumber() || info.HasUpdated[currentFrame])
+                {
+                    uint32_t offset = ring->Write(info.LocalStorage.Data, info.LocalStorage.GetSize());
+                    const bool fallback = offset == UINT32_MAX;
+
+                    // The ring grows next frame, until then the constants go to a buffer of this set bound at offset 0
+                    if(fallback)
+                    {
+                        auto &buffer = m_UniformBuffers[currentFrame][bufferInfo.first];
+                        if(!buffer)
+                        {
+                            buffer = SharedPtr<UniformBuffer>(new VulkanUniformBuffer());
+                            buffer->Init(info.LocalStorage.GetSize(), nullptr);
+                        }
+                        buffer->SetData(info.LocalStorage.Data);
+                    }
+
+                    info.DynamicOffset = fallback ? 0 : offset;
+                    if(info.InFallback[currentFrame] != fallback)
+                    {
+                        info.InFallback[currentFrame] = fallback;
+                        m_DescriptorDirty[currentFrame] = true;
+                    }
+
+                    info.RingFrame = ring->GetFrameNumber();
+                    for(uint32_t frame = 0; frame < m_FramesInFlight; frame++)
+                        info.HasUpdated[frame] = false;
+                }
+                continue;
+            }
+
             if(bufferInfo.second.HasUpdated[currentFrame])
             {
                 m_UniformBuffers[currentFrame][bufferInfo.first]->SetData(bufferInfo.second.LocalStorage.Data);
@@ -136,6 +211,25 @@ namespace NekoEngine
             }
         }
 
+        for(auto &bufferInfo: m_StorageBuffers)
+        {
+            StorageBufferInfo &info = bufferInfo.second;
+            if(!info.HasUpdated[currentFrame] || info.LocalStorage.empty())
+                continue;
+
+            const uint32_t size = (uint32_t)info.LocalStorage.size();
+            VulkanBuffer* buffer = info.Buffers[currentFrame].get();
+            if(buffer->GetSize() < size)
+            {
+                // Headroom so a slowly rising count does not reallocate every frame
+                buffer->Resize(size + size / 2);
+                m_DescriptorDirty[currentFrame] = true;
+            }
+
+            buffer->SetData(info.LocalStorage.data(), size);
+            info.HasUpdated[currentFrame] = false;
+        }
+
         if(m_DescriptorDirty[currentFrame] || !m_DescriptorUpdated[currentFrame])
         {
             m_DescriptorDirty[currentFrame] = false;
@@ -213,11 +307,26 @@ namespace NekoEngine
                     descriptorWritesCount++;
                 }
 
-                else if(imageInfo.type == DescriptorType::UNIFORM_BUFFER)
+                else if(imageInfo.type == DescriptorType::UNIFORM_BUFFER || imageInfo.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
                 {
-                    auto* vkUniformBuffer = dynamic_cast<VulkanUniformBuffer*>(m_UniformBuffers[currentFrame][imageInfo.name].get());
-                    m_BufferInfoPool[index].buffer = vkUniformBuffer->GetBuffer();
-                    m_BufferInfoPool[index].offset = imageInfo.offset;
+                    if(imageInfo.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC && m_UniformBuffersData[imageInfo.name].InFallback[currentFrame])
+                    {
+                        auto* vkUniformBuffer = dynamic_cast<VulkanUniformBuffer*>(m_UniformBuffers[currentFrame][imageInfo.name].get());
+                        m_BufferInfoPool[index].buffer = vkUniformBuffer->GetBuffer();
+                        m_BufferInfoPool[index].offset = 0;
+                    }
+                    else if(imageInfo.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
+                    {
+                        // Offset into the ring is given at bind time
+                        m_BufferInfoPool[index].buffer = ring->GetBuffer();
+                        m_BufferInfoPool[index].offset = 0;
+                    }
+                    else
+                    {
+                        auto* vkUniformBuffer = dynamic_cast<VulkanUniformBuffer*>(m_UniformBuffers[currentFrame][imageInfo.name].get());
+                        m_BufferInfoPool[index].buffer = vkUniformBuffer->GetBuffer();
+                        m_BufferInfoPool[index].offset = imageInfo.offset;
+                    }
                     m_BufferInfoPool[index].range = imageInfo.size;
 
                     VkWriteDescriptorSet writeDescriptorSet = {};
@@ -231,9 +340,24 @@ namespace NekoEngine
                     m_WriteDescriptorSetPool[descriptorWritesCount] = writeDescriptorSet;
                     index++;
                     descriptorWritesCount++;
+                }
+                else if(imageInfo.type == DescriptorType::STORAGE_BUFFER)
+                {
+                    m_BufferInfoPool[index].buffer = m_StorageBuffers[imageInfo.name].Buffers[currentFrame]->GetBuffer();
+                    m_BufferInfoPool[index].offset = 0;
+                    m_BufferInfoPool[index].range = VK_WHOLE_SIZE;
+
+                    VkWriteDescriptorSet writeDescriptorSet = {};
+                    writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                    writeDescriptorSet.dstSet = m_DescriptorSet[currentFrame];
+                    writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                    writeDescriptorSet.dstBinding = imageInfo.binding;
+                    writeDescriptorSet.pBufferInfo = &m_BufferInfoPool[index];
+                    writeDescriptorSet.descriptorCount = 1;
 
-                    if(imageInfo.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
-                        m_Dynamic = true;
+                    m_WriteDescriptorSetPool[descriptorWritesCount] = writeDescriptorSet;
+                    index++;
+                    descriptorWritesCount++;
                 }
             }
 
@@ -243,6 +367,14 @@ namespace NekoEngine
         }
     }
 
+    uint32_t VulkanDescriptorSet::GetDynamicOffsets(uint32_t* offsets) const
+    {
+        for(uint32_t i = 0; i < (uint32_t)m_DynamicBuffers.size(); i++)
+            offsets[i] = m_DynamicBuffers[i]->DynamicOffset;
+
+        return (uint32_t)m_DynamicBuffers.size();
+    }
+
     void VulkanDescriptorSet::TransitionImages(CommandBuffer* commandBuffer)
     {
         for(auto &imageInfo: m_Descriptors.descriptors)
@@ -333,45 +465,76 @@ namespace NekoEngine
         return nullptr;
     }
 
-    void VulkanDescriptorSet::SetUniform(const std::string &bufferName, const std::string &uniformName, void* data)
+    UniformHandle VulkanDescriptorSet::GetUniformHandle(const std::string &bufferName, const std::string &uniformName)
     {
+        UniformHandle handle;
+
         auto itr = m_UniformBuffersData.find(bufferName);
-        if(itr != m_UniformBuffersData.end())
+        if(itr == m_UniformBuffersData.end())
+            return handle;
+
+        uint32_t slot = 0;
+        while(slot < (uint32_t)m_UniformBufferSlots.size() && m_UniformBufferSlots[slot] != &itr->second)
+            slot++;
+
+        if(uniformName.empty())
         {
-            for(auto &member: itr->second.m_Members)
-            {
-                if(member.name == uniformName)
-                {
-                    itr->second.LocalStorage.Write(data, member.size, member.offset);
+            handle.buffer = slot;
+            handle.size   = (uint32_t)itr->second.LocalStorage.GetSize();
+            return handle;
+        }
 
-                    itr->second.HasUpdated[0] = true;
-                    itr->second.HasUpdated[1] = true;
-                    itr->second.HasUpdated[2] = true;
-                    return;
-                }
+        for(auto &member: itr->second.m_Members)
+        {
+            if(member.name == uniformName)
+            {
+                handle.buffer = slot;
+                handle.offset = member.offset;
+                handle.size   = member.size;
+                break;
             }
         }
 
+        return handle;
+    }
+
+    void VulkanDescriptorSet::SetUniform(const UniformHandle &handle, const void* data)
+    {
+        SetUniform(handle, data, handle.size);
+    }
+
+    void VulkanDescriptorSet::SetUniform(const UniformHandle &handle, const void* data, uint32_t size)
+    {
+        if(!handle.IsValid() || handle.buffer >= m_UniformBufferSlots.size())
+            return;
+
+        UniformBufferInfo* info = m_UniformBufferSlots[handle.buffer];
+        info->LocalStorage.Write((void*)data, size, handle.offset);
+        info->HasUpdated[0] = true;
+        info->HasUpdated[1] = true;
+        info->HasUpdated[2] = true;
+    }
+
+    void VulkanDescriptorSet::SetUniform(const std::string &bufferName, const std::string &uniformName, void* data)
+    {
+        UniformHandle handle = GetUniformHandle(bufferName, uniformName);
+        if(handle.IsValid())
+        {
+            SetUniform(handle, data);
+            return;
+        }
+
         LOG_FORMAT("Uniform not found %s.%s", bufferName.c_str(), uniformName.c_str());
     }
 
     void VulkanDescriptorSet::SetUniform(const std::string &bufferName, const std::string &uniformName, void* data,
                                          uint32_t size)
     {
-        std::map<std::string, UniformBufferInfo>::iterator itr = m_UniformBuffersData.find(bufferName);
-        if(itr != m_UniformBuffersData.end())
+        UniformHandle handle = GetUniformHandle(bufferName, uniformName);
+        if(handle.IsValid())
         {
-            for(auto &member: itr->second.m_Members)
-            {
-                if(member.name == uniformName)
-                {
-                    itr->second.LocalStorage.Write(data, size, member.offset);
-                    itr->second.HasUpdated[0] = true;
-                    itr->second.HasUpdated[1] = true;
-                    itr->second.HasUpdated[2] = true;
-                    return;
-                }
-            }
+            SetUniform(handle, data, size);
+            return;
         }
 
         LOG_FORMAT("Uniform not found %s.%s", bufferName.c_str(), uniformName.c_str());
@@ -379,14 +542,10 @@ namespace NekoEngine
 
     void VulkanDescriptorSet::SetUniformBufferData(const std::string &bufferName, void* data)
     {
-
-        auto itr = m_UniformBuffersData.find(bufferName);
-        if(itr != m_UniformBuffersData.end())
+        UniformHandle handle = GetUniformHandle(bufferName);
+        if(handle.IsValid())
         {
-            itr->second.LocalStorage.Write(data, itr->second.LocalStorage.GetSize(), 0);
-            itr->second.HasUpdated[0] = true;
-            itr->second.HasUpdated[1] = true;
-            itr->second.HasUpdated[2] = true;
+            SetUniform(handle, data);
             return;
         }
 
@@ -406,6 +565,21 @@ namespace NekoEngine
         }
     }
 
+    void VulkanDescriptorSet::SetStorageBufferData(const std::string &bufferName, const void* data, uint32_t size)
+    {
+        auto itr = m_StorageBuffers.find(bufferName);
+        if(itr == m_StorageBuffers.end())
+        {
+            LOG_FORMAT("Storage buffer not found %s", bufferName.c_str());
+            return;
+        }
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        itr->second.LocalStorage.assign(bytes, bytes + size);
+        for(uint32_t frame = 0; frame < m_FramesInFlight; frame++)
+            itr->second.HasUpdated[frame] = true;
+    }
+
     VkDescriptorSet VulkanDescriptorSet::GetDescriptorSet()
     {
         uint32_t currentFrame = gVulkanContext.GetSwapChain()->GetCurrentBufferIndex();
@@ -1,6 +1,7 @@
 #pragma once
 #include "RHI/DescriptorSet.h"
 #include "Buffer.h"
+#include "VulkanBuffer.h"
 #include "Vk.h"
 
 #define MAX_BUFFER_INFOS 32
@@ -16,6 +17,24 @@ namespace NekoEngine
 
         // Per frame in flight
         bool HasUpdated[10];
+
+        // Dynamic buffers live in the uniform ring, rewritten the first time they are updated each frame
+        bool Dynamic           = false;
+        uint32_t Binding       = 0;
+        uint32_t DynamicOffset = 0;
+        uint64_t RingFrame     = UINT64_MAX;
+
+        // Per frame in flight, set while the ring was full and the frame's descriptor points at its own buffer
+        bool InFallback[10] = {};
+    };
+
+    struct StorageBufferInfo
+    {
+        ArrayList<uint8_t> LocalStorage;
+        ArrayList<UniquePtr<VulkanBuffer>> Buffers; // Per frame in flight, only ever grown
+
+        // Per frame in flight
+        bool HasUpdated[10];
     };
 
     class VulkanDescriptorSet : public DescriptorSet
@@ -36,6 +55,10 @@ namespace NekoEngine
         std::map<uint32_t, std::map<std::string, SharedPtr<UniformBuffer>>> m_UniformBuffers;
 
         std::map<std::string, UniformBufferInfo> m_UniformBuffersData;
+        ArrayList<UniformBufferInfo*> m_UniformBufferSlots; // UniformHandle::buffer indexes this, in reflection order
+        ArrayList<UniformBufferInfo*> m_DynamicBuffers;     // Sorted by binding, the order dynamic offsets are bound in
+        std::map<std::string, StorageBufferInfo> m_StorageBuffers;
+        uint32_t m_RingGeneration = 0;
         bool m_DescriptorDirty[3];
         bool m_DescriptorUpdated[3];
 
@@ -51,15 +74,20 @@ namespace NekoEngine
         void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data) override;
         void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data, uint32_t size) override;
         void SetUniformBufferData(const std::string& bufferName, void* data) override;
+        UniformHandle GetUniformHandle(const std::string& bufferName, const std::string& uniformName = "") override;
+        void SetUniform(const UniformHandle& handle, const void* data) override;
+        void SetUniform(const UniformHandle& handle, const void* data, uint32_t size) override;
         void TransitionImages(CommandBuffer* commandBuffer) override;
 
         UniformBuffer* GetUnifromBuffer(const std::string& name) override;
         bool GetIsDynamic() const { return m_Dynamic; }
+        uint32_t GetDynamicOffsets(uint32_t* offsets) const;
 
         void SetDynamicOffset(uint32_t offset) override { m_DynamicOffset = offset; }
         uint32_t GetDynamicOffset() const override { return m_DynamicOffset; }
         bool GetHasUpdated(uint32_t frame) { return m_DescriptorUpdated[frame]; }
         void SetUniformDynamic(const std::string& bufferName, uint32_t size) override;
+        void SetStorageBufferData(const std::string& bufferName, const void* data, uint32_t size) override;
     protected:
         void UpdateInternal(std::vector<Descriptor>* imageInfos);
     };
@@ -5,6 +5,8 @@
 #include "VulkanCommandPool.h"
 #include "RHI/Renderer.h"
 #include "StringUtility.h"
+#include "File/FileSystem.h"
+#include <filesystem>
 
 namespace NekoEngine
 {
@@ -108,6 +110,9 @@ namespace NekoEngine
         caps.MaxTextureUnits              = properties.limits.maxDescriptorSetSamplers;
         caps.UniformBufferOffsetAlignment = int(properties.limits.minUniformBufferOffsetAlignment);
         caps.SupportCompute               = false; // true; //Need to sort descriptor set management first
+        caps.SupportTextureCopy           = true;
+        caps.SupportTimestamps            = properties.limits.timestampComputeAndGraphics
+                                            && queueFamilyProperties[queueFamilyIndices.graphicsFamily].timestampValidBits > 0;
 
         uint32_t extCount = 0;
         vkEnumerateDeviceExtensionProperties(handle, nullptr, &extCount, nullptr);
@@ -191,6 +196,13 @@ namespace NekoEngine
 
         }
 
+        // Cooked KTX2 textures are block compressed
+        if(supportedFeatures.textureCompressionBC)
+        {
+            enabledFeatures.textureCompressionBC = VK_TRUE;
+            Renderer::capabilities.TextureCompressionBC = true;
+        }
+
 //        unsigned int glfwExtensionCount = 0;
 //        const char** glfwExtensions;
 //
@@ -241,6 +253,7 @@ namespace NekoEngine
         vkGetDeviceQueue(handle, physicalDevice->queueFamilyIndices.graphicsFamily, 0, &graphicsQueue);
         vkGetDeviceQueue(handle, physicalDevice->queueFamilyIndices.computeFamily, 0, &computeQueue);
         vkGetDeviceQueue(handle, physicalDevice->queueFamilyIndices.transferFamily, 0, &presentQueue);
+        vkGetDeviceQueue(handle, physicalDevice->queueFamilyIndices.transferFamily, 0, &transferQueue);
 
         VmaAllocatorCreateInfo allocatorInfo = {};
         allocatorInfo.physicalDevice = physicalDevice->GetHandle();
@@ -282,20 +295,119 @@ namespace NekoEngine
         return VK_SUCCESS;
     }
 
+    namespace
+    {
+        // Written in front of the driver's blob. Some drivers crash on data from another GPU or driver
+        // instead of rejecting it, so a mismatch throws the file away before Vulkan sees it.
+        struct PipelineCacheFileHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t vendorID;
+            uint32_t deviceID;
+            uint32_t driverVersion;
+            uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+            uint32_t reserved; // Keeps the layout free of padding so headers compare with memcmp
+            uint64_t dataSize;
+        };
+
+        constexpr uint32_t PipelineCacheMagic   = 0x43504b4e; // NKPC
+        constexpr uint32_t PipelineCacheVersion = 1;
+
+        String GetPipelineCachePath()
+        {
+            return String(RENDER_CACHE_FOLDER) + "PipelineCache.bin";
+        }
+
+        PipelineCacheFileHeader MakePipelineCacheHeader(const VkPhysicalDeviceProperties& properties, uint64_t dataSize)
+        {
+            PipelineCacheFileHeader header = {};
+            header.magic         = PipelineCacheMagic;
+            header.version       = PipelineCacheVersion;
+            header.vendorID      = properties.vendorID;
+            header.deviceID      = properties.deviceID;
+            header.driverVersion = properties.driverVersion;
+            header.dataSize      = dataSize;
+            memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+            return header;
+        }
+    }
+
     void VulkanDevice::CreatePipelineCache()
     {
         VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
         pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-        if(vkCreatePipelineCache(handle, &pipelineCacheCreateInfo, nullptr, &pipelineCache) != VK_SUCCESS)
+
+        const String path = GetPipelineCachePath();
+        uint8_t* fileData = nullptr;
+
+        if(FileSystem::FileExists(path))
+        {
+            const int64_t fileSize = FileSystem::GetFileSize(path);
+            fileData = fileSize > (int64_t)sizeof(PipelineCacheFileHeader) ? FileSystem::ReadFile(path) : nullptr;
+
+            if(fileData)
+            {
+                PipelineCacheFileHeader header;
+                memcpy(&header, fileData, sizeof(header));
+
+                const PipelineCacheFileHeader expected = MakePipelineCacheHeader(physicalDevice->GetProperties(), header.dataSize);
+                if(memcmp(&header, &expected, sizeof(header)) == 0 && header.dataSize == uint64_t(fileSize) - sizeof(header))
+                {
+                    pipelineCacheCreateInfo.initialDataSize = size_t(header.dataSize);
+                    pipelineCacheCreateInfo.pInitialData    = fileData + sizeof(header);
+                    LOG_FORMAT("Loaded pipeline cache, %llu bytes", (unsigned long long)header.dataSize);
+                }
+                else
+                {
+                    LOG("Pipeline cache was written by another device or driver, ignoring it");
+                }
+            }
+        }
+
+        VkResult result = vkCreatePipelineCache(handle, &pipelineCacheCreateInfo, nullptr, &pipelineCache);
+
+        // The driver can still refuse the blob, start empty rather than fail
+        if(result != VK_SUCCESS && pipelineCacheCreateInfo.pInitialData)
+        {
+            pipelineCacheCreateInfo.initialDataSize = 0;
+            pipelineCacheCreateInfo.pInitialData    = nullptr;
+            result = vkCreatePipelineCache(handle, &pipelineCacheCreateInfo, nullptr, &pipelineCache);
+        }
+
+        delete[] fileData;
+
+        if(result != VK_SUCCESS)
         {
             throw std::runtime_error("failed to create pipeline cache!");
         }
     }
 
+    void VulkanDevice::SavePipelineCache()
+    {
+        size_t dataSize = 0;
+        if(vkGetPipelineCacheData(handle, pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0)
+            return;
+
+        ArrayList<uint8_t> fileData(sizeof(PipelineCacheFileHeader) + dataSize);
+        if(vkGetPipelineCacheData(handle, pipelineCache, &dataSize, fileData.data() + sizeof(PipelineCacheFileHeader)) != VK_SUCCESS)
+            return;
+
+        const PipelineCacheFileHeader header = MakePipelineCacheHeader(physicalDevice->GetProperties(), dataSize);
+        memcpy(fileData.data(), &header, sizeof(header));
+
+        std::error_code error;
+        std::filesystem::create_directories(RENDER_CACHE_FOLDER, error);
+
+        if(!FileSystem::WriteFile(GetPipelineCachePath(), fileData.data(), uint32_t(sizeof(header) + dataSize)))
+            LOG("Failed to write pipeline cache");
+    }
+
     VulkanDevice::~VulkanDevice()
     {
         LOG("Destroying Vulkan device");
         commandPool.reset();
+        SavePipelineCache();
         vkDestroyPipelineCache(handle, pipelineCache, nullptr);
         vmaDestroyAllocator(allocator);
         vkDestroyDevice(handle, nullptr);
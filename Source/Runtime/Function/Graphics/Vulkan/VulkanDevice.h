@@ -47,6 +47,7 @@ namespace NekoEngine
         const ArrayList<VkQueueFamilyProperties>& GetQueueFamilyProperties() const { return queueFamilyProperties; }
 
         inline int32_t GetGraphicsFamilyIndex() const { return queueFamilyIndices.graphicsFamily; }
+        inline int32_t GetTransferFamilyIndex() const { return queueFamilyIndices.transferFamily; }
 
         uint32_t GetGPUCount() const
         {
@@ -64,7 +65,7 @@ namespace NekoEngine
         VkQueue graphicsQueue;
         VkQueue presentQueue;
         VkQueue computeQueue;
-//        VkQueue transferQueue;
+        VkQueue transferQueue;
 
         SharedPtr<VulkanCommandPool> commandPool;
 //        VkCommandPool computeCommandPool;
@@ -85,6 +86,7 @@ namespace NekoEngine
 
         bool Init();
         void CreatePipelineCache();
+        void SavePipelineCache();
         SharedPtr<VulkanCommandPool> GetCommandPool(){ return commandPool; }
         VkQueue GetGraphicsQueue() const { return graphicsQueue; }
 
@@ -96,6 +98,7 @@ namespace NekoEngine
         VmaAllocator& GetAllocator(){ return allocator; }
 
         VkQueue GetComputeQueue() const { return computeQueue; }
+        VkQueue GetTransferQueue() const { return transferQueue; }
         VkQueue GetPresentQueue() const { return presentQueue; }
 
     };
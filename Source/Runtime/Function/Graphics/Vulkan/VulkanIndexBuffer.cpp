@@ -1,6 +1,8 @@
 #include "VulkanIndexBuffer.h"
 #include "VulkanDevice.h"
 #include "VulkanCommandBuffer.h"
+#include "VulkanRenderer.h"
+#include "VulkanUploadManager.h"
 
 namespace NekoEngine
 {
@@ -9,6 +11,7 @@ namespace NekoEngine
         m_Size = count * sizeof(uint16_t);
         m_Count = count;
         m_Usage = bufferUsage;
+        Create(data);
     }
 
     VulkanIndexBuffer::VulkanIndexBuffer(uint32_t* data, uint32_t count, BufferUsage bufferUsage)
@@ -16,6 +19,27 @@ namespace NekoEngine
         m_Size = count * sizeof(uint32_t);
         m_Count = count;
         m_Usage = bufferUsage;
+        Create(data);
+    }
+
+    void VulkanIndexBuffer::Create(const void* data)
+    {
+        if(m_Size == 0)
+            return;
+
+        if(m_Usage == BufferUsage::STATIC)
+        {
+            VulkanBuffer::Init(VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_Size, nullptr);
+
+            if(data)
+                VulkanRenderer::GetUploadManager()->UploadBuffer(buffer, 0, data, m_Size, VK_ACCESS_INDEX_READ_BIT,
+                                                                 VK_PIPELINE_STAGE_VERTEX_INPUT_BIT);
+        }
+        else
+        {
+            VulkanBuffer::Init(VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, m_Size, data);
+        }
     }
 
     VulkanIndexBuffer::~VulkanIndexBuffer()
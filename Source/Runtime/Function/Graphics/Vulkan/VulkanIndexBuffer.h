@@ -19,6 +19,8 @@ namespace NekoEngine
         void SetCount(uint32_t m_index_count) override { m_Count = m_index_count; };
         void ReleasePointer() override;
 
+    private:
+        void Create(const void* data);
     };
 
 } // NekoEngine
@@ -46,25 +46,58 @@ namespace NekoEngine
         {
             CreateFramebuffers();
 
-            uint32_t stride = dynamic_cast<VulkanShader*>(shader.get())->GetVertexInputStride();
+            uint32_t stride         = dynamic_cast<VulkanShader*>(shader.get())->GetVertexInputStride();
+            uint32_t instanceStride = shader->GetInstanceInputStride();
 
-            // Vertex layout
-            VkVertexInputBindingDescription vertexBindingDescription;
+            std::vector<VkVertexInputAttributeDescription> vertexInputAttributeDescription = dynamic_cast<VulkanShader*>(shader.get())->GetVertexInputAttributeDescription();
 
-            if(stride > 0)
+            // Packed vertices, the shader reads the same inputs but the buffer stores them in other formats
+            if(stride > 0 && pipelineDesc.vertexLayout)
             {
-                vertexBindingDescription.binding   = 0;
-                vertexBindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-                vertexBindingDescription.stride    = dynamic_cast<VulkanShader*>(shader.get())->GetVertexInputStride();
+                const auto& elements = pipelineDesc.vertexLayout->GetLayout();
+                stride               = pipelineDesc.vertexLayout->GetStride();
+
+                for(auto& attribute : vertexInputAttributeDescription)
+                {
+                    if(attribute.binding != 0)
+                        continue;
+
+                    if(attribute.location >= elements.size())
+                    {
+                        LOG_FORMAT("[Pipeline] Vertex layout has no element for input location %u", attribute.location);
+                        continue;
+                    }
+
+                    attribute.format = VulkanUtility::FormatToVK(elements[attribute.location].format, false);
+                    attribute.offset = elements[attribute.location].offset;
+                }
             }
 
-            const std::vector<VkVertexInputAttributeDescription>& vertexInputAttributeDescription = dynamic_cast<VulkanShader*>(shader.get())->GetVertexInputAttributeDescription();
+            // Vertex layout, instanced shaders read per instance data from binding 1
+            VkVertexInputBindingDescription vertexBindingDescriptions[2];
+            uint32_t bindingCount = 0;
+
+            if(stride > 0)
+            {
+                vertexBindingDescriptions[0].binding   = 0;
+                vertexBindingDescriptions[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+                vertexBindingDescriptions[0].stride    = stride;
+                bindingCount                           = 1;
+
+                if(instanceStride > 0)
+                {
+                    vertexBindingDescriptions[1].binding   = 1;
+                    vertexBindingDescriptions[1].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+                    vertexBindingDescriptions[1].stride    = instanceStride;
+                    bindingCount                           = 2;
+                }
+            }
 
             VkPipelineVertexInputStateCreateInfo vi {};
             vi.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
             vi.pNext                           = NULL;
-            vi.vertexBindingDescriptionCount   = stride > 0 ? 1 : 0;
-            vi.pVertexBindingDescriptions      = stride > 0 ? &vertexBindingDescription : nullptr;
+            vi.vertexBindingDescriptionCount   = bindingCount;
+            vi.pVertexBindingDescriptions      = stride > 0 ? vertexBindingDescriptions : nullptr;
             vi.vertexAttributeDescriptionCount = stride > 0 ? uint32_t(vertexInputAttributeDescription.size()) : 0;
             vi.pVertexAttributeDescriptions    = stride > 0 ? vertexInputAttributeDescription.data() : nullptr;
 
@@ -271,27 +304,23 @@ namespace NekoEngine
 
 
 
-    void VulkanPipeline::Bind(CommandBuffer* commandBuffer, uint32_t layer)
+    VulkanFramebuffer* VulkanPipeline::GetFramebuffer(uint32_t layer) const
     {
-        VulkanFramebuffer* framebuffer;
+        if(pipelineDesc.isSwapChainTarget)
+            return frameBuffers[gVulkanContext.GetSwapChain()->GetCurrentImageIndex()].get();
 
+        if(pipelineDesc.depthArrayTarget || pipelineDesc.cubeMapTarget)
+            return frameBuffers[layer].get();
+
+        return frameBuffers[0].get();
+    }
+
+    void VulkanPipeline::Bind(CommandBuffer* commandBuffer, uint32_t layer)
+    {
         if(!isCompute)
         {
             TransitionAttachments();
-            if(pipelineDesc.isSwapChainTarget)
-            {
-                framebuffer = frameBuffers[gVulkanContext.GetSwapChain()->GetCurrentImageIndex()].get();
-            }
-            else if(pipelineDesc.depthArrayTarget || pipelineDesc.cubeMapTarget)
-            {
-                framebuffer = frameBuffers[layer].get();
-            }
-            else
-            {
-                framebuffer = frameBuffers[0].get();
-            }
-
-            renderPass->BeginRenderpass(commandBuffer, pipelineDesc.clearColor, framebuffer, SubPassContents::INLINE, GetWidth(), GetHeight());
+            renderPass->BeginRenderpass(commandBuffer, pipelineDesc.clearColor, GetFramebuffer(layer), SubPassContents::INLINE, GetWidth(), GetHeight());
         }
         else
         {
@@ -440,6 +469,29 @@ namespace NekoEngine
         }
     }
 
+    void VulkanPipeline::BeginSecondary(CommandBuffer* primaryCommandBuffer, uint32_t layer)
+    {
+        if(isCompute)
+            return;
+
+        TransitionAttachments();
+        renderPass->BeginRenderpass(primaryCommandBuffer, pipelineDesc.clearColor, GetFramebuffer(layer), SubPassContents::SECONDARY, GetWidth(), GetHeight());
+    }
+
+    void VulkanPipeline::BindSecondary(CommandBuffer* secondaryCommandBuffer, uint32_t layer)
+    {
+        // Dynamic state is not inherited from the primary buffer, so viewport and depth bias are set again
+        secondaryCommandBuffer->BeginRecordingSecondary(renderPass.get(), GetFramebuffer(layer));
+        secondaryCommandBuffer->UpdateViewport(GetWidth(), GetHeight(), pipelineDesc.isSwapChainTarget);
+
+        VkCommandBuffer handle = dynamic_cast<VulkanCommandBuffer*>(secondaryCommandBuffer)->GetHandle();
+        vkCmdBindPipeline(handle, VK_PIPELINE_BIND_POINT_GRAPHICS, this->handle);
+        if(isDepthBiasEnabled)
+        {
+            vkCmdSetDepthBias(handle, depthBiasConstantFactor, 0.0f, depthBiasSlopeFactor);
+        }
+    }
+
     void VulkanPipeline::End(CommandBuffer* commandBuffer)
     {
         if(!isCompute)
@@ -19,13 +19,16 @@ namespace NekoEngine
         bool Init(const PipelineDesc& pipelineDesc);
         void Bind(CommandBuffer* commandBuffer, uint32_t layer) override;
         void End(CommandBuffer* commandBuffer) override;
+        void BeginSecondary(CommandBuffer* primaryCommandBuffer, uint32_t layer) override;
+        void BindSecondary(CommandBuffer* secondaryCommandBuffer, uint32_t layer) override;
         void ClearRenderTargets(CommandBuffer* commandBuffer) override;
         void TransitionAttachments();
 
-        SharedPtr<Shader> GetShader() const override { return nullptr; }
+        SharedPtr<Shader> GetShader() const override { return shader; }
         VkPipelineLayout& GetPipelineLayout() { return layout; }
 
         void CreateFramebuffers();
+        VulkanFramebuffer* GetFramebuffer(uint32_t layer) const;
 
         static void MakeDefault();
     };
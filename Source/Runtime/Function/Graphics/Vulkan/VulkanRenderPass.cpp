@@ -139,7 +139,10 @@ namespace NekoEngine
 
         vkCmdBeginRenderPass(dynamic_cast<VulkanCommandBuffer*>(commandBuffer)->GetHandle(), &info,
                              SubPassContents2Vk(contents));
-        commandBuffer->UpdateViewport(width, height, isSwapChainTarget);
+
+        // A pass recorded in secondary buffers may only execute them, they set their own viewport
+        if(contents == SubPassContents::INLINE)
+            commandBuffer->UpdateViewport(width, height, isSwapChainTarget);
     }
 
     void VulkanRenderPass::EndRenderpass(CommandBuffer* commandBuffer)
@@ -7,6 +7,9 @@
 #include "VulkanDevice.h"
 #include "VulkanInitializer.h"
 #include "VulkanContext.h"
+#include "VulkanUniformRing.h"
+#include "VulkanUploadManager.h"
+#include "VulkanTimestampQueries.h"
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "stb/stb_image_write.h"
@@ -17,6 +20,11 @@ namespace NekoEngine
     std::vector<DeletionQueue> VulkanRenderer::deletionQueue = {};
     VkDescriptorPool VulkanRenderer::descriptorPool = {};
     int VulkanRenderer::currentDeletionQueue = 0;
+    UniquePtr<VulkanUniformRing> VulkanRenderer::uniformRing = nullptr;
+    UniquePtr<VulkanUploadManager> VulkanRenderer::uploadManager = nullptr;
+#ifdef NekoEngine_PROFILE
+    UniquePtr<VulkanTimestampQueries> VulkanRenderer::timestampQueries = nullptr;
+#endif
 
     void VulkanRenderer::Init(bool loadEmbeddedShaders)
     {
@@ -85,11 +93,33 @@ namespace NekoEngine
         deletionQueue[deletionQueueIndex].Flush();
 
         gVulkanContext.GetSwapChain()->Begin();
+        GetUniformRing()->BeginFrame(gVulkanContext.GetSwapChain()->GetCurrentBufferIndex());
+
+#ifdef NekoEngine_PROFILE
+        if(capabilities.SupportTimestamps)
+        {
+            auto swapChain = gVulkanContext.GetSwapChain();
+            if(!timestampQueries)
+                timestampQueries = MakeUnique<VulkanTimestampQueries>((uint32_t)swapChain->GetSwapChainBufferCount());
+
+            timestampQueries->BeginFrame(swapChain->GetCurrentBufferIndex(), (VulkanCommandBuffer*)swapChain->GetCurrentCommandBuffer());
+        }
+#endif
     }
 
     void VulkanRenderer::Present()
     {
         auto swapChain = gVulkanContext.GetSwapChain();
+        GetUniformRing()->Flush();
+
+        // Submitted ahead of the frame so everything it samples has arrived
+        GetUploadManager()->Flush();
+
+#ifdef NekoEngine_PROFILE
+        if(timestampQueries)
+            timestampQueries->EndFrame();
+#endif
+
         swapChain->End();
         swapChain->QueueSubmit();
 
@@ -136,6 +166,122 @@ namespace NekoEngine
         }
     }
 
+    static VkImageLayout ResourceStateToLayout(ResourceState state, bool depth)
+    {
+        switch(state)
+        {
+            case ResourceState::RenderTarget:
+                return VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+            case ResourceState::DepthWrite:
+                return VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+            case ResourceState::DepthRead:
+                return VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+            case ResourceState::ShaderRead:
+                return depth ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            case ResourceState::Storage:
+                return VK_IMAGE_LAYOUT_GENERAL;
+            default:
+                return VK_IMAGE_LAYOUT_UNDEFINED;
+        }
+    }
+
+    uint32_t VulkanRenderer::TransitionTextures(const TextureBarrier* barriers, uint32_t count, CommandBuffer* commandBuffer)
+    {
+        static ArrayList<VulkanUtility::ImageLayoutTransition> transitions;
+        transitions.clear();
+
+        for(uint32_t i = 0; i < count; i++)
+        {
+            Texture* texture = barriers[i].texture;
+            if(!texture || barriers[i].state == ResourceState::Undefined)
+                continue;
+
+            VulkanUtility::ImageLayoutTransition transition;
+            switch(texture->GetType())
+            {
+                case TextureType::COLOUR:
+                {
+                    auto colour = dynamic_cast<VulkanTexture2D*>(texture);
+                    transition.newLayout = ResourceStateToLayout(barriers[i].state, false);
+                    if(colour->GetImageLayout() == transition.newLayout)
+                        continue;
+
+                    transition.image     = colour->GetImage();
+                    transition.format    = colour->GetVkFormat();
+                    transition.oldLayout = colour->GetImageLayout();
+                    transition.mipLevels = colour->GetMipMapLevels();
+                    colour->SetImageLayout(transition.newLayout);
+                    break;
+                }
+                case TextureType::DEPTH:
+                {
+                    auto depth = dynamic_cast<VulkanTextureDepth*>(texture);
+                    transition.newLayout = ResourceStateToLayout(barriers[i].state, true);
+                    if(depth->GetImageLayout() == transition.newLayout)
+                        continue;
+
+                    transition.image     = depth->GetImage();
+                    transition.format    = depth->GetVkFormat();
+                    transition.oldLayout = depth->GetImageLayout();
+                    depth->SetImageLayout(transition.newLayout);
+                    break;
+                }
+                case TextureType::DEPTHARRAY:
+                {
+                    auto depthArray = dynamic_cast<VulkanTextureDepthArray*>(texture);
+                    transition.newLayout = ResourceStateToLayout(barriers[i].state, true);
+                    if(depthArray->GetImageLayout() == transition.newLayout)
+                        continue;
+
+                    transition.image      = depthArray->GetImage();
+                    transition.format     = depthArray->GetVkFormat();
+                    transition.oldLayout  = depthArray->GetImageLayout();
+                    transition.layerCount = depthArray->GetCount();
+                    depthArray->SetImageLayout(transition.newLayout);
+                    break;
+                }
+                default:
+                    continue;
+            }
+
+            transitions.push_back(transition);
+        }
+
+        if(!transitions.empty())
+            VulkanUtility::TransitionImageLayouts(transitions.data(), (uint32_t)transitions.size(), ((VulkanCommandBuffer*) commandBuffer)->GetHandle());
+
+        return (uint32_t)transitions.size();
+    }
+
+    void VulkanRenderer::CopyTextureLayer(Texture* source, Texture* destination, uint32_t layer, CommandBuffer* commandBuffer)
+    {
+        auto src = dynamic_cast<VulkanTextureDepthArray*>(source);
+        auto dst = dynamic_cast<VulkanTextureDepthArray*>(destination);
+        if(!src || !dst)
+        {
+            LOG("[Renderer] CopyTextureLayer only supports depth arrays");
+            return;
+        }
+
+        VkImageLayout srcLayout = src->GetImageLayout();
+        VkImageLayout dstLayout = dst->GetImageLayout();
+        src->TransitionImage(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, (VulkanCommandBuffer*) commandBuffer);
+        dst->TransitionImage(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (VulkanCommandBuffer*) commandBuffer);
+
+        VkImageCopy region = {};
+        region.srcSubresource.aspectMask     = VK_IMAGE_ASPECT_DEPTH_BIT;
+        region.srcSubresource.baseArrayLayer = layer;
+        region.srcSubresource.layerCount     = 1;
+        region.dstSubresource                = region.srcSubresource;
+        region.extent                        = { src->GetWidth(), src->GetHeight(), 1 };
+
+        vkCmdCopyImage(((VulkanCommandBuffer*) commandBuffer)->GetHandle(), src->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                       dst->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+        src->TransitionImage(srcLayout, (VulkanCommandBuffer*) commandBuffer);
+        dst->TransitionImage(dstLayout, (VulkanCommandBuffer*) commandBuffer);
+    }
+
     void VulkanRenderer::ClearSwapChainImage() const
     {
         auto m_SwapChain = gVulkanContext.GetSwapChain();
@@ -162,16 +308,20 @@ namespace NekoEngine
     VulkanRenderer::BindDescriptorSets(Pipeline* pipeline, CommandBuffer* commandBuffer, uint32_t dynamicOffset,
                                        DescriptorSet** descriptorSets, uint32_t descriptorCount)
     {
-        uint32_t numDynamicDescriptorSets = 0;
+        // Local so secondary command buffers can be recorded on several threads at once
+        VkDescriptorSet descriptorSetPool[16];
+        uint32_t dynamicOffsets[16];
+        uint32_t numDynamicOffsets = 0;
         uint32_t numDesciptorSets = 0;
 
         for(uint32_t i = 0; i < descriptorCount; i++)
         {
             if(descriptorSets[i])
             {
+                // Dynamic sets carry their own ring offsets, in set then binding order
                 auto vkDesSet = dynamic_cast<VulkanDescriptorSet*>(descriptorSets[i]);
                 if(vkDesSet->GetIsDynamic())
-                    numDynamicDescriptorSets++;
+                    numDynamicOffsets += vkDesSet->GetDynamicOffsets(dynamicOffsets + numDynamicOffsets);
 
                 descriptorSetPool[numDesciptorSets] = vkDesSet->GetDescriptorSet();
 
@@ -185,7 +335,7 @@ namespace NekoEngine
                                 dynamic_cast<VulkanPipeline*>(pipeline)->IsCompute() ? VK_PIPELINE_BIND_POINT_COMPUTE
                                                                                      : VK_PIPELINE_BIND_POINT_GRAPHICS,
                                 dynamic_cast<VulkanPipeline*>(pipeline)->GetPipelineLayout(), 0, numDesciptorSets,
-                                descriptorSetPool, numDynamicDescriptorSets, &dynamicOffset);
+                                descriptorSetPool, numDynamicOffsets, dynamicOffsets);
 
     }
 
@@ -211,6 +361,12 @@ namespace NekoEngine
         vkCmdDrawIndexed(dynamic_cast<VulkanCommandBuffer*>(commandBuffer)->GetHandle(), count, 1, start, 0, 0);
     }
 
+    void VulkanRenderer::DrawIndexedInstanced(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t instanceCount,
+                                              uint32_t start, uint32_t firstInstance)
+    {
+        vkCmdDrawIndexed(dynamic_cast<VulkanCommandBuffer*>(commandBuffer)->GetHandle(), count, instanceCount, start, 0, firstInstance);
+    }
+
     void VulkanRenderer::Dispatch(CommandBuffer* commandBuffer, uint32_t workGroupSizeX, uint32_t workGroupSizeY,
                                   uint32_t workGroupSizeZ)
     {
@@ -460,4 +616,54 @@ file << "P6\n"
         }
         return deletionQueue[index];
     }
+
+    VulkanUniformRing* VulkanRenderer::GetUniformRing()
+    {
+        // Created on first use, the swap chain decides how many frames are in flight
+        if(!uniformRing)
+            uniformRing = MakeUnique<VulkanUniformRing>(gVulkanContext.GetSwapChain()->GetSwapChainBufferCount(), UNIFORM_RING_FRAME_SIZE);
+
+        return uniformRing.get();
+    }
+
+    void VulkanRenderer::ReleaseUniformRing()
+    {
+        uniformRing.reset();
+    }
+
+    VulkanUploadManager* VulkanRenderer::GetUploadManager()
+    {
+        if(!uploadManager)
+            uploadManager = MakeUnique<VulkanUploadManager>(UPLOAD_RING_SIZE);
+
+        return uploadManager.get();
+    }
+
+    void VulkanRenderer::ReleaseUploadManager()
+    {
+        uploadManager.reset();
+    }
+
+    void VulkanRenderer::BeginGPUScope(const char* name, CommandBuffer* commandBuffer)
+    {
+#ifdef NekoEngine_PROFILE
+        if(timestampQueries)
+            timestampQueries->BeginScope(name, (VulkanCommandBuffer*)commandBuffer);
+#endif
+    }
+
+    void VulkanRenderer::EndGPUScope(CommandBuffer* commandBuffer)
+    {
+#ifdef NekoEngine_PROFILE
+        if(timestampQueries)
+            timestampQueries->EndScope((VulkanCommandBuffer*)commandBuffer);
+#endif
+    }
+
+    void VulkanRenderer::ReleaseTimestampQueries()
+    {
+#ifdef NekoEngine_PROFILE
+        timestampQueries.reset();
+#endif
+    }
 } // NekoEngine
\ No newline at end of file
@@ -5,18 +5,26 @@
 #include "Vk.h"
 namespace NekoEngine
 {
+    class VulkanUniformRing;
+    class VulkanUploadManager;
+    class VulkanTimestampQueries;
+
     class VulkanRenderer : public Renderer
     {
     private:
         uint32_t currentSemaphoreIndex = 0;
         String rendererTitle;
         uint32_t descriptorCapacity = 0;
-        VkDescriptorSet descriptorSetPool[16] = {};
 
         static int deletionQueueIndex;
         static VkDescriptorPool descriptorPool;
         static ArrayList<DeletionQueue> deletionQueue;
         static int currentDeletionQueue;
+        static UniquePtr<VulkanUniformRing> uniformRing;
+        static UniquePtr<VulkanUploadManager> uploadManager;
+#ifdef NekoEngine_PROFILE
+        static UniquePtr<VulkanTimestampQueries> timestampQueries;
+#endif
 
     public:
         VulkanRenderer() = default;
@@ -26,10 +34,15 @@ namespace NekoEngine
         void Present() override;
         void ClearRenderTarget(Texture* texture, CommandBuffer* commandBuffer, Color clearColour) override;
         void ClearSwapChainImage() const;
+        uint32_t TransitionTextures(const TextureBarrier* barriers, uint32_t count, CommandBuffer* commandBuffer) override;
+        void CopyTextureLayer(Texture* source, Texture* destination, uint32_t layer, CommandBuffer* commandBuffer) override;
+        void BeginGPUScope(const char* name, CommandBuffer* commandBuffer) override;
+        void EndGPUScope(CommandBuffer* commandBuffer) override;
         void OnResize(uint32_t height, uint32_t width);
         void BindDescriptorSets(Pipeline* pipeline, CommandBuffer* commandBuffer, uint32_t dynamicOffset, DescriptorSet** descriptorSets, uint32_t descriptorCount) override;
         void Draw(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType = DataType::UNSIGNED_INT, void* indices = nullptr) override;
         void DrawIndexed(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start = 0) override;
+        void DrawIndexedInstanced(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t instanceCount, uint32_t start = 0, uint32_t firstInstance = 0) override;
         void Dispatch(CommandBuffer* commandBuffer, uint32_t workGroupSizeX, uint32_t workGroupSizeY, uint32_t workGroupSizeZ) override;
         void SaveScreenshot(const std::string& path, Texture* texture = nullptr) override;
 
@@ -57,6 +70,14 @@ namespace NekoEngine
 
         static DeletionQueue& GetDeletionQueue(int index);
 
+        static VulkanUniformRing* GetUniformRing();
+        static void ReleaseUniformRing();
+
+        static VulkanUploadManager* GetUploadManager();
+        static void ReleaseUploadManager();
+
+        static void ReleaseTimestampQueries();
+
     };
 
 } // NekoEngine
@@ -4,12 +4,18 @@
 #include "File/VirtualFileSystem.h"
 #include "File/FileSystem.h"
 #include "Hash.h"
+#include "Math/Maths.h"
 #include "VulkanPipeline.h"
 #include "VulkanDevice.h"
 #include "VulkanCommandBuffer.h"
 #include "VulkanContext.h"
 #include "VulkanInitializer.h"
 #include "SPIRV-Cross/spirv_cross.hpp"
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/vector.hpp>
+#include <cereal/types/string.hpp>
+#include <filesystem>
+#include <sstream>
 
 namespace NekoEngine
 {
@@ -389,6 +395,13 @@ namespace NekoEngine
             LOG_FORMAT("Failed to load shader %s", name.c_str());
         }
 
+        // A missing stage (e.g. SPIR-V not compiled yet) leaves the shader unusable
+        if(currentShaderStage != stageCount)
+        {
+            LOG_FORMAT("Shader %s is missing %u stage(s)", name.c_str(), stageCount - currentShaderStage);
+            isCompiled = false;
+        }
+
         CreatePipelineLayout();
         return true;
     }
@@ -402,6 +415,12 @@ namespace NekoEngine
         }
     }
 
+    void VulkanShader::BindPushConstant(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t index, const void* data)
+    {
+        auto& pc = pushConstants[index];
+        vkCmdPushConstants(dynamic_cast<VulkanCommandBuffer*>(commandBuffer)->GetHandle(), dynamic_cast<VulkanPipeline*>(pipeline)->GetPipelineLayout(), VulkanUtility::ShaderTypeToVK(pc.shaderStage), 0, pc.size, data);
+    }
+
     void VulkanShader::CreatePipelineLayout()
     {
         ArrayList<ArrayList<DescriptorLayoutInfo>> layouts;
@@ -569,167 +588,358 @@ namespace NekoEngine
         return 0;
     }
 
-    void VulkanShader::LoadFromData(const uint32_t* source, uint32_t fileSize, ShaderType shaderType, int currentShaderStage)
+    // Everything LoadFromData needs from SPIRV-Cross for one stage, cached on disk by SPIR-V hash
+    struct ShaderStageReflection
     {
-        VkShaderModuleCreateInfo shaderCreateInfo = {};
-        shaderCreateInfo.sType                    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        shaderCreateInfo.codeSize                 = fileSize;
-        shaderCreateInfo.pCode                    = source;
-        shaderCreateInfo.pNext                    = VK_NULL_HANDLE;
+        struct Member
+        {
+            uint32_t size   = 0;
+            uint32_t offset = 0;
+            uint32_t type   = 0;
+            String name;
+
+            template <typename Archive>
+            void serialize(Archive& archive) { archive(size, offset, type, name); }
+        };
+
+        struct Resource
+        {
+            uint32_t set     = 0;
+            uint32_t binding = 0;
+            uint32_t count   = 1;
+            uint32_t size    = 0;
+            String name;
+            ArrayList<Member> members;
+
+            template <typename Archive>
+            void serialize(Archive& archive) { archive(set, binding, count, size, name, members); }
+        };
+
+        struct Attribute
+        {
+            uint32_t binding  = 0;
+            uint32_t location = 0;
+            uint32_t offset   = 0;
+            uint32_t format   = 0;
+
+            template <typename Archive>
+            void serialize(Archive& archive) { archive(binding, location, offset, format); }
+        };
+
+        ArrayList<Attribute> attributes;
+        uint32_t vertexStride   = 0;
+        uint32_t instanceStride = 0;
+
+        ArrayList<Resource> uniformBuffers;
+        ArrayList<Resource> pushConstants;
+        ArrayList<Resource> sampledImages;
+        ArrayList<Resource> storageImages;
+        ArrayList<Resource> storageBuffers;
+
+        template <typename Archive>
+        void serialize(Archive& archive)
+        {
+            archive(attributes, vertexStride, instanceStride, uniformBuffers, pushConstants, sampledImages, storageImages,
+                    storageBuffers);
+        }
+    };
+
+    namespace
+    {
+        // Bump when ShaderStageReflection or what is reflected changes
+        constexpr uint32_t ReflectionCacheVersion = 4;
+
+        String GetReflectionCachePath(const uint32_t* source, uint32_t size)
+        {
+            uint64_t hash = std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(source), size));
+            HashCombine(hash, ReflectionCacheVersion);
+
+            char name[32];
+            snprintf(name, sizeof(name), "%016llx.refl", (unsigned long long)hash);
+            return String(RENDER_CACHE_FOLDER) + "Shaders/" + name;
+        }
+
+        bool LoadReflectionCache(const String& path, uint32_t spirvSize, ShaderStageReflection& reflection)
+        {
+            ArrayList<uint8_t> data;
+            if(!FileSystem::FileExists(path) || !FileSystem::ReadFile(path, data))
+                return false;
+
+            std::istringstream stream(String(data.begin(), data.end()));
+
+            try
+            {
+                cereal::BinaryInputArchive archive(stream);
+                uint32_t version = 0, size = 0;
+                archive(version, size);
+
+                // The size guards against hash collisions between different SPIR-V
+                if(version != ReflectionCacheVersion || size != spirvSize)
+                    return false;
+
+                archive(reflection);
+            }
+            catch(...)
+            {
+                LOG_FORMAT("Ignoring corrupt shader reflection cache %s", path.c_str());
+                reflection = ShaderStageReflection();
+                return false;
+            }
+
+            return true;
+        }
 
+        void SaveReflectionCache(const String& path, uint32_t spirvSize, const ShaderStageReflection& reflection)
+        {
+            std::ostringstream stream;
+            {
+                cereal::BinaryOutputArchive archive(stream);
+                archive(ReflectionCacheVersion, spirvSize, reflection);
+            }
+
+            std::error_code error;
+            std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+
+            const String blob = stream.str();
+            FileSystem::WriteFile(path, (uint8_t*)blob.data(), (uint32_t)blob.size());
+        }
+    }
+
+    void VulkanShader::Reflect(const uint32_t* source, uint32_t fileSize, ShaderType shaderType, ShaderStageReflection& reflection)
+    {
         std::vector<uint32_t> spv(source, source + fileSize / sizeof(uint32_t));
 
         spirv_cross::Compiler comp(std::move(spv));
         // The SPIR-V is now parsed, and we can perform reflection on it.
         spirv_cross::ShaderResources resources = comp.get_shader_resources();
 
+        auto reflectMembers = [&](const spirv_cross::Resource& u, ShaderStageReflection::Resource& resource)
+        {
+            auto& bufferType = comp.get_type(u.base_type_id);
+            int memberCount  = (int)bufferType.member_types.size();
+
+            for(int i = 0; i < memberCount; i++)
+            {
+                auto& member  = resource.members.emplace_back();
+                member.name   = comp.get_member_name(bufferType.self, i);
+                member.size   = (uint32_t)comp.get_declared_struct_member_size(bufferType, i);
+                member.offset = comp.type_struct_member_offset(bufferType, i);
+                member.type   = (uint32_t)SPIRVTypeToDataType(comp.get_type(bufferType.member_types[i]));
+            }
+        };
+
         if(shaderType == ShaderType::VERTEX)
         {
             // Vertex Layout
-            vertexInputStride = 0;
-
             for(const spirv_cross::Resource& resource : resources.stage_inputs)
             {
                 const spirv_cross::SPIRType& InputType = comp.get_type(resource.type_id);
 
-                VkVertexInputAttributeDescription Description = {};
-                Description.binding                           = comp.get_decoration(resource.id, spv::DecorationBinding);
-                Description.location                          = comp.get_decoration(resource.id, spv::DecorationLocation);
-                Description.offset                            = vertexInputStride;
-                Description.format                            = GetVulkanFormat(InputType);
-                vertexInputAttributeDescriptions.push_back(Description);
+                // Inputs named inInstance* step per instance from binding 1, matrices take one location per column
+                bool perInstance  = resource.name.rfind("inInstance", 0) == 0;
+                uint32_t& stride  = perInstance ? reflection.instanceStride : reflection.vertexStride;
+                uint32_t location = comp.get_decoration(resource.id, spv::DecorationLocation);
+
+                for(uint32_t column = 0; column < Maths::Max(1u, InputType.columns); column++)
+                {
+                    auto& attribute    = reflection.attributes.emplace_back();
+                    attribute.binding  = perInstance ? 1 : comp.get_decoration(resource.id, spv::DecorationBinding);
+                    attribute.location = location + column;
+                    attribute.offset   = stride;
+                    attribute.format   = (uint32_t)GetVulkanFormat(InputType);
 
-                vertexInputStride += GetStrideFromVulkanFormat(Description.format);
+                    stride += GetStrideFromVulkanFormat((VkFormat)attribute.format);
+                }
             }
         }
 
-        // Descriptor Layout
         for(auto& u : resources.uniform_buffers)
         {
-            uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
-            uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
-            auto& type       = comp.get_type(u.type_id);
+            auto& type     = comp.get_type(u.type_id);
+            auto& resource = reflection.uniformBuffers.emplace_back();
+            resource.set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+            resource.binding = comp.get_decoration(u.id, spv::DecorationBinding);
+            resource.count   = type.array.size() ? uint32_t(type.array[0]) : 1;
+            resource.size    = (uint32_t)comp.get_declared_struct_size(comp.get_type(u.base_type_id));
+            resource.name    = u.name;
+            reflectMembers(u, resource);
+        }
 
-            LOG_FORMAT("Found UBO %s at set = %d, binding = %d", u.name.c_str(), set, binding);
-            descriptorLayoutInfos.push_back({ DescriptorType::UNIFORM_BUFFER, shaderType, binding, set, type.array.size() ? uint32_t(type.array[0]) : 1 });
+        for(auto& u : resources.push_constant_buffers)
+        {
+            // Only the ranges the shader actually reads are pushed
+            uint32_t size = 0;
+            for(auto& range : comp.get_active_buffer_ranges(u.id))
+                size += uint32_t(range.range);
 
-            auto& bufferType      = comp.get_type(u.base_type_id);
-            auto bufferSize       = comp.get_declared_struct_size(bufferType);
-            int memberCount       = (int)bufferType.member_types.size();
-            auto& descriptorInfo  = descriptorSetInfos[set];
-            auto& descriptor      = descriptorInfo.descriptors.emplace_back();
-            descriptor.binding    = binding;
-            descriptor.size       = (uint32_t)bufferSize;
-            descriptor.name       = u.name;
-            descriptor.offset     = 0;
-            descriptor.shaderType = shaderType;
-            descriptor.type       = DescriptorType::UNIFORM_BUFFER;
-            descriptor.buffer     = nullptr;
+            auto& resource = reflection.pushConstants.emplace_back();
+            resource.size  = size;
+            resource.name  = u.name;
+            reflectMembers(u, resource);
+        }
 
-            for(int i = 0; i < memberCount; i++)
-            {
-                auto type              = comp.get_type(bufferType.member_types[i]);
-                const auto& memberName = comp.get_member_name(bufferType.self, i);
-                auto size              = comp.get_declared_struct_member_size(bufferType, i);
-                auto offset            = comp.type_struct_member_offset(bufferType, i);
+        for(auto& u : resources.sampled_images)
+        {
+            auto& type     = comp.get_type(u.type_id);
+            auto& resource = reflection.sampledImages.emplace_back();
+            resource.set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+            resource.binding = comp.get_decoration(u.id, spv::DecorationBinding);
+            resource.count   = type.array.size() ? uint32_t(type.array[0]) : 1;
+            resource.name    = u.name;
+        }
 
-                std::string uniformName = u.name + "." + memberName;
+        for(auto& u : resources.storage_images)
+        {
+            auto& type     = comp.get_type(u.type_id);
+            auto& resource = reflection.storageImages.emplace_back();
+            resource.set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+            resource.binding = comp.get_decoration(u.id, spv::DecorationBinding);
+            resource.count   = type.array.size() ? uint32_t(type.array[0]) : 1;
+            resource.name    = u.name;
+        }
+
+        for(auto& u : resources.storage_buffers)
+        {
+            // Size is the fixed part only, a trailing runtime array adds nothing
+            auto& type     = comp.get_type(u.type_id);
+            auto& resource = reflection.storageBuffers.emplace_back();
+            resource.set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
+            resource.binding = comp.get_decoration(u.id, spv::DecorationBinding);
+            resource.count   = type.array.size() ? uint32_t(type.array[0]) : 1;
+            resource.size    = (uint32_t)comp.get_declared_struct_size(comp.get_type(u.base_type_id));
+            resource.name    = u.name;
+        }
+    }
 
-                auto& member  = descriptor.m_Members.emplace_back();
-                member.name   = memberName;
-                member.offset = offset;
-                member.size   = (uint32_t)size;
+    void VulkanShader::ApplyReflection(const ShaderStageReflection& reflection, ShaderType shaderType)
+    {
+        if(shaderType == ShaderType::VERTEX)
+        {
+            vertexInputStride   = reflection.vertexStride;
+            instanceInputStride = reflection.instanceStride;
 
-//                (LOG_FORMAT("{0} - Size {1}, offset {2}", uniformName, size, offset));
+            for(auto& attribute : reflection.attributes)
+            {
+                VkVertexInputAttributeDescription Description = {};
+                Description.binding                           = attribute.binding;
+                Description.location                          = attribute.location;
+                Description.offset                            = attribute.offset;
+                Description.format                            = (VkFormat)attribute.format;
+                vertexInputAttributeDescriptions.push_back(Description);
             }
         }
 
-        for(auto& u : resources.push_constant_buffers)
+        // Descriptor Layout
+        for(auto& u : reflection.uniformBuffers)
         {
-            uint32_t set     = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
-            uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
+            LOG_FORMAT("Found UBO %s at set = %d, binding = %d", u.name.c_str(), u.set, u.binding);
 
-            uint32_t binding3 = comp.get_decoration(u.id, spv::DecorationOffset);
+            // Material constants come from the per frame uniform ring, every shader has to agree on this
+            // because material sets are bound with the pipelines of several passes
+            const DescriptorType uniformType = u.set == DESCRIPTOR_SET_MATERIAL ? DescriptorType::UNIFORM_BUFFER_DYNAMIC
+                                                                                : DescriptorType::UNIFORM_BUFFER;
+            descriptorLayoutInfos.push_back({ uniformType, shaderType, u.binding, u.set, u.count });
 
-            auto& type = comp.get_type(u.type_id);
-
-            auto ranges = comp.get_active_buffer_ranges(u.id);
+            auto& descriptorInfo  = descriptorSetInfos[u.set];
+            auto& descriptor      = descriptorInfo.descriptors.emplace_back();
+            descriptor.binding    = u.binding;
+            descriptor.size       = u.size;
+            descriptor.name       = u.name;
+            descriptor.offset     = 0;
+            descriptor.shaderType = shaderType;
+            descriptor.type       = uniformType;
+            descriptor.buffer     = nullptr;
 
-            uint32_t size = 0;
-            for(auto& range : ranges)
+            for(auto& m : u.members)
             {
-//                LOG_FORMAT("Accessing Member {0} offset {1}, size {2}", range.index, range.offset, range.range);
-                size += uint32_t(range.range);
+                auto& member    = descriptor.m_Members.emplace_back();
+                member.name     = m.name;
+                member.fullName = u.name + "." + m.name;
+                member.offset   = m.offset;
+                member.size     = m.size;
+                member.type     = (ShaderDataType)m.type;
             }
+        }
 
-//            LOG_FORMAT("Found Push Constant {0} at set = {1}, binding = {2}", u.name.c_str(), set, binding, type.array.size() ? uint32_t(type.array[0]) : 1);
-
-            pushConstants.push_back({ size, shaderType });
-            pushConstants.back().data = new uint8_t[size];
-
-            auto& bufferType = comp.get_type(u.base_type_id);
-            auto bufferSize  = comp.get_declared_struct_size(bufferType);
-            int memberCount  = (int)bufferType.member_types.size();
+        for(auto& u : reflection.pushConstants)
+        {
+            pushConstants.push_back({ u.size, shaderType });
+            pushConstants.back().data = new uint8_t[u.size];
 
-            for(int i = 0; i < memberCount; i++)
+            for(auto& m : u.members)
             {
-                auto type               = comp.get_type(bufferType.member_types[i]);
-                const auto& memberName  = comp.get_member_name(bufferType.self, i);
-                auto size               = comp.get_declared_struct_member_size(bufferType, i);
-                auto offset             = comp.type_struct_member_offset(bufferType, i);
-                std::string uniformName = u.name + "." + memberName;
-                auto& member            = pushConstants.back().m_Members.emplace_back();
-                member.size             = (uint32_t)size;
-                member.offset           = offset;
-                member.type             = SPIRVTypeToDataType(type);
-                member.fullName         = uniformName;
-                member.name             = memberName;
+                auto& member    = pushConstants.back().m_Members.emplace_back();
+                member.size     = m.size;
+                member.offset   = m.offset;
+                member.type     = (ShaderDataType)m.type;
+                member.fullName = u.name + "." + m.name;
+                member.name     = m.name;
             }
         }
 
-        for(auto& u : resources.sampled_images)
+        for(auto& u : reflection.sampledImages)
         {
-            uint32_t set         = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
-            uint32_t binding     = comp.get_decoration(u.id, spv::DecorationBinding);
-            auto& descriptorInfo = descriptorSetInfos[set];
+            auto& descriptorInfo = descriptorSetInfos[u.set];
             auto& descriptor     = descriptorInfo.descriptors.emplace_back();
 
-            auto& type = comp.get_type(u.type_id);
-//            (LOG_FORMAT("Found Sampled Image {0} at set = {1}, binding = {2}", u.name.c_str(), set, binding));
-
-            descriptorLayoutInfos.push_back({ DescriptorType::IMAGE_SAMPLER, shaderType, binding, set, type.array.size() ? uint32_t(type.array[0]) : 1 });
+            descriptorLayoutInfos.push_back({ DescriptorType::IMAGE_SAMPLER, shaderType, u.binding, u.set, u.count });
 
-            descriptor.binding      = binding;
+            descriptor.binding      = u.binding;
             descriptor.textureCount = 1;
             descriptor.name         = u.name;
             descriptor.texture      = Material::GetDefaultTexture().get(); // TODO: Move
         }
 
-        for(auto& u : resources.storage_images)
+        for(auto& u : reflection.storageImages)
         {
-            const auto& name       = u.name;
-            auto& type             = comp.get_type(u.type_id);
-            uint32_t binding       = comp.get_decoration(u.id, spv::DecorationBinding);
-            uint32_t descriptorSet = comp.get_decoration(u.id, spv::DecorationDescriptorSet);
-            uint32_t dimension     = type.image.dim;
-            uint32_t arraySize     = type.array[0];
-            if(arraySize == 0)
-                arraySize = 1;
-
-            auto& descriptorInfo = descriptorSetInfos[descriptorSet];
+            auto& descriptorInfo = descriptorSetInfos[u.set];
             auto& descriptor     = descriptorInfo.descriptors.emplace_back();
 
-//            (LOG_FORMAT("Found Storage Image {0} at set = {1}, binding = {2}", u.name.c_str(), descriptorSet, binding));
-
-            descriptorLayoutInfos.push_back({ DescriptorType::IMAGE_STORAGE, shaderType, binding, descriptorSet, type.array.size() ? uint32_t(type.array[0]) : 1 });
+            descriptorLayoutInfos.push_back({ DescriptorType::IMAGE_STORAGE, shaderType, u.binding, u.set, u.count });
 
             descriptor.type         = DescriptorType::IMAGE_STORAGE;
-            descriptor.binding      = binding;
+            descriptor.binding      = u.binding;
             descriptor.textureCount = 1;
             descriptor.name         = u.name;
             descriptor.texture      = Material::GetDefaultTexture().get(); // TODO: Move
         }
 
+        for(auto& u : reflection.storageBuffers)
+        {
+            auto& descriptorInfo = descriptorSetInfos[u.set];
+            auto& descriptor     = descriptorInfo.descriptors.emplace_back();
+
+            descriptorLayoutInfos.push_back({ DescriptorType::STORAGE_BUFFER, shaderType, u.binding, u.set, u.count });
+
+            descriptor.type       = DescriptorType::STORAGE_BUFFER;
+            descriptor.binding    = u.binding;
+            descriptor.size       = u.size;
+            descriptor.offset     = 0;
+            descriptor.name       = u.name;
+            descriptor.shaderType = shaderType;
+            descriptor.buffer     = nullptr;
+        }
+    }
+
+    void VulkanShader::LoadFromData(const uint32_t* source, uint32_t fileSize, ShaderType shaderType, int currentShaderStage)
+    {
+        VkShaderModuleCreateInfo shaderCreateInfo = {};
+        shaderCreateInfo.sType                    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        shaderCreateInfo.codeSize                 = fileSize;
+        shaderCreateInfo.pCode                    = source;
+        shaderCreateInfo.pNext                    = VK_NULL_HANDLE;
+
+        // SPIRV-Cross only runs the first time a given SPIR-V binary is seen
+        ShaderStageReflection reflection;
+        const String cachePath = GetReflectionCachePath(source, fileSize);
+        if(!LoadReflectionCache(cachePath, fileSize, reflection))
+        {
+            Reflect(source, fileSize, shaderType, reflection);
+            SaveReflectionCache(cachePath, fileSize, reflection);
+        }
+
+        ApplyReflection(reflection, shaderType);
+
         shaderStageInfo[currentShaderStage].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
         shaderStageInfo[currentShaderStage].stage = VulkanUtility::ShaderTypeToVK(shaderType);
         shaderStageInfo[currentShaderStage].pName = "main";
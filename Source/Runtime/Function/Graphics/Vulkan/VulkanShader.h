@@ -12,6 +12,8 @@ namespace NekoEngine
     VkFormat GetVulkanFormat(const spirv_cross::SPIRType& type);
     uint32_t GetStrideFromVulkanFormat(VkFormat format);
 
+    struct ShaderStageReflection;
+
     class VulkanShader : public Shader
     {
     private:
@@ -40,6 +42,7 @@ namespace NekoEngine
         void CreatePipelineLayout();
         void ParseShaderFile(const std::vector<std::string>& lines, std::map<ShaderType, std::string>* shaders);
         void BindPushConstants(CommandBuffer* commandBuffer, Pipeline* pipeline) override;
+        void BindPushConstant(CommandBuffer* commandBuffer, Pipeline* pipeline, uint32_t index, const void* data) override;
 
         ShaderDataType SPIRVTypeToDataType(const spirv_cross::SPIRType type);
 
@@ -80,6 +83,8 @@ namespace NekoEngine
         const std::vector<VkVertexInputAttributeDescription>& GetVertexInputAttributeDescription() const { return vertexInputAttributeDescriptions; }
     private:
         void LoadFromData(const uint32_t* data, uint32_t size, ShaderType type, int currentShaderStage);
+        void Reflect(const uint32_t* data, uint32_t size, ShaderType type, ShaderStageReflection& reflection);
+        void ApplyReflection(const ShaderStageReflection& reflection, ShaderType type);
     };
 
 } // NekoEngine
@@ -2,6 +2,7 @@
 #include "VulkanTexture.h"
 #include "Window/GLFWWindow.h"
 #include "VulkanCommandBuffer.h"
+#include "VulkanCommandPool.h"
 #include "VulkanDevice.h"
 #include "VulkanContext.h"
 #include "Engine.h"
@@ -203,6 +204,11 @@ namespace NekoEngine
             bufferData[i].MainCommandBuffer = nullptr;
             bufferData[i].CommandPool = nullptr;
 
+            bufferData[i].SecondaryCommandBuffers.clear();
+            for(auto& pool : bufferData[i].SecondaryCommandPools)
+                pool->Destroy();
+            bufferData[i].SecondaryCommandPools.clear();
+
             delete swapChainBuffers[i];
         }
 
@@ -304,6 +310,23 @@ namespace NekoEngine
         return bufferData[currentBufferIndex].MainCommandBuffer.get();
     }
 
+    CommandBuffer* VulkanSwapChain::GetSecondaryCommandBuffer(uint32_t index)
+    {
+        // Secondary buffers are executed by the frame's main buffer, so its fence also covers them
+        auto& frameData = bufferData[currentBufferIndex];
+        while(frameData.SecondaryCommandBuffers.size() <= index)
+        {
+            auto pool = MakeShared<VulkanCommandPool>(gVulkanContext.GetDevice()->GetPhysicalDevice()->GetGraphicsFamilyIndex(), VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+            auto commandBuffer = MakeShared<VulkanCommandBuffer>();
+            commandBuffer->Init(false, pool->GetHandle());
+
+            frameData.SecondaryCommandPools.push_back(pool);
+            frameData.SecondaryCommandBuffers.push_back(commandBuffer);
+        }
+
+        return frameData.SecondaryCommandBuffers[index].get();
+    }
+
     void VulkanSwapChain::SetVSync(bool vsync)
     {
         this->isVSync = vsync;
@@ -13,6 +13,10 @@ namespace NekoEngine
         VkSemaphore PresentSemaphore = VK_NULL_HANDLE;
         SharedPtr<VulkanCommandPool> CommandPool;
         SharedPtr<VulkanCommandBuffer> MainCommandBuffer;
+
+        // Each secondary buffer has its own pool so they can be recorded on different threads
+        ArrayList<SharedPtr<VulkanCommandPool>> SecondaryCommandPools;
+        ArrayList<SharedPtr<VulkanCommandBuffer>> SecondaryCommandBuffers;
     };
 
     class VulkanSwapChain : public SwapChain
@@ -47,6 +51,7 @@ namespace NekoEngine
         uint32_t GetCurrentImageIndex() const override;
         size_t GetSwapChainBufferCount() const override;
         CommandBuffer* GetCurrentCommandBuffer() override;
+        CommandBuffer* GetSecondaryCommandBuffer(uint32_t index) override;
         void SetVSync(bool vsync) override;
 
         const VkSwapchainKHR GetHandle() const
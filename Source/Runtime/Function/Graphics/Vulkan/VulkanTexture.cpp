@@ -1,10 +1,11 @@
 #include "VulkanTexture.h"
 #include "VulkanUtility.h"
 #include "File/ImageLoader.h"
+#include "File/KTX2.h"
 #include "Math/Maths.h"
 #include "VulkanRenderer.h"
-#include "File/ImageLoader.h"
 #include "VulkanDevice.h"
+#include "VulkanUploadManager.h"
 
 namespace NekoEngine
 {
@@ -98,7 +99,9 @@ namespace NekoEngine
         CreateImageVMA(imageInfo, image, allocation);
     }
 
-    void GenerateMipmaps(CommandBuffer* commandBuffer, VkImage image, VkFormat imageFormat, uint32_t texWidth,
+    // Expects every level in TRANSFER_DST_OPTIMAL and leaves them all in SHADER_READ_ONLY_OPTIMAL.
+    // Blits need a graphics queue, uploads record this after their copies through the upload manager.
+    void GenerateMipmaps(VkCommandBuffer vkCommandBuffer, VkImage image, VkFormat imageFormat, uint32_t texWidth,
                          uint32_t texHeight, uint32_t mipLevels,
                          uint32_t layer = 0, uint32_t layerCount = 1)
     {
@@ -110,13 +113,6 @@ namespace NekoEngine
             LOG("Texture image format does not support linear blitting!");
         }
 
-        VkCommandBuffer vkCommandBuffer;
-
-        if(commandBuffer)
-            vkCommandBuffer = ((VulkanCommandBuffer*) commandBuffer)->GetHandle();
-        else
-            vkCommandBuffer = VulkanUtility::BeginSingleTimeCommands();
-
         VkImageMemoryBarrier barrier{};
         barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
         barrier.image = image;
@@ -210,8 +206,67 @@ namespace NekoEngine
                              nullptr,
                              1,
                              &barrier);
+    }
+
+    // Copies every level and face of a cooked KTX2 file from the mapped file into the image, which ends up
+    // sampleable after the next upload batch. Nothing is decoded and no mips are generated.
+    static void UploadKTX2(const KTX2::Image &ktx, VkImage image)
+    {
+        // Level data is contiguous in the file, stage the span covering all of it
+        uint64_t begin = ktx.levels[0].offset;
+        uint64_t end = 0;
+        for(auto &level: ktx.levels)
+        {
+            begin = Maths::Min(begin, level.offset);
+            end = Maths::Max(end, level.offset + level.size);
+        }
+
+        ArrayList<VkBufferImageCopy> regions(ktx.levelCount);
+        for(uint32_t level = 0; level < ktx.levelCount; level++)
+        {
+            // Faces of a level are back to back, one region covers all of them
+            VkBufferImageCopy &region = regions[level];
+            region = {};
+            region.bufferOffset = ktx.levels[level].offset - begin;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = level;
+            region.imageSubresource.layerCount = ktx.faceCount;
+            region.imageExtent = {Maths::Max(ktx.width >> level, 1u), Maths::Max(ktx.height >> level, 1u), 1};
+        }
 
-        VulkanUtility::EndSingleTimeCommands(vkCommandBuffer);
+        VkImageSubresourceRange range = {};
+        range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        range.levelCount = ktx.levelCount;
+        range.layerCount = ktx.faceCount;
+
+        VulkanRenderer::GetUploadManager()->UploadImage(image, ktx.file.data + begin, static_cast<uint32_t>(end - begin),
+                                                        regions.data(), ktx.levelCount, range,
+                                                        KTX2::GetBlockSize(ktx.vkFormat), VK_IMAGE_LAYOUT_UNDEFINED,
+                                                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+
+    static bool LoadKTX2File(const String &fileName, KTX2::Image &ktx, uint32_t faceCount)
+    {
+        if(!Renderer::capabilities.TextureCompressionBC)
+        {
+            LOG_FORMAT("[Texture] %s is block compressed, the device does not support BC formats", fileName.c_str());
+            return false;
+        }
+
+        if(!KTX2::Load(fileName, ktx))
+        {
+            LOG_FORMAT("[Texture] Could not load %s", fileName.c_str());
+            return false;
+        }
+
+        if(ktx.faceCount != faceCount)
+        {
+            LOG_FORMAT("[Texture] %s has %u faces, expected %u", fileName.c_str(), ktx.faceCount, faceCount);
+            KTX2::Free(ktx);
+            return false;
+        }
+
+        return true;
     }
 
 
@@ -277,6 +332,22 @@ namespace NekoEngine
         vkFormat = ConvertRHIFormat2VkFormat(parameters.format, parameters.srgb);
         isDeleteImage = true;
         flags = parameters.flags;
+
+        // Load may switch the format, cooked KTX2 files carry their own
+        if(Load())
+        {
+            imageView = CreateImageView(image, VulkanUtility::FormatToVK(params.format, params.srgb), mipMapLevels,
+                                        VK_IMAGE_VIEW_TYPE_2D, VK_IMAGE_ASPECT_COLOR_BIT, 1);
+            sampler = CreateTextureSampler(VulkanUtility::TextureFilterToVK(params.magFilter),
+                                           VulkanUtility::TextureFilterToVK(params.minFilter), 0.0f,
+                                           static_cast<float>(mipMapLevels), params.anisotropicFiltering,
+                                           params.anisotropicFiltering
+                                           ? gVulkanContext.GetDevice()->GetPhysicalDevice()->GetProperties().limits.maxSamplerAnisotropy
+                                           : 1.0f, VulkanUtility::TextureWrapToVK(params.wrap),
+                                           VulkanUtility::TextureWrapToVK(params.wrap),
+                                           VulkanUtility::TextureWrapToVK(params.wrap));
+        }
+
         UpdateDescriptor();
     }
 
@@ -323,8 +394,6 @@ namespace NekoEngine
                                { vmaDestroyImage(GET_ALLOCATOR(), tImage, tAlloc); });
         }
 
-        if(stagingBuffer) delete stagingBuffer;
-
         imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
     }
 
@@ -398,6 +467,9 @@ namespace NekoEngine
 
         flags |= TextureFlags::Texture_Sampled;
 
+        if(data == nullptr && KTX2::IsKTX2File(fileName))
+            return LoadKTX2();
+
         if(data == nullptr)
         {
             pixels = ImageLoader::LoadImageFromFile(fileName, &width, &height, &bits);
@@ -431,32 +503,78 @@ namespace NekoEngine
             mipMapLevels = 1;
         }
 
-        auto t_StagingBuffer = new VulkanBuffer(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
-                                                static_cast<uint32_t>(imageSize), pixels);
-
-        if(data == nullptr)
-        {
-            delete[] pixels;
-        }
-
         CreateImage(width, height, mipMapLevels, vkFormat, VK_IMAGE_TYPE_2D, VK_IMAGE_TILING_OPTIMAL,
                         VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
                         VK_IMAGE_USAGE_STORAGE_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, image,
                         imageMemory, 1, 0, allocation);
 
-        VulkanUtility::TransitionImageLayout(image, vkFormat, VK_IMAGE_LAYOUT_UNDEFINED,
-                                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipMapLevels);
-        VulkanUtility::CopyBufferToImage(t_StagingBuffer->GetHandle(), image, width, height);
+        const bool createMips = (flags & TextureFlags::Texture_CreateMips) != 0;
 
-        delete t_StagingBuffer;
+        VkBufferImageCopy region = {};
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageExtent = {width, height, 1};
 
-        if(flags & TextureFlags::Texture_CreateMips)
+        VkImageSubresourceRange range = {};
+        range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        range.levelCount = mipMapLevels;
+        range.layerCount = 1;
+
+        // Copied into the staging ring here, the GPU side runs with the next batch of uploads
+        auto uploadManager = VulkanRenderer::GetUploadManager();
+        uploadManager->UploadImage(image, pixels, static_cast<uint32_t>(imageSize), &region, 1, range, bits / 8,
+                                   VK_IMAGE_LAYOUT_UNDEFINED,
+                                   createMips ? VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+        if(data == nullptr)
+        {
+            delete[] pixels;
+        }
+
+        if(createMips)
         {
-            GenerateMipmaps(nullptr, image, vkFormat, width, height, mipMapLevels);
+            VkImage tImage = image;
+            VkFormat tFormat = vkFormat;
+            uint32_t tWidth = width, tHeight = height, tMips = mipMapLevels;
+            uploadManager->RecordGraphics([tImage, tFormat, tWidth, tHeight, tMips](VkCommandBuffer commandBuffer)
+                                          { GenerateMipmaps(commandBuffer, tImage, tFormat, tWidth, tHeight, tMips); });
         }
 
         m_UUID = Random64::Rand(0, ULLONG_MAX);
-        TransitionImage(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, nullptr);
+        imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        UpdateDescriptor();
+
+        return true;
+    }
+
+    bool VulkanTexture2D::LoadKTX2()
+    {
+        KTX2::Image ktx;
+        if(!LoadKTX2File(fileName, ktx, 1))
+            return false;
+
+        // The mip chain was built by the cooker
+        flags &= ~TextureFlags::Texture_CreateMips;
+
+        width = ktx.width;
+        height = ktx.height;
+        mipMapLevels = ktx.levelCount;
+        vkFormat = static_cast<VkFormat>(ktx.vkFormat);
+        params.format = VulkanUtility::VKToFormat(vkFormat);
+        params.srgb = ktx.srgb;
+        rhiFormat = params.format;
+        bitsPerChannel = GetBitsFromFormat(params.format);
+
+        CreateImage(width, height, mipMapLevels, vkFormat, VK_IMAGE_TYPE_2D, VK_IMAGE_TILING_OPTIMAL,
+                    VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                    image, imageMemory, 1, 0, allocation);
+
+        UploadKTX2(ktx, image);
+        KTX2::Free(ktx);
+
+        m_UUID = Random64::Rand(0, ULLONG_MAX);
+        imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        UpdateDescriptor();
 
         return true;
     }
@@ -499,21 +617,28 @@ namespace NekoEngine
         if(!pixels)
         {
             LOG("failed to load texture image!");
+            return;
         }
 
         mipMapLevels = 1;
 
-        if(!stagingBuffer)
-            stagingBuffer = new VulkanBuffer(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
-                                             static_cast<uint32_t>(imageSize), pixels);
-        else
-            stagingBuffer->SetData(pixels, static_cast<uint32_t>(imageSize));
+        VkBufferImageCopy region = {};
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageExtent = {width, height, 1};
+
+        VkImageSubresourceRange range = {};
+        range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        range.levelCount = 1;
+        range.layerCount = 1;
 
-        TransitionImage(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-        VulkanUtility::CopyBufferToImage(stagingBuffer->GetBuffer(), image, static_cast<uint32_t>(width),
-                                         static_cast<uint32_t>(height));
+        // Passing the current layout keeps the copy behind frames that may still sample the old contents
+        VulkanRenderer::GetUploadManager()->UploadImage(image, pixels, static_cast<uint32_t>(imageSize), &region, 1, range,
+                                                        bitsPerChannel / 2, imageLayout,
+                                                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
-        TransitionImage(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        UpdateDescriptor();
     }
 
     void VulkanTexture2D::UpdateDescriptor()
@@ -716,7 +841,8 @@ namespace NekoEngine
         vkFormat           = VK_FORMAT_D32_SFLOAT;
         rhiFormat             = VulkanUtility::VKToFormat(vkFormat);
 
-        CreateImage(width, height, 1, vkFormat, VK_IMAGE_TYPE_2D, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, image, imageMemory, count, 0, allocation);
+        CreateImage(width, height, 1, vkFormat, VK_IMAGE_TYPE_2D, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+                    VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, image, imageMemory, count, 0, allocation);
 
         imageView = CreateImageView(image, vkFormat, 1, VK_IMAGE_VIEW_TYPE_2D_ARRAY, VK_IMAGE_ASPECT_DEPTH_BIT, count);
 
@@ -765,6 +891,9 @@ namespace NekoEngine
     {
         files[0] = filepath;
         rhiFormat = params.format;
+
+        if(KTX2::IsKTX2File(filepath))
+            LoadKTX2();
     }
 
     VulkanTextureCube::VulkanTextureCube(const std::string* _files)
@@ -794,10 +923,6 @@ namespace NekoEngine
     void VulkanTextureCube::BuildTexture()
     {
         uint32_t dataSize = width * height * GetBytesPerPixel() * layersNum;
-        uint8_t* allData = new uint8_t[dataSize];
-        uint32_t pointeroffset = 0;
-
-        uint32_t faceOrder[6] = {3, 1, 0, 4, 2, 5};
 
         CreateImage(width, height, mipsNums, vkFormat, VK_IMAGE_TYPE_2D, VK_IMAGE_TILING_OPTIMAL,
                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
@@ -812,20 +937,6 @@ namespace NekoEngine
 
         if(data)
         {
-            memcpy(allData, data, dataSize);
-
-            VulkanBuffer* stagingBuffer = new VulkanBuffer(VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
-                                                           static_cast<uint32_t>(dataSize), allData);
-
-            if(data == nullptr)
-            {
-                delete[] allData;
-                allData = nullptr;
-            }
-
-            VkCommandBuffer commandBuffer = VulkanUtility::BeginSingleTimeCommands();
-
             //// Setup buffer copy regions for each face including all of it's miplevels
             std::vector<VkBufferImageCopy> bufferCopyRegions;
             uint32_t offset = 0;
@@ -851,39 +962,21 @@ namespace NekoEngine
                 }
             }
 
-            // Image barrier for optimal image (target)
-            // Set initial layout for all array layers (faces) of the optimal (target) tiled texture
             VkImageSubresourceRange subresourceRange = {};
             subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             subresourceRange.baseMipLevel = 0;
             subresourceRange.levelCount = mipsNums;
             subresourceRange.layerCount = layersNum;
 
-            VulkanUtility::TransitionImageLayout(image, vkFormat, VK_IMAGE_LAYOUT_UNDEFINED,
-                                                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipsNums, layersNum,
-                                                 commandBuffer);
-
-            // Copy the cube map faces from the staging buffer to the optimal tiled image
-            vkCmdCopyBufferToImage(
-                    commandBuffer,
-                    stagingBuffer->GetBuffer(),
-                    image,
-                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                    static_cast<uint32_t>(bufferCopyRegions.size()),
-                    bufferCopyRegions.data());
-
-            // Change texture image layout to shader read after all faces have been copied
-            VulkanUtility::TransitionImageLayout(image, vkFormat, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                                                 VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipsNums, layersNum,
-                                                 commandBuffer);
+            // All faces in one staged copy, left in shader read once the upload batch runs
+            VulkanRenderer::GetUploadManager()->UploadImage(image, data, dataSize, bufferCopyRegions.data(),
+                                                            static_cast<uint32_t>(bufferCopyRegions.size()),
+                                                            subresourceRange, GetBytesPerPixel(),
+                                                            VK_IMAGE_LAYOUT_UNDEFINED,
+                                                            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
             imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-            VulkanUtility::EndSingleTimeCommands(commandBuffer);
-
-            delete stagingBuffer;
         }
-        delete[] allData;
 
         for(uint32_t i = 0; i < layersNum; i++)
         {
@@ -1056,23 +1149,11 @@ namespace NekoEngine
             }
         }
 
-        auto* stagingBuffer = new VulkanBuffer(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
-                                               static_cast<uint32_t>(size), allData);
-
-        if(data == nullptr)
-        {
-            delete[] allData;
-            allData = nullptr;
-        }
-
         CreateImage(faceWidths[0], faceHeights[0], mipsNums, vkFormat, VK_IMAGE_TYPE_2D, VK_IMAGE_TILING_OPTIMAL,
                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, image, imageMemory, 6, VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT,
                     allocation);
 
-
-        VkCommandBuffer commandBuffer = VulkanUtility::BeginSingleTimeCommands();
-
         //// Setup buffer copy regions for each face including all of it's miplevels
         std::vector<VkBufferImageCopy> bufferCopyRegions;
         uint32_t offset = 0;
@@ -1094,38 +1175,25 @@ namespace NekoEngine
                 bufferCopyRegions.push_back(bufferCopyRegion);
 
                 // Increase offset into staging buffer for next level / face
-                offset += faceWidths[level] * faceWidths[level] * GetBytesPerChannel();
+                offset += faceWidths[level] * faceHeights[level] * GetBytesPerChannel();
             }
         }
 
-        // Image barrier for optimal image (target)
-        // Set initial layout for all array layers (faces) of the optimal (target) tiled texture
         VkImageSubresourceRange subresourceRange = {};
         subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         subresourceRange.baseMipLevel = 0;
         subresourceRange.levelCount = mipsNums;
         subresourceRange.layerCount = 6;
 
-        VulkanUtility::TransitionImageLayout(image, vkFormat, VK_IMAGE_LAYOUT_UNDEFINED,
-                                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipsNums, 6, commandBuffer);
-
-        // Copy the cube map faces from the staging buffer to the optimal tiled image
-        vkCmdCopyBufferToImage(
-                commandBuffer,
-                stagingBuffer->GetBuffer(),
-                image,
-                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                static_cast<uint32_t>(bufferCopyRegions.size()),
-                bufferCopyRegions.data());
-
-        // Change texture image layout to shader read after all faces have been copied
-        VulkanUtility::TransitionImageLayout(image, vkFormat, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipsNums, 6, commandBuffer);
+        // Only the packed faces are staged, the source pixels can be freed straight away
+        VulkanRenderer::GetUploadManager()->UploadImage(image, allData, pointeroffset, bufferCopyRegions.data(),
+                                                        static_cast<uint32_t>(bufferCopyRegions.size()),
+                                                        subresourceRange, GetBytesPerChannel(),
+                                                        VK_IMAGE_LAYOUT_UNDEFINED,
+                                                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
         imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
-        VulkanUtility::EndSingleTimeCommands(commandBuffer);
-
         sampler = CreateTextureSampler(VK_FILTER_LINEAR, VK_FILTER_LINEAR, 0.0f, static_cast<float>(mipsNums), false,
                                        gVulkanContext.GetDevice()->GetPhysicalDevice()->GetProperties().limits.maxSamplerAnisotropy,
                                        VK_SAMPLER_ADDRESS_MODE_REPEAT, VK_SAMPLER_ADDRESS_MODE_REPEAT,
@@ -1134,8 +1202,6 @@ namespace NekoEngine
 
         m_UUID = Random64::Rand(0, ULLONG_MAX);
 
-        delete stagingBuffer;
-
         for(uint32_t m = 0; m < mips; m++)
         {
             for(uint32_t f = 0; f < 6; f++)
@@ -1158,13 +1224,58 @@ namespace NekoEngine
         }
     }
 
+    bool VulkanTextureCube::LoadKTX2()
+    {
+        KTX2::Image ktx;
+        if(!LoadKTX2File(files[0], ktx, 6))
+            return false;
+
+        flags |= TextureFlags::Texture_Sampled;
+
+        width = ktx.width;
+        height = ktx.height;
+        mipsNums = ktx.levelCount;
+        layersNum = 6;
+        isDeleteImage = true;
+        vkFormat = static_cast<VkFormat>(ktx.vkFormat);
+        params.format = VulkanUtility::VKToFormat(vkFormat);
+        params.srgb = ktx.srgb;
+        rhiFormat = params.format;
+
+        CreateImage(width, height, mipsNums, vkFormat, VK_IMAGE_TYPE_2D, VK_IMAGE_TILING_OPTIMAL,
+                    VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                    image, imageMemory, 6, VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT, allocation);
+
+        UploadKTX2(ktx, image);
+        KTX2::Free(ktx);
+
+        imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        sampler = CreateTextureSampler(VK_FILTER_LINEAR, VK_FILTER_LINEAR, 0.0f, static_cast<float>(mipsNums), false,
+                                       gVulkanContext.GetDevice()->GetPhysicalDevice()->GetProperties().limits.maxSamplerAnisotropy,
+                                       VK_SAMPLER_ADDRESS_MODE_REPEAT, VK_SAMPLER_ADDRESS_MODE_REPEAT,
+                                       VK_SAMPLER_ADDRESS_MODE_REPEAT);
+        imageView = CreateImageView(image, vkFormat, mipsNums, VK_IMAGE_VIEW_TYPE_CUBE, VK_IMAGE_ASPECT_COLOR_BIT, 6);
+
+        for(uint32_t i = 0; i < 6; i++)
+        {
+            individualImageViews.push_back(CreateImageView(image, vkFormat, 1, VK_IMAGE_VIEW_TYPE_2D,
+                                                           VK_IMAGE_ASPECT_COLOR_BIT, 1, i));
+        }
+
+        m_UUID = Random64::Rand(0, ULLONG_MAX);
+        UpdateDescriptor();
+
+        return true;
+    }
+
     void VulkanTextureCube::GenerateMipMaps(CommandBuffer* commandBuffer)
     {
         VulkanUtility::TransitionImageLayout(image, vkFormat, imageLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                              mipsNums, 6, ((VulkanCommandBuffer*) commandBuffer)->GetHandle());
 
         for(int i = 0; i < 6; i++)
-            GenerateMipmaps(commandBuffer, image, vkFormat, width, height, mipsNums, i, 1);
+            GenerateMipmaps(((VulkanCommandBuffer*) commandBuffer)->GetHandle(), image, vkFormat, width, height, mipsNums, i, 1);
 
         // Generate mips sets layout to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
         VulkanUtility::TransitionImageLayout(image, vkFormat, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, imageLayout,
@@ -1195,6 +1306,18 @@ namespace NekoEngine
                         return VK_FORMAT_R32G32B32_SFLOAT;
                     case RHIFormat::R32G32B32A32_Float:
                         return VK_FORMAT_R32G32B32A32_SFLOAT;
+                    case RHIFormat::BC1_Unorm:
+                        return VK_FORMAT_BC1_RGB_SRGB_BLOCK;
+                    case RHIFormat::BC3_Unorm:
+                        return VK_FORMAT_BC3_SRGB_BLOCK;
+                    case RHIFormat::BC4_Unorm:
+                        return VK_FORMAT_BC4_UNORM_BLOCK;
+                    case RHIFormat::BC5_Unorm:
+                        return VK_FORMAT_BC5_UNORM_BLOCK;
+                    case RHIFormat::BC6H_UFloat:
+                        return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+                    case RHIFormat::BC7_Unorm:
+                        return VK_FORMAT_BC7_SRGB_BLOCK;
                     default:
                         LOG("Unsupported image bit-depth!");
                         return VK_FORMAT_R8G8B8A8_SRGB;
@@ -1240,6 +1363,18 @@ namespace NekoEngine
                         return VK_FORMAT_D24_UNORM_S8_UINT;
                     case RHIFormat::D32_Float_S8_UInt:
                         return VK_FORMAT_D32_SFLOAT_S8_UINT;
+                    case RHIFormat::BC1_Unorm:
+                        return VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+                    case RHIFormat::BC3_Unorm:
+                        return VK_FORMAT_BC3_UNORM_BLOCK;
+                    case RHIFormat::BC4_Unorm:
+                        return VK_FORMAT_BC4_UNORM_BLOCK;
+                    case RHIFormat::BC5_Unorm:
+                        return VK_FORMAT_BC5_UNORM_BLOCK;
+                    case RHIFormat::BC6H_UFloat:
+                        return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+                    case RHIFormat::BC7_Unorm:
+                        return VK_FORMAT_BC7_UNORM_BLOCK;
                     default:
                         LOG("Unsupported image bit-depth!");
                         return VK_FORMAT_R8G8B8A8_UNORM;
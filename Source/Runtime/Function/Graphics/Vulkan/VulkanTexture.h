@@ -22,7 +22,6 @@ namespace NekoEngine
         VkDeviceMemory imageMemory = VK_NULL_HANDLE;
         VkDescriptorImageInfo descriptor = {};
         HashMap<uint32_t, VkImageView> mipMaps;
-        VulkanBuffer* stagingBuffer = nullptr;
         VmaAllocation allocation = VK_NULL_HANDLE;
         bool isDeleteImage;
     public:
@@ -37,6 +36,8 @@ namespace NekoEngine
         void Unbind(uint32_t slot = 0) const override {};
         void BuildTexture();
         void TransitionImage(VkImageLayout newLayout, VulkanCommandBuffer* commandBuffer = nullptr);
+        // Records that a batched transition has moved the image to layout, see VulkanRenderer::TransitionTextures
+        void SetImageLayout(VkImageLayout layout) { imageLayout = layout; UpdateDescriptor(); }
         void UpdateDescriptor();
         VkImageView GetMipImageView(uint32_t mipLevel);
         void SetData(const void* pixels) override;
@@ -45,6 +46,7 @@ namespace NekoEngine
 
         bool Load();
         void Load(uint32_t _width, uint32_t _height, void* _data, TextureDesc _parameters = TextureDesc(), TextureLoadOptions _loadOptions = TextureLoadOptions()) override;
+        bool LoadKTX2();
 
         TextureType GetType() override
         {
@@ -93,6 +95,7 @@ namespace NekoEngine
         void BuildTexture();
         void UpdateDescriptor();
         void TransitionImage(VkImageLayout newLayout, VulkanCommandBuffer* commandBuffer = nullptr);
+        void SetImageLayout(VkImageLayout layout) { imageLayout = layout; UpdateDescriptor(); }
 
         void* GetHandle() const override { return (void*)this; }
         const VkImageView& GetImageView() const { return imageView; }
@@ -131,6 +134,7 @@ namespace NekoEngine
 
         void UpdateDescriptor();
         void TransitionImage(VkImageLayout newLayout, VulkanCommandBuffer* commandBuffer = nullptr);
+        void SetImageLayout(VkImageLayout layout) { imageLayout = layout; UpdateDescriptor(); }
 
         TextureType GetType() override
         {
@@ -139,6 +143,8 @@ namespace NekoEngine
 
         VkImageView GetImageView(int index) const { return individualImageViews[index]; }
         uint32_t GetCount() const override { return count; }
+        uint32_t GetWidth(uint32_t mip = 0) const override { return width >> mip; }
+        uint32_t GetHeight(uint32_t mip = 0) const override { return height >> mip; }
 
         void* GetHandle() const override { return (void*)this; }
         const VkImageView& GetImageView() const { return imageView; }
@@ -192,6 +198,7 @@ namespace NekoEngine
         void Unbind(uint32_t slot = 0) const override {};
 
         void Load(uint32_t mips);
+        bool LoadKTX2();
 
         TextureType GetType() override
         {
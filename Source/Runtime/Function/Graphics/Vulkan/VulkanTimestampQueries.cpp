@@ -0,0 +1,137 @@
+#include "VulkanTimestampQueries.h"
+
+#ifdef NekoEngine_PROFILE
+
+#include "VulkanContext.h"
+#include "VulkanDevice.h"
+#include "VulkanCommandBuffer.h"
+#include "Math/Maths.h"
+
+namespace NekoEngine
+{
+    static constexpr uint32_t QueriesPerFrame = 1 + VulkanTimestampQueries::MaxScopes * 2;
+    static constexpr uint32_t NoScope = ~0u;
+
+    VulkanTimestampQueries::VulkanTimestampQueries(uint32_t frameCount)
+    {
+        auto physicalDevice = gVulkanContext.GetDevice()->GetPhysicalDevice();
+        const uint32_t validBits = physicalDevice->GetQueueFamilyProperties()[physicalDevice->GetGraphicsFamilyIndex()].timestampValidBits;
+        m_Period    = physicalDevice->GetProperties().limits.timestampPeriod;
+        m_ValidMask = validBits >= 64 ? ~0ull : (1ull << validBits) - 1;
+
+        VkQueryPoolCreateInfo poolInfo{};
+        poolInfo.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        poolInfo.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+        poolInfo.queryCount = QueriesPerFrame;
+
+        m_Frames.resize(Maths::Max(frameCount, 1u));
+        for(auto &frame: m_Frames)
+        {
+            VK_CHECK_RESULT(vkCreateQueryPool(GET_DEVICE(), &poolInfo, nullptr, &frame.pool), "Failed to create timestamp query pool");
+            frame.scopes.reserve(MaxScopes);
+        }
+
+        m_Results.resize(QueriesPerFrame);
+        m_Events.reserve(MaxScopes);
+    }
+
+    VulkanTimestampQueries::~VulkanTimestampQueries()
+    {
+        for(auto &frame: m_Frames)
+            vkDestroyQueryPool(GET_DEVICE(), frame.pool, nullptr);
+    }
+
+    void VulkanTimestampQueries::BeginFrame(uint32_t frameIndex, VulkanCommandBuffer* commandBuffer)
+    {
+        m_Frame = frameIndex % (uint32_t)m_Frames.size();
+        Frame &frame = m_Frames[m_Frame];
+
+        if(frame.submitted)
+            ReadBack(frame);
+
+        frame.scopes.clear();
+        frame.queryCount = 1;
+        frame.submitted  = false;
+        m_OpenScopes.clear();
+
+        vkCmdResetQueryPool(commandBuffer->GetHandle(), frame.pool, 0, QueriesPerFrame);
+        vkCmdWriteTimestamp(commandBuffer->GetHandle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, frame.pool, 0);
+        m_Recording = true;
+    }
+
+    void VulkanTimestampQueries::EndFrame()
+    {
+        if(!m_Recording)
+            return;
+
+        // A scope left open never gets its second timestamp, which would keep the whole frame from reading back
+        Frame &frame = m_Frames[m_Frame];
+        frame.submitTime = Profiler::Now();
+        frame.submitted  = m_OpenScopes.empty();
+        m_Recording      = false;
+    }
+
+    void VulkanTimestampQueries::BeginScope(const char* name, VulkanCommandBuffer* commandBuffer)
+    {
+        if(!m_Recording)
+            return;
+
+        Frame &frame = m_Frames[m_Frame];
+        if(frame.scopes.size() >= MaxScopes)
+        {
+            m_OpenScopes.push_back(NoScope);
+            return;
+        }
+
+        const uint32_t index = (uint32_t)frame.scopes.size();
+        frame.scopes.push_back({name, (uint32_t)m_OpenScopes.size()});
+        m_OpenScopes.push_back(index);
+
+        vkCmdWriteTimestamp(commandBuffer->GetHandle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, frame.pool, 1 + index * 2);
+    }
+
+    void VulkanTimestampQueries::EndScope(VulkanCommandBuffer* commandBuffer)
+    {
+        if(!m_Recording || m_OpenScopes.empty())
+            return;
+
+        const uint32_t index = m_OpenScopes.back();
+        m_OpenScopes.pop_back();
+        if(index == NoScope)
+            return;
+
+        Frame &frame = m_Frames[m_Frame];
+        vkCmdWriteTimestamp(commandBuffer->GetHandle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, frame.pool, 2 + index * 2);
+        frame.queryCount = Maths::Max(frame.queryCount, 3 + index * 2);
+    }
+
+    void VulkanTimestampQueries::ReadBack(Frame& frame)
+    {
+        // The swap chain waited on the frame's fence, anything not available now never will be
+        VkResult result = vkGetQueryPoolResults(GET_DEVICE(), frame.pool, 0, frame.queryCount, sizeof(uint64_t) * frame.queryCount,
+                                                m_Results.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+        if(result != VK_SUCCESS)
+            return;
+
+        const uint64_t start = m_Results[0];
+        auto toCPUTime = [this, &frame, start](uint64_t timestamp)
+        {
+            return frame.submitTime + int64_t(double((timestamp - start) & m_ValidMask) * m_Period);
+        };
+
+        m_Events.clear();
+        for(uint32_t i = 0; i < (uint32_t)frame.scopes.size(); i++)
+        {
+            ProfileEvent &event = m_Events.emplace_back();
+            event.name  = frame.scopes[i].name;
+            event.depth = frame.scopes[i].depth;
+            event.begin = toCPUTime(m_Results[1 + i * 2]);
+            event.end   = toCPUTime(m_Results[2 + i * 2]);
+        }
+
+        Profiler::SubmitGPUFrame(m_Events.data(), (uint32_t)m_Events.size());
+    }
+
+} // NekoEngine
+
+#endif
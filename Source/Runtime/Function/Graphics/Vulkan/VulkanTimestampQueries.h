@@ -0,0 +1,64 @@
+#pragma once
+#include "Vk.h"
+#include "Core.h"
+#include "Profiler/Profiler.h"
+
+#ifdef NekoEngine_PROFILE
+
+namespace NekoEngine
+{
+    class VulkanCommandBuffer;
+
+    // Timestamp queries for the profiler, a query pool per frame in flight. Query 0 of a frame is written when
+    // it begins and each scope takes the two after. A frame's results are read without waiting when its slot
+    // comes round again, after the swap chain has waited on its fence, and placed on the CPU timeline so the
+    // first timestamp lines up with the submit. The GPU starts no earlier than that, so GPU scopes show at
+    // most that much early.
+    class VulkanTimestampQueries
+    {
+    public:
+        static constexpr uint32_t MaxScopes = 128;
+
+        VulkanTimestampQueries(uint32_t frameCount);
+        ~VulkanTimestampQueries();
+
+        // Hands the slot's last results to the profiler and resets its queries, before anything else is recorded
+        void BeginFrame(uint32_t frame, VulkanCommandBuffer* commandBuffer);
+
+        // Right before the frame's command buffer is submitted
+        void EndFrame();
+
+        void BeginScope(const char* name, VulkanCommandBuffer* commandBuffer);
+        void EndScope(VulkanCommandBuffer* commandBuffer);
+
+    private:
+        struct Scope
+        {
+            const char* name = nullptr;
+            uint32_t depth   = 0;
+        };
+
+        struct Frame
+        {
+            VkQueryPool pool    = VK_NULL_HANDLE;
+            ArrayList<Scope> scopes;
+            uint32_t queryCount = 0;
+            int64_t submitTime  = 0;
+            bool submitted      = false;
+        };
+
+        void ReadBack(Frame& frame);
+
+        ArrayList<Frame> m_Frames;
+        ArrayList<uint32_t> m_OpenScopes; // Scopes begun and not ended yet this frame
+        ArrayList<uint64_t> m_Results;
+        ArrayList<ProfileEvent> m_Events;
+        uint32_t m_Frame     = 0;
+        bool m_Recording     = false;
+        double m_Period      = 1.0;   // Nanoseconds per tick
+        uint64_t m_ValidMask = ~0ull; // Bits the graphics queue's timestamps have
+    };
+
+} // NekoEngine
+
+#endif
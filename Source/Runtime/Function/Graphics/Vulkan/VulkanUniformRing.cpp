@@ -0,0 +1,82 @@
+#include "VulkanUniformRing.h"
+#include "VulkanContext.h"
+
+namespace NekoEngine
+{
+    VulkanUniformRing::VulkanUniformRing(uint32_t frameCount, uint32_t frameSize)
+        : m_FrameCount(frameCount)
+    {
+        m_Alignment = Maths::Max((uint32_t)gVulkanContext.GetMinUniformBufferOffsetAlignment(), 1u);
+        m_FrameSize = (frameSize + m_Alignment - 1) & ~(m_Alignment - 1);
+        CreateBuffer();
+    }
+
+    VulkanUniformRing::~VulkanUniformRing()
+    {
+        m_Buffer.Unmap();
+    }
+
+    void VulkanUniformRing::CreateBuffer()
+    {
+        m_Buffer.Unmap();
+
+        if(m_Generation > 0)
+            m_Buffer.Resize(m_FrameSize * m_FrameCount);
+        else
+            m_Buffer.Init(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                          m_FrameSize * m_FrameCount, nullptr);
+
+        // Stays mapped for the lifetime of the buffer
+        m_Buffer.Map();
+        m_Generation++;
+    }
+
+    void VulkanUniformRing::BeginFrame(uint32_t frame)
+    {
+        // Growing replaces the buffer, only safe between frames. Whatever did not fit last frame
+        // was written to the descriptor sets' own buffers instead.
+        if(m_Overflowed)
+        {
+            m_Overflowed = false;
+            m_FrameSize *= 2;
+            CreateBuffer();
+            LOG_FORMAT("Uniform ring grown to %u bytes per frame", m_FrameSize);
+        }
+
+        m_Frame = frame % m_FrameCount;
+        m_Head.store(0, std::memory_order_relaxed);
+        m_FrameNumber++;
+    }
+
+    void VulkanUniformRing::Flush()
+    {
+        // No-op on coherent memory
+        uint32_t used = GetUsedSize();
+        if(used > 0)
+            m_Buffer.Flush(used, (VkDeviceSize)m_Frame * m_FrameSize);
+    }
+
+    uint32_t VulkanUniformRing::Allocate(uint32_t size)
+    {
+        const uint32_t alignedSize = (size + m_Alignment - 1) & ~(m_Alignment - 1);
+        const uint32_t offset      = m_Head.fetch_add(alignedSize, std::memory_order_relaxed);
+
+        if(offset + alignedSize > m_FrameSize)
+        {
+            if(!m_Overflowed.exchange(true))
+                LOG_FORMAT("Uniform ring full at %u bytes per frame, falling back to per set buffers until it grows", m_FrameSize);
+            return UINT32_MAX;
+        }
+
+        return m_Frame * m_FrameSize + offset;
+    }
+
+    uint32_t VulkanUniformRing::Write(const void* data, uint32_t size)
+    {
+        uint32_t offset = Allocate(size);
+        if(offset != UINT32_MAX)
+            memcpy(m_Buffer.GetMapped() + offset, data, size);
+        return offset;
+    }
+
+} // NekoEngine
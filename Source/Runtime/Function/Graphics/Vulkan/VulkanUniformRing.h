@@ -0,0 +1,57 @@
+#pragma once
+#include "VulkanBuffer.h"
+#include "Math/Maths.h"
+#include <atomic>
+
+namespace NekoEngine
+{
+    // One persistently mapped uniform buffer split into a region per frame in flight. Each frame's
+    // constants are written front to back into its region and bound with dynamic offsets, so there is
+    // no buffer per descriptor set and no map/unmap per update. A region is reset when its frame begins,
+    // after the swap chain has waited for the GPU to finish with it.
+    class VulkanUniformRing
+    {
+    public:
+        VulkanUniformRing(uint32_t frameCount, uint32_t frameSize);
+        ~VulkanUniformRing();
+
+        void BeginFrame(uint32_t frame);
+        void Flush();
+
+        // Thread safe. Returns the absolute offset to bind, or UINT32_MAX when this frame's region is full.
+        // A full region is logged once and doubled at the next BeginFrame.
+        uint32_t Allocate(uint32_t size);
+        uint32_t Write(const void* data, uint32_t size);
+
+        VkBuffer GetBuffer() const { return m_Buffer.GetBuffer(); }
+
+        // Changes when the buffer is recreated, descriptor sets pointing at it must be rewritten
+        uint32_t GetGeneration() const { return m_Generation; }
+
+        // Increases every frame, used to tell whether a sub-allocation belongs to the current frame
+        uint64_t GetFrameNumber() const { return m_FrameNumber; }
+
+        uint32_t GetUsedSize() const { return Maths::Min(m_Head.load(std::memory_order_relaxed), m_FrameSize); }
+        uint32_t GetFrameSize() const { return m_FrameSize; }
+
+    private:
+        void CreateBuffer();
+
+        struct RingBuffer : public VulkanBuffer
+        {
+            uint8_t* GetMapped() const { return static_cast<uint8_t*>(mapped); }
+        };
+
+        RingBuffer m_Buffer;
+        uint32_t m_FrameCount;
+        uint32_t m_FrameSize;
+        uint32_t m_Alignment;
+        uint32_t m_Frame       = 0;
+        uint32_t m_Generation  = 0;
+        uint64_t m_FrameNumber = 0;
+
+        std::atomic<uint32_t> m_Head{0}; // Relative to the start of the current frame's region
+        std::atomic<bool> m_Overflowed{false};
+    };
+
+} // NekoEngine
@@ -0,0 +1,387 @@
+#include "VulkanUploadManager.h"
+#include "VulkanContext.h"
+#include "VulkanDevice.h"
+
+namespace NekoEngine
+{
+    namespace
+    {
+        void DestinationAccessForLayout(VkImageLayout layout, VkAccessFlags& access, VkPipelineStageFlags& stage)
+        {
+            if(layout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+            {
+                access = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+                stage  = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            }
+            else
+            {
+                access = VK_ACCESS_SHADER_READ_BIT;
+                stage  = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+            }
+        }
+
+        // bufferOffset of an image copy has to be a multiple of both the texel size and four
+        uint32_t CopyAlignment(uint32_t texelSize)
+        {
+            if(texelSize % 4 == 0)
+                return texelSize;
+            return texelSize % 2 == 0 ? texelSize * 2 : texelSize * 4;
+        }
+    }
+
+    VulkanUploadManager::VulkanUploadManager(uint32_t ringSize)
+        : m_RingSize(ringSize)
+    {
+        auto device         = gVulkanContext.GetDevice();
+        auto physicalDevice = device->GetPhysicalDevice();
+
+        m_GraphicsFamily    = (uint32_t)physicalDevice->GetGraphicsFamilyIndex();
+        m_TransferFamily    = (uint32_t)physicalDevice->GetTransferFamilyIndex();
+        m_DedicatedTransfer = m_TransferFamily != m_GraphicsFamily;
+        m_GraphicsQueue     = device->GetGraphicsQueue();
+        m_TransferQueue     = m_DedicatedTransfer ? device->GetTransferQueue() : m_GraphicsQueue;
+
+        VkCommandPoolCreateInfo poolInfo = {};
+        poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = m_GraphicsFamily;
+        VK_CHECK_RESULT(vkCreateCommandPool(GET_DEVICE(), &poolInfo, nullptr, &m_GraphicsPool), "Failed to create upload command pool!");
+
+        if(m_DedicatedTransfer)
+        {
+            poolInfo.queueFamilyIndex = m_TransferFamily;
+            VK_CHECK_RESULT(vkCreateCommandPool(GET_DEVICE(), &poolInfo, nullptr, &m_TransferPool), "Failed to create upload command pool!");
+        }
+
+        m_Ring.Init(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                    ringSize, nullptr);
+
+        // Stays mapped for the lifetime of the manager
+        m_Ring.Map();
+
+        LOG_FORMAT("Upload manager created, %s", m_DedicatedTransfer ? "dedicated transfer queue" : "graphics queue only");
+    }
+
+    VulkanUploadManager::~VulkanUploadManager()
+    {
+        WaitIdle();
+
+        for(Batch* batch: m_Batches)
+        {
+            if(batch->transferDone)
+                vkDestroySemaphore(GET_DEVICE(), batch->transferDone, nullptr);
+            vkDestroyFence(GET_DEVICE(), batch->fence, nullptr);
+            delete batch;
+        }
+
+        if(m_TransferPool)
+            vkDestroyCommandPool(GET_DEVICE(), m_TransferPool, nullptr);
+        vkDestroyCommandPool(GET_DEVICE(), m_GraphicsPool, nullptr);
+
+        m_Ring.Unmap();
+        m_Ring.FreeResources();
+    }
+
+    VulkanUploadManager::Batch& VulkanUploadManager::GetOpenBatch()
+    {
+        if(m_Open)
+            return *m_Open;
+
+        Batch* batch = nullptr;
+        if(!m_Free.empty())
+        {
+            batch = m_Free.back();
+            m_Free.pop_back();
+        }
+        else
+        {
+            batch = m_Batches.emplace_back(new Batch());
+
+            VkCommandBufferAllocateInfo allocInfo = {};
+            allocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandBufferCount = 1;
+            allocInfo.commandPool        = m_GraphicsPool;
+            VK_CHECK_RESULT(vkAllocateCommandBuffers(GET_DEVICE(), &allocInfo, &batch->graphicsCommands), "Failed to allocate upload command buffer!");
+
+            if(m_DedicatedTransfer)
+            {
+                allocInfo.commandPool = m_TransferPool;
+                VK_CHECK_RESULT(vkAllocateCommandBuffers(GET_DEVICE(), &allocInfo, &batch->transferCommands), "Failed to allocate upload command buffer!");
+
+                VkSemaphoreCreateInfo semaphoreInfo = {};
+                semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+                VK_CHECK_RESULT(vkCreateSemaphore(GET_DEVICE(), &semaphoreInfo, nullptr, &batch->transferDone), "Failed to create upload semaphore!");
+            }
+
+            VkFenceCreateInfo fenceInfo = {};
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            VK_CHECK_RESULT(vkCreateFence(GET_DEVICE(), &fenceInfo, nullptr, &batch->fence), "Failed to create upload fence!");
+        }
+
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        VK_CHECK_RESULT(vkBeginCommandBuffer(batch->graphicsCommands, &beginInfo), "Failed to begin upload command buffer!");
+        if(batch->transferCommands)
+            VK_CHECK_RESULT(vkBeginCommandBuffer(batch->transferCommands, &beginInfo), "Failed to begin upload command buffer!");
+
+        batch->hasTransferWork = false;
+        m_Open = batch;
+        return *batch;
+    }
+
+    VkBuffer VulkanUploadManager::Stage(const void* data, uint32_t size, uint32_t alignment, VkDeviceSize &offset)
+    {
+        if(size <= m_RingSize)
+        {
+            for(int attempt = 0; attempt < 2; attempt++)
+            {
+                uint64_t position = m_Head;
+                uint64_t physical = position % m_RingSize;
+                uint64_t aligned  = (physical + alignment - 1) / alignment * alignment;
+
+                // Never split an upload across the end of the ring, skip to the start instead
+                if(aligned + size > m_RingSize)
+                {
+                    position += m_RingSize - physical;
+                    aligned = 0;
+                }
+                else
+                {
+                    position += aligned - physical;
+                }
+
+                if(position + size - m_Tail <= m_RingSize)
+                {
+                    m_Head = position + size;
+                    memcpy(m_Ring.GetMapped() + aligned, data, size);
+                    offset = aligned;
+                    return m_Ring.GetBuffer();
+                }
+
+                Retire();
+            }
+        }
+
+        // The ring is full of uploads still in flight, give this one its own staging buffer rather than wait
+        auto buffer = new VulkanBuffer(VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, size, data);
+        GetOpenBatch().dedicatedBuffers.push_back(buffer);
+        offset = 0;
+        return buffer->GetBuffer();
+    }
+
+    void VulkanUploadManager::UploadBuffer(VkBuffer buffer, VkDeviceSize offset, const void* data, uint32_t size,
+                                           VkAccessFlags dstAccess, VkPipelineStageFlags dstStage, bool inUse)
+    {
+        if(size == 0)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Batch& batch = GetOpenBatch();
+
+        VkDeviceSize stagingOffset = 0;
+        VkBuffer staging = Stage(data, size, 4, stagingOffset);
+
+        VkBufferCopy copy = {};
+        copy.srcOffset = stagingOffset;
+        copy.dstOffset = offset;
+        copy.size      = size;
+
+        VkBufferMemoryBarrier barrier = {};
+        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.buffer              = buffer;
+        barrier.offset              = offset;
+        barrier.size                = size;
+        barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+
+        if(inUse || !m_DedicatedTransfer)
+        {
+            // Earlier frames may still be reading the old contents
+            if(inUse)
+                vkCmdPipelineBarrier(batch.graphicsCommands, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                     0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+            vkCmdCopyBuffer(batch.graphicsCommands, staging, buffer, 1, &copy);
+
+            barrier.dstAccessMask = dstAccess;
+            vkCmdPipelineBarrier(batch.graphicsCommands, VK_PIPELINE_STAGE_TRANSFER_BIT, dstStage, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+            return;
+        }
+
+        vkCmdCopyBuffer(batch.transferCommands, staging, buffer, 1, &copy);
+
+        // Release from the transfer family, then acquire on the graphics queue once the batch's semaphore is signalled
+        barrier.dstAccessMask       = 0;
+        barrier.srcQueueFamilyIndex = m_TransferFamily;
+        barrier.dstQueueFamilyIndex = m_GraphicsFamily;
+        vkCmdPipelineBarrier(batch.transferCommands, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                             0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = dstAccess;
+        vkCmdPipelineBarrier(batch.graphicsCommands, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, dstStage, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+        batch.hasTransferWork = true;
+    }
+
+    void VulkanUploadManager::UploadImage(VkImage image, const void* data, uint32_t size, const VkBufferImageCopy* regions,
+                                          uint32_t regionCount, const VkImageSubresourceRange &range, uint32_t texelSize,
+                                          VkImageLayout oldLayout, VkImageLayout finalLayout)
+    {
+        if(size == 0 || regionCount == 0)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Batch& batch = GetOpenBatch();
+
+        VkDeviceSize stagingOffset = 0;
+        VkBuffer staging = Stage(data, size, CopyAlignment(Maths::Max(texelSize, 1u)), stagingOffset);
+
+        ArrayList<VkBufferImageCopy> copies(regions, regions + regionCount);
+        for(auto &copy: copies)
+            copy.bufferOffset += stagingOffset;
+
+        const bool discard = oldLayout == VK_IMAGE_LAYOUT_UNDEFINED;
+        const bool transferQueue = discard && m_DedicatedTransfer;
+        VkCommandBuffer copyCommands = transferQueue ? batch.transferCommands : batch.graphicsCommands;
+
+        VkImageMemoryBarrier barrier = {};
+        barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.image               = image;
+        barrier.subresourceRange    = range;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.oldLayout           = oldLayout;
+        barrier.newLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcAccessMask       = discard ? 0 : VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(copyCommands, discard ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        vkCmdCopyBufferToImage(copyCommands, staging, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, regionCount, copies.data());
+
+        VkAccessFlags dstAccess;
+        VkPipelineStageFlags dstStage;
+        DestinationAccessForLayout(finalLayout, dstAccess, dstStage);
+
+        barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout     = finalLayout;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        if(!transferQueue)
+        {
+            barrier.dstAccessMask = dstAccess;
+            vkCmdPipelineBarrier(copyCommands, VK_PIPELINE_STAGE_TRANSFER_BIT, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+            return;
+        }
+
+        // Release and acquire carry the same layout transition, it happens once between the two
+        barrier.dstAccessMask       = 0;
+        barrier.srcQueueFamilyIndex = m_TransferFamily;
+        barrier.dstQueueFamilyIndex = m_GraphicsFamily;
+        vkCmdPipelineBarrier(batch.transferCommands, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = dstAccess;
+        vkCmdPipelineBarrier(batch.graphicsCommands, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        batch.hasTransferWork = true;
+    }
+
+    void VulkanUploadManager::RecordGraphics(const std::function<void(VkCommandBuffer)> &record)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        record(GetOpenBatch().graphicsCommands);
+    }
+
+    void VulkanUploadManager::Flush()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Retire();
+        SubmitOpenBatch();
+    }
+
+    void VulkanUploadManager::SubmitOpenBatch()
+    {
+        if(!m_Open)
+            return;
+
+        Batch& batch = *m_Open;
+        m_Open = nullptr;
+        batch.ringEnd = m_Head;
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+
+        if(batch.transferCommands)
+        {
+            VK_CHECK_RESULT(vkEndCommandBuffer(batch.transferCommands), "Failed to record upload command buffer!");
+
+            if(batch.hasTransferWork)
+            {
+                submitInfo.pCommandBuffers      = &batch.transferCommands;
+                submitInfo.signalSemaphoreCount = 1;
+                submitInfo.pSignalSemaphores    = &batch.transferDone;
+                VK_CHECK_RESULT(vkQueueSubmit(m_TransferQueue, 1, &submitInfo, VK_NULL_HANDLE), "Failed to submit uploads!");
+            }
+        }
+
+        VK_CHECK_RESULT(vkEndCommandBuffer(batch.graphicsCommands), "Failed to record upload command buffer!");
+
+        // The acquire barriers wait for the copies on the GPU, the CPU carries on
+        const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        submitInfo.pCommandBuffers      = &batch.graphicsCommands;
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores    = nullptr;
+        submitInfo.waitSemaphoreCount   = batch.hasTransferWork ? 1 : 0;
+        submitInfo.pWaitSemaphores      = &batch.transferDone;
+        submitInfo.pWaitDstStageMask    = &waitStage;
+        VK_CHECK_RESULT(vkQueueSubmit(m_GraphicsQueue, 1, &submitInfo, batch.fence), "Failed to submit uploads!");
+
+        m_InFlight.push_back(&batch);
+    }
+
+    void VulkanUploadManager::Retire()
+    {
+        // Batches finish in submission order, stop at the first one still running
+        while(!m_InFlight.empty())
+        {
+            Batch* batch = m_InFlight.front();
+            if(vkGetFenceStatus(GET_DEVICE(), batch->fence) != VK_SUCCESS)
+                break;
+
+            VK_CHECK_RESULT(vkResetFences(GET_DEVICE(), 1, &batch->fence), "Failed to reset upload fence!");
+            m_Tail = batch->ringEnd;
+
+            for(auto buffer: batch->dedicatedBuffers)
+            {
+                buffer->FreeResources();
+                delete buffer;
+            }
+            batch->dedicatedBuffers.clear();
+
+            m_InFlight.pop_front();
+            m_Free.push_back(batch);
+        }
+    }
+
+    void VulkanUploadManager::WaitIdle()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        SubmitOpenBatch();
+
+        for(Batch* batch: m_InFlight)
+            vkWaitForFences(GET_DEVICE(), 1, &batch->fence, VK_TRUE, UINT64_MAX);
+
+        Retire();
+    }
+
+} // NekoEngine
@@ -0,0 +1,87 @@
+#pragma once
+#include "VulkanBuffer.h"
+#include "Math/Maths.h"
+#include <mutex>
+#include <deque>
+
+namespace NekoEngine
+{
+    // Streams texture and buffer data to the GPU without stalling the render thread. Source data is copied
+    // into one persistently mapped staging ring and every copy requested during a frame is submitted as a
+    // single batch, on the dedicated transfer queue when the device has one. Resources are handed over to
+    // the graphics queue with queue family ownership barriers, and a fence per batch tells the ring when
+    // its staging space can be reused. Nothing here waits on the GPU except WaitIdle at shutdown.
+    class VulkanUploadManager
+    {
+    public:
+        explicit VulkanUploadManager(uint32_t ringSize);
+        ~VulkanUploadManager();
+
+        // inUse means the GPU may still read the buffer, the copy then runs on the graphics queue behind that work
+        void UploadBuffer(VkBuffer buffer, VkDeviceSize offset, const void* data, uint32_t size,
+                          VkAccessFlags dstAccess, VkPipelineStageFlags dstStage, bool inUse = false);
+
+        // Region buffer offsets are relative to data. Uploads to an image with oldLayout UNDEFINED discard its
+        // contents and may run on the transfer queue, anything else is ordered behind earlier graphics work.
+        // The image is in finalLayout for every graphics submission after the next Flush.
+        void UploadImage(VkImage image, const void* data, uint32_t size, const VkBufferImageCopy* regions,
+                         uint32_t regionCount, const VkImageSubresourceRange& range, uint32_t texelSize,
+                         VkImageLayout oldLayout, VkImageLayout finalLayout);
+
+        // Records graphics queue work that has to follow the copies of the current batch, mip generation for example
+        void RecordGraphics(const std::function<void(VkCommandBuffer)>& record);
+
+        // Submits the open batch. Called before every graphics submission that may use uploaded resources.
+        void Flush();
+        void WaitIdle();
+
+        uint32_t GetBatchesInFlight() const { return (uint32_t)m_InFlight.size(); }
+        uint64_t GetRingUsed() const { return m_Head - m_Tail; }
+        bool HasTransferQueue() const { return m_DedicatedTransfer; }
+
+    private:
+        struct Batch
+        {
+            VkCommandBuffer transferCommands = VK_NULL_HANDLE;
+            VkCommandBuffer graphicsCommands = VK_NULL_HANDLE;
+            VkSemaphore transferDone         = VK_NULL_HANDLE;
+            VkFence fence                    = VK_NULL_HANDLE;
+            uint64_t ringEnd                 = 0; // Ring head after the batch's last allocation
+            bool hasTransferWork             = false;
+            ArrayList<VulkanBuffer*> dedicatedBuffers; // Uploads that did not fit in the ring
+        };
+
+        struct RingBuffer : public VulkanBuffer
+        {
+            uint8_t* GetMapped() const { return static_cast<uint8_t*>(mapped); }
+        };
+
+        Batch& GetOpenBatch();
+        void SubmitOpenBatch();
+        void Retire();
+
+        // Copies data into staging memory, returns the buffer and offset the copy reads from
+        VkBuffer Stage(const void* data, uint32_t size, uint32_t alignment, VkDeviceSize& offset);
+
+        RingBuffer m_Ring;
+        uint64_t m_RingSize;
+        uint64_t m_Head = 0; // Monotonic, the physical offset is the value modulo the ring size
+        uint64_t m_Tail = 0;
+
+        bool m_DedicatedTransfer = false;
+        uint32_t m_TransferFamily;
+        uint32_t m_GraphicsFamily;
+        VkQueue m_TransferQueue;
+        VkQueue m_GraphicsQueue;
+        VkCommandPool m_TransferPool = VK_NULL_HANDLE;
+        VkCommandPool m_GraphicsPool = VK_NULL_HANDLE;
+
+        Batch* m_Open = nullptr;
+        std::deque<Batch*> m_InFlight;
+        ArrayList<Batch*> m_Free;
+        ArrayList<Batch*> m_Batches;
+
+        std::mutex m_Mutex;
+    };
+
+} // NekoEngine
@@ -3,6 +3,8 @@
 #include "VulkanSwapChain.h"
 #include "Engine.h"
 #include "VulkanContext.h"
+#include "VulkanRenderer.h"
+#include "VulkanUploadManager.h"
 
 namespace NekoEngine
 {
@@ -114,6 +116,15 @@ namespace NekoEngine
     {
         VK_CHECK_RESULT(vkEndCommandBuffer(commandBuffer), "Failed to record command buffer!");
 
+        // Pending uploads go first, this work may touch the resources they fill
+        VulkanRenderer::GetUploadManager()->Flush();
+
+        VkFenceCreateInfo fenceInfo = {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VkFence fence;
+        VK_CHECK_RESULT(vkCreateFence(GET_DEVICE(), &fenceInfo, nullptr, &fence), "Failed to create fence!");
+
         VkSubmitInfo submitInfo;
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submitInfo.commandBufferCount = 1;
@@ -124,10 +135,13 @@ namespace NekoEngine
         submitInfo.signalSemaphoreCount = 0;
         submitInfo.waitSemaphoreCount = 0;
 
-        VK_CHECK_RESULT(vkQueueSubmit(gVulkanContext.GetDevice()->GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE),
+        VK_CHECK_RESULT(vkQueueSubmit(gVulkanContext.GetDevice()->GetGraphicsQueue(), 1, &submitInfo, fence),
                         "Failed to submit queue!");
-        VK_CHECK_RESULT(vkQueueWaitIdle(gVulkanContext.GetDevice()->GetGraphicsQueue()),
+
+        // Waits for this submission and the ones before it, not for the whole queue to drain
+        VK_CHECK_RESULT(vkWaitForFences(GET_DEVICE(), 1, &fence, VK_TRUE, UINT64_MAX),
                         "Failed to wait for queue to finish!");
+        vkDestroyFence(GET_DEVICE(), fence, nullptr);
 
         vkFreeCommandBuffers(GET_DEVICE(), GET_COMMAND_POOL(), 1, &commandBuffer);
     }
@@ -367,78 +381,104 @@ namespace NekoEngine
             singleTimeCommand = true;
         }
 
-        VkImageSubresourceRange subresourceRange = {};
-        subresourceRange.aspectMask = IsDepthFormat(format) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+        ImageLayoutTransition transition;
+        transition.image      = image;
+        transition.format     = format;
+        transition.oldLayout  = oldImageLayout;
+        transition.newLayout  = newImageLayout;
+        transition.mipLevels  = mipLevels;
+        transition.layerCount = layerCount;
+        TransitionImageLayouts(&transition, 1, commandBuffer);
 
-        if(IsStencilFormat(format))
-            subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+        if(singleTimeCommand)
+            EndSingleTimeCommands(commandBuffer);
+    }
 
-        subresourceRange.baseMipLevel = 0;
-        subresourceRange.levelCount = mipLevels;
-        subresourceRange.baseArrayLayer = 0;
-        subresourceRange.layerCount = layerCount;
+    void VulkanUtility::TransitionImageLayouts(const ImageLayoutTransition* transitions, uint32_t count,
+                                               VkCommandBuffer commandBuffer)
+    {
+        static const uint32_t MaxBatchedBarriers = 32;
+        VkImageMemoryBarrier imageMemoryBarriers[MaxBatchedBarriers];
 
-        // Create an image barrier object
-        VkImageMemoryBarrier imageMemoryBarrier = ImageMemoryBarrier();
-        imageMemoryBarrier.oldLayout = oldImageLayout;
-        imageMemoryBarrier.newLayout = newImageLayout;
-        imageMemoryBarrier.image = image;
-        imageMemoryBarrier.subresourceRange = subresourceRange;
-        imageMemoryBarrier.srcAccessMask = LayoutToAccessMask(oldImageLayout, false);
-        imageMemoryBarrier.dstAccessMask = LayoutToAccessMask(newImageLayout, true);
-        imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-
-        VkPipelineStageFlags sourceStage = 0;
+        uint32_t recorded = 0;
+        while(recorded < count)
         {
-            if(imageMemoryBarrier.oldLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR)
-            {
-                sourceStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-            }
-            else if(imageMemoryBarrier.srcAccessMask != 0)
-            {
-                sourceStage = AccessFlagsToPipelineStage(imageMemoryBarrier.srcAccessMask,
-                                                         VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
-                                                         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
-                                                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
-            }
-            else
-            {
-                sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-            }
-        }
+            const uint32_t batchCount = std::min(count - recorded, MaxBatchedBarriers);
+            VkPipelineStageFlags sourceStage = 0;
+            VkPipelineStageFlags destinationStage = 0;
 
-        VkPipelineStageFlags destinationStage = 0;
-        {
-            if(imageMemoryBarrier.newLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR)
+            for(uint32_t i = 0; i < batchCount; i++)
             {
-                destinationStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-            }
-            else if(imageMemoryBarrier.dstAccessMask != 0)
-            {
-                destinationStage = AccessFlagsToPipelineStage(imageMemoryBarrier.dstAccessMask,
+                const ImageLayoutTransition &transition = transitions[recorded + i];
+
+                VkImageSubresourceRange subresourceRange = {};
+                subresourceRange.aspectMask = IsDepthFormat(transition.format) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+
+                if(IsStencilFormat(transition.format))
+                    subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+
+                subresourceRange.baseMipLevel = 0;
+                subresourceRange.levelCount = transition.mipLevels;
+                subresourceRange.baseArrayLayer = 0;
+                subresourceRange.layerCount = transition.layerCount;
+
+                // Create an image barrier object
+                VkImageMemoryBarrier &imageMemoryBarrier = imageMemoryBarriers[i];
+                imageMemoryBarrier = ImageMemoryBarrier();
+                imageMemoryBarrier.oldLayout = transition.oldLayout;
+                imageMemoryBarrier.newLayout = transition.newLayout;
+                imageMemoryBarrier.image = transition.image;
+                imageMemoryBarrier.subresourceRange = subresourceRange;
+                imageMemoryBarrier.srcAccessMask = LayoutToAccessMask(transition.oldLayout, false);
+                imageMemoryBarrier.dstAccessMask = LayoutToAccessMask(transition.newLayout, true);
+                imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+
+                if(imageMemoryBarrier.oldLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR)
+                {
+                    sourceStage |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+                }
+                else if(imageMemoryBarrier.srcAccessMask != 0)
+                {
+                    sourceStage |= AccessFlagsToPipelineStage(imageMemoryBarrier.srcAccessMask,
                                                               VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
                                                               VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
                                                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
-            }
-            else
-            {
-                destinationStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-            }
-        }
+                }
+                else
+                {
+                    sourceStage |= VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+                }
 
-        // Put barrier inside setup command buffer
-        vkCmdPipelineBarrier(
-                commandBuffer,
-                sourceStage,
-                destinationStage,
-                0,
-                0, nullptr,
-                0, nullptr,
-                1, &imageMemoryBarrier);
+                if(imageMemoryBarrier.newLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR)
+                {
+                    destinationStage |= VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+                }
+                else if(imageMemoryBarrier.dstAccessMask != 0)
+                {
+                    destinationStage |= AccessFlagsToPipelineStage(imageMemoryBarrier.dstAccessMask,
+                                                                   VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                                                                   VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+                                                                   VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+                }
+                else
+                {
+                    destinationStage |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+                }
+            }
 
-        if(singleTimeCommand)
-            EndSingleTimeCommands(commandBuffer);
+            // One barrier for the whole batch, waiting on the union of the source stages
+            vkCmdPipelineBarrier(
+                    commandBuffer,
+                    sourceStage,
+                    destinationStage,
+                    0,
+                    0, nullptr,
+                    0, nullptr,
+                    batchCount, imageMemoryBarriers);
+
+            recorded += batchCount;
+        }
     }
 
     VkFormat VulkanUtility::FindSupportedFormat(const std::vector<VkFormat> &candidates, VkImageTiling tiling,
@@ -561,6 +601,8 @@ namespace NekoEngine
                 return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
             case DescriptorType::IMAGE_STORAGE:
                 return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            case DescriptorType::STORAGE_BUFFER:
+                return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
         }
 
         LOG("Unsupported Descriptor Type");
@@ -636,6 +678,18 @@ namespace NekoEngine
                     return VK_FORMAT_R32G32B32_SFLOAT;
                 case RHIFormat::R32G32B32A32_Float:
                     return VK_FORMAT_R32G32B32A32_SFLOAT;
+                case RHIFormat::BC1_Unorm:
+                    return VK_FORMAT_BC1_RGB_SRGB_BLOCK;
+                case RHIFormat::BC3_Unorm:
+                    return VK_FORMAT_BC3_SRGB_BLOCK;
+                case RHIFormat::BC4_Unorm:
+                    return VK_FORMAT_BC4_UNORM_BLOCK;
+                case RHIFormat::BC5_Unorm:
+                    return VK_FORMAT_BC5_UNORM_BLOCK;
+                case RHIFormat::BC6H_UFloat:
+                    return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+                case RHIFormat::BC7_Unorm:
+                    return VK_FORMAT_BC7_SRGB_BLOCK;
                 default:
                     LOG("[Texture] Unsupported image bit-depth!");
                     return VK_FORMAT_R8G8B8A8_SRGB;
@@ -681,6 +735,20 @@ namespace NekoEngine
                     return VK_FORMAT_D24_UNORM_S8_UINT;
                 case RHIFormat::D32_Float_S8_UInt:
                     return VK_FORMAT_D32_SFLOAT_S8_UINT;
+                case RHIFormat::BC1_Unorm:
+                    return VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+                case RHIFormat::BC3_Unorm:
+                    return VK_FORMAT_BC3_UNORM_BLOCK;
+                case RHIFormat::BC4_Unorm:
+                    return VK_FORMAT_BC4_UNORM_BLOCK;
+                case RHIFormat::BC5_Unorm:
+                    return VK_FORMAT_BC5_UNORM_BLOCK;
+                case RHIFormat::BC6H_UFloat:
+                    return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+                case RHIFormat::BC7_Unorm:
+                    return VK_FORMAT_BC7_UNORM_BLOCK;
+                case RHIFormat::R16G16B16A16_Snorm:
+                    return VK_FORMAT_R16G16B16A16_SNORM;
                 default:
                     LOG("[Texture] Unsupported image bit-depth!");
                     return VK_FORMAT_R8G8B8A8_UNORM;
@@ -726,6 +794,21 @@ namespace NekoEngine
                 return RHIFormat::D24_Unorm_S8_UInt;
             case VK_FORMAT_D32_SFLOAT_S8_UINT:
                 return RHIFormat::D32_Float_S8_UInt;
+            case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+                return RHIFormat::BC1_Unorm;
+            case VK_FORMAT_BC3_UNORM_BLOCK:
+            case VK_FORMAT_BC3_SRGB_BLOCK:
+                return RHIFormat::BC3_Unorm;
+            case VK_FORMAT_BC4_UNORM_BLOCK:
+                return RHIFormat::BC4_Unorm;
+            case VK_FORMAT_BC5_UNORM_BLOCK:
+                return RHIFormat::BC5_Unorm;
+            case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+                return RHIFormat::BC6H_UFloat;
+            case VK_FORMAT_BC7_UNORM_BLOCK:
+            case VK_FORMAT_BC7_SRGB_BLOCK:
+                return RHIFormat::BC7_Unorm;
             default:
                 LOG("[Texture] Unsupported texture type!");
                 return RHIFormat::R8G8B8A8_Unorm;
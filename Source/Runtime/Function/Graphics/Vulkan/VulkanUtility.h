@@ -8,6 +8,17 @@ namespace NekoEngine
 {
     namespace VulkanUtility
     {
+        // One image of a batched layout transition
+        struct ImageLayoutTransition
+        {
+            VkImage image           = VK_NULL_HANDLE;
+            VkFormat format         = VK_FORMAT_UNDEFINED;
+            VkImageLayout oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            VkImageLayout newLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            uint32_t mipLevels      = 1;
+            uint32_t layerCount     = 1;
+        };
+
         void Init();
         void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer &buffer,
                      VkDeviceMemory &bufferMemory, VmaAllocator allocator = nullptr,
@@ -27,6 +38,10 @@ namespace NekoEngine
                                    uint32_t mipLevels = 1, uint32_t layerCount = 1,
                                    VkCommandBuffer commandBuffer = nullptr);
 
+        // Records the transitions with as few vkCmdPipelineBarrier calls as possible, each waiting on the
+        // union of the stages of its images
+        void TransitionImageLayouts(const ImageLayoutTransition* transitions, uint32_t count, VkCommandBuffer commandBuffer);
+
         uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
 
         VkFormat FindSupportedFormat(const std::vector<VkFormat> &candidates, VkImageTiling tiling,
@@ -1,6 +1,8 @@
 #include "VulkanVertexBuffer.h"
 #include "VulkanDevice.h"
 #include "VulkanCommandBuffer.h"
+#include "VulkanRenderer.h"
+#include "VulkanUploadManager.h"
 
 namespace NekoEngine
 {
@@ -10,8 +12,17 @@ namespace NekoEngine
         size = 0;
         isMapped = false;
 
-        SetUsage(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-        SetMemoryProperyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        // Static data lives in device local memory and is filled through the upload manager
+        if(bufferUsage == BufferUsage::STATIC)
+        {
+            SetUsage(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+            SetMemoryProperyFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        }
+        else
+        {
+            SetUsage(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+            SetMemoryProperyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        }
 
     }
 
@@ -45,6 +56,20 @@ namespace NekoEngine
         {
             return;
         }
+        if(bufferUsage == BufferUsage::STATIC)
+        {
+            // A freshly created buffer has no readers, so its copy can go to the transfer queue
+            const bool inUse = _size <= size;
+            if(!inUse)
+            {
+                size = _size;
+                VulkanBuffer::Resize(_size);
+            }
+
+            VulkanRenderer::GetUploadManager()->UploadBuffer(buffer, 0, data, _size, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
+                                                             VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, inUse);
+            return;
+        }
         if(_size > size)
         {
             size = _size;
@@ -58,6 +83,13 @@ namespace NekoEngine
 
     void VulkanVertexBuffer::SetDataSub(uint32_t _size, const void* data, uint32_t offset)
     {
+        if(bufferUsage == BufferUsage::STATIC && offset + _size <= size)
+        {
+            VulkanRenderer::GetUploadManager()->UploadBuffer(buffer, offset, data, _size, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
+                                                             VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, true);
+            return;
+        }
+
         //TODO: Need Check
         if(_size > size)
         {
@@ -79,6 +111,15 @@ namespace NekoEngine
         }
     }
 
+    void VulkanVertexBuffer::BindInstanceData(CommandBuffer* commandBuffer)
+    {
+        VkDeviceSize offset = 0;
+        if(commandBuffer)
+        {
+            vkCmdBindVertexBuffers(dynamic_cast<VulkanCommandBuffer*>(commandBuffer)->GetHandle(), 1, 1, &(VulkanBuffer::buffer), &offset);
+        }
+    }
+
     void VulkanVertexBuffer::Unbind()
     {
     }
@@ -16,6 +16,7 @@ namespace NekoEngine
         void ReleasePointer() override;
 
         void Bind(CommandBuffer* commandBuffer, Pipeline* pipeline) override;
+        void BindInstanceData(CommandBuffer* commandBuffer) override;
         void Unbind() override;
 
         uint32_t GetSize() override { return size; }
@@ -0,0 +1,50 @@
+#include "NullWindow.h"
+#include "Null/NullContext.h"
+#include "Null/NullSwapChain.h"
+
+namespace NekoEngine
+{
+    NullWindow::NullWindow(const Window::CreateInfo& createInfo)
+    {
+        isInit    = false;
+        isResized = true;
+
+        Init(createInfo);
+
+        gNullContext.Init();
+        graphicsContext = &gNullContext;
+        swapChain = MakeShared<NullSwapChain>(width, height);
+        swapChain->Init(isVSync, this);
+    }
+
+    bool NullWindow::Init(const Window::CreateInfo& properties)
+    {
+        LOG("Initializing null window");
+
+        width        = properties.width;
+        height       = properties.height;
+        isVSync      = properties.isVSync;
+        isFullscreen = properties.isFullscreen;
+        isBorderless = properties.isBorderless;
+        title        = properties.title;
+
+        windowData.Title    = title;
+        windowData.Width    = width;
+        windowData.Height   = height;
+        windowData.VSync    = isVSync;
+        windowData.Exit     = false;
+        windowData.DPIScale = 1.0f;
+
+        instance = this;
+        isInit   = true;
+        return true;
+    }
+
+    void NullWindow::SetVSync(bool vsync)
+    {
+        isVSync = vsync;
+        if(swapChain)
+            swapChain->SetVSync(vsync);
+    }
+
+} // NekoEngine
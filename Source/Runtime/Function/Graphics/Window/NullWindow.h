@@ -0,0 +1,29 @@
+#pragma once
+#include "Window.h"
+
+namespace NekoEngine
+{
+    // Window for RENDER_API::NONE, has a size and a swap chain but nothing on screen and no input
+    class NullWindow final : public Window
+    {
+    private:
+        bool shouldExit = false;
+
+    public:
+        explicit NullWindow(const CreateInfo& properties);
+        ~NullWindow() override = default;
+
+        bool Init(const CreateInfo& properties) override;
+        bool ShouldExit() override { return shouldExit; }
+        void ToggleVSync() override { SetVSync(!isVSync); }
+        void SetVSync(bool vsync) override;
+        void SetTitle(const String& _title) override { title = _title; }
+        void OnUpdate() override {}
+        void SetMousePosition(const FVector2 pos) override {}
+        void ProcessInput() override {}
+        void Maximise() override {}
+
+        void Close() { shouldExit = true; }
+    };
+
+} // NekoEngine
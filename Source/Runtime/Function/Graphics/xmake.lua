@@ -3,4 +3,4 @@
 target("Graphics")
     set_kind("static")
     add_deps("Core")
-    add_files("/Window/*.cpp", "/RHI/*.cpp", "/Vulkan/*.cpp", "/Renderable/*.cpp", "/Renderer/*.cpp")
+    add_files("/Window/*.cpp", "/RHI/*.cpp", "/Vulkan/*.cpp", "/Null/*.cpp", "/Renderable/*.cpp", "/Renderer/*.cpp")
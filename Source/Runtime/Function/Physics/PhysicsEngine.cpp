@@ -7,6 +7,7 @@
 #include "Engine.h"
 #include "Integration.h"
 #include "Timer/TimeStep.h"
+#include "JobSystem/ParallelEach.h"
 
 namespace NekoEngine
 {
@@ -130,6 +131,14 @@ namespace NekoEngine
         }
     }
 
+    void PhysicsEngine::DeclareAccess(SystemAccess& access)
+    {
+        // Axis constraints look their target up in the UUID index, which only reads it
+        access.Read<Transform, IDComponent, SpringConstraintComponent, DistanceConstraintComponent, WeldConstraintComponent>();
+        access.Write<RigidBody3DComponent, AxisConstraintComponent>();
+        access.Group<RigidBody3DComponent>(entt::get<Transform>);
+    }
+
     void PhysicsEngine::UpdatePhysics()
     {
         m_Manifolds.clear();
@@ -164,7 +173,7 @@ namespace NekoEngine
         auto &registry = scene->GetRegistry();
         auto group = registry.group<RigidBody3DComponent>(entt::get<Transform>);
 
-        for(auto entity: group)
+        ParallelEach(group, 256, [&group](entt::entity entity)
         {
             const auto &[phys, trans] = group.get<RigidBody3DComponent, Transform>(entity);
 
@@ -173,7 +182,7 @@ namespace NekoEngine
                 trans.SetLocalPosition(phys.GetRigidBody()->GetPosition());
                 trans.SetLocalOrientation(phys.GetRigidBody()->GetOrientation());
             }
-        };
+        });
     }
 
     glm::quat QuatMulVec3(const glm::quat &quat, const glm::vec3 &b)
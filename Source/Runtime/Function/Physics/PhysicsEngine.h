@@ -86,6 +86,7 @@ namespace NekoEngine
         void OnInit() override {};
         // Update Physics Engine
         void OnUpdate(const TimeStep& timeStep, Level* level) override;
+        void DeclareAccess(SystemAccess& access) override;
 
         void SyncTransforms(Level* level);
 
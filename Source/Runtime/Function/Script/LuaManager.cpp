@@ -213,6 +213,7 @@ namespace NekoEngine
 
         float dt = (float)gEngine->GetTimeStep()->GetSeconds();
 
+        // Serial on purpose: every script runs in the one shared lua_State, which can't be entered from two threads
         for(auto entity : view)
         {
             auto& luaScript = registry.get<LuaScriptComponent>(entity);
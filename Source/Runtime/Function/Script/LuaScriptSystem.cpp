@@ -0,0 +1,24 @@
+#include "LuaScriptSystem.h"
+#include "LuaManager.h"
+
+namespace NekoEngine
+{
+    LuaScriptSystem::LuaScriptSystem(LuaManager* luaManager)
+            : m_LuaManager(luaManager)
+    {
+        m_DebugName = "LuaScripts";
+    }
+
+    void LuaScriptSystem::OnUpdate(const TimeStep& timeStep, Level* level)
+    {
+        m_LuaManager->OnUpdate(level);
+    }
+
+    void LuaScriptSystem::DeclareAccess(SystemAccess& access)
+    {
+        // Scripts share one lua_State and reach the whole registry through the ECS bindings,
+        // creating entities and adding components included
+        access.MainThread().Exclusive();
+    }
+
+} // NekoEngine
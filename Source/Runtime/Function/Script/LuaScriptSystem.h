@@ -0,0 +1,26 @@
+#pragma once
+
+#include "System/ISystem.h"
+
+namespace NekoEngine
+{
+    class LuaManager;
+
+    // Runs LuaScriptComponent updates as part of the SystemManager's schedule.
+    // The LuaManager stays owned by the engine, this only forwards the update.
+    class LuaScriptSystem : public ISystem
+    {
+    public:
+        explicit LuaScriptSystem(LuaManager* luaManager);
+
+        void OnInit() override {}
+        void OnUpdate(const TimeStep& timeStep, Level* level) override;
+        void OnImGui() override {}
+        void OnDebugDraw() override {}
+        void DeclareAccess(SystemAccess& access) override;
+
+    private:
+        LuaManager* m_LuaManager = nullptr;
+    };
+
+} // NekoEngine
@@ -93,25 +93,143 @@ namespace NekoEngine
         return result ? buffer : nullptr;
     }
 
+    bool FileSystem::ReadFile(const std::string &path, ArrayList<uint8_t> &outData)
+    {
+        outData.clear();
+
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        if(!stream)
+            return false;
+
+        const std::streamoff size = stream.tellg();
+        if(size < 0)
+            return false;
+
+        outData.resize(static_cast<size_t>(size));
+        stream.seekg(0, std::ios::beg);
+        if(!stream.read(reinterpret_cast<char*>(outData.data()), size))
+        {
+            outData.clear();
+            return false;
+        }
+
+        return true;
+    }
+
     std::string FileSystem::ReadTextFile(const std::string &path)
     {
         if(!FileExists(path))
             return std::string();
 
-        std::ifstream stream(path);
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        const std::streamoff size = stream.tellg();
+        if(size < 0)
+            return std::string();
 
+        // Read the whole file in one go instead of line by line
         std::string fileContent;
-        std::string line;
-        while(std::getline(stream, line))
-        {                               // Read file line by line
-            fileContent += line + "\n"; // Append each line to fileContent
-        }
+        fileContent.resize(static_cast<size_t>(size));
+        stream.seekg(0, std::ios::beg);
+        stream.read(&fileContent[0], size);
+        fileContent.resize(static_cast<size_t>(stream.gcount()));
 
         stream.close();
 
+        // Same result as reading line by line in text mode, CRLF becomes LF and the last line ends with one
+        size_t length = 0;
+        for(size_t i = 0; i < fileContent.size(); i++)
+        {
+            if(fileContent[i] == '\r' && i + 1 < fileContent.size() && fileContent[i + 1] == '\n')
+                continue;
+            fileContent[length++] = fileContent[i];
+        }
+        fileContent.resize(length);
+
+        if(!fileContent.empty() && fileContent.back() != '\n')
+            fileContent += '\n';
+
         return fileContent;
     }
 
+#if defined(_WIN32)
+    bool FileSystem::MapFile(const std::string &path, MappedFile &outFile)
+    {
+        const HANDLE file = CreateFileW(StringToWString(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if(file == INVALID_HANDLE_VALUE)
+            return false;
+
+        const int64_t size = GetFileSizeInternal(file);
+        if(size <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(mapping == NULL)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if(view == nullptr)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        outFile.data          = static_cast<const uint8_t*>(view);
+        outFile.size          = size;
+        outFile.fileHandle    = file;
+        outFile.mappingHandle = mapping;
+        return true;
+    }
+
+    void FileSystem::UnmapFile(MappedFile &file)
+    {
+        if(file.data)
+            UnmapViewOfFile(file.data);
+        if(file.mappingHandle)
+            CloseHandle(file.mappingHandle);
+        if(file.fileHandle)
+            CloseHandle(file.fileHandle);
+
+        file = MappedFile();
+    }
+#else
+    // No mapping here, the whole file is read into a heap buffer that UnmapFile frees
+    bool FileSystem::MapFile(const std::string &path, MappedFile &outFile)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if(!file)
+            return false;
+
+        const int64_t size = (int64_t)file.tellg();
+        if(size <= 0)
+            return false;
+
+        uint8_t* buffer = new uint8_t[size];
+        file.seekg(0, std::ios::beg);
+        if(!file.read(reinterpret_cast<char*>(buffer), size))
+        {
+            delete[] buffer;
+            return false;
+        }
+
+        outFile.data = buffer;
+        outFile.size = size;
+        return true;
+    }
+
+    void FileSystem::UnmapFile(MappedFile &file)
+    {
+        delete[] file.data;
+        file = MappedFile();
+    }
+#endif
+
     bool FileSystem::WriteFile(const std::string &path, uint8_t* buffer, uint32_t size)
     {
         std::ofstream stream(path, std::ios::binary | std::ios::trunc);
@@ -10,6 +10,16 @@ namespace NekoEngine
         WRITE_READ
     };
 
+    // Read only view of a whole file mapped into the address space. Where files can't be mapped the
+    // whole file is read into memory instead and both handles stay null.
+    struct MappedFile
+    {
+        const uint8_t* data = nullptr;
+        int64_t size        = 0;
+        void* fileHandle    = nullptr;
+        void* mappingHandle = nullptr;
+    };
+
     class FileSystem
     {
     private:
@@ -19,10 +29,18 @@ namespace NekoEngine
         static bool FolderExists(const String& path);
         static int64_t GetFileSize(const String& path);
 
+        // Binary reads, the bytes come back exactly as they are on disk
         static uint8_t* ReadFile(const String& path);
         static bool ReadFile(const String& path, void* buffer, int64_t size = -1);
+        static bool ReadFile(const String& path, ArrayList<uint8_t>& outData);
+
+        // Text read, line endings are normalised to LF
         static String ReadTextFile(const String& path);
 
+        // Binary, used by the chunked level format and cooked textures to read in place
+        static bool MapFile(const String& path, MappedFile& outFile);
+        static void UnmapFile(MappedFile& file);
+
         static bool WriteFile(const String& path, uint8_t* buffer, uint32_t size);
         static bool WriteTextFile(const String& path, const String& text);
 
@@ -0,0 +1,266 @@
+#include "KTX2.h"
+#include "VirtualFileSystem.h"
+#include "StringUtility.h"
+#include <algorithm>
+#include <cstring>
+
+namespace NekoEngine
+{
+    namespace KTX2
+    {
+        static const uint8_t Identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+        // Identifier, header and index up to the level index
+        static const uint32_t HeaderSize     = 80;
+        static const uint32_t LevelIndexSize = 24;
+
+#pragma pack(push, 1)
+        struct Header
+        {
+            uint32_t vkFormat;
+            uint32_t typeSize;
+            uint32_t pixelWidth;
+            uint32_t pixelHeight;
+            uint32_t pixelDepth;
+            uint32_t layerCount;
+            uint32_t faceCount;
+            uint32_t levelCount;
+            uint32_t supercompressionScheme;
+
+            uint32_t dfdByteOffset;
+            uint32_t dfdByteLength;
+            uint32_t kvdByteOffset;
+            uint32_t kvdByteLength;
+            uint64_t sgdByteOffset;
+            uint64_t sgdByteLength;
+        };
+#pragma pack(pop)
+
+        static bool IsSRGBFormat(uint32_t vkFormat)
+        {
+            return vkFormat == FORMAT_BC1_RGB_SRGB || vkFormat == FORMAT_BC3_SRGB || vkFormat == FORMAT_BC7_SRGB;
+        }
+
+        // Basic data format descriptor, required by the container. Readers that only look at vkFormat (ours)
+        // ignore it, other tools use it to validate the file.
+        static ArrayList<uint32_t> BuildDFD(uint32_t vkFormat)
+        {
+            struct Sample
+            {
+                uint32_t bitOffset;
+                uint32_t bitLength;
+                uint32_t channel;
+                uint32_t lower;
+                uint32_t upper;
+            };
+
+            const uint32_t QualifierLinear = 0x10;
+            const uint32_t QualifierFloat  = 0x80;
+
+            uint32_t colorModel = 0;
+            ArrayList<Sample> samples;
+
+            switch(vkFormat)
+            {
+                case FORMAT_BC1_RGB_UNORM:
+                case FORMAT_BC1_RGB_SRGB:
+                    colorModel = 128;
+                    samples.push_back({0, 64, 0, 0, UINT32_MAX});
+                    break;
+                case FORMAT_BC3_UNORM:
+                case FORMAT_BC3_SRGB:
+                    colorModel = 130;
+                    samples.push_back({0, 64, 15 | (IsSRGBFormat(vkFormat) ? QualifierLinear : 0), 0, UINT32_MAX});
+                    samples.push_back({64, 64, 0, 0, UINT32_MAX});
+                    break;
+                case FORMAT_BC4_UNORM:
+                    colorModel = 131;
+                    samples.push_back({0, 64, 0, 0, UINT32_MAX});
+                    break;
+                case FORMAT_BC5_UNORM:
+                    colorModel = 132;
+                    samples.push_back({0, 64, 0, 0, UINT32_MAX});
+                    samples.push_back({64, 64, 1, 0, UINT32_MAX});
+                    break;
+                case FORMAT_BC6H_UFLOAT:
+                    colorModel = 133;
+                    samples.push_back({0, 128, QualifierFloat, 0, 0x3F800000}); // 0.0f to 1.0f
+                    break;
+                default:
+                    colorModel = 134;
+                    samples.push_back({0, 128, 0, 0, UINT32_MAX});
+                    break;
+            }
+
+            const uint32_t blockSize = 24 + 16 * static_cast<uint32_t>(samples.size());
+
+            ArrayList<uint32_t> dfd;
+            dfd.push_back(4 + blockSize);
+            dfd.push_back(0);                                    // Khronos vendor, basic descriptor type
+            dfd.push_back(2 | (blockSize << 16));                // Version 1.3
+            dfd.push_back(colorModel | (1 << 8) | ((IsSRGBFormat(vkFormat) ? 2 : 1) << 16)); // BT.709, sRGB or linear
+            dfd.push_back(3 | (3 << 8));                         // 4x4x1x1 texel block
+            dfd.push_back(GetBlockSize(vkFormat));
+            dfd.push_back(0);
+
+            for(auto& sample : samples)
+            {
+                dfd.push_back(sample.bitOffset | ((sample.bitLength - 1) << 16) | (sample.channel << 24));
+                dfd.push_back(0);
+                dfd.push_back(sample.lower);
+                dfd.push_back(sample.upper);
+            }
+
+            return dfd;
+        }
+
+        bool IsKTX2File(const String& filename)
+        {
+            return StringUtility::ToLower(StringUtility::GetFilePathExtension(filename)) == "ktx2";
+        }
+
+        uint32_t GetBlockSize(uint32_t vkFormat)
+        {
+            if(vkFormat >= 131 && vkFormat <= 146)
+                return (vkFormat <= 134 || vkFormat == 139 || vkFormat == 140) ? 8 : 16;
+            return 0;
+        }
+
+        bool Load(const String& filename, Image& outImage)
+        {
+            String physicalPath;
+            if(!VirtualFileSystem::ResolvePhysicalPath(filename, physicalPath))
+                return false;
+
+            MappedFile file;
+            if(!FileSystem::MapFile(physicalPath, file))
+                return false;
+
+            if(file.size < HeaderSize || memcmp(file.data, Identifier, sizeof(Identifier)) != 0)
+            {
+                LOG_FORMAT("[KTX2] %s is not a KTX2 file", filename.c_str());
+                FileSystem::UnmapFile(file);
+                return false;
+            }
+
+            Header header;
+            memcpy(&header, file.data + sizeof(Identifier), sizeof(Header));
+
+            const uint32_t levelCount = header.levelCount > 0 ? header.levelCount : 1;
+            const uint32_t height     = header.pixelHeight > 0 ? header.pixelHeight : 1;
+            const uint32_t blockSize  = GetBlockSize(header.vkFormat);
+
+            uint32_t maxLevelCount = 1;
+            while(maxLevelCount < 32 && (std::max(header.pixelWidth, height) >> maxLevelCount) > 0)
+                maxLevelCount++;
+
+            if(header.supercompressionScheme != 0 || header.pixelDepth > 1 || header.layerCount > 1 || header.pixelWidth == 0 ||
+               (header.faceCount != 1 && header.faceCount != 6) || blockSize == 0 || levelCount > maxLevelCount)
+            {
+                LOG_FORMAT("[KTX2] %s uses an unsupported layout or format", filename.c_str());
+                FileSystem::UnmapFile(file);
+                return false;
+            }
+
+            if(file.size < HeaderSize + levelCount * LevelIndexSize)
+            {
+                LOG_FORMAT("[KTX2] %s is truncated", filename.c_str());
+                FileSystem::UnmapFile(file);
+                return false;
+            }
+
+            outImage.levels.resize(levelCount);
+            for(uint32_t level = 0; level < levelCount; level++)
+            {
+                const uint8_t* entry = file.data + HeaderSize + level * LevelIndexSize;
+                memcpy(&outImage.levels[level].offset, entry, sizeof(uint64_t));
+                memcpy(&outImage.levels[level].size, entry + 8, sizeof(uint64_t));
+
+                const uint64_t offset = outImage.levels[level].offset;
+                const uint64_t size   = outImage.levels[level].size;
+                if(offset > static_cast<uint64_t>(file.size) || size > static_cast<uint64_t>(file.size) - offset)
+                {
+                    LOG_FORMAT("[KTX2] %s is truncated", filename.c_str());
+                    FileSystem::UnmapFile(file);
+                    outImage.levels.clear();
+                    return false;
+                }
+
+                // The upload copies whole blocks of every face, a short level would read past its data
+                const uint64_t levelWidth  = std::max(header.pixelWidth >> level, 1u);
+                const uint64_t levelHeight = std::max(height >> level, 1u);
+                const uint64_t expected    = ((levelWidth + 3) / 4) * ((levelHeight + 3) / 4) * blockSize * header.faceCount;
+                if(size < expected)
+                {
+                    LOG_FORMAT("[KTX2] %s level %u holds %llu bytes, %llu expected", filename.c_str(), level,
+                               (unsigned long long)size, (unsigned long long)expected);
+                    FileSystem::UnmapFile(file);
+                    outImage.levels.clear();
+                    return false;
+                }
+            }
+
+            outImage.vkFormat   = header.vkFormat;
+            outImage.width      = header.pixelWidth;
+            outImage.height     = height;
+            outImage.faceCount  = header.faceCount;
+            outImage.levelCount = levelCount;
+            outImage.srgb       = IsSRGBFormat(header.vkFormat);
+            outImage.file       = file;
+
+            return true;
+        }
+
+        void Free(Image& image)
+        {
+            FileSystem::UnmapFile(image.file);
+            image.levels.clear();
+        }
+
+        bool Write(const String& filename, uint32_t vkFormat, uint32_t width, uint32_t height, uint32_t faceCount,
+                   const ArrayList<ArrayList<uint8_t>>& levels)
+        {
+            const uint32_t levelCount = static_cast<uint32_t>(levels.size());
+            const uint32_t alignment  = GetBlockSize(vkFormat);
+            const ArrayList<uint32_t> dfd = BuildDFD(vkFormat);
+
+            Header header = {};
+            header.vkFormat      = vkFormat;
+            header.typeSize      = 1;
+            header.pixelWidth    = width;
+            header.pixelHeight   = height;
+            header.faceCount     = faceCount;
+            header.levelCount    = levelCount;
+            header.dfdByteOffset = HeaderSize + levelCount * LevelIndexSize;
+            header.dfdByteLength = static_cast<uint32_t>(dfd.size() * sizeof(uint32_t));
+
+            // Levels are stored smallest first, each aligned to the block size
+            ArrayList<uint64_t> offsets(levelCount);
+            uint64_t size = header.dfdByteOffset + header.dfdByteLength;
+            for(int32_t level = levelCount - 1; level >= 0; level--)
+            {
+                size = (size + alignment - 1) / alignment * alignment;
+                offsets[level] = size;
+                size += levels[level].size();
+            }
+
+            ArrayList<uint8_t> buffer(size, 0);
+            memcpy(buffer.data(), Identifier, sizeof(Identifier));
+            memcpy(buffer.data() + sizeof(Identifier), &header, sizeof(Header));
+
+            for(uint32_t level = 0; level < levelCount; level++)
+            {
+                const uint64_t length = levels[level].size();
+                uint8_t* entry = buffer.data() + HeaderSize + level * LevelIndexSize;
+                memcpy(entry, &offsets[level], sizeof(uint64_t));
+                memcpy(entry + 8, &length, sizeof(uint64_t));
+                memcpy(entry + 16, &length, sizeof(uint64_t));
+                memcpy(buffer.data() + offsets[level], levels[level].data(), length);
+            }
+
+            memcpy(buffer.data() + header.dfdByteOffset, dfd.data(), header.dfdByteLength);
+
+            return FileSystem::WriteFile(filename, buffer.data(), static_cast<uint32_t>(buffer.size()));
+        }
+    }
+} // NekoEngine
@@ -0,0 +1,60 @@
+#pragma once
+#include "Core.h"
+#include "FileSystem.h"
+namespace NekoEngine
+{
+    // Reader and writer for the KTX2 container, used for cooked textures that carry their whole mip chain in a
+    // GPU format. Only uncompressed payloads (no supercompression) of 2D textures and cube maps are handled.
+    namespace KTX2
+    {
+        // VkFormat values of the formats the texture cooker writes. Kept as plain numbers so the file layer does
+        // not depend on Vulkan, they match VkFormat exactly.
+        enum Format : uint32_t
+        {
+            FORMAT_UNDEFINED       = 0,
+            FORMAT_BC1_RGB_UNORM   = 131,
+            FORMAT_BC1_RGB_SRGB    = 132,
+            FORMAT_BC3_UNORM       = 137,
+            FORMAT_BC3_SRGB        = 138,
+            FORMAT_BC4_UNORM       = 139,
+            FORMAT_BC5_UNORM       = 141,
+            FORMAT_BC6H_UFLOAT     = 143,
+            FORMAT_BC7_UNORM       = 145,
+            FORMAT_BC7_SRGB        = 146
+        };
+
+        struct Level
+        {
+            uint64_t offset = 0; // From the start of the file
+            uint64_t size   = 0; // All faces of the level, face after face
+        };
+
+        struct Image
+        {
+            uint32_t vkFormat   = FORMAT_UNDEFINED;
+            uint32_t width      = 0;
+            uint32_t height     = 0;
+            uint32_t faceCount  = 1;
+            uint32_t levelCount = 1;
+            bool srgb           = false;
+            ArrayList<Level> levels; // Level 0 is the full resolution image
+
+            MappedFile file;
+
+            const uint8_t* GetLevelData(uint32_t level) const { return file.data + levels[level].offset; }
+        };
+
+        bool IsKTX2File(const String& filename);
+
+        // Bytes per 4x4 block, 0 for formats that are not block compressed
+        uint32_t GetBlockSize(uint32_t vkFormat);
+
+        // Maps the file and validates the header and level index, the level data is read in place
+        bool Load(const String& filename, Image& outImage);
+        void Free(Image& image);
+
+        // levels[level] holds faceCount faces of that level back to back
+        bool Write(const String& filename, uint32_t vkFormat, uint32_t width, uint32_t height, uint32_t faceCount,
+                   const ArrayList<ArrayList<uint8_t>>& levels);
+    }
+} // NekoEngine
@@ -0,0 +1,77 @@
+#include "Renderer/OcclusionCuller.h"
+#include "Renderable/Mesh.h"
+#include "JobSystem/JobSystem.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdio>
+
+// Rasterises one wall into the occlusion buffer and checks a box behind it is culled while boxes in front of it
+// and beside it are not. Run through xmake test, a non zero exit code is a failure.
+
+using namespace NekoEngine;
+
+namespace
+{
+    int failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if(!condition)
+        {
+            std::printf("FAILED: %s\n", what);
+            failures++;
+        }
+    }
+
+    // 4x4 quad in the xy plane, facing +z
+    SharedPtr<Mesh> CreateQuad()
+    {
+        std::vector<Vertex> vertices(4);
+        vertices[0].position = glm::vec3(-2.0f, -2.0f, 0.0f);
+        vertices[1].position = glm::vec3(2.0f, -2.0f, 0.0f);
+        vertices[2].position = glm::vec3(2.0f, 2.0f, 0.0f);
+        vertices[3].position = glm::vec3(-2.0f, 2.0f, 0.0f);
+
+        const std::vector<uint32_t> indices = { 0, 1, 2, 2, 3, 0 };
+
+        // No simplification, both triangles have to reach the rasteriser
+        return Mesh::CreateCPUOnly(indices, vertices, 1.0f);
+    }
+}
+
+int main()
+{
+    JobSystem::OnInit();
+
+    {
+        // Camera at the origin looking down -z, the wall 10 units in front of it
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), (float)OCCLUSION_WIDTH / (float)OCCLUSION_HEIGHT, 0.1f, 100.0f);
+        const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const glm::mat4 wall       = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -10.0f));
+
+        SharedPtr<Mesh> quad = CreateQuad();
+
+        OcclusionCuller culler;
+        culler.Begin(projection * view);
+        culler.AddOccluder(quad.get(), wall, 0);
+        culler.Render();
+
+        Check(culler.GetNumTriangles() == 2, "both triangles of the quad are set up");
+
+        // Centre pixel lies on the wall, 1/w of a point 10 units away
+        const float centreDepth = culler.GetDepth()[(OCCLUSION_HEIGHT / 2) * OCCLUSION_WIDTH + OCCLUSION_WIDTH / 2];
+        Check(glm::abs(centreDepth - 0.1f) < 1e-3f, "the wall is rasterised at its depth");
+        Check(culler.GetDepth()[0] == 0.0f, "pixels outside the wall stay cleared");
+
+        Check(culler.IsOccluded(glm::vec3(-0.5f, -0.5f, -20.5f), glm::vec3(0.5f, 0.5f, -19.5f)), "box behind the wall is occluded");
+        Check(!culler.IsOccluded(glm::vec3(-0.5f, -0.5f, -5.5f), glm::vec3(0.5f, 0.5f, -4.5f)), "box in front of the wall is visible");
+        Check(!culler.IsOccluded(glm::vec3(7.5f, -0.5f, -20.5f), glm::vec3(8.5f, 0.5f, -19.5f)), "box beside the wall is visible");
+        Check(!culler.IsOccluded(glm::vec3(-0.5f, -0.5f, -1.0f), glm::vec3(0.5f, 0.5f, 1.0f)), "box crossing the near plane is visible");
+    }
+
+    JobSystem::Release();
+
+    if(failures == 0)
+        std::printf("OcclusionCuller: all checks passed\n");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,6 @@
+target("OcclusionCullerTest")
+    set_kind("binary")
+    set_default(false)
+    add_deps("Function")
+    add_files("OcclusionCullerTest.cpp")
+    add_tests("default")
@@ -0,0 +1,432 @@
+#include "Engine.h"
+#include "Null/NullRenderer.h"
+#include "JobSystem/JobSystem.h"
+#include "OS/WindowsOS.h"
+#include "Level/Level.h"
+#include "Renderable/Camera.h"
+#include "Renderable/Light.h"
+#include "Renderable/Material.h"
+#include "Component/ModelComponent.h"
+#include "Entity/EntityManager.h"
+#include "File/FileSystem.h"
+#include "Math/Transform.h"
+#include "Math/Maths.h"
+#include "Profiler/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <chrono>
+#include <sstream>
+
+// Headless renderer benchmark. Runs the engine on the null backend, so every frame goes through the scene
+// renderer as usual but nothing is submitted to a GPU, and reports CPU frame times and what each pass recorded.
+//
+//   RendererBenchmark [--level materials|instanced|lights] [--count N] [--frames N] [--warmup N]
+//                     [--width W] [--height H] [--csv out.csv] [--trace out.json]
+//
+// materials: N cubes, each with its own material. instanced: N cubes sharing one model and material.
+// lights: a field of cubes lit by N point lights. --trace writes the profiler's scopes for the measured frames
+// as a Chrome trace, when the profiler is built in.
+
+using namespace NekoEngine;
+
+namespace
+{
+    enum class BenchmarkLevel : uint8_t
+    {
+        Materials,
+        Instanced,
+        Lights
+    };
+
+    struct BenchmarkOptions
+    {
+        BenchmarkLevel level = BenchmarkLevel::Materials;
+        uint32_t count       = 2000;
+        uint32_t frames      = 300;
+        uint32_t warmup      = 30;
+        uint32_t width       = 1920;
+        uint32_t height      = 1080;
+        String csv;
+        String trace;
+    };
+
+    // One measured frame
+    struct FrameSample
+    {
+        double frameMs = 0.0; // Whole engine frame, update to present
+        double sceneMs = 0.0; // BeginScene and OnRender of the scene renderer
+        NullFrameStats stats;
+    };
+
+    // Counters of every pass with the same name, summed over the measured frames
+    struct PassTotals
+    {
+        String name;
+        uint32_t instances = 0; // Times the pass was begun
+        NullPassCounters counters;
+    };
+
+    class BenchmarkEngine : public Engine
+    {
+    private:
+        BenchmarkOptions options;
+        double lastSceneMs = 0.0;
+
+    public:
+        BenchmarkEngine(const BenchmarkOptions& _options) : options(_options) {}
+
+        void Deserialise() override
+        {
+            Engine::Deserialise();
+
+            m_ProjectSettings.Width      = options.width;
+            m_ProjectSettings.Height     = options.height;
+            m_ProjectSettings.VSync      = false;
+            m_ProjectSettings.Fullscreen = false;
+            m_ProjectSettings.Title      = "RendererBenchmark";
+        }
+
+        // Nothing to save, the benchmark never owns a project
+        void Serialise() override {}
+
+        void OnRender() override
+        {
+            auto start = std::chrono::steady_clock::now();
+            Engine::OnRender();
+            lastSceneMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        void LoadLevel(Level* level)
+        {
+            levelManager->EnqueueLevel(level);
+            levelManager->SwitchLevel((int)levelManager->LevelCount() - 1);
+
+            // The switch is applied by the next frame, which renders nothing
+            OnFrame();
+        }
+
+        double GetLastSceneMs() const { return lastSceneMs; }
+    };
+
+    bool ParseUInt(const char* text, uint32_t& value)
+    {
+        char* end = nullptr;
+        unsigned long parsed = strtoul(text, &end, 10);
+        if(end == text || *end != '\0')
+            return false;
+
+        value = (uint32_t)parsed;
+        return true;
+    }
+
+    bool ParseArguments(int argc, char** argv, BenchmarkOptions& options)
+    {
+        for(int i = 1; i < argc; i++)
+        {
+            const String argument = argv[i];
+            const bool hasValue   = i + 1 < argc;
+
+            if(argument == "--level" && hasValue)
+            {
+                const String level = argv[++i];
+                if(level == "materials")
+                    options.level = BenchmarkLevel::Materials;
+                else if(level == "instanced")
+                    options.level = BenchmarkLevel::Instanced;
+                else if(level == "lights")
+                    options.level = BenchmarkLevel::Lights;
+                else
+                    return false;
+            }
+            else if(argument == "--count" && hasValue)
+            {
+                if(!ParseUInt(argv[++i], options.count))
+                    return false;
+            }
+            else if(argument == "--frames" && hasValue)
+            {
+                if(!ParseUInt(argv[++i], options.frames) || options.frames == 0)
+                    return false;
+            }
+            else if(argument == "--warmup" && hasValue)
+            {
+                if(!ParseUInt(argv[++i], options.warmup))
+                    return false;
+            }
+            else if(argument == "--width" && hasValue)
+            {
+                if(!ParseUInt(argv[++i], options.width) || options.width == 0)
+                    return false;
+            }
+            else if(argument == "--height" && hasValue)
+            {
+                if(!ParseUInt(argv[++i], options.height) || options.height == 0)
+                    return false;
+            }
+            else if(argument == "--csv" && hasValue)
+                options.csv = argv[++i];
+            else if(argument == "--trace" && hasValue)
+                options.trace = argv[++i];
+            else
+                return false;
+        }
+
+        return true;
+    }
+
+    const char* LevelName(BenchmarkLevel level)
+    {
+        switch(level)
+        {
+            case BenchmarkLevel::Materials:
+                return "materials";
+            case BenchmarkLevel::Instanced:
+                return "instanced";
+            case BenchmarkLevel::Lights:
+                return "lights";
+        }
+
+        return "";
+    }
+
+    SharedPtr<Material> CreateMaterial(const glm::vec4& colour)
+    {
+        auto material = MakeShared<Material>();
+        MaterialProperties properties;
+        properties.albedoColour       = colour;
+        properties.roughness          = Random32::Rand(0.0f, 1.0f);
+        properties.metallic           = Random32::Rand(0.0f, 1.0f);
+        properties.albedoMapFactor    = 0.0f;
+        properties.roughnessMapFactor = 0.0f;
+        properties.normalMapFactor    = 0.0f;
+        properties.metallicMapFactor  = 0.0f;
+        properties.emissiveMapFactor  = 0.0f;
+        properties.occlusionMapFactor = 0.0f;
+        material->SetMaterialProperites(properties);
+        return material;
+    }
+
+    // Objects on a square grid in front of the camera, spacing 3 units
+    glm::vec3 GridPosition(uint32_t index, uint32_t count)
+    {
+        const uint32_t side = Maths::Max(1u, (uint32_t)std::ceil(std::sqrt((float)count)));
+        const float offset  = (float)(side - 1) * 1.5f;
+        return glm::vec3((float)(index % side) * 3.0f - offset, 0.0f, -(float)(index / side) * 3.0f);
+    }
+
+    Level* BuildLevel(const BenchmarkOptions& options)
+    {
+        auto level = new Level(String("Benchmark ") + LevelName(options.level));
+        auto entityManager = level->GetEntityManager();
+        const uint32_t side = Maths::Max(1u, (uint32_t)std::ceil(std::sqrt((float)options.count)));
+        const float extent = (float)side * 3.0f;
+
+        auto camera = entityManager->Create("Camera");
+        camera.AddComponent<Camera>(60.0f, 0.1f, extent * 2.0f + 100.0f, (float)options.width / (float)options.height);
+        camera.GetTransform().SetLocalTransform(glm::inverse(glm::lookAt(glm::vec3(0.0f, extent * 0.35f, extent * 0.25f),
+                                                                         glm::vec3(0.0f, 0.0f, -extent * 0.5f),
+                                                                         glm::vec3(0.0f, 1.0f, 0.0f))));
+
+        auto sun = entityManager->Create("Sun");
+        sun.AddComponent<Light>(glm::vec3(0.3f, -1.0f, -0.4f), glm::vec4(1.0f), 120000.0f, LightType::DirectionalLight);
+        sun.GetTransform().SetLocalTransform(glm::inverse(glm::lookAt(glm::vec3(30.0f, 50.0f, 20.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f))));
+
+        // The lights level keeps a fixed number of objects, count is the number of lights
+        const uint32_t objectCount = options.level == BenchmarkLevel::Lights ? 1024 : options.count;
+        auto sharedModel    = MakeShared<Model>(PrimitiveType::Cube);
+        auto sharedMaterial = CreateMaterial(glm::vec4(0.8f, 0.8f, 0.8f, 1.0f));
+        sharedModel->GetMeshes().front()->SetMaterial(sharedMaterial);
+
+        for(uint32_t i = 0; i < objectCount; i++)
+        {
+            auto cube = entityManager->Create("Cube");
+            cube.GetTransform().SetLocalPosition(GridPosition(i, objectCount));
+
+            if(options.level == BenchmarkLevel::Materials)
+            {
+                auto& model = cube.AddComponent<ModelComponent>(PrimitiveType::Cube).model;
+                model->GetMeshes().front()->SetMaterial(CreateMaterial(glm::vec4(Random32::Rand(0.0f, 1.0f), Random32::Rand(0.0f, 1.0f),
+                                                                                 Random32::Rand(0.0f, 1.0f), 1.0f)));
+            }
+            else
+            {
+                cube.AddComponent<ModelComponent>(sharedModel);
+            }
+        }
+
+        if(options.level == BenchmarkLevel::Lights)
+        {
+            for(uint32_t i = 0; i < options.count; i++)
+            {
+                const glm::vec3 position = GridPosition(Random32::Rand(0u, objectCount - 1), objectCount) + glm::vec3(0.0f, 2.0f, 0.0f);
+                const glm::vec4 colour   = glm::vec4(Random32::Rand(0.0f, 1.0f), Random32::Rand(0.0f, 1.0f), Random32::Rand(0.0f, 1.0f), 1.0f);
+
+                auto light = entityManager->Create("Point Light");
+                light.AddComponent<Light>(glm::vec3(0.0f), colour, 20000.0f, LightType::PointLight, position, Random32::Rand(2.0f, 8.0f));
+                light.GetTransform().SetLocalPosition(position);
+            }
+        }
+
+        return level;
+    }
+
+    double Percentile(ArrayList<double> values, float percentile)
+    {
+        std::sort(values.begin(), values.end());
+        const size_t index = std::min(values.size() - 1, (size_t)(percentile * (float)(values.size() - 1) + 0.5f));
+        return values[index];
+    }
+
+    void ReportTimes(const char* name, const ArrayList<double>& values)
+    {
+        double total = 0.0;
+        for(double value : values)
+            total += value;
+
+        LOG_FORMAT("%-12s mean %8.3f ms | median %8.3f ms | p95 %8.3f ms | min %8.3f ms | max %8.3f ms", name,
+                   total / (double)values.size(), Percentile(values, 0.5f), Percentile(values, 0.95f),
+                   *std::min_element(values.begin(), values.end()), *std::max_element(values.begin(), values.end()));
+    }
+
+    void Report(const BenchmarkOptions& options, const ArrayList<FrameSample>& samples)
+    {
+        ArrayList<double> frameTimes, sceneTimes;
+        ArrayList<PassTotals> passes; // In the order they first appeared
+        NullPassCounters total;
+        uint64_t uploadedBytes = 0;
+        uint32_t descriptorSetUpdates = 0;
+
+        for(auto& sample : samples)
+        {
+            frameTimes.push_back(sample.frameMs);
+            sceneTimes.push_back(sample.sceneMs);
+            total.Add(sample.stats.total);
+            uploadedBytes        += sample.stats.uploadedBytes;
+            descriptorSetUpdates += sample.stats.descriptorSetUpdates;
+
+            for(auto& pass : sample.stats.passes)
+            {
+                auto itr = std::find_if(passes.begin(), passes.end(), [&pass](const PassTotals& totals) { return totals.name == pass.name; });
+                if(itr == passes.end())
+                {
+                    passes.emplace_back().name = pass.name;
+                    itr = passes.end() - 1;
+                }
+
+                itr->instances++;
+                itr->counters.Add(pass.counters);
+            }
+        }
+
+        const double frames = (double)samples.size();
+        LOG_FORMAT("Level %s, %u objects/lights, %ux%u, %u frames after %u warm up frames", LevelName(options.level), options.count,
+                   options.width, options.height, options.frames, options.warmup);
+        ReportTimes("Frame", frameTimes);
+        ReportTimes("Scene", sceneTimes);
+
+        LOG_FORMAT("Per frame: %.1f draws, %.1f instances, %.1f pipeline binds, %.1f descriptor binds, %.1f push constants, %.1f barriers, %.1f copies, %.1f descriptor set updates, %.1f KB uploaded",
+                   total.drawCalls / frames, total.instances / frames, total.pipelineBinds / frames, total.descriptorBinds / frames,
+                   total.pushConstants / frames, total.barriers / frames, total.copies / frames, descriptorSetUpdates / frames, (double)uploadedBytes / frames / 1024.0);
+
+        LOG_FORMAT("%-28s %6s %9s %9s %9s %9s %9s %9s", "Pass (per frame)", "Count", "Draws", "Instances", "Pipelines", "Desc", "VB", "Dispatch");
+        for(auto& pass : passes)
+        {
+            const char* name = pass.name.empty() ? "(outside a pass)" : pass.name.c_str();
+            LOG_FORMAT("%-28s %6.1f %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f", name, pass.instances / frames,
+                       pass.counters.drawCalls / frames, pass.counters.instances / frames, pass.counters.pipelineBinds / frames,
+                       pass.counters.descriptorBinds / frames, pass.counters.vertexBufferBinds / frames, pass.counters.dispatches / frames);
+        }
+    }
+
+    bool WriteCSV(const String& path, const ArrayList<FrameSample>& samples)
+    {
+        std::ostringstream csv;
+        csv << "frame,frame_ms,scene_ms,passes,draws,instances,pipeline_binds,descriptor_binds,vertex_buffer_binds,push_constants,dispatches,barriers,copies,uploaded_bytes,descriptor_set_updates\n";
+
+        for(size_t i = 0; i < samples.size(); i++)
+        {
+            const FrameSample& sample = samples[i];
+            const NullPassCounters& total = sample.stats.total;
+            csv << i << ',' << sample.frameMs << ',' << sample.sceneMs << ',' << sample.stats.passes.size() << ',' << total.drawCalls << ','
+                << total.instances << ',' << total.pipelineBinds << ',' << total.descriptorBinds << ',' << total.vertexBufferBinds << ','
+                << total.pushConstants << ',' << total.dispatches << ',' << total.barriers << ',' << total.copies << ',' << sample.stats.uploadedBytes << ',' << sample.stats.descriptorSetUpdates << '\n';
+        }
+
+        return FileSystem::WriteTextFile(path, csv.str());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    if(!ParseArguments(argc, argv, options))
+    {
+        LOG("Usage: RendererBenchmark [--level materials|instanced|lights] [--count N] [--frames N] [--warmup N] [--width W] [--height H] [--csv out.csv] [--trace out.json]");
+        return 1;
+    }
+
+    GraphicsContext::SetRenderAPI(RENDER_API::NONE);
+
+    JobSystem::OnInit();
+
+    auto windowsOS = new WindowsOS();
+    OS::SetInstance(windowsOS);
+    windowsOS->Init();
+
+    auto engine = std::make_shared<BenchmarkEngine>(options);
+    gEngine = engine;
+    engine->Init();
+    engine->LoadLevel(BuildLevel(options));
+
+    auto renderer = static_cast<NullRenderer*>(engine->GetRenderer());
+    ArrayList<FrameSample> samples;
+    samples.reserve(options.frames);
+
+    for(uint32_t frame = 0; frame < options.warmup + options.frames; frame++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        engine->OnFrame();
+        const double frameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if(frame < options.warmup)
+            continue;
+
+#ifdef NekoEngine_PROFILE
+        // The frame marker is at the start of a frame, so this one is captured from the next marker on
+        if(frame == options.warmup && !options.trace.empty())
+            Profiler::BeginCapture(options.frames);
+#endif
+
+        FrameSample& sample = samples.emplace_back();
+        sample.frameMs = frameMs;
+        sample.sceneMs = engine->GetLastSceneMs();
+        sample.stats   = renderer->GetLastFrameStats();
+    }
+
+    Report(options, samples);
+
+    if(!options.csv.empty() && !WriteCSV(options.csv, samples))
+    {
+        LOG_FORMAT("Could not write %s", options.csv.c_str());
+    }
+
+    if(!options.trace.empty())
+    {
+#ifdef NekoEngine_PROFILE
+        // Closes the last measured frame
+        NekoEngine_PROFILE_FRAMEMARKER();
+        if(!Profiler::SaveChromeTrace(options.trace))
+            LOG_FORMAT("Could not write %s", options.trace.c_str());
+#else
+        LOG("--trace needs the profiler, build with --profiler=y");
+#endif
+    }
+
+    engine->OnQuit();
+    engine.reset();
+    gEngine.reset();
+
+    JobSystem::Release();
+    return 0;
+}
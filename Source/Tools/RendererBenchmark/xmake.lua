@@ -0,0 +1,5 @@
+target("RendererBenchmark")
+    set_kind("binary")
+    set_targetdir("../../..//")
+    add_deps("Function")
+    add_files("/*.cpp")
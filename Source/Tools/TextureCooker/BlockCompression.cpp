@@ -0,0 +1,375 @@
+#include "BlockCompression.h"
+#define STB_DXT_IMPLEMENTATION
+#include "stb_dxt.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+namespace NekoEngine
+{
+    namespace BlockCompression
+    {
+        // Interpolation weights of 4 bit indices, shared by BC6H and BC7
+        static const int32_t Weights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+        struct BitWriter
+        {
+            uint8_t* dest;
+            uint32_t position = 0;
+
+            void Write(uint32_t value, uint32_t count)
+            {
+                for(uint32_t i = 0; i < count; i++, position++)
+                    dest[position >> 3] |= ((value >> i) & 1) << (position & 7);
+            }
+        };
+
+        // Single subset block with 4 bit indices, the layout BC7 mode 6 and BC6H mode 11 have in common
+        struct Block
+        {
+            uint32_t endpoints[2][4];
+            uint32_t pBits[2] = {};
+            uint8_t indices[16];
+            float error = FLT_MAX;
+        };
+
+        // Endpoints at the extremes of the block's colours along their principal axis
+        static void FitEndpoints(const float* pixels, uint32_t channels, float* e0, float* e1)
+        {
+            float mean[4] = {};
+            float minimum[4] = {FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX};
+            float maximum[4] = {-FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX};
+            for(uint32_t i = 0; i < 16; i++)
+            {
+                for(uint32_t c = 0; c < channels; c++)
+                {
+                    mean[c] += pixels[i * 4 + c] / 16.0f;
+                    minimum[c] = std::min(minimum[c], pixels[i * 4 + c]);
+                    maximum[c] = std::max(maximum[c], pixels[i * 4 + c]);
+                }
+            }
+
+            float covariance[4][4] = {};
+            for(uint32_t i = 0; i < 16; i++)
+                for(uint32_t a = 0; a < channels; a++)
+                    for(uint32_t b = 0; b < channels; b++)
+                        covariance[a][b] += (pixels[i * 4 + a] - mean[a]) * (pixels[i * 4 + b] - mean[b]);
+
+            // Power iteration, started from the bounding box diagonal
+            float axis[4] = {};
+            for(uint32_t c = 0; c < channels; c++)
+                axis[c] = maximum[c] - minimum[c];
+
+            for(uint32_t iteration = 0; iteration < 8; iteration++)
+            {
+                float next[4] = {};
+                for(uint32_t a = 0; a < channels; a++)
+                    for(uint32_t b = 0; b < channels; b++)
+                        next[a] += covariance[a][b] * axis[b];
+
+                float length = 0.0f;
+                for(uint32_t c = 0; c < channels; c++)
+                    length += next[c] * next[c];
+                if(length < 1e-12f)
+                    break;
+
+                length = std::sqrt(length);
+                for(uint32_t c = 0; c < channels; c++)
+                    axis[c] = next[c] / length;
+            }
+
+            float length = 0.0f;
+            for(uint32_t c = 0; c < channels; c++)
+                length += axis[c] * axis[c];
+            length = std::sqrt(length);
+            for(uint32_t c = 0; c < channels; c++)
+                axis[c] = length > 0.0f ? axis[c] / length : 0.0f;
+
+            float tMin = 0.0f, tMax = 0.0f;
+            for(uint32_t i = 0; i < 16; i++)
+            {
+                float t = 0.0f;
+                for(uint32_t c = 0; c < channels; c++)
+                    t += (pixels[i * 4 + c] - mean[c]) * axis[c];
+                tMin = std::min(tMin, t);
+                tMax = std::max(tMax, t);
+            }
+
+            for(uint32_t c = 0; c < channels; c++)
+            {
+                e0[c] = mean[c] + axis[c] * tMin;
+                e1[c] = mean[c] + axis[c] * tMax;
+            }
+        }
+
+        // Least squares endpoints for a fixed set of indices
+        static bool RefitEndpoints(const float* pixels, uint32_t channels, const uint8_t* indices, float* e0, float* e1)
+        {
+            float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+            float ap[4] = {}, bp[4] = {};
+            for(uint32_t i = 0; i < 16; i++)
+            {
+                const float w = Weights4[indices[i]] / 64.0f;
+                const float a = 1.0f - w;
+                aa += a * a;
+                ab += a * w;
+                bb += w * w;
+                for(uint32_t c = 0; c < channels; c++)
+                {
+                    ap[c] += a * pixels[i * 4 + c];
+                    bp[c] += w * pixels[i * 4 + c];
+                }
+            }
+
+            const float determinant = aa * bb - ab * ab;
+            if(std::fabs(determinant) < 1e-6f)
+                return false;
+
+            for(uint32_t c = 0; c < channels; c++)
+            {
+                e0[c] = (bb * ap[c] - ab * bp[c]) / determinant;
+                e1[c] = (aa * bp[c] - ab * ap[c]) / determinant;
+            }
+            return true;
+        }
+
+        // Picks the closest palette entry for every pixel
+        static void SelectIndices(const float* pixels, uint32_t channels, const int32_t palette[16][4], Block& block)
+        {
+            block.error = 0.0f;
+            for(uint32_t i = 0; i < 16; i++)
+            {
+                float bestError = FLT_MAX;
+                for(uint8_t index = 0; index < 16; index++)
+                {
+                    float error = 0.0f;
+                    for(uint32_t c = 0; c < channels; c++)
+                    {
+                        const float difference = palette[index][c] - pixels[i * 4 + c];
+                        error += difference * difference;
+                    }
+
+                    if(error < bestError)
+                    {
+                        bestError = error;
+                        block.indices[i] = index;
+                    }
+                }
+                block.error += bestError;
+            }
+        }
+
+        // The anchor index is stored without its top bit, swapping the endpoints clears it
+        static void FixAnchor(Block& block)
+        {
+            if(block.indices[0] & 8)
+            {
+                std::swap(block.endpoints[0], block.endpoints[1]);
+                std::swap(block.pBits[0], block.pBits[1]);
+                for(auto& index : block.indices)
+                    index = 15 - index;
+            }
+        }
+
+        // Fits, scores, refits once with least squares and keeps the better of the two
+        template<typename Evaluate>
+        static Block Compress(const float* pixels, uint32_t channels, Evaluate evaluate)
+        {
+            float e0[4], e1[4];
+            FitEndpoints(pixels, channels, e0, e1);
+
+            Block best;
+            evaluate(e0, e1, best);
+
+            Block refined;
+            if(RefitEndpoints(pixels, channels, best.indices, e0, e1))
+            {
+                evaluate(e0, e1, refined);
+                if(refined.error < best.error)
+                    best = refined;
+            }
+
+            FixAnchor(best);
+            return best;
+        }
+
+        static void QuantizeBC7Endpoint(const float* endpoint, uint32_t* quantized, uint32_t& pBit)
+        {
+            // The shared p-bit is the low bit of all four channels, keep whichever lands closer
+            float bestError = FLT_MAX;
+            for(uint32_t p = 0; p < 2; p++)
+            {
+                uint32_t candidate[4];
+                float error = 0.0f;
+                for(uint32_t c = 0; c < 4; c++)
+                {
+                    const float value = std::clamp(endpoint[c], 0.0f, 255.0f);
+                    candidate[c] = static_cast<uint32_t>(std::clamp(std::lround((value - p) / 2.0f), 0l, 127l));
+                    const float difference = static_cast<float>((candidate[c] << 1) | p) - value;
+                    error += difference * difference;
+                }
+
+                if(error < bestError)
+                {
+                    bestError = error;
+                    pBit = p;
+                    memcpy(quantized, candidate, sizeof(candidate));
+                }
+            }
+        }
+
+        static uint32_t UnquantizeBC6H(uint32_t value)
+        {
+            if(value == 0)
+                return 0;
+            if(value == 1023)
+                return 0xFFFF;
+            return ((value << 16) + 0x8000) >> 10;
+        }
+
+        // Unsigned BC6H scales the interpolated value back into half float range
+        static uint32_t FinishBC6H(uint32_t value)
+        {
+            return (value * 31) >> 6;
+        }
+
+        static uint32_t QuantizeBC6H(float half)
+        {
+            const int32_t guess = static_cast<int32_t>(half / 31.0f);
+
+            uint32_t best = 0;
+            float bestError = FLT_MAX;
+            for(int32_t candidate = guess - 1; candidate <= guess + 1; candidate++)
+            {
+                const uint32_t value = static_cast<uint32_t>(std::clamp(candidate, 0, 1023));
+                const float error = std::fabs(static_cast<float>(FinishBC6H(UnquantizeBC6H(value))) - half);
+                if(error < bestError)
+                {
+                    bestError = error;
+                    best = value;
+                }
+            }
+            return best;
+        }
+
+        void EncodeBC1(uint8_t* dest, const uint8_t* rgba)
+        {
+            stb_compress_dxt_block(dest, rgba, 0, STB_DXT_HIGHQUAL);
+        }
+
+        void EncodeBC3(uint8_t* dest, const uint8_t* rgba)
+        {
+            stb_compress_dxt_block(dest, rgba, 1, STB_DXT_HIGHQUAL);
+        }
+
+        void EncodeBC4(uint8_t* dest, const uint8_t* rgba)
+        {
+            uint8_t red[16];
+            for(uint32_t i = 0; i < 16; i++)
+                red[i] = rgba[i * 4];
+            stb_compress_bc4_block(dest, red);
+        }
+
+        void EncodeBC5(uint8_t* dest, const uint8_t* rgba)
+        {
+            uint8_t redGreen[32];
+            for(uint32_t i = 0; i < 16; i++)
+            {
+                redGreen[i * 2 + 0] = rgba[i * 4 + 0];
+                redGreen[i * 2 + 1] = rgba[i * 4 + 1];
+            }
+            stb_compress_bc5_block(dest, redGreen);
+        }
+
+        // Mode 6: one subset, RGBA 7.7.7.7 endpoints with a p-bit each and 4 bit indices
+        void EncodeBC7(uint8_t* dest, const uint8_t* rgba)
+        {
+            float pixels[64];
+            for(uint32_t i = 0; i < 64; i++)
+                pixels[i] = rgba[i];
+
+            Block block = Compress(pixels, 4, [&pixels](const float* e0, const float* e1, Block& out)
+            {
+                QuantizeBC7Endpoint(e0, out.endpoints[0], out.pBits[0]);
+                QuantizeBC7Endpoint(e1, out.endpoints[1], out.pBits[1]);
+
+                int32_t palette[16][4];
+                for(uint32_t index = 0; index < 16; index++)
+                {
+                    for(uint32_t c = 0; c < 4; c++)
+                    {
+                        const int32_t a = static_cast<int32_t>((out.endpoints[0][c] << 1) | out.pBits[0]);
+                        const int32_t b = static_cast<int32_t>((out.endpoints[1][c] << 1) | out.pBits[1]);
+                        palette[index][c] = ((64 - Weights4[index]) * a + Weights4[index] * b + 32) >> 6;
+                    }
+                }
+
+                SelectIndices(pixels, 4, palette, out);
+            });
+
+            memset(dest, 0, 16);
+            BitWriter writer{dest};
+            writer.Write(1 << 6, 7);
+            for(uint32_t c = 0; c < 4; c++)
+            {
+                writer.Write(block.endpoints[0][c], 7);
+                writer.Write(block.endpoints[1][c], 7);
+            }
+            writer.Write(block.pBits[0], 1);
+            writer.Write(block.pBits[1], 1);
+            writer.Write(block.indices[0], 3);
+            for(uint32_t i = 1; i < 16; i++)
+                writer.Write(block.indices[i], 4);
+        }
+
+        // Mode 11 (0x03): one region, 10 bit endpoints without deltas and 4 bit indices. Fitting happens on the
+        // half float bit patterns, which are close to logarithmic, so errors are weighted like the format stores them.
+        void EncodeBC6H(uint8_t* dest, const float* rgba)
+        {
+            float pixels[64] = {};
+            for(uint32_t i = 0; i < 16; i++)
+            {
+                for(uint32_t c = 0; c < 3; c++)
+                {
+                    float value = rgba[i * 4 + c];
+                    value = std::isfinite(value) ? std::clamp(value, 0.0f, 65504.0f) : 0.0f;
+                    pixels[i * 4 + c] = static_cast<float>(glm::packHalf1x16(value));
+                }
+            }
+
+            Block block = Compress(pixels, 3, [&pixels](const float* e0, const float* e1, Block& out)
+            {
+                for(uint32_t c = 0; c < 3; c++)
+                {
+                    out.endpoints[0][c] = QuantizeBC6H(std::clamp(e0[c], 0.0f, 31743.0f));
+                    out.endpoints[1][c] = QuantizeBC6H(std::clamp(e1[c], 0.0f, 31743.0f));
+                }
+
+                int32_t palette[16][4];
+                for(uint32_t index = 0; index < 16; index++)
+                {
+                    for(uint32_t c = 0; c < 3; c++)
+                    {
+                        const uint32_t a = UnquantizeBC6H(out.endpoints[0][c]);
+                        const uint32_t b = UnquantizeBC6H(out.endpoints[1][c]);
+                        const uint32_t value = ((64 - Weights4[index]) * a + Weights4[index] * b + 32) >> 6;
+                        palette[index][c] = static_cast<int32_t>(FinishBC6H(value));
+                    }
+                }
+
+                SelectIndices(pixels, 3, palette, out);
+            });
+
+            memset(dest, 0, 16);
+            BitWriter writer{dest};
+            writer.Write(0x03, 5);
+            for(uint32_t endpoint = 0; endpoint < 2; endpoint++)
+                for(uint32_t c = 0; c < 3; c++)
+                    writer.Write(block.endpoints[endpoint][c], 10);
+            writer.Write(block.indices[0], 3);
+            for(uint32_t i = 1; i < 16; i++)
+                writer.Write(block.indices[i], 4);
+        }
+    }
+} // NekoEngine
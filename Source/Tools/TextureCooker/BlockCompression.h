@@ -0,0 +1,15 @@
+#pragma once
+#include "Core.h"
+namespace NekoEngine
+{
+    // Encoders for one 4x4 block. Pixels are row major, RGBA with 4 values per pixel.
+    namespace BlockCompression
+    {
+        void EncodeBC1(uint8_t* dest, const uint8_t* rgba);
+        void EncodeBC3(uint8_t* dest, const uint8_t* rgba);
+        void EncodeBC4(uint8_t* dest, const uint8_t* rgba); // Red only
+        void EncodeBC5(uint8_t* dest, const uint8_t* rgba); // Red and green
+        void EncodeBC7(uint8_t* dest, const uint8_t* rgba);
+        void EncodeBC6H(uint8_t* dest, const float* rgba);  // Unsigned, alpha is ignored
+    }
+} // NekoEngine
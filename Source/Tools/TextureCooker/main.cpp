@@ -0,0 +1,313 @@
+#include "BlockCompression.h"
+#include "File/KTX2.h"
+#include "StringUtility.h"
+#include "stb_image.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Offline texture cooker. Decodes a source image, builds the full mip chain on the CPU and writes it block
+// compressed into a KTX2 file that the engine uploads as is.
+//
+//   TextureCooker <input> [output.ktx2] [--format bc1|bc3|bc4|bc5|bc6h|bc7] [--linear] [--normal] [--no-mips]
+//
+// HDR sources default to BC6H, normal maps (--normal) to BC5 and everything else to BC7. Colour is treated as
+// sRGB unless --linear or --normal is given, filtering always happens in linear space.
+
+using namespace NekoEngine;
+
+namespace
+{
+    enum class CookFormat : uint8_t
+    {
+        BC1,
+        BC3,
+        BC4,
+        BC5,
+        BC6H,
+        BC7
+    };
+
+    struct CookOptions
+    {
+        String input;
+        String output;
+        CookFormat format = CookFormat::BC7;
+        bool formatSet    = false;
+        bool srgb         = true;
+        bool normalMap    = false;
+        bool mips         = true;
+    };
+
+    // RGBA floats, one level of the mip chain
+    struct Image
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        ArrayList<float> pixels;
+
+        const float* GetPixel(uint32_t x, uint32_t y) const
+        {
+            return &pixels[(std::min(y, height - 1) * width + std::min(x, width - 1)) * 4];
+        }
+    };
+
+    float SRGBToLinear(float value)
+    {
+        return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+    }
+
+    float LinearToSRGB(float value)
+    {
+        return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    }
+
+    bool ParseFormat(const String& name, CookFormat& format)
+    {
+        static const std::pair<const char*, CookFormat> Formats[] = {
+                {"bc1", CookFormat::BC1}, {"bc3", CookFormat::BC3}, {"bc4", CookFormat::BC4},
+                {"bc5", CookFormat::BC5}, {"bc6h", CookFormat::BC6H}, {"bc7", CookFormat::BC7}};
+
+        for(auto& entry : Formats)
+        {
+            if(StringUtility::ToLower(name) == entry.first)
+            {
+                format = entry.second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ParseArguments(int argc, char** argv, CookOptions& options)
+    {
+        for(int i = 1; i < argc; i++)
+        {
+            const String argument = argv[i];
+            if(argument == "--format" && i + 1 < argc)
+            {
+                if(!ParseFormat(argv[++i], options.format))
+                {
+                    LOG_FORMAT("Unknown format %s", argv[i]);
+                    return false;
+                }
+                options.formatSet = true;
+            }
+            else if(argument == "--linear")
+                options.srgb = false;
+            else if(argument == "--normal")
+                options.normalMap = true;
+            else if(argument == "--no-mips")
+                options.mips = false;
+            else if(options.input.empty())
+                options.input = argument;
+            else if(options.output.empty())
+                options.output = argument;
+            else
+                return false;
+        }
+
+        if(options.input.empty())
+            return false;
+
+        if(options.output.empty())
+            options.output = StringUtility::RemoveFilePathExtension(options.input) + ".ktx2";
+
+        return true;
+    }
+
+    // decodeSRGB converts 8 bit colour to linear, HDR sources are linear already
+    bool LoadSource(const String& path, bool decodeSRGB, Image& image)
+    {
+        int width = 0, height = 0, channels = 0;
+
+        if(stbi_is_hdr(path.c_str()))
+        {
+            float* pixels = stbi_loadf(path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+            if(!pixels)
+                return false;
+
+            image.pixels.assign(pixels, pixels + width * height * 4);
+            stbi_image_free(pixels);
+        }
+        else
+        {
+            uint8_t* pixels = stbi_load(path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+            if(!pixels)
+                return false;
+
+            image.pixels.resize(width * height * 4);
+            for(int i = 0; i < width * height * 4; i++)
+            {
+                const float value = pixels[i] / 255.0f;
+                image.pixels[i] = (decodeSRGB && i % 4 != 3) ? SRGBToLinear(value) : value;
+            }
+            stbi_image_free(pixels);
+        }
+
+        image.width = static_cast<uint32_t>(width);
+        image.height = static_cast<uint32_t>(height);
+        return true;
+    }
+
+    // 2x2 box filter, the last row or column is repeated for odd sizes
+    Image Downsample(const Image& source, bool normalMap)
+    {
+        Image result;
+        result.width = std::max(source.width / 2, 1u);
+        result.height = std::max(source.height / 2, 1u);
+        result.pixels.resize(result.width * result.height * 4);
+
+        for(uint32_t y = 0; y < result.height; y++)
+        {
+            for(uint32_t x = 0; x < result.width; x++)
+            {
+                float* out = &result.pixels[(y * result.width + x) * 4];
+                for(uint32_t c = 0; c < 4; c++)
+                {
+                    out[c] = 0.25f * (source.GetPixel(x * 2, y * 2)[c] + source.GetPixel(x * 2 + 1, y * 2)[c] +
+                                      source.GetPixel(x * 2, y * 2 + 1)[c] + source.GetPixel(x * 2 + 1, y * 2 + 1)[c]);
+                }
+
+                // Averaged normals get shorter, which the shader would read as a flatter surface
+                if(normalMap)
+                {
+                    glm::vec3 normal = glm::vec3(out[0], out[1], out[2]) * 2.0f - 1.0f;
+                    normal = glm::length(normal) > 0.0f ? glm::normalize(normal) : glm::vec3(0.0f, 0.0f, 1.0f);
+                    out[0] = normal.x * 0.5f + 0.5f;
+                    out[1] = normal.y * 0.5f + 0.5f;
+                    out[2] = normal.z * 0.5f + 0.5f;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    uint32_t GetVkFormat(CookFormat format, bool srgb)
+    {
+        switch(format)
+        {
+            case CookFormat::BC1:
+                return srgb ? KTX2::FORMAT_BC1_RGB_SRGB : KTX2::FORMAT_BC1_RGB_UNORM;
+            case CookFormat::BC3:
+                return srgb ? KTX2::FORMAT_BC3_SRGB : KTX2::FORMAT_BC3_UNORM;
+            case CookFormat::BC4:
+                return KTX2::FORMAT_BC4_UNORM;
+            case CookFormat::BC5:
+                return KTX2::FORMAT_BC5_UNORM;
+            case CookFormat::BC6H:
+                return KTX2::FORMAT_BC6H_UFLOAT;
+            default:
+                return srgb ? KTX2::FORMAT_BC7_SRGB : KTX2::FORMAT_BC7_UNORM;
+        }
+    }
+
+    ArrayList<uint8_t> EncodeLevel(const Image& image, CookFormat format, bool srgb, uint32_t blockSize)
+    {
+        const uint32_t blocksX = (image.width + 3) / 4;
+        const uint32_t blocksY = (image.height + 3) / 4;
+        ArrayList<uint8_t> result(blocksX * blocksY * blockSize);
+
+        for(uint32_t by = 0; by < blocksY; by++)
+        {
+            for(uint32_t bx = 0; bx < blocksX; bx++)
+            {
+                uint8_t* dest = &result[(by * blocksX + bx) * blockSize];
+
+                // Edge blocks repeat the last row and column
+                float texels[64];
+                for(uint32_t i = 0; i < 16; i++)
+                    memcpy(&texels[i * 4], image.GetPixel(bx * 4 + i % 4, by * 4 + i / 4), sizeof(float) * 4);
+
+                if(format == CookFormat::BC6H)
+                {
+                    BlockCompression::EncodeBC6H(dest, texels);
+                    continue;
+                }
+
+                uint8_t rgba[64];
+                for(uint32_t i = 0; i < 64; i++)
+                {
+                    float value = std::clamp(texels[i], 0.0f, 1.0f);
+                    if(srgb && i % 4 != 3)
+                        value = LinearToSRGB(value);
+                    rgba[i] = static_cast<uint8_t>(value * 255.0f + 0.5f);
+                }
+
+                switch(format)
+                {
+                    case CookFormat::BC1:
+                        BlockCompression::EncodeBC1(dest, rgba);
+                        break;
+                    case CookFormat::BC3:
+                        BlockCompression::EncodeBC3(dest, rgba);
+                        break;
+                    case CookFormat::BC4:
+                        BlockCompression::EncodeBC4(dest, rgba);
+                        break;
+                    case CookFormat::BC5:
+                        BlockCompression::EncodeBC5(dest, rgba);
+                        break;
+                    default:
+                        BlockCompression::EncodeBC7(dest, rgba);
+                        break;
+                }
+            }
+        }
+
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    CookOptions options;
+    if(!ParseArguments(argc, argv, options))
+    {
+        LOG("Usage: TextureCooker <input> [output.ktx2] [--format bc1|bc3|bc4|bc5|bc6h|bc7] [--linear] [--normal] [--no-mips]");
+        return 1;
+    }
+
+    const bool isHDR = stbi_is_hdr(options.input.c_str()) != 0;
+    if(!options.formatSet)
+        options.format = isHDR ? CookFormat::BC6H : options.normalMap ? CookFormat::BC5 : CookFormat::BC7;
+
+    // Only the colour formats have sRGB variants, BC4 and BC5 store the source values as they are
+    const bool colourFormat = options.format == CookFormat::BC1 || options.format == CookFormat::BC3 ||
+                              options.format == CookFormat::BC7;
+    const bool srgb = options.srgb && !options.normalMap && colourFormat;
+    const bool decodeSRGB = srgb || (options.srgb && !options.normalMap && options.format == CookFormat::BC6H);
+
+    Image image;
+    if(!LoadSource(options.input, decodeSRGB, image))
+    {
+        LOG_FORMAT("Could not load %s", options.input.c_str());
+        return 1;
+    }
+
+    const uint32_t vkFormat = GetVkFormat(options.format, srgb);
+    const uint32_t blockSize = KTX2::GetBlockSize(vkFormat);
+    const uint32_t width = image.width;
+    const uint32_t height = image.height;
+
+    ArrayList<ArrayList<uint8_t>> levels;
+    while(true)
+    {
+        levels.push_back(EncodeLevel(image, options.format, srgb, blockSize));
+
+        if(!options.mips || (image.width == 1 && image.height == 1))
+            break;
+
+        image = Downsample(image, options.normalMap);
+    }
+
+    if(!KTX2::Write(options.output, vkFormat, width, height, 1, levels))
+    {
+        LOG_FORMAT("Could not write %s", options.output.c_str());
+        return 1;
+    }
+
+    LOG_FORMAT("Cooked %s: %ux%u, %u levels", options.output.c_str(), width, height, static_cast<uint32_t>(levels.size()));
+    return 0;
+}
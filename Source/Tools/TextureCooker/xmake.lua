@@ -0,0 +1,5 @@
+target("TextureCooker")
+    set_kind("binary")
+    set_targetdir("../../..//")
+    add_deps("Core", "File")
+    add_files("/*.cpp")
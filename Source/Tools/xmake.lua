@@ -0,0 +1 @@
+includes("TextureCooker", "RendererBenchmark")
@@ -15,5 +15,5 @@ add_includedirs("/Runtime/Core/Math")
 add_includedirs("/Runtime/Platform")
 add_includedirs("/Editor")
 
-includes("Editor", "Runtime")
+includes("Editor", "Runtime", "Tools", "Tests")
 
@@ -8,6 +8,17 @@ set_toolchains("msvc")
 add_rules("mode.debug", "mode.release")
 add_includedirs("/ThirdParty", "/Embedded", "/Assets")
 
+-- Frame profiler, its scopes compile to nothing when this is off
+option("profiler")
+    set_default(true)
+    set_showmenu(true)
+    set_description("Build the frame profiler (CPU scopes, GPU timestamps, trace export)")
+option_end()
+
+if has_config("profiler") then
+    add_defines("NekoEngine_PROFILE")
+end
+
 if is_mode("debug") then
     -- 添加DEBUG编译宏
     add_defines("DEBUG")